@@ -49,6 +49,7 @@ set(
 set(
 	NORMSOURCES_CATH_REFINE_ALIGN_OPTIONS
 		cath_refine_align/options/cath_refine_align_options.cpp
+		cath_refine_align/options/refine_mode_options_block.cpp
 )
 
 set(
@@ -154,6 +155,7 @@ set(
 set(
 	NORMSOURCES_CLUSTER_MAP
 		cluster/map/aggregate_map_results.cpp
+		cluster/map/domain_overlap_index.cpp
 		cluster/map/map_clusters.cpp
 		cluster/map/map_results.cpp
 		cluster/map/overlap_frac_distn.cpp
@@ -235,6 +237,11 @@ set(
 		executables/cath_resolve_hits/cath_resolve_hits.cpp
 )
 
+set(
+	NORMSOURCES_EXECUTABLES_CATH_RESOLVE_HITS_BENCHMARK
+		executables/cath_resolve_hits_benchmark/cath_resolve_hits_benchmark.cpp
+)
+
 set(
 	NORMSOURCES_EXECUTABLES_CATH_SCORE_ALIGN
 		executables/cath_score_align/cath_score_align.cpp
@@ -264,6 +271,7 @@ set(
 		${NORMSOURCES_EXECUTABLES_CATH_MAP_CLUSTERS}
 		${NORMSOURCES_EXECUTABLES_CATH_REFINE_ALIGN}
 		${NORMSOURCES_EXECUTABLES_CATH_RESOLVE_HITS}
+		${NORMSOURCES_EXECUTABLES_CATH_RESOLVE_HITS_BENCHMARK}
 		${NORMSOURCES_EXECUTABLES_CATH_SCORE_ALIGN}
 		${NORMSOURCES_EXECUTABLES_CATH_SSAP}
 		${NORMSOURCES_EXECUTABLES_CATH_SUPERPOSE}
@@ -290,6 +298,8 @@ set(
 
 set(
 	NORMSOURCES_OPTIONS_OPTIONS_BLOCK
+		options/options_block/align_batch_options_block.cpp
+		options/options_block/batch_run_options.cpp
 		options/options_block/check_pdb_options_block.cpp
 		options/options_block/detail_help_options_block.cpp
 		options/options_block/extract_pdb_options_block.cpp
@@ -297,6 +307,7 @@ set(
 		options/options_block/misc_help_version_options_block.cpp
 		options/options_block/options_block.cpp
 		options/options_block/options_block_tester.cpp
+		options/options_block/pdb_batch_options_block.cpp
 		options/options_block/pdb_input_options_block.cpp
 		options/options_block/pdb_input_spec.cpp
 		options/options_block/string_options_block.cpp
@@ -316,6 +327,12 @@ set(
 		resolve_hits/algo/scored_arch_proxy.cpp
 )
 
+set(
+	NORMSOURCES_RESOLVE_HITS_BENCHMARK
+		resolve_hits/benchmark/resolver_benchmark.cpp
+		resolve_hits/benchmark/synthetic_hits_spec.cpp
+)
+
 set(
 	NORMSOURCES_RESOLVE_HITS_FILE_DETAIL
 		resolve_hits/file/detail/hmmer_aln.cpp
@@ -330,6 +347,7 @@ set(
 		resolve_hits/file/hits_input_format_tag.cpp
 		resolve_hits/file/parse_domain_hits_table.cpp
 		resolve_hits/file/parse_hmmer_out.cpp
+		resolve_hits/file/sort_hits_by_query.cpp
 )
 
 set(
@@ -400,6 +418,7 @@ set(
 set(
 	NORMSOURCES_RESOLVE_HITS
 		${NORMSOURCES_RESOLVE_HITS_ALGO}
+		${NORMSOURCES_RESOLVE_HITS_BENCHMARK}
 		resolve_hits/calc_hit.cpp
 		resolve_hits/calc_hit_list.cpp
 		resolve_hits/cath_hit_resolver.cpp
@@ -411,6 +430,7 @@ set(
 		resolve_hits/hit_arch.cpp
 		resolve_hits/hit_extras.cpp
 		resolve_hits/hit_score_type.cpp
+		resolve_hits/hits_summary.cpp
 		${NORMSOURCES_RESOLVE_HITS_HTML_OUTPUT}
 		${NORMSOURCES_RESOLVE_HITS_OPTIONS}
 		${NORMSOURCES_RESOLVE_HITS_READ_AND_PROCESS_HITS}
@@ -497,6 +517,7 @@ set(
 set(
 	NORMSOURCES_SRC_COMMON_COMMON_FILE
 		src_common/common/file/find_file.cpp
+		src_common/common/file/gzip_file.cpp
 		src_common/common/file/ofstream_list.cpp
 		src_common/common/file/open_fstream.cpp
 		src_common/common/file/path_or_istream.cpp
@@ -513,6 +534,7 @@ set(
 		${NORMSOURCES_SRC_COMMON_COMMON_EXCEPTION}
 		${NORMSOURCES_SRC_COMMON_COMMON_FILE}
 		src_common/common/logger.cpp
+		src_common/common/peak_memory_usage.cpp
 		src_common/common/program_exception_wrapper.cpp
 		src_common/common/test_or_exe_run_mode.cpp
 )
@@ -686,6 +708,7 @@ set(
 set(
 	NORMSOURCES_UNI_ALIGNMENT_REFINER
 		uni/alignment/refiner/alignment_refiner.cpp
+		uni/alignment/refiner/alignment_refiner_mode.cpp
 		${NORMSOURCES_UNI_ALIGNMENT_REFINER_DETAIL}
 		uni/alignment/refiner/indexed_refiner.cpp
 )
@@ -804,6 +827,17 @@ set(
 		uni/file/hmmer_scores_file/hmmer_scores_file.cpp
 )
 
+set(
+	NORMSOURCES_UNI_FILE_MMCIF
+		uni/file/mmcif/bcif_reader.cpp
+		uni/file/mmcif/detail/atom_site_field.cpp
+		uni/file/mmcif/detail/atom_site_pdb_builder.cpp
+		uni/file/mmcif/detail/bcif_column.cpp
+		uni/file/mmcif/detail/cif_tokenizer.cpp
+		uni/file/mmcif/detail/msgpack_value.cpp
+		uni/file/mmcif/mmcif_reader.cpp
+)
+
 set(
 	NORMSOURCES_UNI_FILE_NAME_SET
 		uni/file/name_set/name_set.cpp
@@ -820,11 +854,16 @@ set(
 set(
 	NORMSOURCES_UNI_FILE_PDB
 		uni/file/pdb/coarse_element_type.cpp
+		uni/file/pdb/detail/pdb_atom_line_parser.cpp
+		uni/file/pdb/detail/pdb_residues_builder.cpp
+		uni/file/pdb/detail/pdb_text_chunk.cpp
 		uni/file/pdb/dssp_skip_policy.cpp
 		uni/file/pdb/pdb.cpp
 		uni/file/pdb/pdb_atom.cpp
 		uni/file/pdb/pdb_atom_parse_status.cpp
+		uni/file/pdb/pdb_batch.cpp
 		uni/file/pdb/pdb_list.cpp
+		uni/file/pdb/pdb_read_benchmark.cpp
 		uni/file/pdb/pdb_record.cpp
 		uni/file/pdb/pdb_residue.cpp
 		uni/file/pdb/proximity_calculator.cpp
@@ -856,6 +895,7 @@ set(
 		${NORMSOURCES_UNI_FILE_DOMAIN_DEFINITION_LIST}
 		${NORMSOURCES_UNI_FILE_DSSP_WOLF}
 		${NORMSOURCES_UNI_FILE_HMMER_SCORES_FILE}
+		${NORMSOURCES_UNI_FILE_MMCIF}
 		${NORMSOURCES_UNI_FILE_NAME_SET}
 		${NORMSOURCES_UNI_FILE_OPTIONS}
 		${NORMSOURCES_UNI_FILE_PDB}
@@ -978,6 +1018,7 @@ set(
 set(
 	NORMSOURCES_UNI_SCORE_ALIGNED_PAIR_SCORE_DETAIL
 		uni/score/aligned_pair_score/detail/score_common_coord_handler.cpp
+		uni/score/aligned_pair_score/detail/score_common_coords_cache.cpp
 )
 
 set(
@@ -1033,6 +1074,7 @@ set(
 
 set(
 	NORMSOURCES_UNI_SCORE_ALIGNED_PAIR_SCORE_LIST
+		uni/score/aligned_pair_score_list/aligned_pair_score_batch.cpp
 		uni/score/aligned_pair_score_list/aligned_pair_score_list.cpp
 		uni/score/aligned_pair_score_list/aligned_pair_score_list_factory.cpp
 		uni/score/aligned_pair_score_list/aligned_pair_score_value_list.cpp
@@ -1049,6 +1091,7 @@ set(
 set(
 	NORMSOURCES_UNI_SCORE_HOMCHECK_TOOLS
 		uni/score/homcheck_tools/ssap_and_prc.cpp
+		uni/score/homcheck_tools/ssap_and_prc_files_reader.cpp
 		uni/score/homcheck_tools/ssaps_and_prcs_of_query.cpp
 		uni/score/homcheck_tools/superfamily_of_domain.cpp
 )
@@ -1107,6 +1150,7 @@ set(
 		uni/score/true_pos_false_neg/classn_rate_stat.cpp
 		uni/score/true_pos_false_neg/classn_stat.cpp
 		uni/score/true_pos_false_neg/classn_stat_pair_series.cpp
+		uni/score/true_pos_false_neg/classn_stat_pair_series_builder.cpp
 		uni/score/true_pos_false_neg/classn_stat_pair_series_list.cpp
 		${NORMSOURCES_UNI_SCORE_TRUE_POS_FALSE_NEG_CLASSN_STAT_PLOTTER}
 		uni/score/true_pos_false_neg/named_true_false_pos_neg_list.cpp
@@ -1145,6 +1189,7 @@ set(
 
 set(
 	NORMSOURCES_UNI_STRUCTURE_ACCESSIBILITY_CALC
+		uni/structure/accessibility_calc/dssp_access_cell_list.cpp
 		uni/structure/accessibility_calc/dssp_accessibility.cpp
 )
 
@@ -1208,6 +1253,7 @@ set(
 set(
 	NORMSOURCES_UNI_STRUCTURE_SEC_STRUC_CALC_DSSP
 		uni/structure/sec_struc_calc/dssp/bifur_hbond_list.cpp
+		uni/structure/sec_struc_calc/dssp/dssp_hbond_backbone_arrays.cpp
 		uni/structure/sec_struc_calc/dssp/dssp_hbond_calc.cpp
 		uni/structure/sec_struc_calc/dssp/dssp_ss_calc.cpp
 )
@@ -1243,9 +1289,11 @@ set(
 set(
 	NORMSOURCES_UNI_STRUCTURE_VIEW_CACHE_INDEX
 		${NORMSOURCES_UNI_STRUCTURE_VIEW_CACHE_INDEX_DETAIL}
+		uni/structure/view_cache/index/flat_view_cache_index.cpp
 		uni/structure/view_cache/index/quad_find_action.cpp
 		uni/structure/view_cache/index/quad_find_action_check.cpp
 		uni/structure/view_cache/index/view_cache_index.cpp
+		uni/structure/view_cache/index/view_cache_index_benchmark.cpp
 		uni/structure/view_cache/index/view_cache_index_entry.cpp
 )
 
@@ -1438,6 +1486,7 @@ set(
 set(
 	TESTSOURCES_CLUSTER_MAP
 		cluster/map/aggregate_map_results_test.cpp
+		cluster/map/domain_overlap_index_test.cpp
 		cluster/map/map_results_test.cpp
 		cluster/map/overlap_frac_distn_test.cpp
 )
@@ -1503,11 +1552,13 @@ set(
 
 set(
 	TESTSOURCES_OPTIONS_OPTIONS_BLOCK
+		options/options_block/align_batch_options_block_test.cpp
 		options/options_block/check_pdb_options_block_test.cpp
 		options/options_block/detail_help_options_block_test.cpp
 		options/options_block/extract_pdb_options_block_test.cpp
 		options/options_block/misc_help_version_options_block_test.cpp
 		options/options_block/options_block_test.cpp
+		options/options_block/pdb_batch_options_block_test.cpp
 		options/options_block/pdb_input_options_block_test.cpp
 		options/options_block/superposition_input_options_block_test.cpp
 )
@@ -1523,6 +1574,12 @@ set(
 		resolve_hits/algo/masked_bests_cache_test.cpp
 )
 
+set(
+	TESTSOURCES_RESOLVE_HITS_BENCHMARK
+		resolve_hits/benchmark/resolver_benchmark_test.cpp
+		resolve_hits/benchmark/synthetic_hits_spec_test.cpp
+)
+
 set(
 	TESTSOURCES_RESOLVE_HITS_FILE_DETAIL
 		resolve_hits/file/detail/hmmer_parser_test.cpp
@@ -1532,6 +1589,7 @@ set(
 	TESTSOURCES_RESOLVE_HITS_FILE
 		resolve_hits/file/cath_id_score_category_test.cpp
 		${TESTSOURCES_RESOLVE_HITS_FILE_DETAIL}
+		resolve_hits/file/sort_hits_by_query_test.cpp
 )
 
 set(
@@ -1594,6 +1652,7 @@ set(
 set(
 	TESTSOURCES_RESOLVE_HITS
 		${TESTSOURCES_RESOLVE_HITS_ALGO}
+		${TESTSOURCES_RESOLVE_HITS_BENCHMARK}
 		resolve_hits/calc_hit_list_test.cpp
 		resolve_hits/cath_hit_resolver_test.cpp
 		${TESTSOURCES_RESOLVE_HITS_FILE}
@@ -1602,6 +1661,7 @@ set(
 		resolve_hits/full_hit_test.cpp
 		resolve_hits/hit_extras_test.cpp
 		resolve_hits/hit_test.cpp
+		resolve_hits/hits_summary_test.cpp
 		${TESTSOURCES_RESOLVE_HITS_HTML_OUTPUT}
 		${TESTSOURCES_RESOLVE_HITS_OPTIONS}
 		${TESTSOURCES_RESOLVE_HITS_READ_AND_PROCESS_HITS}
@@ -1663,6 +1723,7 @@ set(
 		src_common/common/algorithm/constexpr_is_uniq_test.cpp
 		src_common/common/algorithm/constexpr_modulo_fns_test.cpp
 		src_common/common/algorithm/for_n_test.cpp
+		src_common/common/algorithm/parallel_sort_test.cpp
 		src_common/common/algorithm/transform_build_test.cpp
 		src_common/common/algorithm/variadic_and_test.cpp
 )
@@ -1730,6 +1791,7 @@ set(
 
 set(
 	TESTSOURCES_SRC_COMMON_COMMON_FILE
+		src_common/common/file/gzip_file_test.cpp
 		src_common/common/file/ofstream_list_test.cpp
 		src_common/common/file/open_fstream_test.cpp
 		src_common/common/file/simple_file_read_write_test.cpp
@@ -1959,6 +2021,7 @@ set(
 
 set(
 	TESTSOURCES_UNI_ALIGNMENT_REFINER
+		uni/alignment/refiner/alignment_refiner_mode_test.cpp
 		uni/alignment/refiner/alignment_refiner_test.cpp
 		${TESTSOURCES_UNI_ALIGNMENT_REFINER_DETAIL}
 		uni/alignment/refiner/indexed_refiner_test.cpp
@@ -2062,6 +2125,12 @@ set(
 		uni/file/hmmer_scores_file/hmmer_scores_file_test.cpp
 )
 
+set(
+	TESTSOURCES_UNI_FILE_MMCIF
+		uni/file/mmcif/bcif_reader_test.cpp
+		uni/file/mmcif/mmcif_reader_test.cpp
+)
+
 set(
 	TESTSOURCES_UNI_FILE_NAME_SET
 		uni/file/name_set/name_set_list_test.cpp
@@ -2077,8 +2146,10 @@ set(
 set(
 	TESTSOURCES_UNI_FILE_PDB
 		uni/file/pdb/coarse_element_type_test.cpp
+		uni/file/pdb/detail/pdb_atom_line_parser_test.cpp
 		uni/file/pdb/element_type_string_test.cpp
 		uni/file/pdb/pdb_atom_test.cpp
+		uni/file/pdb/pdb_batch_test.cpp
 		uni/file/pdb/pdb_list_test.cpp
 		uni/file/pdb/pdb_residue_test.cpp
 		uni/file/pdb/pdb_test.cpp
@@ -2106,6 +2177,7 @@ set(
 	TESTSOURCES_UNI_FILE
 		${TESTSOURCES_UNI_FILE_DSSP_WOLF}
 		${TESTSOURCES_UNI_FILE_HMMER_SCORES_FILE}
+		${TESTSOURCES_UNI_FILE_MMCIF}
 		${TESTSOURCES_UNI_FILE_NAME_SET}
 		${TESTSOURCES_UNI_FILE_OPTIONS}
 		${TESTSOURCES_UNI_FILE_PDB}
@@ -2238,6 +2310,7 @@ set(
 set(
 	TESTSOURCES_UNI_SCORE_ALIGNED_PAIR_SCORE_DETAIL
 		uni/score/aligned_pair_score/detail/score_common_coord_handler_test.cpp
+		uni/score/aligned_pair_score/detail/score_common_coords_cache_test.cpp
 )
 
 set(
@@ -2262,6 +2335,7 @@ set(
 
 set(
 	TESTSOURCES_UNI_SCORE_ALIGNED_PAIR_SCORE_LIST
+		uni/score/aligned_pair_score_list/aligned_pair_score_batch_test.cpp
 		uni/score/aligned_pair_score_list/aligned_pair_score_list_factory_test.cpp
 		uni/score/aligned_pair_score_list/aligned_pair_score_list_test.cpp
 )
@@ -2269,6 +2343,7 @@ set(
 set(
 	TESTSOURCES_UNI_SCORE_HOMCHECK_TOOLS
 		uni/score/homcheck_tools/ssap_and_prc_test.cpp
+		uni/score/homcheck_tools/ssap_and_prc_files_reader_test.cpp
 		uni/score/homcheck_tools/ssaps_and_prcs_of_query_test.cpp
 		uni/score/homcheck_tools/superfamily_of_domain_test.cpp
 )
@@ -2307,6 +2382,7 @@ set(
 set(
 	TESTSOURCES_UNI_SCORE_TRUE_POS_FALSE_NEG
 		uni/score/true_pos_false_neg/classn_rate_stat_test.cpp
+		uni/score/true_pos_false_neg/classn_stat_pair_series_builder_test.cpp
 		uni/score/true_pos_false_neg/classn_stat_pair_series_list_test.cpp
 		uni/score/true_pos_false_neg/classn_stat_pair_series_test.cpp
 		${TESTSOURCES_UNI_SCORE_TRUE_POS_FALSE_NEG_CLASSN_STAT_PLOTTER}
@@ -2344,6 +2420,7 @@ set(
 
 set(
 	TESTSOURCES_UNI_STRUCTURE_ACCESSIBILITY_CALC
+		uni/structure/accessibility_calc/dssp_access_cell_list_test.cpp
 		uni/structure/accessibility_calc/dssp_accessibility_test.cpp
 )
 
@@ -2391,6 +2468,7 @@ set(
 set(
 	TESTSOURCES_UNI_STRUCTURE_SEC_STRUC_CALC_DSSP
 		uni/structure/sec_struc_calc/dssp/bifur_hbond_list_test.cpp
+		uni/structure/sec_struc_calc/dssp/dssp_hbond_backbone_arrays_test.cpp
 		uni/structure/sec_struc_calc/dssp/dssp_hbond_calc_test.cpp
 		uni/structure/sec_struc_calc/dssp/dssp_ss_calc_test.cpp
 		${TESTSOURCES_UNI_STRUCTURE_SEC_STRUC_CALC_DSSP_TEST}
@@ -2449,8 +2527,10 @@ set(
 set(
 	TESTSOURCES_UNI_STRUCTURE_VIEW_CACHE_INDEX
 		${TESTSOURCES_UNI_STRUCTURE_VIEW_CACHE_INDEX_DETAIL}
+		uni/structure/view_cache/index/flat_view_cache_index_test.cpp
 		uni/structure/view_cache/index/view_cache_index_entry_test.cpp
 		uni/structure/view_cache/index/view_cache_index_test.cpp
+		uni/structure/view_cache/view_cache_test.cpp
 )
 
 set(
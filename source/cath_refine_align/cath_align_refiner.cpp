@@ -27,10 +27,12 @@
 #include "alignment/alignment_context.hpp"
 #include "alignment/gap/gap_penalty.hpp"
 #include "alignment/refiner/alignment_refiner.hpp"
+#include "alignment/refiner/alignment_refiner_mode.hpp"
 #include "alignment/residue_score/residue_scorer.hpp"
 #include "cath_refine_align/options/cath_refine_align_options.hpp"
 #include "chopping/region/region.hpp"
 #include "common/exception/not_implemented_exception.hpp"
+#include "common/size_t_literal.hpp"
 #include "outputter/alignment_outputter/alignment_outputter.hpp"
 #include "outputter/alignment_outputter/alignment_outputter_list.hpp"
 #include "outputter/superposition_outputter/superposition_outputter.hpp"
@@ -45,6 +47,9 @@
 #include "structure/protein/sec_struc_planar_angles.hpp"
 #include "superposition/superposition_context.hpp"
 
+#include <algorithm>
+#include <thread>
+
 using namespace cath;
 using namespace cath::align;
 using namespace cath::align::gap;
@@ -108,7 +113,8 @@ void cath_align_refiner::refine(const cath_refine_align_options &prm_cath_refine
 //
 //	return;
 
-	const alignment refined_alignment        = alignment_refiner().iterate( the_alignment, proteins, gap_penalty( 50, 0 ) );
+	const size_t    num_refine_threads       = max( 1_z, static_cast<size_t>( thread::hardware_concurrency() ) );
+	const alignment refined_alignment        = alignment_refiner{ num_refine_threads, get_refiner_mode( prm_cath_refine_align_options ) }.iterate( the_alignment, proteins, gap_penalty( 50, 0 ) );
 	const alignment scored_refined_alignment = score_alignment_copy( residue_scorer(), refined_alignment, proteins );
 
 //	const protein &protein_a = proteins[0];
@@ -160,6 +160,7 @@ void cath_refine_align_options::check_ok_to_use() const {
 cath_refine_align_options::cath_refine_align_options() {
 	super::add_string       ( "\033[1mInput\033[0m"       );
 	super::add_options_block( the_alignment_input_options_block      );
+	super::add_options_block( the_refine_mode_ob                     );
 
 	super::add_options_block( the_ids_ob                             );
 	super::add_options_block( the_pdb_input_options_block            );
@@ -187,6 +188,11 @@ const alignment_input_spec & cath_refine_align_options::get_alignment_input_spec
 	return the_alignment_input_options_block.get_alignment_input_spec();
 }
 
+/// \brief Getter for how the alignment_refiner should update its scores between iterations
+const alignment_refiner_mode & cath_refine_align_options::get_refiner_mode() const {
+	return the_refine_mode_ob.get_refiner_mode();
+}
+
 /// \brief TODOCUMENT
 alignment_outputter_list cath_refine_align_options::get_alignment_outputters() const {
 	check_ok_to_use();
@@ -233,6 +239,14 @@ align_refining cath::opts::get_align_refining(const cath_refine_align_options &p
 	return prm_cath_refine_align_options.get_alignment_input_spec().get_refining();
 }
 
+/// \brief Get how the alignment_refiner should update its scores between iterations, as implied by the specified cath_refine_align_options
+///
+/// \relates cath_refine_align_options
+alignment_refiner_mode cath::opts::get_refiner_mode(const cath_refine_align_options &prm_cath_refine_align_options ///< The cath_refine_align_options to query
+                                                   ) {
+	return prm_cath_refine_align_options.get_refiner_mode();
+}
+
 /// \brief Get the single pdbs_acquirer implied by the specified cath_refine_align_options
 ///        (or throw an invalid_argument_exception if fewer/more are implied)
 ///
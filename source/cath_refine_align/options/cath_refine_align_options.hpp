@@ -22,6 +22,7 @@
 #define _CATH_TOOLS_SOURCE_CATH_REFINE_ALIGN_OPTIONS_CATH_REFINE_ALIGN_OPTIONS_HPP
 
 #include "alignment/options_block/alignment_input_options_block.hpp"
+#include "cath_refine_align/options/refine_mode_options_block.hpp"
 #include "chopping/chopping_type_aliases.hpp"
 #include "common/type_aliases.hpp"
 #include "display/options/display_options_block.hpp"
@@ -57,6 +58,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			alignment_input_options_block      the_alignment_input_options_block{ align::align_refining::HEAVY };
 
+			/// \brief The options_block for how the alignment should be refined
+			refine_mode_options_block          the_refine_mode_ob;
+
 			/// \brief The options_block for the IDs options
 			ids_options_block                  the_ids_ob;
 
@@ -93,6 +97,7 @@ namespace cath {
 			const str_vec & get_ids() const;
 			const pdb_input_spec & get_pdb_input_spec() const;
 			const alignment_input_spec & get_alignment_input_spec() const;
+			const align::alignment_refiner_mode & get_refiner_mode() const;
 			alignment_outputter_list get_alignment_outputters() const;
 			superposition_outputter_list get_superposition_outputters(const default_supn_outputter &) const;
 
@@ -103,6 +108,7 @@ namespace cath {
 
 		std::unique_ptr<const align::alignment_acquirer> get_alignment_acquirer(const cath_refine_align_options &);
 		align::align_refining get_align_refining(const cath_refine_align_options &);
+		align::alignment_refiner_mode get_refiner_mode(const cath_refine_align_options &);
 		std::unique_ptr<const pdbs_acquirer> get_pdbs_acquirer(const cath_refine_align_options &);
 		selection_policy_acquirer get_selection_policy_acquirer(const cath_refine_align_options &);
 
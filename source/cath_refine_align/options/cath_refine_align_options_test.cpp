@@ -19,6 +19,15 @@
 /// along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <boost/test/auto_unit_test.hpp>
 
+#include "cath_refine_align/options/cath_refine_align_options.hpp"
+#include "chopping/domain/domain.hpp"
+#include "chopping/region/region.hpp"
+#include "options/executable/parse_sources.hpp"
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::opts;
+
 namespace cath {
 	namespace test {
 
@@ -38,4 +47,20 @@ BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_CHECK( true );
 }
 
+BOOST_AUTO_TEST_CASE(refines_fully_by_default) {
+	const auto the_options = make_and_parse_options<cath_refine_align_options>(
+		str_vec{ cath_refine_align_options::PROGRAM_NAME },
+		parse_sources::CMND_LINE_ONLY
+	);
+	BOOST_TEST( get_refiner_mode( the_options ) == alignment_refiner_mode::FULL );
+}
+
+BOOST_AUTO_TEST_CASE(parses_incremental_refine_mode) {
+	const auto the_options = make_and_parse_options<cath_refine_align_options>(
+		str_vec{ cath_refine_align_options::PROGRAM_NAME, "--" + refine_mode_options_block::PO_REFINE_MODE, "incremental" },
+		parse_sources::CMND_LINE_ONLY
+	);
+	BOOST_TEST( get_refiner_mode( the_options ) == alignment_refiner_mode::INCREMENTAL );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+/// \file
+/// \brief The refine_mode_options_block class definitions
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "refine_mode_options_block.hpp"
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "common/boost_addenda/program_options/layout_values_with_descs.hpp"
+#include "common/clone/make_uptr_clone.hpp"
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::common;
+using namespace cath::opts;
+
+using boost::algorithm::join;
+using boost::none;
+using boost::program_options::options_description;
+using boost::program_options::value;
+using boost::program_options::variables_map;
+using std::string;
+using std::unique_ptr;
+
+constexpr alignment_refiner_mode refine_mode_options_block::DEFAULT_REFINER_MODE;
+
+/// \brief The option name for how the alignment_refiner should update its scores between iterations
+const string refine_mode_options_block::PO_REFINE_MODE { "refine-mode" };
+
+/// \brief A standard do_clone method
+unique_ptr<options_block> refine_mode_options_block::do_clone() const {
+	return { make_uptr_clone( *this ) };
+}
+
+/// \brief Define this block's name (used as a header for the block in the usage)
+string refine_mode_options_block::do_get_block_name() const {
+	return "Refining";
+}
+
+/// \brief Add this block's options to the provided options_description
+void refine_mode_options_block::do_add_visible_options_to_description(options_description &prm_desc,           ///< The options_description to which the options are added
+                                                                      const size_t        &/*prm_line_length*/ ///< The line length to be used when outputting the description (not very clearly documented in Boost)
+                                                                      ) {
+	const string mode_varname { "<mode>" };
+
+	const auto refine_mode_notifier = [&] (const alignment_refiner_mode &x) { refiner_mode = x; };
+
+	const str_vec mode_descs = layout_values_with_descs(
+		all_alignment_refiner_modes,
+		[] (const alignment_refiner_mode &x) { return to_string( x ); },
+		&description_of_alignment_refiner_mode,
+		SUB_DESC_PAIR_SEPARATOR
+	);
+
+	prm_desc.add_options()
+		(
+			PO_REFINE_MODE.c_str(),
+			value<alignment_refiner_mode>()
+				->value_name   ( mode_varname         )
+				->notifier     ( refine_mode_notifier )
+				->default_value( DEFAULT_REFINER_MODE ),
+			( "Refine the alignment's scores in mode " + mode_varname + ", one of available values:" + SUB_DESC_SEPARATOR
+				+ join( mode_descs, SUB_DESC_SEPARATOR ) ).c_str()
+		);
+}
+
+/// \brief Generate a description of any problem that makes the specified refine_mode_options_block invalid
+///        or none otherwise
+str_opt refine_mode_options_block::do_invalid_string(const variables_map &/*prm_variables_map*/ ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
+                                                     ) const {
+	return none;
+}
+
+/// \brief Return all options names for this block
+str_vec refine_mode_options_block::do_get_all_options_names() const {
+	return {
+		refine_mode_options_block::PO_REFINE_MODE,
+	};
+}
+
+/// \brief Getter for how the alignment_refiner should update its scores between iterations
+const alignment_refiner_mode & refine_mode_options_block::get_refiner_mode() const {
+	return refiner_mode;
+}
@@ -0,0 +1,58 @@
+/// \file
+/// \brief The refine_mode_options_block class header
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_CATH_REFINE_ALIGN_OPTIONS_REFINE_MODE_OPTIONS_BLOCK_HPP
+#define _CATH_TOOLS_SOURCE_CATH_REFINE_ALIGN_OPTIONS_REFINE_MODE_OPTIONS_BLOCK_HPP
+
+#include "alignment/refiner/alignment_refiner_mode.hpp"
+#include "options/options_block/options_block.hpp"
+
+namespace cath {
+	namespace opts {
+
+		/// \brief Define an options_block for options specifying how cath-refine-align should refine the alignment
+		class refine_mode_options_block final : public options_block {
+		private:
+			using super = options_block;
+
+			/// \brief How the alignment_refiner should update its scores between iterations
+			align::alignment_refiner_mode refiner_mode = DEFAULT_REFINER_MODE;
+
+			std::unique_ptr<options_block> do_clone() const final;
+			std::string do_get_block_name() const final;
+			void do_add_visible_options_to_description(boost::program_options::options_description &,
+			                                           const size_t &) final;
+			str_opt do_invalid_string(const boost::program_options::variables_map &) const final;
+			str_vec do_get_all_options_names() const final;
+
+		public:
+			/// \brief The default value for how the alignment_refiner should update its scores between iterations
+			static constexpr align::alignment_refiner_mode DEFAULT_REFINER_MODE = align::alignment_refiner_mode::FULL;
+
+			static const std::string PO_REFINE_MODE;
+
+			const align::alignment_refiner_mode & get_refiner_mode() const;
+		};
+
+	} // namespace opts
+} // namespace cath
+
+#endif
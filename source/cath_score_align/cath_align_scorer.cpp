@@ -25,11 +25,15 @@
 #include "alignment/alignment.hpp"
 #include "cath_score_align/options/cath_score_align_options.hpp"
 #include "common/exception/not_implemented_exception.hpp"
+#include "common/file/ofstream_list.hpp"
+#include "common/logger.hpp"
 #include "file/name_set/name_set_list.hpp"
 #include "file/pdb/pdb.hpp"
 #include "file/pdb/pdb_atom.hpp"
 #include "file/pdb/pdb_residue.hpp"
 #include "file/strucs_context.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_batch.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_list.hpp"
 #include "score/aligned_pair_score_list/aligned_pair_score_list_factory.hpp"
 #include "score/aligned_pair_score_list/aligned_pair_score_value_list.hpp"
 #include "score/aligned_pair_score_list/score_value_list_outputter/score_value_list_json_outputter.hpp"
@@ -47,6 +51,38 @@ using namespace cath::opts;
 using namespace cath::score;
 using namespace std;
 
+/// \brief Score each of the alignments in the batch specified in the options, writing a line per alignment
+///        to the batch report and then exiting with a failure if any of the alignments couldn't be scored
+///
+/// A problem with one alignment doesn't stop the others being scored.
+void cath_align_scorer::score_batch(const cath_score_align_options &prm_cath_score_align_options, ///< The details of the cath-score-align batch to perform
+                                    ostream                        &prm_stdout,                  ///< The ostream to which the batch report should be written (unless a batch report file is specified)
+                                    ostream                        &prm_stderr                   ///< The ostream to which any warnings and the summary should be written
+                                    ) {
+	const align_batch_options_block          &batch_options = prm_cath_score_align_options.get_align_batch_options_block();
+	const aligned_pair_score_batch_entry_vec  entries       = read_aligned_pair_score_batch_manifest( *batch_options.get_align_list_file() );
+
+	ofstream_list the_ofstreams{ prm_stdout };
+	auto report_ostreams = the_ofstreams.open_ofstreams( { batch_options.get_batch_run_options().get_batch_report_file().value_or( the_ofstreams.get_flag() ) } );
+	const size_t num_failed = score_aligned_pair_batch(
+		entries,
+		make_default_aligned_pair_score_list(),
+		report_ostreams.front().get(),
+		prm_stderr,
+		batch_options.get_batch_run_options().get_num_threads()
+	);
+	the_ofstreams.close_all();
+
+	if ( num_failed > 0 ) {
+		logger::log_and_exit(
+			logger::return_code::GENERIC_FAILURE_RETURN_CODE,
+			"Unable to score " + std::to_string( num_failed ) + " of the batch's " + std::to_string( entries.size() ) + " alignments\n",
+			ref( prm_stderr )
+		);
+	}
+	prm_stderr << "All " << entries.size() << " alignments in the batch scored successfully\n";
+}
+
 /// \brief Perform a cath-score-align job as specified by the cath_superpose_options argument
 ///
 /// The input and output stream parameters default to cin and cout respectively but are configurable,
@@ -54,7 +90,7 @@ using namespace std;
 void cath_align_scorer::score(const cath_score_align_options &prm_cath_score_align_options, ///< The details of the cath-score-align job to perform
                               istream                         &prm_istream,                 ///< The istream from which any stdin-like input should be read
                               ostream                         &prm_stdout,                  ///< The ostream to which any stdout-like output should be written
-                              ostream                         &/*prm_stderr*/               ///< The ostream to which any stderr-like output should be written
+                              ostream                         &prm_stderr                   ///< The ostream to which any stderr-like output should be written
                               ) {
 	// If the options are invalid or specify to do_nothing, then just return
 	const auto &error_or_help_string = prm_cath_score_align_options.get_error_or_help_string();
@@ -63,6 +99,11 @@ void cath_align_scorer::score(const cath_score_align_options &prm_cath_score_ali
 		return;
 	}
 
+	if ( specifies_batch( prm_cath_score_align_options.get_align_batch_options_block() ) ) {
+		score_batch( prm_cath_score_align_options, prm_stdout, prm_stderr );
+		return;
+	}
+
 	// Grab the PDBs and their IDs
 	const strucs_context context  = get_pdbs_and_names( prm_cath_score_align_options, prm_istream, false );
 	const protein_list   proteins = build_protein_list( context );
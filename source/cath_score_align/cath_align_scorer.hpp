@@ -33,6 +33,11 @@ namespace cath {
 	///
 	/// The details of the job to be done are passed in a cath_score_align_options object.
 	class cath_align_scorer {
+	private:
+		static void score_batch(const opts::cath_score_align_options &,
+		                        std::ostream &,
+		                        std::ostream &);
+
 	public:
 		cath_align_scorer() = delete;
 		~cath_align_scorer() = delete;
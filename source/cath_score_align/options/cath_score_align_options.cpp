@@ -83,6 +83,16 @@ str_opt cath_score_align_options::do_get_error_or_help_string() const {
 	const auto num_aln_acquirers = get_num_acquirers( the_alignment_input_options_block );
 	const auto num_pdb_acquirers = get_num_acquirers( the_pdb_input_options_block       );
 
+	// A batch's alignments and structures come from its list file so check that neither is specified separately
+	if ( specifies_batch( the_align_batch_options_block ) ) {
+		if ( ( num_aln_acquirers != 0 ) || ( num_pdb_acquirers != 0 ) ) {
+			return "Cannot specify a source of alignments or PDBs with --"
+			       + align_batch_options_block::PO_ALIGN_LIST_FILE
+			       + " (which lists the structure and alignment files to score)";
+		}
+		return none;
+	}
+
 	// If there are no objects then no options were specified so just output the standard usage error string
 	if ( ( num_aln_acquirers == 0 ) && ( num_pdb_acquirers == 0 ) ) {
 		return ""s;
@@ -112,7 +122,9 @@ string cath_score_align_options::do_get_help_prefix_string() const {
 
 Please specify:
  * at most one alignment (default: --)" + alignment_input_options_block::PO_DO_THE_SSAPS + R"()
- * one method of reading proteins (number of proteins currently restricted to 2)";
+ * one method of reading proteins (number of proteins currently restricted to 2)
+
+...or specify a batch of alignments to score with --)" + align_batch_options_block::PO_ALIGN_LIST_FILE;
 }
 
 /// \brief Get a string to append to the standard help (just empty here)
@@ -138,6 +150,7 @@ void cath_score_align_options::check_ok_to_use() const {
 cath_score_align_options::cath_score_align_options() {
 	super::add_options_block( the_alignment_input_options_block );
 	super::add_options_block( the_pdb_input_options_block       );
+	super::add_options_block( the_align_batch_options_block     );
 }
 
 /// \brief Getter for the pdb_input_spec
@@ -150,6 +163,11 @@ const alignment_input_spec & cath_score_align_options::get_alignment_input_spec(
 	return the_alignment_input_options_block.get_alignment_input_spec();
 }
 
+/// \brief Getter for the options block for scoring a batch of alignments
+const align_batch_options_block & cath_score_align_options::get_align_batch_options_block() const {
+	return the_align_batch_options_block;
+}
+
 /// \brief Get the single alignment_acquirer implied by the specified cath_score_align_options
 ///        (or throw an invalid_argument_exception if fewer/more are implied)
 ///
@@ -24,6 +24,7 @@
 #include "alignment/options_block/alignment_input_options_block.hpp"
 #include "common/type_aliases.hpp"
 #include "options/executable/executable_options.hpp"
+#include "options/options_block/align_batch_options_block.hpp"
 #include "options/options_block/pdb_input_options_block.hpp"
 
 #include <iosfwd>
@@ -49,6 +50,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			pdb_input_options_block       the_pdb_input_options_block;
 
+			/// \brief The options block for scoring a batch of alignments
+			align_batch_options_block     the_align_batch_options_block;
+
 			std::string do_get_program_name() const final;
 			str_opt do_get_error_or_help_string() const final;
 
@@ -63,6 +67,7 @@ namespace cath {
 
 			const pdb_input_spec & get_pdb_input_spec() const;
 			const alignment_input_spec & get_alignment_input_spec() const;
+			const align_batch_options_block & get_align_batch_options_block() const;
 
 			static const std::string PROGRAM_NAME;
 		};
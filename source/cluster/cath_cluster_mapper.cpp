@@ -20,6 +20,7 @@
 
 #include "cath_cluster_mapper.hpp"
 
+#include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/filesystem/path.hpp>
 
 #include "cluster/clustmap_options.hpp"
@@ -39,17 +40,102 @@
 #include "common/optional/make_optional_if.hpp"
 #include "options/executable/executable_options.hpp"
 
+#include <deque>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <iterator>
+#include <sstream>
+#include <string>
 
 using namespace cath::clust::detail;
 using namespace cath::common;
 using namespace cath::opts;
 
+using boost::algorithm::any_of;
 using boost::filesystem::path;
+using std::deque;
+using std::future;
 using std::ifstream;
 using std::istream;
+using std::istreambuf_iterator;
+using std::istringstream;
 using std::ostream;
+using std::ostringstream;
+using std::string;
+
+namespace cath {
+	namespace clust {
+		namespace detail {
+
+			/// \brief The outcome of performing a single mapping_job, buffered so that it can be
+			///        generated on a worker thread and then written out in the original job order
+			struct mapping_job_outcome final {
+				/// \brief The text to write to the output(s)
+				string                output_text;
+
+				/// \brief The text to write to the error stream
+				string                stderr_text;
+
+				/// \brief The aggregate results from this job alone
+				aggregate_map_results agg_results;
+			};
+
+			/// \brief Perform the specified mapping_job and return the buffered outcome
+			///
+			/// This doesn't touch any shared state so multiple jobs can safely be performed concurrently
+			/// (a job whose cluster-membership file is specified as "-" reads its own stream over the
+			/// input that was read up front rather than sharing the input stream)
+			inline mapping_job_outcome perform_mapping_job(const mapping_job          &prm_job,          ///< The mapping_job to perform
+			                                               const string               &prm_input_text,   ///< The text of the input stream (used if the job's cluster-membership file is "-")
+			                                               const bool                 &prm_is_first_job, ///< Whether this is the first job (so the results should include a header)
+			                                               const clust_mapping_spec   &prm_mapping_spec, ///< The clustmap_mapping_spec specifying the map-clusters action to perform
+			                                               const clustmap_output_spec &prm_output_spec   ///< The clustmap_output_spec specifying the map-clusters action to perform
+			                                               ) {
+				const auto &job_new_clustmemb_file = prm_job.get_new_cluster_membership_file();
+				const auto &job_old_clustmemb_file = prm_job.get_old_cluster_membership_file();
+
+				ostringstream output_ss;
+				ostringstream stderr_ss;
+				mapping_job_outcome outcome{ string{}, string{}, aggregate_map_results{ prm_mapping_spec } };
+
+				id_of_str_bidirnl seq_ider;
+
+				istringstream   input_iss{ prm_input_text };
+				path_or_istream istream_wrapper{ input_iss };
+				auto &the_istream = istream_wrapper.set_path( job_new_clustmemb_file ).get_istream();
+				const new_cluster_data new_to_clusters = parse_new_membership( the_istream, seq_ider, ostream_ref{ stderr_ss } );
+				istream_wrapper.close();
+
+				const old_cluster_data_opt old_from_clusters = make_optional_if_fn(
+					static_cast<bool>( job_old_clustmemb_file ),
+					[&] { return parse_old_membership( *job_old_clustmemb_file, seq_ider, ostream_ref{ stderr_ss }  ); }
+				);
+
+				const auto results = map_clusters(
+					old_from_clusters,
+					new_to_clusters,
+					prm_mapping_spec,
+					make_optional_if( prm_output_spec.get_print_domain_mapping(), ostream_ref{ output_ss } )
+				);
+
+				if ( ! prm_output_spec.get_print_domain_mapping() ) {
+					output_ss << results_string( old_from_clusters, new_to_clusters, results, prm_job.get_batch_id(), prm_is_first_job );
+					// output_ss << longer_results_string( old_from_clusters, new_to_clusters, results, prm_job.get_batch_id() );
+				}
+
+				if ( old_from_clusters ) {
+					outcome.agg_results.add_map_results( results, *old_from_clusters, new_to_clusters );
+				}
+
+				outcome.output_text = output_ss.str();
+				outcome.stderr_text = stderr_ss.str();
+				return outcome;
+			}
+
+		} // namespace detail
+	} // namespace clust
+} // namespace cath
 
 /// \brief Perform map-clusters according to the specified arguments strings with the specified i/o streams
 void cath::clust::perform_map_clusters(const str_vec       &args,             ///< The arguments strings specifying the map-clusters action to perform
@@ -123,6 +209,16 @@ void cath::clust::perform_map_clusters(const clustmap_input_spec   &prm_input_sp
 	                                                     } };
 	istream_wrapper.close();
 
+	// If any job reads its cluster-membership from the input stream, read the input stream once, up front,
+	// so that the jobs (which may be performed concurrently) don't share it
+	const bool   jobs_read_input = any_of(
+		jobs,
+		[] (const mapping_job &x) { return x.get_new_cluster_membership_file() == "-"; }
+	);
+	const string input_text      = jobs_read_input
+		? string{ istreambuf_iterator<char>{ prm_istream }, istreambuf_iterator<char>{} }
+		: string{};
+
 	aggregate_map_results agg_results{ prm_mapping_spec };
 
 	ofstream_list out_list{ prm_stdout };
@@ -130,41 +226,44 @@ void cath::clust::perform_map_clusters(const clustmap_input_spec   &prm_input_sp
 		path_vec{ { prm_output_spec.get_output_to_file().value_or( out_list.get_flag() ) } }
 	);
 
-	// \TODO Come C++17 and structured bindings, use here
-	for (const size_t &job_idx : indices( jobs.size() ) ) {
-		const mapping_job &job                    = jobs[ job_idx ];
-		const auto        &job_batch_id           = job.get_batch_id();
-		const auto        &job_new_clustmemb_file = job.get_new_cluster_membership_file();
-		const auto        &job_old_clustmemb_file = job.get_old_cluster_membership_file();
-
-		id_of_str_bidirnl seq_ider;
-
-		auto &the_istream = istream_wrapper.set_path( job_new_clustmemb_file ).get_istream();
-		const new_cluster_data new_to_clusters = parse_new_membership( the_istream, seq_ider, ref( prm_stderr ) );
-		istream_wrapper.close();
-
-		const old_cluster_data_opt old_from_clusters = make_optional_if_fn(
-			static_cast<bool>( job_old_clustmemb_file ),
-			[&] { return parse_old_membership( *job_old_clustmemb_file, seq_ider, ref( prm_stderr )  ); }
-		);
-
-		const auto results = map_clusters(
-			old_from_clusters,
-			new_to_clusters,
-			prm_mapping_spec,
-			make_optional_if( prm_output_spec.get_print_domain_mapping(), the_ostreams.front() )
-		);
-
-		if ( ! prm_output_spec.get_print_domain_mapping() ) {
+	// Write out a job's outcome and merge its results into the aggregate
+	// (only ever called from this thread, in the original job order)
+	const auto write_outcome = [&] (const mapping_job_outcome &prm_outcome) {
+		prm_stderr << prm_outcome.stderr_text;
+		if ( prm_output_spec.get_print_domain_mapping() ) {
+			the_ostreams.front().get() << prm_outcome.output_text;
+		}
+		else {
 			for (auto &the_ostream : the_ostreams) {
-				the_ostream.get() << results_string( old_from_clusters, new_to_clusters, results, job_batch_id, ( job_idx == 0 ) );
-				// the_ostream.get() << longer_results_string( old_from_clusters, new_to_clusters, results, job_batch_id );
+				the_ostream.get() << prm_outcome.output_text;
 			}
 		}
+		agg_results.add_aggregate_map_results( prm_outcome.agg_results );
+	};
 
-		if ( old_from_clusters ) {
-			agg_results.add_map_results( results, *old_from_clusters, new_to_clusters );
+	// Perform the jobs, with up to num_threads in flight at once, always
+	// consuming the oldest job's outcome first so the output order is preserved
+	const size_t &num_threads = prm_input_spec.get_num_threads();
+	deque<future<mapping_job_outcome>> outcome_futures;
+	for (const size_t &job_idx : indices( jobs.size() ) ) {
+		if ( num_threads <= 1 ) {
+			write_outcome( perform_mapping_job( jobs[ job_idx ], input_text, ( job_idx == 0 ), prm_mapping_spec, prm_output_spec ) );
+			continue;
 		}
+		if ( outcome_futures.size() >= num_threads ) {
+			write_outcome( outcome_futures.front().get() );
+			outcome_futures.pop_front();
+		}
+		outcome_futures.push_back( std::async(
+			std::launch::async,
+			[&, job_idx] {
+				return perform_mapping_job( jobs[ job_idx ], input_text, ( job_idx == 0 ), prm_mapping_spec, prm_output_spec );
+			}
+		) );
+	}
+	while ( ! outcome_futures.empty() ) {
+		write_outcome( outcome_futures.front().get() );
+		outcome_futures.pop_front();
 	}
 
 	if ( prm_output_spec.get_summarise_to_file() ) {
@@ -27,6 +27,8 @@
 #include "cluster/options/options_block/clustmap_output_options_block.hpp"
 #include "cluster/test/map_clusters_fixture.hpp"
 #include "common/algorithm/copy_build.hpp"
+#include "common/file/slurp.hpp"
+#include "common/file/spew.hpp"
 #include "common/file/temp_file.hpp"
 #include "common/regex/regex_count.hpp"
 #include "common/type_aliases.hpp"
@@ -306,6 +308,27 @@ BOOST_AUTO_TEST_CASE(fails_if_map_from_file_when_using_batches) {
 }
 
 
+BOOST_AUTO_TEST_CASE(fails_if_multiple_threads_when_not_using_batches) {
+	// When calling perform_map_clusters with options: an input file and multiple threads (but no batches flag)
+	execute_perform_map_clusters( { eg_input_file().string(),
+		"--" + clustmap_input_options_block::PO_NUM_THREADS, "2" } );
+
+	// Then expect the correct error message in the output stream
+	BOOST_CHECK( regex_search( output_ss.str(), regex{ R"(Cannot specify more than one thread.*unless reading batches from input)" } ) );
+}
+
+
+BOOST_AUTO_TEST_CASE(fails_if_zero_threads) {
+	// When calling perform_map_clusters with options: a batch input file, the batches flag and zero threads
+	execute_perform_map_clusters( { eg_batch_input_file().string(),
+		"--" + clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		"--" + clustmap_input_options_block::PO_NUM_THREADS, "0" } );
+
+	// Then expect the correct error message in the output stream
+	BOOST_CHECK( regex_search( output_ss.str(), regex{ R"(number of threads.*must be at least 1)" } ) );
+}
+
+
 BOOST_AUTO_TEST_CASE(accepts_non_numeric_cluster_names_in_map_from) {
 	// When calling perform_map_clusters with options: an input file, a map-from file that includes non-numeric cluster names
 	execute_perform_map_clusters( { eg_input_file().string(),
@@ -624,6 +647,54 @@ BOOST_AUTO_TEST_CASE(handles_batch) {
 }
 
 
+BOOST_AUTO_TEST_CASE(handles_batch_with_multiple_threads) {
+	// When calling perform_map_clusters with options: an batch input file, the --read-batches-from-input flag and multiple threads
+	execute_perform_map_clusters( { eg_batch_input_file().string(),
+		"--" + clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		"--" + clustmap_input_options_block::PO_NUM_THREADS, "3" } );
+
+	// Then expect the same results, in the same order, as when processing the batches serially
+	BOOST_CHECK_STRING_MATCHES_FILE( output_ss.str(), eg_batch_result_file() );
+}
+
+
+BOOST_AUTO_TEST_CASE(handles_batch_reading_from_input_stream_with_multiple_threads) {
+	// Given a batch file in which one batch reads its cluster-membership from the input stream
+	const path batch_dir = eg_batch_input_file().parent_path();
+	spew(
+		TEMP_TEST_FILE_FILENAME,
+		"1.10.10.640 " + ( batch_dir / "1.10.10.640.later" ).string() + " " + ( batch_dir / "1.10.10.640.v4_0_0" ).string() + "\n"
+		+ "example - "                                                     + ( batch_dir / "example.v4_0_0"     ).string() + "\n"
+	);
+	input_ss.str( slurp( batch_dir / "example.later" ) );
+
+	// When calling perform_map_clusters with options: that batch file, the --read-batches-from-input flag and multiple threads
+	execute_perform_map_clusters( { TEMP_TEST_FILE_FILENAME.string(),
+		"--" + clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		"--" + clustmap_input_options_block::PO_NUM_THREADS, "2" } );
+
+	// Then expect the same results as when the batch reads its cluster-membership from the file
+	BOOST_CHECK_STRING_MATCHES_FILE( output_ss.str(), eg_batch_result_file() );
+}
+
+
+BOOST_AUTO_TEST_CASE(summary_of_batch_with_multiple_threads_matches_serial) {
+	// When calling perform_map_clusters on a batch file serially and then with multiple threads, summarising each to a file
+	execute_perform_map_clusters( { eg_batch_input_file().string(),
+		"--" + clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		"--" + clustmap_output_options_block::PO_SUMMARISE_TO_FILE, TEMP_TEST_FILE_FILENAME.string() } );
+	const string serial_summary = slurp( TEMP_TEST_FILE_FILENAME );
+
+	execute_perform_map_clusters( { eg_batch_input_file().string(),
+		"--" + clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		"--" + clustmap_input_options_block::PO_NUM_THREADS, "2",
+		"--" + clustmap_output_options_block::PO_SUMMARISE_TO_FILE, TEMP_TEST_FILE_FILENAME.string() } );
+
+	// Then expect the two summaries to be identical
+	BOOST_CHECK_EQUAL( slurp( TEMP_TEST_FILE_FILENAME ), serial_summary );
+}
+
+
 BOOST_AUTO_TEST_CASE(provides_entry_level_output) {
 	// When calling perform_map_clusters with options: an input file, a map-from file and the --print-entry-results flag
 	execute_perform_map_clusters( { eg_input_file().string(),
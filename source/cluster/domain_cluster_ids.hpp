@@ -117,7 +117,7 @@ namespace cath {
 
 			/// \brief Const-overload of standard subscript operator
 			inline const domain_cluster_id & operator[](const size_t &prm_index ///< The index of the domain_cluster_id to access
-			                                            ) {
+			                                            ) const {
 				return dom_clust_ids[ prm_index ];
 			}
 
@@ -137,6 +137,34 @@ aggregate_map_results & aggregate_map_results::add_map_results(const map_results
 	return *this;
 }
 
+/// \brief Add the results from another aggregate_map_results
+///
+/// This allows mappings to be aggregated separately (eg on separate threads) and then merged
+aggregate_map_results & aggregate_map_results::add_aggregate_map_results(const aggregate_map_results &prm_aggregate_map_results ///< The aggregate_map_results to add
+                                                                         ) {
+	if ( prm_aggregate_map_results.the_spec != the_spec ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot add aggregate_map_results that were performed under a different clust_mapping_spec to an aggregate_map_results"));
+	}
+	if ( ! prm_aggregate_map_results.added_to ) {
+		return *this;
+	}
+
+	num_old_clusters                    += prm_aggregate_map_results.num_old_clusters;
+	num_new_clusters                    += prm_aggregate_map_results.num_new_clusters;
+	num_mapped_clusters                 += prm_aggregate_map_results.num_mapped_clusters;
+	num_old_entries                     += prm_aggregate_map_results.num_old_entries;
+	num_new_entries                     += prm_aggregate_map_results.num_new_entries;
+	num_mapped_entries                  += prm_aggregate_map_results.num_mapped_entries;
+	num_with_nothing_on_parent          += prm_aggregate_map_results.num_with_nothing_on_parent;
+
+	highest_old_dom_overlap_fractions   += prm_aggregate_map_results.highest_old_dom_overlap_fractions;
+	highest_old_clust_overlap_fractions += prm_aggregate_map_results.highest_old_clust_overlap_fractions;
+
+	added_to                             = true;
+
+	return *this;
+}
+
 /// \brief Make a aggregate_map_results containing one entry, the mapping between the specified clusters with the specified results
 ///
 /// \relates aggregate_map_results
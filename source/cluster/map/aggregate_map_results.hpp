@@ -91,6 +91,8 @@ namespace cath {
 			aggregate_map_results & add_map_results(const map_results &,
 			                                        const old_cluster_data &,
 			                                        const new_cluster_data &);
+
+			aggregate_map_results & add_aggregate_map_results(const aggregate_map_results &);
 		};
 
 		aggregate_map_results make_aggregate_map_results(const map_results &,
@@ -21,9 +21,12 @@
 #include <boost/test/auto_unit_test.hpp>
 
 #include "cluster/map/aggregate_map_results.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/size_t_literal.hpp"
 #include "test/boost_addenda/boost_check_no_throw_diag.hpp"
 
 using namespace cath::clust;
+using namespace cath::common;
 
 BOOST_AUTO_TEST_SUITE(aggregate_map_results_test_suite)
 
@@ -31,4 +34,16 @@ BOOST_AUTO_TEST_CASE(default_ctor_does_not_throw) {
 	BOOST_CHECK_NO_THROW_DIAG( aggregate_map_results a{} );
 }
 
+BOOST_AUTO_TEST_CASE(adding_empty_aggregate_leaves_not_added_to) {
+	aggregate_map_results a{};
+	a.add_aggregate_map_results( aggregate_map_results{} );
+	BOOST_CHECK( ! a.get_added_to() );
+	BOOST_CHECK_EQUAL( a.get_num_old_clusters(), 0_z );
+}
+
+BOOST_AUTO_TEST_CASE(adding_aggregate_with_different_spec_throws) {
+	aggregate_map_results a{};
+	BOOST_CHECK_THROW( a.add_aggregate_map_results( aggregate_map_results{ clust_mapping_spec{ 0.7 } } ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/// \map
+/// \brief The domain_overlap_index class definitions
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "domain_overlap_index.hpp"
+
+#include <boost/range/algorithm/sort.hpp>
+
+#include "cluster/domain_cluster_ids.hpp"
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/size_t_literal.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+using namespace cath;
+using namespace cath::clust;
+using namespace cath::common;
+using namespace cath::seq;
+
+using boost::range::sort;
+using std::make_pair;
+using std::max;
+using std::pair;
+using std::tie;
+
+/// \brief Ctor from the domain_cluster_ids of one sequence
+domain_overlap_index::domain_overlap_index(const domain_cluster_ids &prm_domain_cluster_ids ///< The domain_cluster_ids to index
+                                           ) {
+	entries.reserve( prm_domain_cluster_ids.size() );
+	for (const size_t &dom_idx : indices( prm_domain_cluster_ids.size() ) ) {
+		const auto &segments = prm_domain_cluster_ids[ dom_idx ].segments;
+		if ( segments ) {
+			entries.push_back( entry{ get_start_res_index( *segments ), get_stop_res_index( *segments ), dom_idx } );
+		}
+	}
+
+	sort(
+		entries,
+		[] (const entry &x, const entry &y) {
+			return tie( x.start, x.index ) < tie( y.start, y.index );
+		}
+	);
+
+	max_stop_to.reserve( entries.size() );
+	for (const entry &the_entry : entries) {
+		max_stop_to.push_back(
+			max_stop_to.empty() ? the_entry.stop
+			                    : max( max_stop_to.back(), the_entry.stop )
+		);
+	}
+}
+
+/// \brief Find the domain in the specified domain_cluster_ids that has the best overlap (over the longer)
+///        with the specified segments, and return its index and the overlap
+///
+/// This gives identical results to scanning all the domains with fraction_overlap_over_longer() and taking the
+/// first with the highest overlap: ties are resolved to the lowest index, and if nothing overlaps at all,
+/// the result is the first domain with an overlap of 0.
+///
+/// \pre The domain_overlap_index must have been built from prm_domain_cluster_ids, which must be non-empty
+///
+/// \relates domain_overlap_index
+pair<size_t, double> cath::clust::best_overlap_over_longer(const domain_overlap_index &prm_index,              ///< The domain_overlap_index built from prm_domain_cluster_ids
+                                                           const domain_cluster_ids   &prm_domain_cluster_ids, ///< The domain_cluster_ids (from one sequence)
+                                                           const seq_seg_run          &prm_segments            ///< The segments of the query domain
+                                                           ) {
+	auto best = make_pair( 0_z, 0.0 );
+	prm_index.for_each_candidate_index(
+		prm_segments,
+		[&] (const size_t &x) {
+			const double overlap = fraction_overlap_over_longer( prm_segments, *prm_domain_cluster_ids[ x ].segments );
+			if ( overlap > best.second || ( overlap == best.second && overlap > 0.0 && x < best.first ) ) {
+				best = make_pair( x, overlap );
+			}
+		}
+	);
+	return best;
+}
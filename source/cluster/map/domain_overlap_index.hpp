@@ -0,0 +1,131 @@
+/// \map
+/// \brief The domain_overlap_index class header
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_CLUSTER_MAP_DOMAIN_OVERLAP_INDEX_HPP
+#define _CATH_TOOLS_SOURCE_CLUSTER_MAP_DOMAIN_OVERLAP_INDEX_HPP
+
+#include "seq/seq_seg_run.hpp"
+#include "seq/seq_type_aliases.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace cath { namespace clust { class domain_cluster_ids; } }
+
+namespace cath {
+	namespace clust {
+
+		/// \brief A sorted interval index over the (segmented) domains of one sequence's domain_cluster_ids
+		///        that allows the domains that might overlap a query seq_seg_run to be found quickly
+		///
+		/// Each domain is indexed by its full extent (start of first segment to stop of last segment)
+		/// so the candidates are a superset of the domains that genuinely overlap the query; callers
+		/// are expected to calculate the real overlap for each candidate.
+		///
+		/// The entries are sorted by start and stored with the running maximum of the stops, which allows a
+		/// query to binary-search for the last entry that starts before the query's stop and then scan back
+		/// only until the running-maximum stop drops below the query's start. For the usual case of
+		/// non-nested domains, that's O(log n + k) for k candidates.
+		///
+		/// Domains without segments (ie whole-sequence domains) are not indexed.
+		class domain_overlap_index final {
+		private:
+			/// \brief The extent of one indexed domain, and its index in the original domain_cluster_ids
+			struct entry final {
+				/// \brief The start residue index of the domain's first segment
+				seq::residx_t start;
+
+				/// \brief The stop residue index of the domain's last segment
+				seq::residx_t stop;
+
+				/// \brief The index of the domain within the original domain_cluster_ids
+				size_t        index;
+			};
+
+			/// \brief The entries, sorted by start (and then by index)
+			std::vector<entry> entries;
+
+			/// \brief The maximum stop in entries[ 0 ] ... entries[ i ] for each i
+			seq::residx_vec    max_stop_to;
+
+		public:
+			explicit domain_overlap_index(const domain_cluster_ids &);
+
+			bool empty() const;
+			size_t size() const;
+
+			template <typename Fn>
+			void for_each_candidate_index(const seq::seq_seg_run &,
+			                              Fn &&) const;
+		};
+
+		/// \brief Whether this domain_overlap_index is empty
+		inline bool domain_overlap_index::empty() const {
+			return entries.empty();
+		}
+
+		/// \brief The number of domains indexed in this domain_overlap_index
+		inline size_t domain_overlap_index::size() const {
+			return entries.size();
+		}
+
+		/// \brief Call the specified function with the index (within the original domain_cluster_ids)
+		///        of each domain whose extent overlaps the extent of the specified seq_seg_run
+		///
+		/// The indices are not passed in any particular order
+		template <typename Fn>
+		void domain_overlap_index::for_each_candidate_index(const seq::seq_seg_run &prm_segments, ///< The segments of the query domain
+		                                                    Fn                    &&prm_fn        ///< The function to call with the index of each candidate domain
+		                                                    ) const {
+			const seq::residx_t query_start = seq::get_start_res_index( prm_segments );
+			const seq::residx_t query_stop  = seq::get_stop_res_index ( prm_segments );
+
+			// Find the end of the entries that start at or before the query stops
+			size_t end_idx = static_cast<size_t>( std::distance(
+				entries.begin(),
+				std::upper_bound(
+					entries.begin(),
+					entries.end(),
+					query_stop,
+					[] (const seq::residx_t &x, const entry &y) { return x < y.start; }
+				)
+			) );
+
+			// Scan back through them while any might still stop at or after the query starts
+			while ( end_idx > 0 && max_stop_to[ end_idx - 1 ] >= query_start ) {
+				--end_idx;
+				if ( entries[ end_idx ].stop >= query_start ) {
+					prm_fn( entries[ end_idx ].index );
+				}
+			}
+		}
+
+		std::pair<size_t, double> best_overlap_over_longer(const domain_overlap_index &,
+		                                                   const domain_cluster_ids &,
+		                                                   const seq::seq_seg_run &);
+
+	} // namespace clust
+} // namespace cath
+
+#endif
@@ -0,0 +1,123 @@
+/// \map
+/// \brief The domain_overlap_index test suite
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "cluster/domain_cluster_ids.hpp"
+#include "cluster/map/domain_overlap_index.hpp"
+#include "common/algorithm/sort_copy.hpp"
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/size_t_literal.hpp"
+#include "common/type_aliases.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+
+using namespace cath;
+using namespace cath::clust;
+using namespace cath::common;
+using namespace cath::seq;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The domain_overlap_index_test_suite_fixture to assist in testing domain_overlap_index
+		class domain_overlap_index_test_suite_fixture {
+		protected:
+			~domain_overlap_index_test_suite_fixture() noexcept = default;
+
+			/// \brief Make an example domain_cluster_ids with: a nested domain, a discontiguous domain and a whole-sequence domain
+			static domain_cluster_ids make_example_domain_cluster_ids() {
+				domain_cluster_ids result;
+				result.emplace_back( make_seq_seg_run_from_res_indices( 100, 199           ), 0 ); // 0
+				result.emplace_back( make_seq_seg_run_from_res_indices(  10,  49, 300, 349 ), 1 ); // 1
+				result.emplace_back( make_seq_seg_run_from_res_indices( 120, 139           ), 2 ); // 2
+				result.emplace_back( make_seq_seg_run_from_res_indices( 400, 499           ), 3 ); // 3
+				result.emplace_back( boost::none,                                             4 ); // 4
+				return result;
+			}
+
+			/// \brief Get the sorted candidate indices from the specified domain_overlap_index for the specified segments
+			static size_vec sorted_candidates(const domain_overlap_index &prm_index,   ///< The domain_overlap_index to query
+			                                  const seq_seg_run          &prm_segments ///< The query segments
+			                                  ) {
+				size_vec result;
+				prm_index.for_each_candidate_index( prm_segments, [&] (const size_t &x) { result.push_back( x ); } );
+				return sort_copy( result );
+			}
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(domain_overlap_index_test_suite, cath::test::domain_overlap_index_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(does_not_index_whole_sequence_domains) {
+	BOOST_CHECK_EQUAL( domain_overlap_index{ make_example_domain_cluster_ids() }.size(), 4_z );
+	BOOST_CHECK      ( domain_overlap_index{ domain_cluster_ids{}              }.empty()  );
+}
+
+BOOST_AUTO_TEST_CASE(finds_candidates_by_extent) {
+	const auto                 doms  = make_example_domain_cluster_ids();
+	const domain_overlap_index index{ doms };
+
+	BOOST_CHECK_EQUAL_RANGES( sorted_candidates( index, make_seq_seg_run_from_res_indices(   0,   9 ) ), size_vec{            } );
+	BOOST_CHECK_EQUAL_RANGES( sorted_candidates( index, make_seq_seg_run_from_res_indices( 130, 135 ) ), size_vec{ 0, 1, 2    } );
+	BOOST_CHECK_EQUAL_RANGES( sorted_candidates( index, make_seq_seg_run_from_res_indices( 349, 400 ) ), size_vec{ 1, 3       } );
+	BOOST_CHECK_EQUAL_RANGES( sorted_candidates( index, make_seq_seg_run_from_res_indices( 500, 600 ) ), size_vec{            } );
+	BOOST_CHECK_EQUAL_RANGES( sorted_candidates( index, make_seq_seg_run_from_res_indices(   0, 999 ) ), size_vec{ 0, 1, 2, 3 } );
+}
+
+BOOST_AUTO_TEST_CASE(best_overlap_matches_exhaustive_scan) {
+	domain_cluster_ids doms;
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 100, 199 ), 0 );
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 150, 249 ), 1 );
+	doms.emplace_back( make_seq_seg_run_from_res_indices(  50,  99 ), 2 );
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 300, 399 ), 3 );
+	const domain_overlap_index index{ doms };
+
+	for (const residx_t &start : { 0u, 60u, 100u, 125u, 150u, 175u, 260u, 380u, 450u } ) {
+		const auto query = make_seq_seg_run_from_res_indices( start, start + 49 );
+
+		auto expected = std::make_pair( 0_z, 0.0 );
+		for (const size_t &dom_idx : indices( doms.size() ) ) {
+			const double overlap = fraction_overlap_over_longer( query, *doms[ dom_idx ].segments );
+			if ( overlap > expected.second ) {
+				expected = std::make_pair( dom_idx, overlap );
+			}
+		}
+
+		const auto got = best_overlap_over_longer( index, doms, query );
+		BOOST_CHECK_EQUAL( got.first,  expected.first  );
+		BOOST_CHECK_EQUAL( got.second, expected.second );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(best_overlap_resolves_ties_to_lowest_index) {
+	domain_cluster_ids doms;
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 300, 399 ), 0 );
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 200, 299 ), 1 );
+	doms.emplace_back( make_seq_seg_run_from_res_indices( 100, 199 ), 2 );
+	const domain_overlap_index index{ doms };
+
+	BOOST_CHECK_EQUAL( best_overlap_over_longer( index, doms, make_seq_seg_run_from_res_indices( 150, 249 ) ).first, 1_z );
+	BOOST_CHECK_EQUAL( best_overlap_over_longer( index, doms, make_seq_seg_run_from_res_indices( 500, 599 ) ).first, 0_z );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -23,8 +23,10 @@
 #include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
+#include <boost/range/algorithm/sort.hpp>
 #include <boost/range/algorithm/stable_partition.hpp>
 
+#include "cluster/map/domain_overlap_index.hpp"
 #include "cluster/map/map_results.hpp"
 #include "cluster/new_cluster_data.hpp"
 #include "cluster/old_cluster_data.hpp"
@@ -32,8 +34,11 @@
 #include "common/algorithm/copy_build.hpp"
 #include "common/algorithm/sort_uniq_build.hpp"
 #include "common/boost_addenda/range/indices.hpp"
+#include "common/cpp14/cbegin_cend.hpp"
 #include "common/type_aliases.hpp"
 
+#include <unordered_map>
+
 using namespace cath;
 using namespace cath::clust::detail;
 using namespace cath::clust;
@@ -43,10 +48,11 @@ using namespace cath::seq;
 using boost::adaptors::filtered;
 using boost::algorithm::any_of;
 using boost::none;
+using boost::range::sort;
 using boost::range::stable_partition;
-using std::less;
 using std::max;
 using std::string;
+using std::unordered_map;
 
 /// \brief Map old clusters to new clusters
 ///
@@ -82,17 +88,26 @@ map_results cath::clust::map_clusters(const old_cluster_data_opt &prm_old_cluste
 		num_mapped_by_new_cluster.resize( num_new_clusters, 0 );
 		num_mapped_by_old_cluster.resize( num_old_clusters, 0 );
 
+		// A store of the number of equivalents to the current old cluster for each of the new clusters
+		// and a list of the new clusters with non-zero entries so that these can be visited (and reset)
+		// without scanning all the new clusters for each of the old clusters
+		size_vec new_clust_equivs( num_new_clusters, 0 );
+		size_vec touched_new_clusters;
+
+		// Lazily-built overlap indices of the new domains on each sequence (which may be reused across old clusters)
+		unordered_map<cluster_id_t, domain_overlap_index> new_overlap_index_of_seq_id;
+
 		// For each old cluster
 		for (const size_t &old_cluster_idx : indices( num_old_clusters ) ) {
 			const cluster_domains &old_cluster = ( *prm_old_clusters ) [ old_cluster_idx ];
 
-			// Initialise a store of the number of equivalents to this old cluster for each of the new clusters
-			size_vec new_clust_equivs( num_new_clusters, 0 );
-
 			// Prepare a function for recording a new domain mapping
 			const auto record_mapping_fn = [&] (const size_t &x) {
 				++( num_mapped_by_old_cluster[ old_cluster_idx ] );
 				++( num_mapped_by_new_cluster[ x               ] );
+				if ( new_clust_equivs[ x ] == 0 ) {
+					touched_new_clusters.push_back( x );
+				}
 				++( new_clust_equivs         [ x               ] );
 			};
 
@@ -170,31 +185,37 @@ map_results cath::clust::map_clusters(const old_cluster_data_opt &prm_old_cluste
 						}
 #endif
 
-						// Check that the new_dom_clust_ids isn't empty
-						if ( new_dom_clust_ids.empty() ) {
-							BOOST_THROW_EXCEPTION(out_of_range_exception("Empty new domain cluster IDs detected"));
-						}
+						// Get the overlap index of the new entries on this sequence, building it if this is the first time
+						// (and checking the new entries are valid, which only needs doing once per sequence)
+						auto new_overlap_index_itr = new_overlap_index_of_seq_id.find( seq_id );
+						if ( new_overlap_index_itr == common::cend( new_overlap_index_of_seq_id ) ) {
+							// Check that the new_dom_clust_ids isn't empty
+							if ( new_dom_clust_ids.empty() ) {
+								BOOST_THROW_EXCEPTION(out_of_range_exception("Empty new domain cluster IDs detected"));
+							}
 
-						// Check that all of the new_dom_clust_ids have segments
-						if ( any_of( new_dom_clust_ids, [&] (const domain_cluster_id &x) { return ! x.segments; } ) ) {
-							BOOST_THROW_EXCEPTION(invalid_argument_exception(
-								"Inconsistent whole-chain-domain on seq "
-								+ prm_old_clusters->get_id_of_seq_name().get_name_of_id( seq_id )
-							));
-						}
+							// Check that all of the new_dom_clust_ids have segments
+							if ( any_of( new_dom_clust_ids, [&] (const domain_cluster_id &x) { return ! x.segments; } ) ) {
+								BOOST_THROW_EXCEPTION(invalid_argument_exception(
+									"Inconsistent whole-chain-domain on seq "
+									+ prm_old_clusters->get_id_of_seq_name().get_name_of_id( seq_id )
+								));
+							}
 
-						// Make a closure for calculating the domain overlap with *old_segments_opt
-						const auto get_dom_ol_fn = [&] (const domain_cluster_id &x) {
-							return fraction_overlap_over_longer( *old_segments_opt, *x.segments );
-						};
+							new_overlap_index_itr = new_overlap_index_of_seq_id.emplace(
+								seq_id,
+								domain_overlap_index{ new_dom_clust_ids }
+							).first;
+						}
 
 						// Find the new entry that maps to the old domain best (and its overlap)
-						const auto &new_with_best_ol_over_longer = *max_proj_element(
+						const auto    best_idx_and_ol              = best_overlap_over_longer(
+							new_overlap_index_itr->second,
 							new_dom_clust_ids,
-							less<>{},
-							[&] (const domain_cluster_id &x) { return get_dom_ol_fn( x ); }
+							*old_segments_opt
 						);
-						const double best_ol = get_dom_ol_fn( new_with_best_ol_over_longer );
+						const auto   &new_with_best_ol_over_longer = new_dom_clust_ids[ best_idx_and_ol.first ];
+						const double &best_ol                      = best_idx_and_ol.second;
 
 						// Record the best overlap
 						highest_old_dom_overlap_fractions.add_overlap_fraction( best_ol );
@@ -227,16 +248,18 @@ map_results cath::clust::map_clusters(const old_cluster_data_opt &prm_old_cluste
 				}
 			}
 
-			// At the end of the old cluster, store any potential new maps
-			for (const size_t &new_cluster_idx : indices( num_new_clusters ) ) {
-				if ( new_clust_equivs[ new_cluster_idx ] > 0 ) {
-					potential_maps.emplace_back(
-						old_cluster_idx,
-						new_cluster_idx,
-						new_clust_equivs[ new_cluster_idx ]
-					);
-				}
+			// At the end of the old cluster, store any potential new maps (in order of new cluster)
+			// and reset new_clust_equivs ready for the next old cluster
+			sort( touched_new_clusters );
+			for (const size_t &new_cluster_idx : touched_new_clusters) {
+				potential_maps.emplace_back(
+					old_cluster_idx,
+					new_cluster_idx,
+					new_clust_equivs[ new_cluster_idx ]
+				);
+				new_clust_equivs[ new_cluster_idx ] = 0;
 			}
+			touched_new_clusters.clear();
 		}
 
 		// Calculate the highest overlap for each of the old clusters
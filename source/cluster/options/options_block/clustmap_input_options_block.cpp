@@ -44,6 +44,9 @@ const string clustmap_input_options_block::PO_MAP_FROM_CLUSTMEMB_FILE { "map-fro
 /// \brief The option name for whether to read batches from working_clustmemb_file (rather than cluster membership directly)
 const string clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT { "read-batches-from-input" };
 
+/// \brief The option name for the maximum number of batches to process concurrently (when reading batches from input)
+const string clustmap_input_options_block::PO_NUM_THREADS             { "num-threads"             };
+
 /// \brief A standard do_clone method
 unique_ptr<options_block> clustmap_input_options_block::do_clone() const {
 	return { make_uptr_clone( *this ) };
@@ -62,6 +65,7 @@ void clustmap_input_options_block::do_add_visible_options_to_description(options
 
 	const auto map_from_clustmemb_file_notifier = [&] (const path_opt &x) { the_spec.set_map_from_clustmemb_file( x ); };
 	const auto read_batches_from_input_notifier = [&] (const bool     &x) { the_spec.set_read_batches_from_input( x ); };
+	const auto num_threads_notifier             = [&] (const size_t   &x) { the_spec.set_num_threads            ( x ); };
 
 	prm_desc.add_options()
 		(
@@ -82,6 +86,15 @@ void clustmap_input_options_block::do_add_visible_options_to_description(options
 			"Read batches of work from the input file with lines of format: `batch_id working_clust_memb_file prev_clust_memb_file` where:\n"
 				" * batch_id             is a unique label for the batch (with no whitespace)\n"
 				" * prev_clust_memb_file is optional"
+		)
+		(
+			( PO_NUM_THREADS ).c_str(),
+			value<size_t>()
+				->value_name   ( "<num>"                                              )
+				->notifier     ( num_threads_notifier                                 )
+				->default_value( clustmap_input_spec::DEFAULT_NUM_THREADS             ),
+			( "Process up to <num> batches concurrently (only valid with --" + PO_READ_BATCHES_FROM_INPUT + ").\n"
+				"Outputs are still written in the order of the batches in the input" ).c_str()
 		);
 
 	static_assert( ! clustmap_input_spec::DEFAULT_READ_BATCHES_FROM_INPUT,
@@ -119,6 +132,7 @@ str_vec clustmap_input_options_block::do_get_all_options_names() const {
 		clustmap_input_options_block::PO_WORKING_CLUSTMEMB_FILE,
 		clustmap_input_options_block::PO_MAP_FROM_CLUSTMEMB_FILE,
 		clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT,
+		clustmap_input_options_block::PO_NUM_THREADS,
 	};
 }
 
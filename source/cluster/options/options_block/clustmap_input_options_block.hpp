@@ -48,6 +48,7 @@ namespace cath {
 			static const std::string PO_WORKING_CLUSTMEMB_FILE;
 			static const std::string PO_MAP_FROM_CLUSTMEMB_FILE;
 			static const std::string PO_READ_BATCHES_FROM_INPUT;
+			static const std::string PO_NUM_THREADS;
 
 			const clustmap_input_spec & get_clustmap_input_spec() const;
 		};
@@ -27,7 +27,8 @@ using namespace cath::clust;
 
 using boost::none;
 
-constexpr bool clustmap_input_spec::DEFAULT_READ_BATCHES_FROM_INPUT;
+constexpr bool   clustmap_input_spec::DEFAULT_READ_BATCHES_FROM_INPUT;
+constexpr size_t clustmap_input_spec::DEFAULT_NUM_THREADS;
 
 /// \brief Return a string explaining why the specified clustmap_input_spec is invalid or none if it isn't
 ///
@@ -42,5 +43,19 @@ str_opt cath::clust::get_invalid_description(const clustmap_input_spec &prm_clus
 			+ ")";
 	}
 
+	if ( prm_clustmap_input_spec.get_num_threads() == 0 ) {
+		return "The number of threads (--"
+			+ clustmap_input_options_block::PO_NUM_THREADS
+			+ ") must be at least 1";
+	}
+
+	if ( prm_clustmap_input_spec.get_num_threads() > 1 && ! prm_clustmap_input_spec.get_read_batches_from_input() ) {
+		return "Cannot specify more than one thread (--"
+			+ clustmap_input_options_block::PO_NUM_THREADS
+			+ ") unless reading batches from input (--"
+			+ clustmap_input_options_block::PO_READ_BATCHES_FROM_INPUT
+			+ ")";
+	}
+
 	return none;
 }
\ No newline at end of file
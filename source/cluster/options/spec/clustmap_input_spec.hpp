@@ -41,9 +41,15 @@ namespace cath {
 			/// \brief Whether to read batches from working_clustmemb_file (rather than cluster membership directly)
 			bool                    read_batches_from_input = DEFAULT_READ_BATCHES_FROM_INPUT;
 
+			/// \brief The maximum number of batches to process concurrently (when reading batches from input)
+			size_t                  num_threads             = DEFAULT_NUM_THREADS;
+
 		public:
 			/// \brief Default value for whether to read batches from working_clustmemb_file (rather than cluster membership directly)
-			static constexpr bool DEFAULT_READ_BATCHES_FROM_INPUT = false;
+			static constexpr bool   DEFAULT_READ_BATCHES_FROM_INPUT = false;
+
+			/// \brief Default value for the maximum number of batches to process concurrently (when reading batches from input)
+			static constexpr size_t DEFAULT_NUM_THREADS             = 1;
 
 			/// \brief Default ctor
 			clustmap_input_spec() = default;
@@ -51,10 +57,12 @@ namespace cath {
 			const boost::filesystem::path & get_working_clustmemb_file() const;
 			const path_opt & get_map_from_clustmemb_file() const;
 			const bool & get_read_batches_from_input() const;
+			const size_t & get_num_threads() const;
 
 			clustmap_input_spec & set_working_clustmemb_file(const boost::filesystem::path &);
 			clustmap_input_spec & set_map_from_clustmemb_file(const path_opt &);
 			clustmap_input_spec & set_read_batches_from_input(const bool &);
+			clustmap_input_spec & set_num_threads(const size_t &);
 		};
 
 		str_opt get_invalid_description(const clustmap_input_spec &);
@@ -74,6 +82,11 @@ namespace cath {
 			return read_batches_from_input;
 		}
 
+		/// \brief Getter for the maximum number of batches to process concurrently (when reading batches from input)
+		inline const size_t & clustmap_input_spec::get_num_threads() const {
+			return num_threads;
+		}
+
 		/// \brief Setter for the cluster-membership file for the working clusters
 		inline clustmap_input_spec & clustmap_input_spec::set_working_clustmemb_file(const boost::filesystem::path &prm_working_clustmemb_file ///< The cluster-membership file for the working clusters
 		                                                                             ) {
@@ -95,6 +108,13 @@ namespace cath {
 			return *this;
 		}
 
+		/// \brief Setter for the maximum number of batches to process concurrently (when reading batches from input)
+		inline clustmap_input_spec & clustmap_input_spec::set_num_threads(const size_t &prm_num_threads ///< The maximum number of batches to process concurrently (when reading batches from input)
+		                                                                  ) {
+			num_threads = prm_num_threads;
+			return *this;
+		}
+
 	} // namespace clust
 } // namespace cath
 
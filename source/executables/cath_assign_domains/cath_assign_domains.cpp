@@ -34,15 +34,19 @@
 #include "common/file/open_fstream.hpp"
 #include "common/file/simple_file_read_write.hpp"
 #include "common/program_exception_wrapper.hpp"
+#include "common/size_t_literal.hpp"
 #include "common/type_aliases.hpp"
 #include "file/prc_scores_file/prc_scores_file.hpp"
 #include "file/ssap_scores_file/ssap_scores_file.hpp"
 #include "score/homcheck_tools/first_result_if.hpp"
+#include "score/homcheck_tools/ssap_and_prc_files_reader.hpp"
 #include "score/homcheck_tools/ssaps_and_prcs_of_query.hpp"
 #include "score/homcheck_tools/superfamily_of_domain.hpp"
 #include "score/score_classification/rbf_model.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <thread>
 
 using namespace cath::common;
 using namespace cath::file;
@@ -67,12 +71,12 @@ using boost::make_optional;
 namespace cath {
 
 	/// \brief Parse a file with each line containing two, whitespace-separated entries: the SSAP and PRC files
-	vector<pair<path, path> > parse_ssap_and_prc_files_data(const path &prm_filename ///< The file to parse
-	                                                        ) {
+	path_path_pair_vec parse_ssap_and_prc_files_data(const path &prm_filename ///< The file to parse
+	                                                 ) {
 		ifstream data_data_ifstream;
 		open_ifstream( data_data_ifstream, prm_filename );
 
-		vector<pair<path, path> > data;
+		path_path_pair_vec data;
 		string line_string;
 		while ( getline( data_data_ifstream, line_string ) ) {
 			const auto line_parts = split_build<str_vec>( line_string, is_space(), token_compress_on );
@@ -258,15 +262,20 @@ namespace cath {
 			BOOST_LOG_TRIVIAL( info ) << "About to parse ssap_and_prc_files data " << data_data_file;
 			const auto ssap_and_prc_files = parse_ssap_and_prc_files_data( data_data_file );
 
+			const size_t num_threads      = max( 1_z, static_cast<size_t>( thread::hardware_concurrency() ) );
+
+			// The files are read in parallel but each pair's results are processed here in order because
+			// processing one query can affect the next (eg by adding a domain to sf_of_dom in a new superfamily)
 			str_vec new_fold_strings;
-			for (const auto &ssap_and_prc_file_pair : ssap_and_prc_files) {
-				const path &ssap_file          = ssap_and_prc_file_pair.first;
-				const path &prc_file           = ssap_and_prc_file_pair.second;
-				const auto the_ssaps           = ssap_scores_file::parse_ssap_scores_file_simple( ssap_file );
-				const auto the_prcs            = prc_scores_file::parse_prc_scores_file_fancy   ( prc_file  );
+			const auto process_ssap_and_prc_files_results = [&] (const ssap_and_prc_files_results &prm_results) {
+				const path &ssap_file          = prm_results.ssap_file;
+				const path &prc_file           = prm_results.prc_file;
+				const auto &the_ssaps          = prm_results.ssaps;
+				const auto &the_prcs           = prm_results.prcs;
 				const auto the_ssaps_and_prcs  = calculate_all_svm_scores_copy(
 					make_ssaps_and_prcs_of_query( the_ssaps, the_prcs ),
-					the_svm
+					the_svm,
+					num_threads
 				);
 
 				constexpr double svm_ssap_overlap_cutoff = 70;
@@ -401,7 +410,8 @@ namespace cath {
 						new_fold_strings.push_back( string_for_new_fold_strings( ssap_file, prc_file, the_ssaps, the_prcs, sf_of_dom ) );
 					}
 				}
-			}
+			};
+			read_ssap_and_prc_files( ssap_and_prc_files, process_ssap_and_prc_files_results, num_threads );
 
 			write_file( "new_fold_info.trac_wiki", new_fold_strings );
 		}
@@ -21,11 +21,13 @@
 #include <boost/filesystem.hpp>
 
 #include "common/exception/invalid_argument_exception.hpp"
+#include "common/file/ofstream_list.hpp"
 #include "common/file/open_fstream.hpp"
 #include "common/logger.hpp"
 #include "common/program_exception_wrapper.hpp"
 #include "file/pdb/pdb.hpp"
 #include "file/pdb/pdb_atom.hpp"
+#include "file/pdb/pdb_batch.hpp"
 #include "file/pdb/pdb_residue.hpp"
 #include "options/executable/cath_check_pdb_options/cath_check_pdb_options.hpp"
 
@@ -62,6 +64,11 @@ namespace cath {
 				return;
 			}
 
+			if ( specifies_batch( the_cath_check_pdb_options.get_pdb_batch_options_block() ) ) {
+				check_pdb_batch( the_cath_check_pdb_options );
+				return;
+			}
+
 			const path pdb_file        = the_cath_check_pdb_options.get_pdb_file();
 			const bool permit_no_atoms = the_cath_check_pdb_options.get_permit_no_atoms();
 			try {
@@ -78,6 +85,36 @@ namespace cath {
 			// If no problems were caught, output that the PDB file was parsed successfully
 			cerr << "PDB file " << pdb_file << " parsed successfully\n";
 		}
+
+		/// \brief Check each of the PDB files in the batch specified in the options, writing a line of status per file
+		///        to the batch report and then exiting with a failure if any file couldn't be checked
+		///
+		/// A problem with one file doesn't stop the others being checked.
+		static void check_pdb_batch(const cath_check_pdb_options &prm_options ///< The cath_check_pdb_options specifying the batch
+		                            ) {
+			const pdb_batch_options_block &batch_options   = prm_options.get_pdb_batch_options_block();
+			const bool                     permit_no_atoms = prm_options.get_permit_no_atoms();
+			const path_vec                 pdb_files       = pdb_batch_files( batch_options.get_pdb_list_file(), batch_options.get_pdb_dir() );
+
+			ofstream_list the_ofstreams{ cout };
+			auto report_ostreams = the_ofstreams.open_ofstreams( { batch_options.get_batch_run_options().get_batch_report_file().value_or( the_ofstreams.get_flag() ) } );
+			const size_t num_failed = process_pdb_batch(
+				pdb_files,
+				[&] (const path &x, pdb &y) { return check_pdb_batch_file( x, y, permit_no_atoms ); },
+				report_ostreams.front().get(),
+				batch_options.get_batch_run_options().get_num_threads()
+			);
+			the_ofstreams.close_all();
+
+			if ( num_failed > 0 ) {
+				logger::log_and_exit(
+					logger::return_code::MALFORMED_PDB_FILE,
+					"Unable to parse " + std::to_string( num_failed ) + " of the batch's " + std::to_string( pdb_files.size() ) + " PDB files"
+				);
+			}
+			cerr << "All " << pdb_files.size() << " PDB files in the batch parsed successfully\n";
+		}
+
 	public:
 
 		/// \brief Check that the PDB file is OK and throw an invalid_argument_exception if not
@@ -23,18 +23,27 @@
 #include "chopping/chopping_type_aliases.hpp"
 #include "chopping/region/region.hpp"
 #include "common/file/ofstream_list.hpp"
+#include "common/logger.hpp"
 #include "common/program_exception_wrapper.hpp"
+#include "common/size_t_literal.hpp"
 #include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_batch.hpp"
 #include "options/executable/cath_extract_pdb_options/cath_extract_pdb_options.hpp"
 
+#include <algorithm>
+#include <thread>
+
 using namespace cath::chop;
 using namespace cath::common;
 using namespace cath::file;
 using namespace cath::opts;
 
 using boost::filesystem::path;
+using std::cerr;
 using std::cout;
+using std::max;
 using std::string;
+using std::thread;
 
 namespace cath {
 
@@ -59,6 +68,14 @@ namespace cath {
 				return;
 			}
 
+			if ( specifies_batch( the_opts.get_pdb_batch_options_block() ) ) {
+				extract_pdb_batch( the_opts );
+				return;
+			}
+
+			// Only one file is being read so give its read all the CPUs
+			const size_t num_read_threads = max( 1_z, static_cast<size_t>( thread::hardware_concurrency() ) );
+
 			const auto out_file_opt = get_output_pdb_file( the_opts );
 			ofstream_list the_ofstreams{ std::cout };
 			const path_vec paths =
@@ -69,10 +86,42 @@ namespace cath {
 
 			write_pdb_file(
 				ostreams[ 0 ],
-				read_pdb_file( get_input_pdb_file( the_opts ) ).set_post_ter_residues( {} ),
+				read_pdb_file( get_input_pdb_file( the_opts ), num_read_threads ).set_post_ter_residues( {} ),
 				get_regions_opt( get_regions( the_opts ) )
 			);
 		}
+
+		/// \brief Extract each of the PDB files in the batch specified in the options to the output directory,
+		///        writing a line of status per file to the batch report and then exiting with a failure if any
+		///        file couldn't be extracted
+		///
+		/// A problem with one file doesn't stop the others being extracted but the whole batch is rejected
+		/// up-front if two of its files would be extracted to the same output file.
+		static void extract_pdb_batch(const cath_extract_pdb_options &prm_options ///< The cath_extract_pdb_options specifying the batch
+		                              ) {
+			const pdb_batch_options_block &batch_options = prm_options.get_pdb_batch_options_block();
+			const path                    &output_dir    = *get_output_dir( prm_options );
+			const path_vec                 pdb_files     = pdb_batch_files( batch_options.get_pdb_list_file(), batch_options.get_pdb_dir() );
+			check_extracted_pdb_batch_filenames_are_distinct( pdb_files, output_dir );
+
+			ofstream_list the_ofstreams{ cout };
+			auto report_ostreams = the_ofstreams.open_ofstreams( { batch_options.get_batch_run_options().get_batch_report_file().value_or( the_ofstreams.get_flag() ) } );
+			const size_t num_failed = process_pdb_batch(
+				pdb_files,
+				[&] (const path &x, pdb &y) { return extract_pdb_batch_file( x, y, output_dir ); },
+				report_ostreams.front().get(),
+				batch_options.get_batch_run_options().get_num_threads()
+			);
+			the_ofstreams.close_all();
+
+			if ( num_failed > 0 ) {
+				logger::log_and_exit(
+					logger::return_code::MALFORMED_PDB_FILE,
+					"Unable to extract " + std::to_string( num_failed ) + " of the batch's " + std::to_string( pdb_files.size() ) + " PDB files"
+				);
+			}
+			cerr << "All " << pdb_files.size() << " PDB files in the batch extracted successfully\n";
+		}
 	};
 } // namespace cath
 
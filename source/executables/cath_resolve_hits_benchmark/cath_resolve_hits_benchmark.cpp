@@ -0,0 +1,233 @@
+/// \file
+/// \brief The cath_resolve_hits_benchmark_program_exception_wrapper definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/program_options.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/program_exception_wrapper.hpp"
+#include "common/rapidjson_addenda/rapidjson_writer.hpp"
+#include "resolve_hits/benchmark/resolver_benchmark.hpp"
+#include "resolve_hits/benchmark/synthetic_hits_spec.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+#include "resolve_hits/options/spec/crh_score_spec.hpp"
+#include "resolve_hits/options/spec/crh_segment_spec.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::seq;
+
+using boost::program_options::bool_switch;
+using boost::program_options::command_line_parser;
+using boost::program_options::notify;
+using boost::program_options::options_description;
+using boost::program_options::store;
+using boost::program_options::value;
+using boost::program_options::variables_map;
+using std::cout;
+using std::mt19937;
+using std::string;
+
+namespace cath {
+	namespace detail {
+
+		/// \brief The number of heap allocations made so far by this program (via the replacement global operator new below)
+		std::atomic<size_t> num_heap_allocations{ 0 };
+
+	} // namespace detail
+} // namespace cath
+
+/// \brief Replacement global operator new that counts allocations so the benchmark can report them
+void * operator new(size_t prm_size ///< The number of bytes to allocate
+                    ) {
+	++cath::detail::num_heap_allocations;
+	if ( void * const ptr = std::malloc( ( prm_size == 0 ) ? 1 : prm_size ) ) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+// GCC (since 11) can't see that these replacements match the replacement operator new above
+// so it warns that free() is called on memory from operator new when they're inlined
+#if defined( __GNUC__ ) && ! defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+/// \brief Replacement global operator delete to match the replacement global operator new
+void operator delete(void *prm_ptr ///< The memory to deallocate
+                     ) noexcept {
+	std::free( prm_ptr );
+}
+
+/// \brief Replacement global sized operator delete to match the replacement global operator new
+void operator delete(void         *prm_ptr,     ///< The memory to deallocate
+                     const size_t  /*prm_size*/ ///< The size of the memory to deallocate
+                     ) noexcept {
+	std::free( prm_ptr );
+}
+
+// Stop suppressing the GCC warning again
+#if defined( __GNUC__ ) && ! defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace cath {
+
+	/// \brief A concrete program_exception_wrapper that implements do_run_program() to generate synthetic hits
+	///        and benchmark the resolve algorithms on them
+	///
+	/// This writes one line of JSON per resolve algorithm so the results can be collected by scripts
+	/// (eg to catch performance regressions or to estimate the resources required for large jobs).
+	///
+	/// Using program_exception_wrapper allows the program to be wrapped in standard last-chance exception handling.
+	class cath_resolve_hits_benchmark_program_exception_wrapper final : public program_exception_wrapper {
+		string do_get_program_name() const final {
+			return "cath-resolve-hits-benchmark";
+		}
+
+		/// \brief Parse the options, generate the hits and then benchmark the requested resolve algorithms on them
+		void do_run_program(int argc, char * argv[]) final {
+			synthetic_hits_spec the_spec;
+			size_t              seed        = 0;
+			size_t              num_repeats = 10;
+			string              resolver    = "both";
+			bool                help        = false;
+
+			options_description desc{ "Usage: cath-resolve-hits-benchmark [options]\n\nBenchmark the cath-resolve-hits algorithms on synthetic hits\n\nOptions" };
+			const auto seq_length_notifier         = [&] (const residx_t &x) { the_spec.set_seq_length        ( x ); };
+			const auto num_hits_notifier           = [&] (const size_t   &x) { the_spec.set_num_hits          ( x ); };
+			const auto mean_hit_length_notifier    = [&] (const residx_t &x) { the_spec.set_mean_hit_length   ( x ); };
+			const auto discontig_fraction_notifier = [&] (const double   &x) { the_spec.set_discontig_fraction( x ); };
+			const auto overlap_fraction_notifier   = [&] (const double   &x) { the_spec.set_overlap_fraction  ( x ); };
+
+			desc.add_options()
+				(
+					"help,h",
+					bool_switch( &help ),
+					"Output this help message"
+				)
+				(
+					"seq-length",
+					value<residx_t>()
+						->notifier     ( seq_length_notifier                             )
+						->default_value( synthetic_hits_spec::DEFAULT_SEQ_LENGTH         ),
+					"Generate hits on a query sequence of this length"
+				)
+				(
+					"num-hits",
+					value<size_t>()
+						->notifier     ( num_hits_notifier                               )
+						->default_value( synthetic_hits_spec::DEFAULT_NUM_HITS           ),
+					"Generate this many hits (which, with --seq-length, controls the density of hits)"
+				)
+				(
+					"mean-hit-length",
+					value<residx_t>()
+						->notifier     ( mean_hit_length_notifier                        )
+						->default_value( synthetic_hits_spec::DEFAULT_MEAN_HIT_LENGTH    ),
+					"Make the hits cover this many residues on average"
+				)
+				(
+					"discontig-fraction",
+					value<double>()
+						->notifier     ( discontig_fraction_notifier                     )
+						->default_value( synthetic_hits_spec::DEFAULT_DISCONTIG_FRACTION ),
+					"Make this fraction of the hits discontiguous"
+				)
+				(
+					"overlap-fraction",
+					value<double>()
+						->notifier     ( overlap_fraction_notifier                       )
+						->default_value( synthetic_hits_spec::DEFAULT_OVERLAP_FRACTION   ),
+					"Make each hit overlap this fraction of the previous one on average"
+				)
+				(
+					"seed",
+					value<size_t>( &seed )
+						->default_value( seed                                            ),
+					"Seed the random number generator with this value"
+				)
+				(
+					"repeats",
+					value<size_t>( &num_repeats )
+						->default_value( num_repeats                                     ),
+					"Resolve the hits this many times"
+				)
+				(
+					"resolver",
+					value<string>( &resolver )
+						->default_value( resolver                                        ),
+					"Benchmark this resolve algorithm: hit_resolver, naive_greedy or both"
+				);
+
+			variables_map vm;
+			store( command_line_parser( argc, argv ).options( desc ).run(), vm );
+			notify( vm );
+
+			if ( help ) {
+				cout << desc << "\n";
+				return;
+			}
+			if ( resolver != "both" && resolver != "hit_resolver" && resolver != "naive_greedy" ) {
+				BOOST_THROW_EXCEPTION(invalid_argument_exception("Unrecognised resolver \"" + resolver + "\" (must be hit_resolver, naive_greedy or both)"));
+			}
+
+			mt19937 rng{ static_cast<mt19937::result_type>( seed ) };
+			const full_hit_list hits = make_synthetic_full_hit_list( the_spec, rng );
+
+			const auto allocation_count_fn = [] { return detail::num_heap_allocations.load(); };
+			for (const bool &naive_greedy : { false, true } ) {
+				if ( resolver != "both" && ( resolver == "naive_greedy" ) != naive_greedy ) {
+					continue;
+				}
+				const resolver_benchmark_result result = benchmark_resolver(
+					hits,
+					crh_score_spec{}.set_naive_greedy( naive_greedy ),
+					crh_segment_spec{},
+					num_repeats,
+					allocation_count_fn
+				);
+
+				rapidjson_writer<json_style::COMPACT> writer;
+				writer.start_object();
+				writer.write_key_value( "seq_length",         the_spec.get_seq_length()         );
+				writer.write_key_value( "mean_hit_length",    the_spec.get_mean_hit_length()    );
+				writer.write_key_value( "discontig_fraction", the_spec.get_discontig_fraction() );
+				writer.write_key_value( "overlap_fraction",   the_spec.get_overlap_fraction()   );
+				writer.write_key_value( "seed",               static_cast<uint64_t>( seed )     );
+				writer.write_key      ( "result"                                                );
+				writer.write_raw_string( to_json_string( result )                               );
+				writer.end_object();
+				cout << writer.get_cpp_string() << "\n";
+			}
+		}
+	};
+} // namespace cath
+
+/// \brief A main function for cath_resolve_hits_benchmark that just calls run_program() on a cath_resolve_hits_benchmark_program_exception_wrapper
+int main(int argc, char * argv[] ) {
+	return cath::cath_resolve_hits_benchmark_program_exception_wrapper().run_program( argc, argv );
+}
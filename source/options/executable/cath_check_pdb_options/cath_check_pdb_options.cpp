@@ -31,6 +31,7 @@
 using namespace cath;
 using namespace cath::common;
 using namespace cath::opts;
+using namespace std::literals::string_literals;
 
 using boost::filesystem::path;
 using boost::none;
@@ -66,12 +67,30 @@ positional_options_description cath_check_pdb_options::get_positional_options()
 /// \returns Any error/help string arising from the newly specified options
 ///          or an empty string if there aren't any
 str_opt cath_check_pdb_options::do_get_error_or_help_string() const {
+	const bool is_batch = specifies_batch( the_pdb_batch_options_block );
+
+	// If there is no PDB file to check then grumble
+	//
+	// (Best done here rather than via boost::program_options::typed_value::required() because
+	//  that leads to an error message that's unclear for users that don't know about positional options
+	//  being implemented via hidden options)
+	if ( get_pdb_file().empty() && ! is_batch ) {
+		return "Must specify a PDB file to check (or a batch of files with --"
+			+ pdb_batch_options_block::PO_PDB_LIST_FILE
+			+ " or --"
+			+ pdb_batch_options_block::PO_PDB_DIR
+			+ ")."s;
+	}
+	if ( ! get_pdb_file().empty() && is_batch ) {
+		return "Cannot specify both a PDB file and a batch of files to check."s;
+	}
 	return none;
 }
 
 /// \brief Get a string to prepend to the standard help
 string cath_check_pdb_options::do_get_help_prefix_string() const {
-	return "Usage: " + PROGRAM_NAME + " pdb_file\n\n"
+	return "Usage: " + PROGRAM_NAME + " pdb_file\n"
+		+ "   or: " + PROGRAM_NAME + " --" + pdb_batch_options_block::PO_PDB_LIST_FILE + " <file> [--" + batch_run_options::PO_NUM_THREADS + " <num>]\n\n"
 		+ get_overview_string();
 }
 
@@ -90,6 +109,7 @@ string cath_check_pdb_options::do_get_overview_string() const {
 /// \brief Ctor for cath_check_pdb_options
 cath_check_pdb_options::cath_check_pdb_options() {
 	super::add_options_block( the_check_pdb_options_block );
+	super::add_options_block( the_pdb_batch_options_block );
 }
 
 /// \brief Getter for the PDB file
@@ -102,4 +122,7 @@ bool cath_check_pdb_options::get_permit_no_atoms() const {
 	return the_check_pdb_options_block.get_permit_no_atoms();
 }
 
-
+/// \brief Getter for the options for checking a batch of PDB files
+const pdb_batch_options_block & cath_check_pdb_options::get_pdb_batch_options_block() const {
+	return the_pdb_batch_options_block;
+}
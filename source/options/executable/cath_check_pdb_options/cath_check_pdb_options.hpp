@@ -25,6 +25,7 @@
 
 #include "options/executable/executable_options.hpp"
 #include "options/options_block/check_pdb_options_block.hpp"
+#include "options/options_block/pdb_batch_options_block.hpp"
 
 #include <vector>
 
@@ -39,6 +40,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			check_pdb_options_block the_check_pdb_options_block;
 
+			/// \brief The options for checking a batch of PDB files (rather than a single file)
+			pdb_batch_options_block the_pdb_batch_options_block;
+
 			std::string do_get_program_name() const final;
 			boost::program_options::positional_options_description get_positional_options() final;
 			str_opt do_get_error_or_help_string() const final;
@@ -52,6 +56,7 @@ namespace cath {
 
 			boost::filesystem::path get_pdb_file() const;
 			bool get_permit_no_atoms() const;
+			const pdb_batch_options_block & get_pdb_batch_options_block() const;
 
 			static const std::string PROGRAM_NAME;
 		};
@@ -32,6 +32,7 @@ using namespace cath;
 using namespace cath::chop;
 using namespace cath::common;
 using namespace cath::opts;
+using namespace std::literals::string_literals;
 
 using boost::filesystem::path;
 using boost::none;
@@ -67,12 +68,42 @@ positional_options_description cath_extract_pdb_options::get_positional_options(
 /// \returns Any error/help string arising from the newly specified options
 ///          or an empty string if there aren't any
 str_opt cath_extract_pdb_options::do_get_error_or_help_string() const {
+	const auto &opts_vm  = get_variables_map();
+	const bool  is_batch = specifies_batch( the_pdb_batch_options_block );
+
+	// If there is no PDB file to extract then grumble
+	//
+	// (Best done here rather than via boost::program_options::typed_value::required() because
+	//  that leads to an error message that's unclear for users that don't know about positional options
+	//  being implemented via hidden options)
+	if ( ! specifies_option( opts_vm, extract_pdb_options_block::PO_INPUT_PDB_FILE ) && ! is_batch ) {
+		return "Must specify an input PDB file to extract (or a batch of files with --"
+			+ pdb_batch_options_block::PO_PDB_LIST_FILE
+			+ " or --"
+			+ pdb_batch_options_block::PO_PDB_DIR
+			+ ")."s;
+	}
+
+	if ( is_batch ) {
+		if ( specifies_option( opts_vm, extract_pdb_options_block::PO_INPUT_PDB_FILE ) ) {
+			return "Cannot specify both an input PDB file and a batch of files to extract."s;
+		}
+		if ( ! the_extract_pdb_options_block.get_output_dir() ) {
+			return "Must specify --" + extract_pdb_options_block::PO_OUTPUT_DIR + " when extracting a batch of PDB files.";
+		}
+		if ( specifies_any_of_options( opts_vm, { extract_pdb_options_block::PO_OUTPUT_PDB_FILE, extract_pdb_options_block::PO_REGIONS } ) ) {
+			return "Cannot specify --" + extract_pdb_options_block::PO_OUTPUT_PDB_FILE
+				+ " or --" + extract_pdb_options_block::PO_REGIONS
+				+ " when extracting a batch of PDB files.";
+		}
+	}
 	return none;
 }
 
 /// \brief Get a string to prepend to the standard help
 string cath_extract_pdb_options::do_get_help_prefix_string() const {
-	return "Usage: " + PROGRAM_NAME + " pdb_file\n\n"
+	return "Usage: " + PROGRAM_NAME + " pdb_file\n"
+		+ "   or: " + PROGRAM_NAME + " --" + pdb_batch_options_block::PO_PDB_LIST_FILE + " <file> --" + extract_pdb_options_block::PO_OUTPUT_DIR + " <dir> [--" + batch_run_options::PO_NUM_THREADS + " <num>]\n\n"
 		+ get_overview_string();
 }
 
@@ -91,6 +122,7 @@ string cath_extract_pdb_options::do_get_overview_string() const {
 /// \brief Ctor for cath_extract_pdb_options
 cath_extract_pdb_options::cath_extract_pdb_options() {
 	super::add_options_block( the_extract_pdb_options_block );
+	super::add_options_block( the_pdb_batch_options_block );
 }
 
 /// \brief TODOCUMENT
@@ -98,6 +130,11 @@ const extract_pdb_options_block & cath_extract_pdb_options::get_extract_pdb_opti
 	return the_extract_pdb_options_block;
 }
 
+/// \brief Getter for the options for extracting a batch of PDB files
+const pdb_batch_options_block & cath_extract_pdb_options::get_pdb_batch_options_block() const {
+	return the_pdb_batch_options_block;
+}
+
 /// \brief TODOCUMENT
 ///
 /// \relates cath_extract_pdb_options
@@ -122,5 +159,10 @@ const domain_opt & cath::opts::get_regions(const cath_extract_pdb_options &prm_o
 	return prm_options.get_extract_pdb_options_block().get_regions();
 }
 
-
-
+/// \brief Get the directory to which each of a batch of PDB files should be extracted
+///
+/// \relates cath_extract_pdb_options
+const path_opt & cath::opts::get_output_dir(const cath_extract_pdb_options &prm_options ///< The cath_extract_pdb_options to query
+                                            ) {
+	return prm_options.get_extract_pdb_options_block().get_output_dir();
+}
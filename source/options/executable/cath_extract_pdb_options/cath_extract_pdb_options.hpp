@@ -25,6 +25,7 @@
 
 #include "options/executable/executable_options.hpp"
 #include "options/options_block/extract_pdb_options_block.hpp"
+#include "options/options_block/pdb_batch_options_block.hpp"
 
 #include <vector>
 
@@ -39,6 +40,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			extract_pdb_options_block the_extract_pdb_options_block;
 
+			/// \brief The options for extracting a batch of PDB files (rather than a single file)
+			pdb_batch_options_block the_pdb_batch_options_block;
+
 			std::string do_get_program_name() const final;
 			boost::program_options::positional_options_description get_positional_options() final;
 			str_opt do_get_error_or_help_string() const final;
@@ -51,6 +55,7 @@ namespace cath {
 			cath_extract_pdb_options();
 
 			const extract_pdb_options_block & get_extract_pdb_options_block() const;
+			const pdb_batch_options_block & get_pdb_batch_options_block() const;
 
 			static const std::string PROGRAM_NAME;
 		};
@@ -58,6 +63,7 @@ namespace cath {
 		const boost::filesystem::path & get_input_pdb_file(const cath_extract_pdb_options &);
 		const path_opt & get_output_pdb_file(const cath_extract_pdb_options &);
 		const chop::domain_opt & get_regions(const cath_extract_pdb_options &);
+		const path_opt & get_output_dir(const cath_extract_pdb_options &);
 
 	} // namespace opts
 } // namespace cath
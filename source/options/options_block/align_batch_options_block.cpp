@@ -0,0 +1,115 @@
+/// \file
+/// \brief The align_batch_options_block class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "align_batch_options_block.hpp"
+
+#include "common/clone/make_uptr_clone.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::opts;
+
+using boost::filesystem::path;
+using boost::program_options::options_description;
+using boost::program_options::value;
+using boost::program_options::variables_map;
+using std::string;
+using std::unique_ptr;
+
+/// \brief The option name for a file listing the alignments to score
+const string align_batch_options_block::PO_ALIGN_LIST_FILE { "align-list-file" };
+
+/// \brief A standard do_clone method
+///
+/// This is a concrete definition of a virtual method that's pure in options_block
+unique_ptr<options_block> align_batch_options_block::do_clone() const {
+	return { make_uptr_clone( *this ) };
+}
+
+/// \brief Define this block's name (used as a header for the block in the usage)
+///
+/// This is a concrete definition of a virtual method that's pure in options_block
+string align_batch_options_block::do_get_block_name() const {
+	return "Batch";
+}
+
+/// \brief Add this block's options to the provided options_description
+///
+/// This is a concrete definition of a virtual method that's pure in options_block
+void align_batch_options_block::do_add_visible_options_to_description(options_description &prm_desc,           ///< The options_description to which the options are added
+                                                                      const size_t        &/*prm_line_length*/ ///< The line length to be used when outputting the description (not very clearly documented in Boost)
+                                                                      ) {
+	const auto align_list_file_notifier = [&] (const path &x) { align_list_file = x; };
+
+	const string file_varname = "<file>";
+
+	prm_desc.add_options()
+		(
+			PO_ALIGN_LIST_FILE.c_str(),
+			value<path>()
+				->notifier     ( align_list_file_notifier )
+				->value_name   ( file_varname             ),
+			( "Score each of the alignments listed in " + file_varname + " (one per line of: structure file, structure file, FASTA alignment file;"
+				" blank lines and lines starting with # are ignored).\n"
+				"Each structure file is only loaded once, however many alignments use it" ).c_str()
+		);
+
+	the_batch_run_options.add_options_to_description( prm_desc, "alignments", "alignment of: files, OK/ERROR, score values, message" );
+}
+
+/// \brief Identify any conflicts that make the currently stored options invalid
+///
+/// This is a concrete definition of a virtual method that's pure in options_block
+str_opt align_batch_options_block::do_invalid_string(const variables_map &prm_variables_map ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
+                                                     ) const {
+	if ( align_list_file && ! options_block::is_acceptable_input_file( *align_list_file, true ) ) {
+		return "No such alignment list file \"" + align_list_file->string() + "\"";
+	}
+	return the_batch_run_options.invalid_string(
+		prm_variables_map,
+		specifies_batch( *this ),
+		{ PO_ALIGN_LIST_FILE }
+	);
+}
+
+/// \brief Return all options names for this block
+str_vec align_batch_options_block::do_get_all_options_names() const {
+	str_vec options_names = batch_run_options::get_all_options_names();
+	options_names.insert( options_names.begin(), align_batch_options_block::PO_ALIGN_LIST_FILE );
+	return options_names;
+}
+
+/// \brief Getter for the file listing the alignments to score
+const path_opt & align_batch_options_block::get_align_list_file() const {
+	return align_list_file;
+}
+
+/// \brief Getter for the options for how the batch is run (report file and number of threads)
+const batch_run_options & align_batch_options_block::get_batch_run_options() const {
+	return the_batch_run_options;
+}
+
+/// \brief Whether the specified align_batch_options_block specifies a batch of alignments to score
+///
+/// \relates align_batch_options_block
+bool cath::opts::specifies_batch(const align_batch_options_block &prm_options_block ///< The align_batch_options_block to query
+                                 ) {
+	return static_cast<bool>( prm_options_block.get_align_list_file() );
+}
@@ -0,0 +1,64 @@
+/// \file
+/// \brief The align_batch_options_block class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_OPTIONS_OPTIONS_BLOCK_ALIGN_BATCH_OPTIONS_BLOCK_HPP
+#define _CATH_TOOLS_SOURCE_OPTIONS_OPTIONS_BLOCK_ALIGN_BATCH_OPTIONS_BLOCK_HPP
+
+#include <boost/optional.hpp>
+
+#include "common/path_type_aliases.hpp"
+#include "options/options_block/batch_run_options.hpp"
+#include "options/options_block/options_block.hpp"
+
+namespace cath {
+	namespace opts {
+
+		/// \brief Handle the options for scoring a batch of alignments (eg in cath-score-align)
+		///        rather than a single alignment
+		class align_batch_options_block final : public options_block {
+		private:
+			using super = options_block;
+
+			/// \brief A file listing the alignments to score (one per line)
+			path_opt          align_list_file;
+
+			/// \brief The options for how the batch is run (report file and number of threads)
+			batch_run_options the_batch_run_options;
+
+			std::unique_ptr<options_block> do_clone() const final;
+			std::string do_get_block_name() const final;
+			void do_add_visible_options_to_description(boost::program_options::options_description &,
+			                                           const size_t &) final;
+			str_opt do_invalid_string(const boost::program_options::variables_map &) const final;
+			str_vec do_get_all_options_names() const final;
+
+		public:
+			const path_opt & get_align_list_file() const;
+			const batch_run_options & get_batch_run_options() const;
+
+			static const std::string PO_ALIGN_LIST_FILE;
+		};
+
+		bool specifies_batch(const align_batch_options_block &);
+
+	} // namespace opts
+} // namespace cath
+
+#endif
@@ -0,0 +1,98 @@
+/// \file
+/// \brief The align_batch_options_block test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include "options/options_block/align_batch_options_block.hpp"
+#include "options/options_block/options_block_tester.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath::opts;
+using namespace std;
+
+using boost::filesystem::path;
+using boost::program_options::variable_value;
+using boost::program_options::variables_map;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The align_batch_options_block_test_suite_fixture to assist in testing align_batch_options_block
+		struct align_batch_options_block_test_suite_fixture : protected options_block_tester,
+		                                                      protected global_test_constants {
+		protected:
+			~align_batch_options_block_test_suite_fixture() noexcept = default;
+
+			align_batch_options_block the_options_block;
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(align_batch_options_block_test_suite, cath::test::align_batch_options_block_test_suite_fixture)
+
+/// \brief Check that if no batch is requested, then that is handled correctly
+BOOST_AUTO_TEST_CASE(handles_no_batch) {
+	parse_into_options_block( the_options_block, {} );
+	BOOST_CHECK( ! specifies_batch( the_options_block ) );
+	BOOST_CHECK_EQUAL( the_options_block.get_batch_run_options().get_num_threads(), batch_run_options::DEFAULT_NUM_THREADS );
+	BOOST_CHECK( ! the_options_block.invalid_string( variables_map{} ) );
+}
+
+/// \brief Check that if an alignment list file and number of threads are requested, then they're handled correctly
+BOOST_AUTO_TEST_CASE(handles_align_list_file_and_num_threads) {
+	const path file = EXAMPLE_A_PDB_FILENAME();
+	parse_into_options_block(
+		the_options_block,
+		{ "--" + align_batch_options_block::PO_ALIGN_LIST_FILE,
+		  file.string(),
+		  "--" + batch_run_options::PO_NUM_THREADS,
+		  "8" }
+	);
+	BOOST_CHECK( specifies_batch( the_options_block ) );
+	BOOST_REQUIRE( the_options_block.get_align_list_file() );
+	BOOST_CHECK_EQUAL( *the_options_block.get_align_list_file(),                    file );
+	BOOST_CHECK_EQUAL( the_options_block.get_batch_run_options().get_num_threads(), 8    );
+	BOOST_CHECK( ! the_options_block.invalid_string( variables_map{} ) );
+}
+
+/// \brief Check that invalid combinations of options are rejected
+BOOST_AUTO_TEST_CASE(rejects_invalid_options) {
+	BOOST_CHECK( parse_into_options_block_copy(
+		the_options_block,
+		{ "--" + align_batch_options_block::PO_ALIGN_LIST_FILE, NONEXISTENT_FILE().string() }
+	).invalid_string( variables_map{} ) );
+	BOOST_CHECK( parse_into_options_block_copy(
+		the_options_block,
+		{ "--" + align_batch_options_block::PO_ALIGN_LIST_FILE, EXAMPLE_A_PDB_FILENAME().string(),
+		  "--" + batch_run_options::PO_NUM_THREADS,             "0" }
+	).invalid_string( variables_map{} ) );
+}
+
+/// \brief Check that the batch-running options are rejected without a batch
+BOOST_AUTO_TEST_CASE(rejects_batch_run_options_without_batch) {
+	variables_map vm;
+	vm.emplace( batch_run_options::PO_NUM_THREADS, variable_value{ size_t{ 2 }, false } );
+	BOOST_CHECK( the_options_block.invalid_string( vm ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
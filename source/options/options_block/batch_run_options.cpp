@@ -0,0 +1,116 @@
+/// \file
+/// \brief The batch_run_options class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "batch_run_options.hpp"
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "options/options_block/options_block.hpp"
+
+using namespace cath;
+using namespace cath::opts;
+using namespace std::literals::string_literals;
+
+using boost::algorithm::join;
+using boost::filesystem::path;
+using boost::none;
+using boost::program_options::options_description;
+using boost::program_options::value;
+using boost::program_options::variables_map;
+using std::string;
+
+/// \brief The option name for a file to which the batch's report should be written
+const string batch_run_options::PO_BATCH_REPORT_FILE { "batch-report-file" };
+
+/// \brief The option name for the maximum number of threads with which to process the batch
+const string batch_run_options::PO_NUM_THREADS       { "num-threads"       };
+
+constexpr size_t batch_run_options::DEFAULT_NUM_THREADS;
+
+/// \brief Add the batch-running options to the provided options_description
+///
+/// This is intended to be called from the do_add_visible_options_to_description() of the options_block
+/// that holds this batch_run_options
+void batch_run_options::add_options_to_description(options_description &prm_desc,             ///< The options_description to which the options are added
+                                                   const string        &prm_entries_name,     ///< The name of the batch's entries in the plural (eg "files")
+                                                   const string        &prm_report_line_desc  ///< A description of the report's line for each entry (eg "file of: file, OK/ERROR, message")
+                                                   ) {
+	const auto batch_report_file_notifier = [&] (const path &x) { batch_report_file = x; };
+
+	const string file_varname = "<file>";
+
+	prm_desc.add_options()
+		(
+			PO_BATCH_REPORT_FILE.c_str(),
+			value<path>()
+				->notifier     ( batch_report_file_notifier )
+				->value_name   ( file_varname               ),
+			( "Write the batch's report (a tab-separated line per " + prm_report_line_desc + ") to " + file_varname + " rather than stdout" ).c_str()
+		)
+		(
+			PO_NUM_THREADS.c_str(),
+			value<size_t>( &num_threads )
+				->value_name   ( "<num>"                    )
+				->default_value( DEFAULT_NUM_THREADS        ),
+			( "Process up to <num> " + prm_entries_name + " of a batch concurrently.\n"
+				"The report is still written in the order of the batch's " + prm_entries_name ).c_str()
+		);
+}
+
+/// \brief Identify any conflicts that make the currently stored options invalid
+///
+/// This is intended to be called from the do_invalid_string() of the options_block
+/// that holds this batch_run_options
+str_opt batch_run_options::invalid_string(const variables_map &prm_variables_map,    ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
+                                          const bool          &prm_specifies_batch,  ///< Whether the holding options_block specifies a batch
+                                          const str_vec       &prm_batch_opt_names   ///< The names of the holding options_block's options that specify a batch
+                                          ) const {
+	if ( batch_report_file && ! options_block::is_acceptable_output_file( *batch_report_file ) ) {
+		return "Unable to write the batch report to \"" + batch_report_file->string() + "\"";
+	}
+	if ( num_threads == 0 ) {
+		return "The number of threads must be at least 1"s;
+	}
+	if ( ! prm_specifies_batch && specifies_any_of_options( prm_variables_map, get_all_options_names() ) ) {
+		return "Cannot specify --" + PO_BATCH_REPORT_FILE + " or --" + PO_NUM_THREADS
+			+ " without a batch (--"
+			+ join( prm_batch_opt_names, " or --" )
+			+ ")";
+	}
+	return none;
+}
+
+/// \brief Getter for the file to which the report of the batch should be written (rather than stdout)
+const path_opt & batch_run_options::get_batch_report_file() const {
+	return batch_report_file;
+}
+
+/// \brief Getter for the maximum number of threads with which to process the batch
+const size_t & batch_run_options::get_num_threads() const {
+	return num_threads;
+}
+
+/// \brief Return all options names for the batch-running options
+str_vec batch_run_options::get_all_options_names() {
+	return {
+		batch_run_options::PO_BATCH_REPORT_FILE,
+		batch_run_options::PO_NUM_THREADS,
+	};
+}
@@ -0,0 +1,71 @@
+/// \file
+/// \brief The batch_run_options class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_OPTIONS_OPTIONS_BLOCK_BATCH_RUN_OPTIONS_HPP
+#define _CATH_TOOLS_SOURCE_OPTIONS_OPTIONS_BLOCK_BATCH_RUN_OPTIONS_HPP
+
+#include <boost/optional.hpp>
+#include <boost/program_options.hpp>
+
+#include "common/path_type_aliases.hpp"
+#include "common/type_aliases.hpp"
+
+#include <string>
+
+namespace cath {
+	namespace opts {
+
+		/// \brief Handle the options for how a batch is run (where its report goes and how many threads it uses)
+		///
+		/// This is shared by the options_blocks that specify a batch (eg pdb_batch_options_block and
+		/// align_batch_options_block), which each hold one of these and just add their own options
+		/// for the list of things in the batch.
+		class batch_run_options final {
+		private:
+			/// \brief A file to which the report of the batch should be written (rather than stdout)
+			path_opt batch_report_file;
+
+			/// \brief The maximum number of threads with which to process the batch
+			size_t   num_threads = DEFAULT_NUM_THREADS;
+
+		public:
+			void add_options_to_description(boost::program_options::options_description &,
+			                                const std::string &,
+			                                const std::string &);
+			str_opt invalid_string(const boost::program_options::variables_map &,
+			                       const bool &,
+			                       const str_vec &) const;
+
+			const path_opt & get_batch_report_file() const;
+			const size_t & get_num_threads() const;
+
+			static str_vec get_all_options_names();
+
+			static const std::string PO_BATCH_REPORT_FILE;
+			static const std::string PO_NUM_THREADS;
+
+			/// \brief The default value for the maximum number of threads with which to process the batch
+			static constexpr size_t DEFAULT_NUM_THREADS = 1;
+		};
+
+	} // namespace opts
+} // namespace cath
+
+#endif
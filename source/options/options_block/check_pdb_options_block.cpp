@@ -81,13 +81,10 @@ void check_pdb_options_block::do_add_hidden_options_to_description(options_descr
 /// At present, this always accepts all options
 str_opt check_pdb_options_block::do_invalid_string(const variables_map &/*prm_variables_map*/ ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
                                                    ) const {
-	// If there is no PDB file to check then grumble
-	//
-	// (Best done here rather than via boost::program_options::typed_value::required() because
-	//  that leads to an error message that's unclear for users that don't know about positional options
-	//  being implemented via hidden options)
+	// If there is no PDB file to check then leave cath_check_pdb_options to grumble
+	// (because the files may instead be specified as a batch in a pdb_batch_options_block)
 	if ( get_pdb_file().empty() ) {
-		return "Must specify a PDB file to check."s;
+		return none;
 	}
 
 	// Check the PDB file is a valid input file
@@ -43,6 +43,7 @@ using std::unique_ptr;
 const string extract_pdb_options_block::PO_INPUT_PDB_FILE  ( "input-pdb-file"  );
 const string extract_pdb_options_block::PO_OUTPUT_PDB_FILE ( "output-pdb-file" );
 const string extract_pdb_options_block::PO_REGIONS         ( "regions"         );
+const string extract_pdb_options_block::PO_OUTPUT_DIR      ( "output-dir"      );
 
 /// \brief A standard do_clone method
 ///
@@ -66,9 +67,11 @@ void extract_pdb_options_block::do_add_visible_options_to_description(options_de
                                                                       ) {
 	const auto out_pdb_notifier = [&] (const path   &x) { output_pdb_file = x; };
 	const auto regions_notifier = [&] (const domain &x) { regions         = x; };
+	const auto out_dir_notifier = [&] (const path   &x) { output_dir      = x; };
 
 	const string file_varname    = "<file>";
 	const string regions_varname = "<regions>";
+	const string dir_varname     = "<dir>";
 
 	prm_desc.add_options()
 		(
@@ -87,6 +90,14 @@ void extract_pdb_options_block::do_add_visible_options_to_description(options_de
 				+ "Format is: 251-348:B,408-416A:B"
 				// + "(Put " + regions_varname + R"( in quotes to prevent the square brackets confusing your shell ("No match")))"
 				).c_str()
+		)
+		(
+			( PO_OUTPUT_DIR ).c_str(),
+			value<path>()
+				->notifier     ( out_dir_notifier )
+				->value_name   ( dir_varname      ),
+			( "When extracting a batch of PDB files, write each to a file of the same name in " + dir_varname + "\n"
+				+ "(without any gzip extension and with any mmCIF/BinaryCIF extension replaced with .pdb)" ).c_str()
 		);
 }
 
@@ -109,17 +120,22 @@ void extract_pdb_options_block::do_add_hidden_options_to_description(options_des
 /// \brief Identify any conflicts that make the currently stored options invalid
 ///
 /// This is a concrete definition of a virtual method that's pure in options_block
-///
-/// At present, this always accepts all options
 str_opt extract_pdb_options_block::do_invalid_string(const variables_map &prm_variables_map ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
                                                      ) const {
-	// If there is no PDB file to extract then grumble
-	//
-	// (Best done here rather than via boost::program_options::typed_value::required() because
-	//  that leads to an error message that's unclear for users that don't know about positional options
-	//  being implemented via hidden options)
+	// Check that any output directory is an existing directory
+	if ( output_dir && ! options_block::is_acceptable_output_dir( *output_dir ) ) {
+		return "No such output directory \"" + output_dir->string() + "\"";
+	}
+
+	// If there is no PDB file to extract then leave cath_extract_pdb_options to grumble
+	// (because the files may instead be specified as a batch in a pdb_batch_options_block)
 	if ( ! specifies_option( prm_variables_map, PO_INPUT_PDB_FILE ) ) {
-		return "Must specify an input PDB file to extract."s;
+		return none;
+	}
+
+	// Check the output directory is only specified for a batch
+	if ( output_dir ) {
+		return "Cannot specify --" + PO_OUTPUT_DIR + " when extracting a single PDB file (use --" + PO_OUTPUT_PDB_FILE + " instead)";
 	}
 
 	// Otherwise return all OK
@@ -132,6 +148,7 @@ str_vec extract_pdb_options_block::do_get_all_options_names() const {
 		extract_pdb_options_block::PO_INPUT_PDB_FILE,
 		extract_pdb_options_block::PO_OUTPUT_PDB_FILE,
 		extract_pdb_options_block::PO_REGIONS,
+		extract_pdb_options_block::PO_OUTPUT_DIR,
 	};
 }
 
@@ -160,3 +177,7 @@ const domain_opt & extract_pdb_options_block::get_regions() const {
 	return regions;
 }
 
+/// \brief Getter for the directory to which each of a batch of PDB files should be extracted
+const path_opt & extract_pdb_options_block::get_output_dir() const {
+	return output_dir;
+}
@@ -44,6 +44,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			chop::domain_opt regions;
 
+			/// \brief The directory to which each of a batch of PDB files should be extracted
+			path_opt output_dir;
+
 			std::unique_ptr<options_block> do_clone() const final;
 			std::string do_get_block_name() const final;
 			void do_add_visible_options_to_description(boost::program_options::options_description &,
@@ -57,10 +60,12 @@ namespace cath {
 			const boost::filesystem::path & get_input_pdb_file() const;
 			const path_opt & get_output_pdb_file() const;
 			const chop::domain_opt & get_regions() const;
+			const path_opt & get_output_dir() const;
 
 			static const std::string PO_INPUT_PDB_FILE;
 			static const std::string PO_OUTPUT_PDB_FILE;
 			static const std::string PO_REGIONS;
+			static const std::string PO_OUTPUT_DIR;
 		};
 		
 	} // namespace opts
@@ -0,0 +1,130 @@
+/// \file
+/// \brief The resolver_benchmark definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "resolver_benchmark.hpp"
+
+#include "common/chrono/duration_to_seconds_string.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/peak_memory_usage.hpp"
+#include "common/rapidjson_addenda/rapidjson_writer.hpp"
+#include "resolve_hits/calc_hit_list.hpp"
+#include "resolve_hits/options/spec/crh_score_spec.hpp"
+#include "resolve_hits/options/spec/crh_segment_spec.hpp"
+#include "resolve_hits/resolve/hit_resolver.hpp"
+#include "resolve_hits/scored_hit_arch.hpp"
+
+#include <chrono>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+
+using boost::make_optional;
+using boost::none;
+using std::chrono::high_resolution_clock;
+using std::string;
+
+/// \brief Benchmark resolving the specified hits with the algorithm selected by the specified crh_score_spec
+///        (ie the naive-greedy algorithm if get_naive_greedy() is true or the standard hit_resolver otherwise)
+///
+/// The preparation of the calc_hit_list is timed separately from the resolving, which is repeated
+/// prm_num_repeats times. Since the hits are supplied directly, no parsing is involved.
+resolver_benchmark_result cath::rslv::benchmark_resolver(const full_hit_list       &prm_full_hits,           ///< The hits to resolve
+                                                         const crh_score_spec      &prm_score_spec,          ///< The score spec to apply to the hits (which also selects the algorithm)
+                                                         const crh_segment_spec    &prm_segment_spec,        ///< The segment spec to apply to the hits
+                                                         const size_t              &prm_num_repeats,         ///< The number of times to resolve the hits
+                                                         const allocation_count_fn &prm_allocation_count_fn  ///< An optional function that returns the total number of heap allocations made so far
+                                                         ) {
+	if ( prm_num_repeats == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot benchmark resolving hits zero times"));
+	}
+	const bool &naive_greedy = prm_score_spec.get_naive_greedy();
+
+	const auto          prepare_start_time = high_resolution_clock::now();
+	const calc_hit_list the_calc_hits{ prm_full_hits, prm_score_spec, prm_segment_spec };
+	const hrc_duration  prepare_durn       = high_resolution_clock::now() - prepare_start_time;
+
+	const size_opt  allocations_before = prm_allocation_count_fn ? make_optional( prm_allocation_count_fn() ) : none;
+	const auto      resolve_start_time = high_resolution_clock::now();
+	scored_hit_arch resolved;
+	for (size_t repeat_ctr = 0; repeat_ctr < prm_num_repeats; ++repeat_ctr) {
+		resolved = resolve_hits( the_calc_hits, naive_greedy );
+	}
+	const hrc_duration resolve_durn      = high_resolution_clock::now() - resolve_start_time;
+	const size_opt     allocations_after = prm_allocation_count_fn ? make_optional( prm_allocation_count_fn() ) : none;
+
+	return {
+		naive_greedy ? "naive_greedy" : "hit_resolver",
+		prm_full_hits.size(),
+		the_calc_hits.size(),
+		prm_num_repeats,
+		prepare_durn,
+		resolve_durn,
+		( allocations_before && allocations_after )
+			? make_optional( ( *allocations_after - *allocations_before ) / prm_num_repeats )
+			: none,
+		peak_resident_set_size_bytes(),
+		resolved.get_score(),
+		resolved.get_arch().size()
+	};
+}
+
+/// \brief Get the number of hits resolved per second in the specified resolver_benchmark_result
+///
+/// \relates resolver_benchmark_result
+double cath::rslv::get_hits_per_second(const resolver_benchmark_result &prm_result ///< The resolver_benchmark_result to query
+                                       ) {
+	return static_cast<double>( prm_result.num_hits * prm_result.num_repeats )
+		/ durn_to_seconds_double( prm_result.resolve_durn );
+}
+
+/// \brief Generate a compact, single-line JSON string describing the specified resolver_benchmark_result
+///
+/// Values that aren't available (eg allocations when no counting function was supplied) are written as null.
+///
+/// \relates resolver_benchmark_result
+string cath::rslv::to_json_string(const resolver_benchmark_result &prm_result ///< The resolver_benchmark_result to describe
+                                  ) {
+	const auto write_size_opt_fn = [] (rapidjson_writer<json_style::COMPACT> &prm_writer, const string &prm_key, const size_opt &prm_value) {
+		prm_writer.write_key( prm_key );
+		if ( prm_value ) {
+			prm_writer.write_value( static_cast<uint64_t>( *prm_value ) );
+		}
+		else {
+			prm_writer.write_null();
+		}
+	};
+
+	rapidjson_writer<json_style::COMPACT> writer;
+	writer.start_object();
+	writer.write_key_value( "resolver",          prm_result.resolver_name                                 );
+	writer.write_key_value( "num_input_hits",    static_cast<uint64_t>( prm_result.num_input_hits       ) );
+	writer.write_key_value( "num_hits",          static_cast<uint64_t>( prm_result.num_hits             ) );
+	writer.write_key_value( "num_repeats",       static_cast<uint64_t>( prm_result.num_repeats          ) );
+	writer.write_key_value( "prepare_seconds",   durn_to_seconds_double( prm_result.prepare_durn        ) );
+	writer.write_key_value( "resolve_seconds",   durn_to_seconds_double( prm_result.resolve_durn        ) );
+	writer.write_key_value( "hits_per_second",   get_hits_per_second   ( prm_result                     ) );
+	write_size_opt_fn     ( writer, "allocations_per_resolve", prm_result.allocations_per_resolve         );
+	write_size_opt_fn     ( writer, "peak_rss_bytes",          prm_result.peak_rss_bytes                  );
+	writer.write_key_value( "resolved_score",    static_cast<double>  ( prm_result.resolved_score       ) );
+	writer.write_key_value( "num_resolved_hits", static_cast<uint64_t>( prm_result.num_resolved_hits    ) );
+	writer.end_object();
+	return writer.get_cpp_string();
+}
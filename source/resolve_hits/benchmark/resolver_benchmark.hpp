@@ -0,0 +1,92 @@
+/// \file
+/// \brief The resolver_benchmark header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_BENCHMARK_RESOLVER_BENCHMARK_HPP
+#define _CATH_TOOLS_SOURCE_RESOLVE_HITS_BENCHMARK_RESOLVER_BENCHMARK_HPP
+
+#include <boost/optional.hpp>
+
+#include "common/chrono/chrono_type_aliases.hpp"
+#include "common/type_aliases.hpp"
+#include "resolve_hits/resolve_hits_type_aliases.hpp"
+
+#include <functional>
+#include <string>
+
+namespace cath { namespace rslv { class crh_score_spec; } }
+namespace cath { namespace rslv { class crh_segment_spec; } }
+namespace cath { namespace rslv { class full_hit_list; } }
+
+namespace cath {
+	namespace rslv {
+
+		/// \brief Type alias for a function that returns the total number of heap allocations made so far
+		///
+		/// Counting allocations requires replacing the global operator new, which can only be done in
+		/// an executable, so the executable passes in a function to read its count.
+		using allocation_count_fn = std::function<size_t()>;
+
+		/// \brief The results of benchmarking one of the resolve algorithms on a list of hits
+		struct resolver_benchmark_result final {
+			/// \brief The name of the resolve algorithm
+			std::string  resolver_name;
+
+			/// \brief The number of hits in the input
+			size_t       num_input_hits;
+
+			/// \brief The number of hits that remained to be resolved after preparation (eg removing redundant hits)
+			size_t       num_hits;
+
+			/// \brief The number of times the hits were resolved
+			size_t       num_repeats;
+
+			/// \brief The time taken to prepare the hits for resolving (eg trimming, sorting, removing redundant hits)
+			hrc_duration prepare_durn;
+
+			/// \brief The total time taken to resolve the hits (over all repeats)
+			hrc_duration resolve_durn;
+
+			/// \brief The mean number of heap allocations made per resolve (if available)
+			size_opt     allocations_per_resolve;
+
+			/// \brief The peak resident set size of the process after resolving (if available)
+			size_opt     peak_rss_bytes;
+
+			/// \brief The score of the resolved architecture
+			resscr_t     resolved_score;
+
+			/// \brief The number of hits in the resolved architecture
+			size_t       num_resolved_hits;
+		};
+
+		resolver_benchmark_result benchmark_resolver(const full_hit_list &,
+		                                             const crh_score_spec &,
+		                                             const crh_segment_spec &,
+		                                             const size_t &,
+		                                             const allocation_count_fn & = nullptr);
+
+		double get_hits_per_second(const resolver_benchmark_result &);
+
+		std::string to_json_string(const resolver_benchmark_result &);
+
+	} // namespace rslv
+} // namespace cath
+
+#endif
@@ -0,0 +1,75 @@
+/// \file
+/// \brief The resolver_benchmark test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/test/auto_unit_test.hpp>
+
+#include "resolve_hits/benchmark/resolver_benchmark.hpp"
+#include "resolve_hits/benchmark/synthetic_hits_spec.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+#include "resolve_hits/options/spec/crh_score_spec.hpp"
+#include "resolve_hits/options/spec/crh_segment_spec.hpp"
+
+#include <random>
+
+using namespace cath;
+using namespace cath::rslv;
+
+using boost::algorithm::contains;
+using std::mt19937;
+
+BOOST_AUTO_TEST_SUITE(resolver_benchmark_test_suite)
+
+BOOST_AUTO_TEST_CASE(hit_resolver_scores_at_least_as_well_as_naive_greedy) {
+	mt19937 rng{ 11 };
+	const full_hit_list hits = make_synthetic_full_hit_list( synthetic_hits_spec{}.set_num_hits( 200 ), rng );
+
+	size_t num_allocations = 0;
+	const auto alloc_count_fn = [&] { return num_allocations; };
+
+	const auto optimal = benchmark_resolver( hits, crh_score_spec{},                          crh_segment_spec{}, 2, alloc_count_fn );
+	const auto greedy  = benchmark_resolver( hits, crh_score_spec{}.set_naive_greedy( true ), crh_segment_spec{}, 2                 );
+
+	BOOST_CHECK_EQUAL( optimal.resolver_name,  "hit_resolver" );
+	BOOST_CHECK_EQUAL( greedy.resolver_name,   "naive_greedy" );
+	BOOST_CHECK_EQUAL( optimal.num_input_hits, 200            );
+	BOOST_CHECK_EQUAL( optimal.num_repeats,    2              );
+	BOOST_CHECK_GT   ( optimal.resolved_score, 0.0            );
+	BOOST_CHECK_GE   ( optimal.resolved_score, greedy.resolved_score );
+
+	BOOST_REQUIRE( optimal.allocations_per_resolve );
+	BOOST_CHECK_EQUAL( *optimal.allocations_per_resolve, 0 );
+	BOOST_CHECK( ! greedy.allocations_per_resolve );
+}
+
+BOOST_AUTO_TEST_CASE(to_json_string_writes_all_fields) {
+	mt19937 rng{ 13 };
+	const full_hit_list hits = make_synthetic_full_hit_list( synthetic_hits_spec{}.set_num_hits( 50 ), rng );
+	const auto json = to_json_string( benchmark_resolver( hits, crh_score_spec{}, crh_segment_spec{}, 1 ) );
+
+	BOOST_CHECK( contains( json, R"("resolver":"hit_resolver")"       ) );
+	BOOST_CHECK( contains( json, R"("num_input_hits":50)"             ) );
+	BOOST_CHECK( contains( json, R"("hits_per_second":)"              ) );
+	BOOST_CHECK( contains( json, R"("allocations_per_resolve":null)"  ) );
+	BOOST_CHECK( contains( json, R"("peak_rss_bytes":)"               ) );
+	BOOST_CHECK( contains( json, R"("num_resolved_hits":)"            ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,214 @@
+/// \file
+/// \brief The synthetic_hits_spec class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "synthetic_hits_spec.hpp"
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+#include "seq/seq_seg.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::seq;
+using namespace std::literals::string_literals;
+
+using boost::none;
+using std::bernoulli_distribution;
+using std::max;
+using std::min;
+using std::mt19937;
+using std::string;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+
+constexpr residx_t synthetic_hits_spec::DEFAULT_SEQ_LENGTH;
+constexpr size_t   synthetic_hits_spec::DEFAULT_NUM_HITS;
+constexpr residx_t synthetic_hits_spec::DEFAULT_MEAN_HIT_LENGTH;
+constexpr double   synthetic_hits_spec::DEFAULT_DISCONTIG_FRACTION;
+constexpr double   synthetic_hits_spec::DEFAULT_OVERLAP_FRACTION;
+
+/// \brief Getter for the length of the query sequence
+const residx_t & synthetic_hits_spec::get_seq_length() const {
+	return seq_length;
+}
+
+/// \brief Getter for the number of hits to generate
+const size_t & synthetic_hits_spec::get_num_hits() const {
+	return num_hits;
+}
+
+/// \brief Getter for the mean number of residues covered by each hit
+const residx_t & synthetic_hits_spec::get_mean_hit_length() const {
+	return mean_hit_length;
+}
+
+/// \brief Getter for the fraction of hits that should be discontiguous
+const double & synthetic_hits_spec::get_discontig_fraction() const {
+	return discontig_fraction;
+}
+
+/// \brief Getter for the mean fraction of each hit that overlaps with the previous hit in its layer
+const double & synthetic_hits_spec::get_overlap_fraction() const {
+	return overlap_fraction;
+}
+
+/// \brief Setter for the length of the query sequence
+synthetic_hits_spec & synthetic_hits_spec::set_seq_length(const residx_t &prm_seq_length ///< The length of the query sequence
+                                                          ) {
+	seq_length = prm_seq_length;
+	return *this;
+}
+
+/// \brief Setter for the number of hits to generate
+synthetic_hits_spec & synthetic_hits_spec::set_num_hits(const size_t &prm_num_hits ///< The number of hits to generate
+                                                        ) {
+	num_hits = prm_num_hits;
+	return *this;
+}
+
+/// \brief Setter for the mean number of residues covered by each hit
+synthetic_hits_spec & synthetic_hits_spec::set_mean_hit_length(const residx_t &prm_mean_hit_length ///< The mean number of residues covered by each hit
+                                                               ) {
+	mean_hit_length = prm_mean_hit_length;
+	return *this;
+}
+
+/// \brief Setter for the fraction of hits that should be discontiguous
+synthetic_hits_spec & synthetic_hits_spec::set_discontig_fraction(const double &prm_discontig_fraction ///< The fraction of hits that should be discontiguous
+                                                                  ) {
+	discontig_fraction = prm_discontig_fraction;
+	return *this;
+}
+
+/// \brief Setter for the mean fraction of each hit that overlaps with the previous hit in its layer
+synthetic_hits_spec & synthetic_hits_spec::set_overlap_fraction(const double &prm_overlap_fraction ///< The mean fraction of each hit that overlaps with the previous hit in its layer
+                                                                ) {
+	overlap_fraction = prm_overlap_fraction;
+	return *this;
+}
+
+/// \brief Generate a description of any problem that makes the specified synthetic_hits_spec invalid
+///        or none otherwise
+///
+/// \relates synthetic_hits_spec
+str_opt cath::rslv::get_invalid_description(const synthetic_hits_spec &prm_spec ///< The synthetic_hits_spec to query
+                                            ) {
+	if ( prm_spec.get_seq_length() == 0 ) {
+		return "Cannot generate synthetic hits for a sequence of zero length"s;
+	}
+	if ( prm_spec.get_mean_hit_length() == 0 || prm_spec.get_mean_hit_length() > prm_spec.get_seq_length() ) {
+		return "The mean hit length must be between one and the sequence length"s;
+	}
+	if ( ! ( prm_spec.get_discontig_fraction() >= 0.0 && prm_spec.get_discontig_fraction() <= 1.0 ) ) {
+		return "The discontiguous fraction must be between 0 and 1"s;
+	}
+	if ( ! ( prm_spec.get_overlap_fraction() >= 0.0 && prm_spec.get_overlap_fraction() < 1.0 ) ) {
+		return "The overlap fraction must be at least 0 and less than 1"s;
+	}
+	return none;
+}
+
+/// \brief Generate a synthetic full_hit_list according to the specified synthetic_hits_spec using the specified random number generator
+///
+/// Each hit's score is drawn uniformly from [1, 100) and its label is "synthetic_hit_" followed by its index.
+/// A discontiguous hit has its residues split evenly across two segments, separated by a gap of between
+/// a quarter and all of its length.
+///
+/// \relates synthetic_hits_spec
+full_hit_list cath::rslv::make_synthetic_full_hit_list(const synthetic_hits_spec &prm_spec, ///< The specification of the hits to generate
+                                                       mt19937                   &prm_rng   ///< The random number generator to use
+                                                       ) {
+	const auto invalid_desc = get_invalid_description( prm_spec );
+	if ( invalid_desc ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception( *invalid_desc ));
+	}
+
+	const residx_t &seq_length  = prm_spec.get_seq_length();
+	const residx_t &mean_length = prm_spec.get_mean_hit_length();
+	const residx_t  max_length  = min( seq_length, mean_length + mean_length / 2 );
+	const residx_t  min_length  = min( max_length, max( residx_t{ 1 }, mean_length / 2 ) );
+
+	// Draw the overlaps from a range that's centred on the requested fraction and stays within [0, 1]
+	const double   overlap     = prm_spec.get_overlap_fraction();
+	uniform_int_distribution <residx_t> length_dist   { min_length,                       max_length                };
+	uniform_real_distribution<double  > overlap_dist  { max( 0.0, 2.0 * overlap - 1.0 ), min( 1.0, 2.0 * overlap ) };
+	uniform_real_distribution<double  > score_dist    { 1.0,                              100.0                     };
+	bernoulli_distribution              discontig_dist{ prm_spec.get_discontig_fraction()                           };
+
+	const auto new_layer_start_fn = [&] {
+		return uniform_int_distribution<residx_t>{ 0, min_length - 1 }( prm_rng );
+	};
+
+	full_hit_vec hits;
+	hits.reserve( prm_spec.get_num_hits() );
+	residx_t cursor = new_layer_start_fn();
+	for (size_t hit_ctr = 0; hit_ctr < prm_spec.get_num_hits(); ++hit_ctr) {
+		const residx_t length = length_dist( prm_rng );
+
+		// If this hit is to be discontiguous (and there's space), choose the gap between its two segments
+		const residx_t gap_length = ( discontig_dist( prm_rng ) && length >= 2 )
+			? uniform_int_distribution<residx_t>{ max( residx_t{ 1 }, length / 4 ), length }( prm_rng )
+			: 0;
+		const residx_t span = ( length + gap_length <= seq_length ) ? length + gap_length : length;
+
+		// If this hit would run off the end of the sequence, start a new layer
+		if ( cursor + span > seq_length ) {
+			cursor = min( new_layer_start_fn(), seq_length - span );
+		}
+
+		const residx_t first_seg_length = length / 2;
+		hits.emplace_back(
+			( span == length )
+				? seq_seg_vec{ seq_seg{ cursor, cursor + length - 1 } }
+				: seq_seg_vec{
+					seq_seg{ cursor,                                 cursor + first_seg_length - 1 },
+					seq_seg{ cursor + first_seg_length + gap_length, cursor + span - 1             }
+				},
+			"synthetic_hit_" + ::std::to_string( hit_ctr ),
+			score_dist( prm_rng )
+		);
+
+		const double step = std::round( static_cast<double>( span ) * ( 1.0 - overlap_dist( prm_rng ) ) );
+		cursor += max( residx_t{ 1 }, static_cast<residx_t>( step ) );
+	}
+	return full_hit_list{ hits };
+}
+
+/// \brief Generate a string describing the specified synthetic_hits_spec
+///
+/// \relates synthetic_hits_spec
+string cath::rslv::to_string(const synthetic_hits_spec &prm_spec ///< The synthetic_hits_spec to describe
+                             ) {
+	return "synthetic_hits_spec[seq_length:"
+		+ ::std::to_string( prm_spec.get_seq_length()         )
+		+ ", num_hits:"
+		+ ::std::to_string( prm_spec.get_num_hits()           )
+		+ ", mean_hit_length:"
+		+ ::std::to_string( prm_spec.get_mean_hit_length()    )
+		+ ", discontig_fraction:"
+		+ ::std::to_string( prm_spec.get_discontig_fraction() )
+		+ ", overlap_fraction:"
+		+ ::std::to_string( prm_spec.get_overlap_fraction()   )
+		+ "]";
+}
@@ -0,0 +1,97 @@
+/// \file
+/// \brief The synthetic_hits_spec class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_BENCHMARK_SYNTHETIC_HITS_SPEC_HPP
+#define _CATH_TOOLS_SOURCE_RESOLVE_HITS_BENCHMARK_SYNTHETIC_HITS_SPEC_HPP
+
+#include "common/type_aliases.hpp"
+#include "seq/seq_type_aliases.hpp"
+
+#include <random>
+#include <string>
+
+namespace cath { namespace rslv { class full_hit_list; } }
+
+namespace cath {
+	namespace rslv {
+
+		/// \brief Specify how to generate a synthetic list of hits for a single query sequence
+		///        (eg for benchmarking the resolve algorithms)
+		///
+		/// The hits are laid out in layers along the sequence: each hit starts a (randomly varying)
+		/// step after the previous one, where that step is the hit's length, reduced by the overlap fraction.
+		/// When a hit would run off the end of the sequence, a new layer is started back near the start.
+		class synthetic_hits_spec final {
+		private:
+			/// \brief The length of the query sequence
+			seq::residx_t seq_length         = DEFAULT_SEQ_LENGTH;
+
+			/// \brief The number of hits to generate (which, with seq_length, controls the density of hits)
+			size_t        num_hits           = DEFAULT_NUM_HITS;
+
+			/// \brief The mean number of residues covered by each hit (the lengths vary uniformly from half to one-and-a-half times this)
+			seq::residx_t mean_hit_length    = DEFAULT_MEAN_HIT_LENGTH;
+
+			/// \brief The fraction of hits that should be discontiguous (ie have two segments)
+			double        discontig_fraction = DEFAULT_DISCONTIG_FRACTION;
+
+			/// \brief The mean fraction of each hit that overlaps with the previous hit in its layer
+			double        overlap_fraction   = DEFAULT_OVERLAP_FRACTION;
+
+		public:
+			/// \brief The default value for the length of the query sequence
+			static constexpr seq::residx_t DEFAULT_SEQ_LENGTH         = 500;
+
+			/// \brief The default value for the number of hits to generate
+			static constexpr size_t        DEFAULT_NUM_HITS           = 1000;
+
+			/// \brief The default value for the mean number of residues covered by each hit
+			static constexpr seq::residx_t DEFAULT_MEAN_HIT_LENGTH    = 80;
+
+			/// \brief The default value for the fraction of hits that should be discontiguous
+			static constexpr double        DEFAULT_DISCONTIG_FRACTION = 0.1;
+
+			/// \brief The default value for the mean fraction of each hit that overlaps with the previous hit in its layer
+			static constexpr double        DEFAULT_OVERLAP_FRACTION   = 0.5;
+
+			const seq::residx_t & get_seq_length() const;
+			const size_t & get_num_hits() const;
+			const seq::residx_t & get_mean_hit_length() const;
+			const double & get_discontig_fraction() const;
+			const double & get_overlap_fraction() const;
+
+			synthetic_hits_spec & set_seq_length(const seq::residx_t &);
+			synthetic_hits_spec & set_num_hits(const size_t &);
+			synthetic_hits_spec & set_mean_hit_length(const seq::residx_t &);
+			synthetic_hits_spec & set_discontig_fraction(const double &);
+			synthetic_hits_spec & set_overlap_fraction(const double &);
+		};
+
+		str_opt get_invalid_description(const synthetic_hits_spec &);
+
+		full_hit_list make_synthetic_full_hit_list(const synthetic_hits_spec &,
+		                                           std::mt19937 &);
+
+		std::string to_string(const synthetic_hits_spec &);
+
+	} // namespace rslv
+} // namespace cath
+
+#endif
@@ -0,0 +1,119 @@
+/// \file
+/// \brief The synthetic_hits_spec test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "resolve_hits/benchmark/synthetic_hits_spec.hpp"
+#include "resolve_hits/full_hit.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+#include "seq/seq_seg.hpp"
+
+#include <random>
+
+namespace cath { namespace test { } }
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::seq;
+using namespace cath::test;
+
+using std::mt19937;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The synthetic_hits_spec_test_suite_fixture to assist in testing synthetic_hits_spec
+		struct synthetic_hits_spec_test_suite_fixture {
+		protected:
+			~synthetic_hits_spec_test_suite_fixture() noexcept = default;
+
+			/// \brief Make a synthetic full_hit_list from the specified spec using a generator seeded with the specified seed
+			static full_hit_list make_hits(const synthetic_hits_spec  &prm_spec, ///< The specification of the hits to generate
+			                               const mt19937::result_type &prm_seed  ///< The seed for the random number generator
+			                               ) {
+				mt19937 rng{ prm_seed };
+				return make_synthetic_full_hit_list( prm_spec, rng );
+			}
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(synthetic_hits_spec_test_suite, synthetic_hits_spec_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(generates_the_requested_number_of_hits_within_the_sequence) {
+	const auto spec = synthetic_hits_spec{}.set_seq_length( 300 ).set_num_hits( 500 );
+	const full_hit_list hits = make_hits( spec, 1 );
+	BOOST_REQUIRE_EQUAL( hits.size(), 500 );
+	for (const full_hit &the_hit : hits) {
+		BOOST_CHECK_LE( get_stop_res_index( the_hit.get_segments().back() ), 299 );
+		BOOST_CHECK_GT( the_hit.get_score(), 0.0 );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(is_reproducible_for_the_same_seed) {
+	const synthetic_hits_spec spec;
+	const full_hit_list hits_a = make_hits( spec, 7 );
+	const full_hit_list hits_b = make_hits( spec, 7 );
+	BOOST_REQUIRE_EQUAL( hits_a.size(), hits_b.size() );
+	for (size_t hit_ctr = 0; hit_ctr < hits_a.size(); ++hit_ctr) {
+		BOOST_CHECK( hits_a[ hit_ctr ] == hits_b[ hit_ctr ] );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(discontig_fraction_controls_the_number_of_discontiguous_hits) {
+	const full_hit_list contig_hits    = make_hits( synthetic_hits_spec{}.set_discontig_fraction( 0.0 ), 3 );
+	const full_hit_list discontig_hits = make_hits( synthetic_hits_spec{}.set_discontig_fraction( 1.0 ), 3 );
+	for (const full_hit &the_hit : contig_hits) {
+		BOOST_CHECK_EQUAL( the_hit.get_segments().size(), 1 );
+	}
+	for (const full_hit &the_hit : discontig_hits) {
+		BOOST_CHECK_EQUAL( the_hit.get_segments().size(), 2 );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(zero_overlap_makes_consecutive_hits_in_a_layer_disjoint) {
+	const full_hit_list hits = make_hits(
+		synthetic_hits_spec{}
+			.set_discontig_fraction( 0.0 )
+			.set_overlap_fraction  ( 0.0 ),
+		5
+	);
+	for (size_t hit_ctr = 1; hit_ctr < hits.size(); ++hit_ctr) {
+		const seq_seg &prev_seg = hits[ hit_ctr - 1 ].get_segments().front();
+		const seq_seg &this_seg = hits[ hit_ctr     ].get_segments().front();
+		// Only check hits that continue the same layer (rather than starting a new one)
+		if ( get_start_res_index( this_seg ) > get_start_res_index( prev_seg ) ) {
+			BOOST_CHECK_GT( get_start_res_index( this_seg ), get_stop_res_index( prev_seg ) );
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(rejects_invalid_specs) {
+	mt19937 rng{ 0 };
+	BOOST_CHECK_THROW( make_synthetic_full_hit_list( synthetic_hits_spec{}.set_seq_length        (    0 ), rng ), invalid_argument_exception );
+	BOOST_CHECK_THROW( make_synthetic_full_hit_list( synthetic_hits_spec{}.set_mean_hit_length   (  501 ), rng ), invalid_argument_exception );
+	BOOST_CHECK_THROW( make_synthetic_full_hit_list( synthetic_hits_spec{}.set_overlap_fraction  (  1.0 ), rng ), invalid_argument_exception );
+	BOOST_CHECK_THROW( make_synthetic_full_hit_list( synthetic_hits_spec{}.set_discontig_fraction( -0.1 ), rng ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
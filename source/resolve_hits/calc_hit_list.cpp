@@ -251,8 +251,6 @@ void cath::rslv::read_hit_list_from_istream(read_and_process_mgr &prm_read_and_p
 		BOOST_THROW_EXCEPTION(invalid_argument_exception(""));
 	}
 
-	prm_read_and_process_mgr.process_all_outstanding();
-
 	const auto is_space_char     = [ ] (const auto &x) { return ( ( x == ' ' ) || ( x == '\t' ) ); };
 	const auto is_non_space_char = [ ] (const auto &x) { return ( ( x != ' ' ) && ( x != '\t' ) ); };
 	const auto find_space        = [&] (const auto &b, const auto &e) {
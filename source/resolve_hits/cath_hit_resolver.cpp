@@ -28,6 +28,8 @@
 #include "resolve_hits/calc_hit_list.hpp"
 #include "resolve_hits/file/parse_domain_hits_table.hpp"
 #include "resolve_hits/file/parse_hmmer_out.hpp"
+#include "resolve_hits/file/sort_hits_by_query.hpp"
+#include "resolve_hits/hits_summary.hpp"
 #include "resolve_hits/html_output/resolve_hits_html_outputter.hpp"
 #include "resolve_hits/options/crh_options.hpp"
 #include "resolve_hits/options/spec/crh_score_spec.hpp"
@@ -101,6 +103,12 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 		ofstreams.close_all();
 	}
 
+	// If merging partial summaries, do that instead of reading any input data
+	if ( is_merging_partial_summaries( in_spec ) ) {
+		merge_partial_summaries( in_spec, out_spec, prm_stdout );
+		return;
+	}
+
 	// If no input specified, stop here
 	if ( ! input_file_opt && ! read_from_stdin ) {
 		return;
@@ -126,12 +134,13 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 		prm_crh_spec
 	);
 
-	try {
+	// Parse the input data from the specified istream into the read_and_process_mgr according to the input format
+	const auto parse_fn = [&] (istream &prm_parse_istream) {
 		switch( in_spec.get_input_format() ) {
 			case ( hits_input_format_tag::HMMER_DOMTBLOUT ) : {
 				parse_domain_hits_table(
 					the_read_and_process_mgr,
-					the_istream_ref,
+					prm_parse_istream,
 					score_spec.get_apply_cath_rules()
 				);
 				break;
@@ -139,29 +148,31 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 			case ( hits_input_format_tag::HMMSCAN_OUT ) : {
 				parse_hmmer_out(
 					the_read_and_process_mgr,
-					the_istream_ref,
+					prm_parse_istream,
 					hmmer_format::HMMSCAN,
 					score_spec.get_apply_cath_rules(),
 					in_spec.get_min_gap_length(),
-					out_spec.get_output_hmmer_aln()
+					out_spec.get_output_hmmer_aln(),
+					in_spec.get_num_threads()
 				);
 				break;
 			}
 			case ( hits_input_format_tag::HMMSEARCH_OUT ) : {
 				parse_hmmer_out(
 					the_read_and_process_mgr,
-					the_istream_ref,
+					prm_parse_istream,
 					hmmer_format::HMMSEARCH,
 					score_spec.get_apply_cath_rules(),
 					in_spec.get_min_gap_length(),
-					out_spec.get_output_hmmer_aln()
+					out_spec.get_output_hmmer_aln(),
+					in_spec.get_num_threads()
 				);
 				break;
 			}
 			case ( hits_input_format_tag::RAW_WITH_SCORES ) : {
 				read_hit_list_from_istream(
 					the_read_and_process_mgr,
-					the_istream_ref,
+					prm_parse_istream,
 					hit_score_type::CRH_SCORE
 				);
 				break;
@@ -169,7 +180,7 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 			case ( hits_input_format_tag::RAW_WITH_EVALUES ) : {
 				read_hit_list_from_istream(
 					the_read_and_process_mgr,
-					the_istream_ref,
+					prm_parse_istream,
 					hit_score_type::FULL_EVALUE
 				);
 				break;
@@ -178,6 +189,21 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 				BOOST_THROW_EXCEPTION(out_of_range_exception("Value of hits_input_format_tag not recognised"));
 			}
 		}
+	};
+
+	try {
+		// If sorting the input hits, pass the input through sort_hits_by_query() so it arrives grouped by query
+		if ( in_spec.get_sort_input_hits() ) {
+			sort_hits_by_query(
+				the_istream_ref,
+				parse_fn,
+				in_spec.get_num_threads(),
+				in_spec.get_sort_run_mb() * 1024 * 1024
+			);
+		}
+		else {
+			parse_fn( the_istream_ref );
+		}
 	}
 	catch (const std::exception &prm_exception) {
 		logger::log_and_exit(
@@ -197,3 +223,42 @@ void cath::rslv::perform_resolve_hits(const crh_spec &prm_crh_spec, ///< The crh
 		input_file_stream.close();
 	}
 }
+
+/// \brief Merge the partial summaries specified in the crh_input_spec and write the result
+///        to the summary outputs specified in the crh_output_spec
+///
+/// If no summary outputs are specified, the merged summary is written to prm_stdout
+void cath::rslv::merge_partial_summaries(const crh_input_spec  &prm_in_spec,  ///< The crh_input_spec specifying the partial summaries to merge
+                                         const crh_output_spec &prm_out_spec, ///< The crh_output_spec specifying the summary outputs
+                                         ostream               &prm_stdout    ///< The output stream
+                                         ) {
+	hits_summary merged_summary;
+	try {
+		merged_summary = read_and_merge_partial_summaries( prm_in_spec.get_partial_summaries_to_merge() );
+	}
+	catch (const std::exception &prm_exception) {
+		logger::log_and_exit(
+			logger::return_code::MALFORMED_RESOLVE_HITS_INFILE,
+			"Unable to merge partial summaries. Error was:\n"s
+				+ prm_exception.what()
+		);
+		return;
+	}
+
+	ofstream_list ofstreams{ prm_stdout };
+	const path_vec &partial_files   = prm_out_spec.get_partial_summary_files();
+	const path_vec  summarise_files = ( prm_out_spec.get_summarise_files().empty() && partial_files.empty() )
+	                                  ? path_vec{ ofstreams.get_flag() }
+	                                  : prm_out_spec.get_summarise_files();
+
+	// As in summarise_hits_processor, only write a (non-partial) summary if there are some hits
+	if ( merged_summary.get_num_hits() > 0 ) {
+		for (const ostream_ref &summarise_ostream : ofstreams.open_ofstreams( summarise_files ) ) {
+			write_summary( summarise_ostream.get(), merged_summary );
+		}
+	}
+	for (const ostream_ref &partial_ostream : ofstreams.open_ofstreams( partial_files ) ) {
+		write_partial_summary( partial_ostream.get(), merged_summary );
+	}
+	ofstreams.close_all();
+}
@@ -26,7 +26,9 @@
 
 #include <iostream>
 
+namespace cath { namespace rslv { class crh_input_spec; } }
 namespace cath { namespace rslv { class crh_options; } }
+namespace cath { namespace rslv { class crh_output_spec; } }
 namespace cath { namespace rslv { class crh_spec; } }
 
 namespace cath {
@@ -45,6 +47,10 @@ namespace cath {
 		                          std::istream & = std::cin,
 		                          std::ostream & = std::cout);
 
+		void merge_partial_summaries(const crh_input_spec &,
+		                             const crh_output_spec &,
+		                             std::ostream & = std::cout);
+
 	} // namespace rslv
 } // namespace cath
 
@@ -389,6 +389,50 @@ BOOST_AUTO_TEST_SUITE_END()
 
 
 
+BOOST_AUTO_TEST_SUITE(sort_input)
+
+BOOST_AUTO_TEST_CASE(file_domtbl) {
+	execute_perform_resolve_hits( {
+		CRH_EG_DOMTBL_IN_FILENAME().string(),
+		"--" + crh_input_options_block::PO_INPUT_FORMAT, to_string( hits_input_format_tag::HMMER_DOMTBLOUT ),
+		"--" + crh_input_options_block::PO_SORT_INPUT_HITS
+	} );
+	BOOST_CHECK_STRING_MATCHES_FILE( blank_vrsn( output_ss ), CRH_EG_DOMTBL_OUT_FILENAME() );
+}
+
+BOOST_AUTO_TEST_CASE(file_raw_score) {
+	execute_perform_resolve_hits( {
+		CRH_EG_RAW_SCORE_IN_FILENAME().string(),
+		"--" + crh_input_options_block::PO_INPUT_FORMAT, to_string( hits_input_format_tag::RAW_WITH_SCORES ),
+		"--" + crh_input_options_block::PO_SORT_INPUT_HITS,
+		"--" + crh_input_options_block::PO_NUM_THREADS, "2",
+		"--" + crh_input_options_block::PO_SORT_RUN_MB, "1"
+	} );
+	BOOST_CHECK_STRING_MATCHES_FILE( blank_vrsn( output_ss ), CRH_EG_RAW_SCORE_OUT_FILENAME() );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_limit_queries) {
+	execute_perform_resolve_hits( {
+		CRH_EG_RAW_SCORE_IN_FILENAME().string(),
+		"--" + crh_input_options_block::PO_SORT_INPUT_HITS,
+		"--" + crh_filter_options_block::PO_LIMIT_QUERIES + "=2"
+	} );
+	BOOST_CHECK( boost::algorithm::contains( output_ss.str(), "Cannot use --limit-queries with --sort-input-hits" ) );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_hmmsearch_out) {
+	execute_perform_resolve_hits( {
+		CRH_EG_HMMSEARCH_IN_FILENAME().string(),
+		"--" + crh_input_options_block::PO_INPUT_FORMAT, to_string( hits_input_format_tag::HMMSEARCH_OUT ),
+		"--" + crh_input_options_block::PO_SORT_INPUT_HITS
+	} );
+	BOOST_CHECK( boost::algorithm::contains( output_ss.str(), "Cannot sort the input hits for hmmsearch_out/hmmscan_out input" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
 BOOST_AUTO_TEST_SUITE(summary_output)
 
 BOOST_AUTO_TEST_CASE(summarise) {
@@ -414,6 +458,46 @@ BOOST_AUTO_TEST_CASE(summarise__deprecated_opts) {
 	BOOST_CHECK( regex_search( log_sink.str(), regex{ R"(deprecated.* \-\-summarise\-to\-file \-)" } ) );
 }
 
+BOOST_AUTO_TEST_CASE(merged_partial_summary_matches_summarise) {
+	execute_perform_resolve_hits( {
+		CRH_EG_HMMSEARCH_IN_FILENAME().string(),
+		"--" + crh_input_options_block::PO_INPUT_FORMAT, to_string( hits_input_format_tag::HMMSEARCH_OUT ),
+		"--" + crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE, TEMP_TEST_FILE_FILENAME.string(),
+		"--" + crh_output_options_block::PO_QUIET
+	} );
+	BOOST_CHECK_EQUAL( output_ss.str(), "" );
+
+	execute_perform_resolve_hits( {
+		"--" + crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY, TEMP_TEST_FILE_FILENAME.string()
+	} );
+	BOOST_CHECK_STRING_MATCHES_FILE( output_ss.str(), CRH_EG_HMMSEARCH_SUMMARISE_OUT_FILENAME() );
+}
+
+BOOST_AUTO_TEST_CASE(writes_mergeable_partial_summary_for_input_without_hits) {
+	input_ss.str( "" );
+	execute_perform_resolve_hits( {
+		"-",
+		"--" + crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE, TEMP_TEST_FILE_FILENAME.string(),
+		"--" + crh_output_options_block::PO_QUIET
+	} );
+	BOOST_CHECK_EQUAL( output_ss.str(), "" );
+	BOOST_CHECK_EQUAL( read_string_from_file( TEMP_TEST_FILE_FILENAME ), "# cath-resolve-hits partial summary v1\nnum-hits\t0\n" );
+
+	execute_perform_resolve_hits( {
+		"--" + crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY, TEMP_TEST_FILE_FILENAME.string(),
+		"--" + crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE, "-"
+	} );
+	BOOST_CHECK_EQUAL( output_ss.str(), "# cath-resolve-hits partial summary v1\nnum-hits\t0\n" );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_hits_output_when_merging_partial_summaries) {
+	execute_perform_resolve_hits( {
+		"--" + crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY, TEMP_TEST_FILE_FILENAME.string(),
+		"--" + crh_output_options_block::PO_JSON_OUTPUT_TO_FILE, "-"
+	} );
+	BOOST_CHECK( boost::algorithm::contains( output_ss.str(), "Cannot output hits text, HTML or JSON when merging partial summaries" ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -154,6 +154,11 @@ namespace cath {
 				void parse_summary_from_header(const bool &,
 				                               const crh_filter_spec &);
 				void parse_alignment_section();
+				template <typename Fn>
+				void finish_alignment(Fn &&,
+				                      const bool &,
+				                      const seq::residx_t &,
+				                      const bool &);
 				void finish_alignment(read_and_process_mgr &,
 				                      const bool &,
 				                      const seq::residx_t &,
@@ -179,6 +184,15 @@ namespace cath {
 				static constexpr size_t LINE_ENV_TO_OFFSET      = 13;
 			};
 
+			template <typename BlockFn, typename AddHitFn>
+			void parse_hmmer_blocks(hmmer_parser &,
+			                        BlockFn &&,
+			                        AddHitFn &&,
+			                        const bool &,
+			                        const crh_filter_spec &,
+			                        const seq::residx_t &,
+			                        const bool &);
+
 			/// \brief const-agnostic implementation of get_query_id()
 			///
 			/// See GSL rule: Pro.Type.3: Don't use const_cast to cast away const (i.e., at all)
@@ -438,11 +452,15 @@ namespace cath {
 				advance_line_to_nonempty();
 			}
 
-			/// \brief Finish the current alignment
-			inline void hmmer_parser::finish_alignment(read_and_process_mgr &prm_read_and_process_mgr, ///< The read_and_process_mgr to which complete hits should be added
-			                                           const bool           &prm_apply_cath_policies,  ///< Whether to apply CATH-Gene3D policies (see `cath-resolve-hits --cath-rules-help`)
-			                                           const seq::residx_t  &prm_min_gap_length,       ///< The minimum length for a gap to be considered a gap
-			                                           const bool           &prm_parse_hmmer_aln       ///< Whether to parse the HMMER alignment information for outputting later
+			/// \brief Finish the current alignment and pass any resulting hit to the specified function
+			///
+			/// The function is called with the same arguments as read_and_process_mgr::add_hit(), which allows
+			/// hits to be buffered (eg by a worker thread) rather than being immediately passed to a read_and_process_mgr
+			template <typename Fn>
+			inline void hmmer_parser::finish_alignment(Fn                  &&prm_add_hit_fn,          ///< The function to which complete hits should be passed
+			                                           const bool           &prm_apply_cath_policies, ///< Whether to apply CATH-Gene3D policies (see `cath-resolve-hits --cath-rules-help`)
+			                                           const seq::residx_t  &prm_min_gap_length,      ///< The minimum length for a gap to be considered a gap
+			                                           const bool           &prm_parse_hmmer_aln      ///< Whether to parse the HMMER alignment information for outputting later
 			                                           ) {
 				auto              aln_results   = the_aln.process_aln( prm_min_gap_length, prm_parse_hmmer_aln );
 				std::string      &id_a          = std::get<0>( aln_results );
@@ -513,7 +531,7 @@ namespace cath {
 					extras.push_back< hit_extra_cat::COND_EVAL >( summ.conditional_evalue );
 					extras.push_back< hit_extra_cat::INDP_EVAL >( summ.independent_evalue );
 
-					prm_read_and_process_mgr.add_hit(
+					std::forward<Fn>( prm_add_hit_fn )(
 						*query_id,
 						std::move( segs ),
 						std::move( id_a ),
@@ -527,6 +545,29 @@ namespace cath {
 				the_aln.reset();
 			}
 
+			/// \brief Finish the current alignment and add any resulting hit to the specified read_and_process_mgr
+			inline void hmmer_parser::finish_alignment(read_and_process_mgr &prm_read_and_process_mgr, ///< The read_and_process_mgr to which complete hits should be added
+			                                           const bool           &prm_apply_cath_policies,  ///< Whether to apply CATH-Gene3D policies (see `cath-resolve-hits --cath-rules-help`)
+			                                           const seq::residx_t  &prm_min_gap_length,       ///< The minimum length for a gap to be considered a gap
+			                                           const bool           &prm_parse_hmmer_aln       ///< Whether to parse the HMMER alignment information for outputting later
+			                                           ) {
+				finish_alignment(
+					[&] (const std::string &prm_query_id, seq::seq_seg_vec prm_segs, std::string prm_label, const double &prm_score, const hit_score_type &prm_score_type, hit_extras_store prm_extras) {
+						prm_read_and_process_mgr.add_hit(
+							prm_query_id,
+							std::move( prm_segs   ),
+							std::move( prm_label  ),
+							prm_score,
+							prm_score_type,
+							std::move( prm_extras )
+						);
+					},
+					prm_apply_cath_policies,
+					prm_min_gap_length,
+					prm_parse_hmmer_aln
+				);
+			}
+
 			/// \brief Non-const getter for the current line
 			inline std::string & hmmer_parser::get_line() {
 				return line;
@@ -557,6 +598,68 @@ namespace cath {
 				return summaries;
 			}
 
+			/// \brief Parse all the blocks from the specified hmmer_parser, passing each block's query ID to the block function
+			///        and each resulting hit to the add-hit function
+			///
+			/// The block function should return whether the block should be parsed (rather than skipped).
+			///
+			/// This holds the main parsing loop so that it can be shared between the serial parse (which passes
+			/// hits straight to a read_and_process_mgr) and the parallel parse (which buffers hits in worker threads)
+			template <typename BlockFn, typename AddHitFn>
+			void parse_hmmer_blocks(hmmer_parser          &prm_parser,              ///< The hmmer_parser from which the blocks should be parsed
+			                        BlockFn              &&prm_block_fn,            ///< The function to call with the query ID at the start of each block, returning whether the block should be parsed
+			                        AddHitFn             &&prm_add_hit_fn,          ///< The function to which complete hits should be passed
+			                        const bool            &prm_apply_cath_policies, ///< Whether to apply CATH-specific policies
+			                        const crh_filter_spec &prm_filter_spec,         ///< The filter spec, used to determine which hits to exclude on inadequate hmm coverage
+			                        const seq::residx_t   &prm_min_gap_length,      ///< The minimum length that an alignment gap can have to be considered a gap
+			                        const bool            &prm_parse_hmmer_aln      ///< Whether to parse/output HMMER output alignment information
+			                        ) {
+				while ( ! prm_parser.end_of_istream() ) {
+					prm_parser.advance_line_to_block();
+
+					if ( prm_parser.end_of_istream() ) {
+						break;
+					}
+
+					prm_parser.advance_line();
+
+					if ( ! prm_block_fn( prm_parser.get_query_id() ) ) {
+						continue;
+					}
+
+					if ( prm_parser.line_is_summary_header() ) {
+						prm_parser.parse_summary_from_header(
+							prm_apply_cath_policies,
+							prm_filter_spec
+						);
+						prm_parser.advance_line_until_next_aln();
+
+						while ( ! prm_parser.line_is_at_block() && ! prm_parser.line_is_at_pipeline_stats() ) {
+							if ( prm_parser.line_is_at_aln() ) {
+								if ( ! prm_parser.alignment_is_empty() ) {
+									prm_parser.finish_alignment(
+										prm_add_hit_fn,
+										prm_apply_cath_policies,
+										prm_min_gap_length,
+										prm_parse_hmmer_aln
+									);
+								}
+								prm_parser.advance_line();
+							}
+							prm_parser.parse_alignment_section();
+						}
+						if ( ! prm_parser.alignment_is_empty() ) {
+							prm_parser.finish_alignment(
+								prm_add_hit_fn,
+								prm_apply_cath_policies,
+								prm_min_gap_length,
+								prm_parse_hmmer_aln
+							);
+						}
+					}
+				}
+			}
+
 		} // namespace detail
 	} // namespace rslv
 } // namespace cath
@@ -22,6 +22,7 @@
 
 #include "common/algorithm/transform_build.hpp"
 #include "common/pair_insertion_operator.hpp"
+#include "common/size_t_literal.hpp"
 #include "resolve_hits/file/detail/hmmer_parser.hpp"
 #include "resolve_hits/file/parse_hmmer_out.hpp"
 #include "resolve_hits/full_hit_list_fns.hpp"
@@ -66,26 +67,41 @@ namespace cath {
 			/// \brief Whether to parse/output hmmsearch output alignment information
 			static constexpr bool OUTPUT_HMMER_ALN     =  true;
 
+			/// \brief The number of threads to use when testing parallel parsing
+			static constexpr size_t PARALLEL_NUM_THREADS = 3;
+
+			/// \brief A tiny chunk size to ensure parallel parsing splits the input at every record
+			static constexpr size_t TINY_CHUNK_SIZE      = 1;
+
 			/// \brief Test whether the result of parsing the specified type of HMMER data from
 			///        the specified file matches the specified data
+			///
+			/// This checks both the serial parse and a parallel parse that's forced to split the input
+			/// into as many chunks as possible
 			void test_parse(const path                       &prm_input_file,   ///< The file to parse
 			                const hmmer_format               &prm_hmmer_format, ///< The type of HMMER data to expect
 			                const str_full_hit_list_pair_vec &prm_expected      ///< The expected results
 			                ) {
-				const auto got = transform_build<str_full_hit_list_pair_vec>(
-					parse_hmmer_out_file(
-						prm_input_file,
-						prm_hmmer_format,
-						APPLY_CATH_POLICIES,
-						MIN_GAP_LENGTH,
-						OUTPUT_HMMER_ALN
-					),
-					[] (const str_calc_hit_list_pair &x) {
-						return make_pair( x.first, x.second.get_full_hits() );
+				for (const size_t &num_threads : { 1_z, PARALLEL_NUM_THREADS } ) {
+					BOOST_TEST_CONTEXT( "Parsing with " << num_threads << " thread(s)" ) {
+						const auto got = transform_build<str_full_hit_list_pair_vec>(
+							parse_hmmer_out_file(
+								prm_input_file,
+								prm_hmmer_format,
+								APPLY_CATH_POLICIES,
+								MIN_GAP_LENGTH,
+								OUTPUT_HMMER_ALN,
+								num_threads,
+								TINY_CHUNK_SIZE
+							),
+							[] (const str_calc_hit_list_pair &x) {
+								return make_pair( x.first, x.second.get_full_hits() );
+							}
+						);
+
+						BOOST_TEST( got == prm_expected, per_element{} );
 					}
-				);
-
-				BOOST_TEST( got == prm_expected, per_element{} );
+				}
 			}
 
 		};
@@ -96,6 +112,8 @@ namespace cath {
 constexpr bool hmmer_parser_test_suite_fixture::APPLY_CATH_POLICIES;
 constexpr bool hmmer_parser_test_suite_fixture::MIN_GAP_LENGTH;
 constexpr bool hmmer_parser_test_suite_fixture::OUTPUT_HMMER_ALN;
+constexpr size_t hmmer_parser_test_suite_fixture::PARALLEL_NUM_THREADS;
+constexpr size_t hmmer_parser_test_suite_fixture::TINY_CHUNK_SIZE;
 
 BOOST_FIXTURE_TEST_SUITE(hmmer_parser_test_suite, hmmer_parser_test_suite_fixture)
 
@@ -0,0 +1,80 @@
+/// \file
+/// \brief The hmmer_query_block class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_FILE_DETAIL_HMMER_QUERY_BLOCK_HPP
+#define _CATH_TOOLS_SOURCE_RESOLVE_HITS_FILE_DETAIL_HMMER_QUERY_BLOCK_HPP
+
+#include "resolve_hits/hit_extras.hpp"
+#include "resolve_hits/hit_score_type.hpp"
+#include "seq/seq_seg.hpp"
+
+#include <string>
+#include <vector>
+
+namespace cath {
+	namespace rslv {
+		namespace detail {
+
+			/// \brief A hit parsed from HMMER output that is being held until it can be passed to a read_and_process_mgr
+			///
+			/// This holds the same pieces of data that are passed to read_and_process_mgr::add_hit()
+			struct hmmer_buffered_hit final {
+				/// \brief The segments of the hit
+				seq::seq_seg_vec segments;
+
+				/// \brief The label of the hit
+				std::string      label;
+
+				/// \brief The score of the hit
+				double           score;
+
+				/// \brief The type of the score
+				hit_score_type   score_type;
+
+				/// \brief Any extra information associated with the hit
+				hit_extras_store extras;
+			};
+
+			/// \brief Type alias for a vector of hmmer_buffered_hit values
+			using hmmer_buffered_hit_vec = std::vector<hmmer_buffered_hit>;
+
+			/// \brief The hits parsed from one block of HMMER output (ie one ">> " block) for a query ID
+			///
+			/// This allows worker threads to parse chunks of HMMER output without access to the read_and_process_mgr
+			/// so that the results can be passed to the read_and_process_mgr in the original order.
+			///
+			/// Recording the query ID even for blocks with no hits ensures that query-limiting behaves exactly as it does
+			/// in the serial parse.
+			struct hmmer_query_block final {
+				/// \brief The query ID associated with the block
+				std::string            query_id;
+
+				/// \brief The hits parsed from the block
+				hmmer_buffered_hit_vec hits;
+			};
+
+			/// \brief Type alias for a vector of hmmer_query_block values
+			using hmmer_query_block_vec = std::vector<hmmer_query_block>;
+
+		} // namespace detail
+	} // namespace rslv
+} // namespace cath
+
+#endif
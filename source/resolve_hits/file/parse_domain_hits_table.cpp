@@ -74,8 +74,6 @@ void cath::rslv::parse_domain_hits_table(read_and_process_mgr &prm_read_and_proc
 	string line_string;
 	bool skipped_for_negtv_bitscore = false;
 
-	prm_read_and_process_mgr.process_all_outstanding();
-
 	// Store the query IDs seen so far if the crh_filter_spec specifies a limit on the number of queries
 	query_id_recorder seen_query_ids;
 
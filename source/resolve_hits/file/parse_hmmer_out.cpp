@@ -26,8 +26,11 @@
 #include "resolve_hits/read_and_process_hits/hits_processor/hits_processor_list.hpp"
 #include "resolve_hits/read_and_process_hits/read_and_process_mgr.hpp"
 
+#include <deque>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <sstream>
 
 using namespace cath;
 using namespace cath::common;
@@ -36,8 +39,51 @@ using namespace cath::rslv::detail;
 using namespace cath::seq;
 
 using boost::filesystem::path;
+using std::deque;
+using std::future;
 using std::ifstream;
 using std::istream;
+using std::istringstream;
+using std::string;
+
+/// \brief Parse a chunk of HMMER output data (consisting of complete records) into hmmer_query_blocks
+///
+/// This doesn't require access to the read_and_process_mgr so it can be run in a worker thread.
+/// It doesn't do any query-skipping because that depends on the query IDs that have been seen in
+/// preceding chunks; that's left to the code that passes the blocks' hits to the read_and_process_mgr.
+hmmer_query_block_vec cath::rslv::detail::parse_hmmer_out_chunk(const string          &prm_chunk,               ///< The chunk of HMMER output data, consisting of complete records
+                                                                const hmmer_format    &prm_hmmer_format,        ///< The HMMER format to parse
+                                                                const bool            &prm_apply_cath_policies, ///< Whether to apply CATH-specific policies
+                                                                const crh_filter_spec &prm_filter_spec,         ///< The filter spec, used to determine which hits to exclude on inadequate hmm coverage
+                                                                const residx_t        &prm_min_gap_length,      ///< The minimum length that an alignment gap can have to be considered a gap
+                                                                const bool            &prm_parse_hmmer_aln      ///< Whether to parse/output HMMER output alignment information
+                                                                ) {
+	istringstream chunk_istream{ prm_chunk };
+	hmmer_parser parser{ prm_hmmer_format, chunk_istream };
+
+	hmmer_query_block_vec blocks;
+	parse_hmmer_blocks(
+		parser,
+		[&] (const string &prm_query_id) {
+			blocks.push_back( hmmer_query_block{ prm_query_id, {} } );
+			return true;
+		},
+		[&] (const string &/*prm_query_id*/, seq_seg_vec prm_segs, string prm_label, const double &prm_score, const hit_score_type &prm_score_type, hit_extras_store prm_extras) {
+			blocks.back().hits.push_back( hmmer_buffered_hit{
+				std::move( prm_segs   ),
+				std::move( prm_label  ),
+				prm_score,
+				prm_score_type,
+				std::move( prm_extras )
+			} );
+		},
+		prm_apply_cath_policies,
+		prm_filter_spec,
+		prm_min_gap_length,
+		prm_parse_hmmer_aln
+	);
+	return blocks;
+}
 
 /// \brief Parse HMMER output data from the specified file and pass the hits to the specified read_and_process_mgr
 void cath::rslv::parse_hmmer_out_file(read_and_process_mgr &prm_read_and_process_mgr, ///< The read_and_process_mgr to which the hits should be passed for processing
@@ -45,7 +91,9 @@ void cath::rslv::parse_hmmer_out_file(read_and_process_mgr &prm_read_and_process
                                       const hmmer_format   &prm_hmmer_format,         ///< The HMMER format to parse
                                       const bool           &prm_apply_cath_policies,  ///< Whether to apply CATH-specific policies
                                       const residx_t       &prm_min_gap_length,       ///< The minimum length that an alignment gap can have to be considered a gap
-                                      const bool           &prm_output_hmmer_aln      ///< Whether to parse/output HMMER output alignment information
+                                      const bool           &prm_output_hmmer_aln,     ///< Whether to parse/output HMMER output alignment information
+                                      const size_t         &prm_num_threads,          ///< The number of threads to use to parse the data
+                                      const size_t         &prm_chunk_size            ///< The approximate size of chunk of data to hand to each worker thread
                                       ) {
 	ifstream the_ifstream;
 	open_ifstream( the_ifstream, prm_hmmer_out_file );
@@ -56,72 +104,118 @@ void cath::rslv::parse_hmmer_out_file(read_and_process_mgr &prm_read_and_process
 		prm_hmmer_format,
 		prm_apply_cath_policies,
 		prm_min_gap_length,
-		prm_output_hmmer_aln
+		prm_output_hmmer_aln,
+		prm_num_threads,
+		prm_chunk_size
 	);
 
 	the_ifstream.close();
 }
 
 /// \brief Parse HMMER output data from the specified input stream and pass the hits to the specified read_and_process_mgr
+///
+/// If more than one thread is requested, the input is split into chunks at record boundaries (ie after "//" lines),
+/// the chunks are parsed concurrently in worker threads and the resulting blocks are passed to the read_and_process_mgr
+/// in their original order as each chunk completes. The number of chunks in flight is limited to the number of threads
+/// so that the memory usage remains bounded.
 void cath::rslv::parse_hmmer_out(read_and_process_mgr &prm_read_and_process_mgr, ///< The read_and_process_mgr to which the hits should be passed for processing
                                  istream              &prm_input_stream,         ///< The istream from which the HMMER domain hits table data should be parsed
                                  const hmmer_format   &prm_hmmer_format,         ///< The HMMER format to parse
                                  const bool           &prm_apply_cath_policies,  ///< Whether to apply CATH-specific policies
                                  const residx_t       &prm_min_gap_length,       ///< The minimum length that an alignment gap can have to be considered a gap
-                                 const bool           &prm_parse_hmmer_aln       ///< Whether to parse/output HMMER output alignment information
+                                 const bool           &prm_parse_hmmer_aln,      ///< Whether to parse/output HMMER output alignment information
+                                 const size_t         &prm_num_threads,          ///< The number of threads to use to parse the data
+                                 const size_t         &prm_chunk_size            ///< The approximate size of chunk of data to hand to each worker thread
                                  ) {
-	hmmer_parser parser{ prm_hmmer_format, prm_input_stream };
-
-	prm_read_and_process_mgr.process_all_outstanding();
-
 	// Store the query IDs seen so far if the crh_filter_spec specifies a limit on the number of queries
 	query_id_recorder seen_query_ids;
 
-	while ( ! parser.end_of_istream() ) {
-		parser.advance_line_to_block();
-
-		if ( parser.end_of_istream() ) {
-			break;
-		}
-
-		parser.advance_line();
+	// If this query ID should be skipped, then skip this entry.
+	// The function also updates seen_query_ids if not skipping this query ID
+	const auto block_fn = [&] (const string &prm_query_id) {
+		return ! should_skip_query_and_update( prm_read_and_process_mgr, prm_query_id, seen_query_ids );
+	};
 
-		// If this query ID should be skipped, then skip this entry.
-		// The function also updates seen_query_ids if not skipping this query ID
-		if ( should_skip_query_and_update( prm_read_and_process_mgr, parser.get_query_id(), seen_query_ids ) ) {
-			continue;
-		}
+	const auto add_hit_fn = [&] (const string &prm_query_id, seq_seg_vec prm_segs, string prm_label, const double &prm_score, const hit_score_type &prm_score_type, hit_extras_store prm_extras) {
+		prm_read_and_process_mgr.add_hit(
+			prm_query_id,
+			std::move( prm_segs   ),
+			std::move( prm_label  ),
+			prm_score,
+			prm_score_type,
+			std::move( prm_extras )
+		);
+	};
 
-		if ( parser.line_is_summary_header() ) {
-			parser.parse_summary_from_header(
-				prm_apply_cath_policies,
-				prm_read_and_process_mgr.get_filter_spec()
-			);
-			parser.advance_line_until_next_aln();
-
-			while ( ! parser.line_is_at_block() && ! parser.line_is_at_pipeline_stats() ) {
-				if ( parser.line_is_at_aln() ) {
-					if ( ! parser.alignment_is_empty() ) {
-						parser.finish_alignment(
-							prm_read_and_process_mgr,
-							prm_apply_cath_policies,
-							prm_min_gap_length,
-							prm_parse_hmmer_aln
+	if ( prm_num_threads <= 1 ) {
+		hmmer_parser parser{ prm_hmmer_format, prm_input_stream };
+		parse_hmmer_blocks(
+			parser,
+			block_fn,
+			add_hit_fn,
+			prm_apply_cath_policies,
+			prm_read_and_process_mgr.get_filter_spec(),
+			prm_min_gap_length,
+			prm_parse_hmmer_aln
+		);
+	}
+	else {
+		deque<future<hmmer_query_block_vec>> pending_chunks;
+
+		// Wait for the oldest chunk and pass its hits to the read_and_process_mgr
+		const auto process_oldest_chunk_fn = [&] {
+			hmmer_query_block_vec blocks = pending_chunks.front().get();
+			pending_chunks.pop_front();
+			for (hmmer_query_block &block : blocks) {
+				if ( block_fn( block.query_id ) ) {
+					for (hmmer_buffered_hit &hit : block.hits) {
+						add_hit_fn(
+							block.query_id,
+							std::move( hit.segments ),
+							std::move( hit.label    ),
+							hit.score,
+							hit.score_type,
+							std::move( hit.extras   )
 						);
 					}
-					parser.advance_line();
 				}
-				parser.parse_alignment_section();
 			}
-			if ( ! parser.alignment_is_empty() ) {
-				parser.finish_alignment(
-					prm_read_and_process_mgr,
-					prm_apply_cath_policies,
-					prm_min_gap_length,
-					prm_parse_hmmer_aln
-				);
+		};
+
+		string chunk;
+		string line;
+
+		// Hand the current chunk to a worker thread (first making space if the maximum number of chunks are in flight)
+		const auto dispatch_chunk_fn = [&] {
+			if ( pending_chunks.size() >= prm_num_threads ) {
+				process_oldest_chunk_fn();
+			}
+			pending_chunks.push_back( std::async(
+				std::launch::async,
+				&parse_hmmer_out_chunk,
+				std::move( chunk ),
+				prm_hmmer_format,
+				prm_apply_cath_policies,
+				std::cref( prm_read_and_process_mgr.get_filter_spec() ),
+				prm_min_gap_length,
+				prm_parse_hmmer_aln
+			) );
+			chunk.clear();
+		};
+
+		while ( getline( prm_input_stream, line ) ) {
+			chunk += line;
+			chunk += '\n';
+			if ( line == "//" && chunk.size() >= prm_chunk_size ) {
+				dispatch_chunk_fn();
 			}
 		}
+		if ( ! chunk.empty() ) {
+			dispatch_chunk_fn();
+		}
+		while ( ! pending_chunks.empty() ) {
+			process_oldest_chunk_fn();
+		}
 	}
 
 	prm_read_and_process_mgr.process_all_outstanding();
@@ -132,7 +226,9 @@ str_calc_hit_list_pair_vec cath::rslv::parse_hmmer_out_file(const path         &
                                                             const hmmer_format &prm_hmmer_format,        ///< The HMMER format to parse
                                                             const bool         &prm_apply_cath_policies, ///< Whether to apply CATH-specific policies
                                                             const residx_t     &prm_min_gap_length,      ///< The minimum length that an alignment gap can have to be considered a gap
-                                                            const bool         &prm_output_hmmer_aln     ///< Whether to parse/output HMMER output alignment information
+                                                            const bool         &prm_output_hmmer_aln,    ///< Whether to parse/output HMMER output alignment information
+                                                            const size_t       &prm_num_threads,         ///< The number of threads to use to parse the data
+                                                            const size_t       &prm_chunk_size           ///< The approximate size of chunk of data to hand to each worker thread
                                                             ) {
 	// gather_hits_processor the_processor;
 	str_calc_hit_list_pair_vec results;
@@ -148,7 +244,9 @@ str_calc_hit_list_pair_vec cath::rslv::parse_hmmer_out_file(const path         &
 		prm_hmmer_format,
 		prm_apply_cath_policies,
 		prm_min_gap_length,
-		prm_output_hmmer_aln
+		prm_output_hmmer_aln,
+		prm_num_threads,
+		prm_chunk_size
 	);
 	return results;
 }
@@ -24,34 +24,63 @@
 #include <boost/filesystem/path.hpp>
 
 #include "common/type_aliases.hpp"
+#include "resolve_hits/file/detail/hmmer_query_block.hpp"
 #include "resolve_hits/file/hmmer_format.hpp"
 #include "resolve_hits/resolve_hits_type_aliases.hpp"
 
 namespace cath { namespace rslv { class calc_hit_list; } }
+namespace cath { namespace rslv { class crh_filter_spec; } }
 namespace cath { namespace rslv { class read_and_process_mgr; } }
 
 namespace cath {
 	namespace rslv {
 
+		/// \brief The default number of threads to use when parsing HMMER output
+		///
+		/// With one thread, the input is parsed serially
+		constexpr size_t DEFAULT_HMMER_OUT_NUM_THREADS = 1;
+
+		/// \brief The default (approximate) size, in bytes, of each chunk of HMMER output to hand to a worker thread
+		///
+		/// Chunks are only ever split at the end of a record (ie at a "//" line) so they may be larger than this
+		constexpr size_t DEFAULT_HMMER_OUT_CHUNK_SIZE  = 4 * 1024 * 1024;
+
+		namespace detail {
+
+			hmmer_query_block_vec parse_hmmer_out_chunk(const std::string &,
+			                                            const hmmer_format &,
+			                                            const bool &,
+			                                            const crh_filter_spec &,
+			                                            const seq::residx_t &,
+			                                            const bool &);
+
+		} // namespace detail
+
 		void parse_hmmer_out_file(read_and_process_mgr &,
 		                          const boost::filesystem::path &,
 		                          const hmmer_format &,
 		                          const bool &,
 		                          const seq::residx_t &,
-		                          const bool &);
+		                          const bool &,
+		                          const size_t & = DEFAULT_HMMER_OUT_NUM_THREADS,
+		                          const size_t & = DEFAULT_HMMER_OUT_CHUNK_SIZE);
 
 		void parse_hmmer_out(read_and_process_mgr &,
 		                     std::istream &,
 		                     const hmmer_format &,
 		                     const bool &,
 		                     const seq::residx_t &,
-		                     const bool &);
+		                     const bool &,
+		                     const size_t & = DEFAULT_HMMER_OUT_NUM_THREADS,
+		                     const size_t & = DEFAULT_HMMER_OUT_CHUNK_SIZE);
 
 		str_calc_hit_list_pair_vec parse_hmmer_out_file(const boost::filesystem::path &,
 		                                                const hmmer_format &,
 		                                                const bool &,
 		                                                const seq::residx_t &,
-		                                                const bool &);
+		                                                const bool &,
+		                                                const size_t & = DEFAULT_HMMER_OUT_NUM_THREADS,
+		                                                const size_t & = DEFAULT_HMMER_OUT_CHUNK_SIZE);
 
 	} // namespace rslv
 } // namespace cath
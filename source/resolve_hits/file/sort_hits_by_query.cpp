@@ -0,0 +1,376 @@
+/// \file
+/// \brief The sort_hits_by_query definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "sort_hits_by_query.hpp"
+
+#include <boost/filesystem/path.hpp>
+#include <boost/iostreams/concepts.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range/algorithm/stable_sort.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/file/open_fstream.hpp"
+#include "common/file/temp_file.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <cstddef>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <memory>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::rslv::detail;
+
+using boost::filesystem::path;
+using boost::iostreams::source_tag;
+using boost::iostreams::stream;
+using boost::numeric_cast;
+using boost::range::stable_sort;
+using boost::string_ref;
+using std::deque;
+using std::future;
+using std::ifstream;
+using std::istream;
+using std::make_shared;
+using std::ofstream;
+using std::shared_ptr;
+using std::streamsize;
+using std::string;
+
+namespace cath {
+	namespace rslv {
+		namespace detail {
+
+			/// \brief Type alias for a function that reads the next line from a sorted run into the specified string,
+			///        returning false if there are no more lines
+			using line_reader_fn = std::function<bool(string &)>;
+
+			/// \brief Type alias for a vector of line_reader_fn
+			using line_reader_fn_vec = std::vector<line_reader_fn>;
+
+			/// \brief A Boost.Iostreams Source that performs a k-way merge of sorted runs of hits lines
+			///
+			/// Lines with equal query IDs are taken from earlier runs first so, since the runs are
+			/// stably sorted and are in input order, each query's lines remain in their original order.
+			///
+			/// Only the current line of each run is held in memory.
+			class merged_hit_runs_source final {
+			public:
+				/// \brief The character type, as required by Boost.Iostreams
+				using char_type = char;
+
+				/// \brief The category, as required by Boost.Iostreams
+				using category  = source_tag;
+
+			private:
+				/// \brief The state of the merge, which is shared between copies because Boost.Iostreams copies its devices
+				struct merge_state final {
+					/// \brief The functions from which to read each run's lines
+					line_reader_fn_vec run_readers;
+
+					/// \brief The current (ie next unmerged) line of each run
+					str_vec            current_lines;
+
+					/// \brief A min-heap (in query ID, then run index) of the indices of runs that have a current line
+					size_vec           run_heap;
+
+					/// \brief The line currently being handed out (with its trailing newline)
+					string             pending;
+
+					/// \brief The offset of the next character in pending to be handed out
+					size_t             pending_offset = 0;
+				};
+
+				/// \brief The shared merge state
+				shared_ptr<merge_state> state;
+
+				/// \brief Return whether the run at index prm_index_a should come after the one at prm_index_b
+				///        (which makes std::push_heap() / std::pop_heap() build a min-heap)
+				bool run_comes_after(const size_t &prm_index_a, ///< The index of the first  run to compare
+				                     const size_t &prm_index_b  ///< The index of the second run to compare
+				                     ) const {
+					const string_ref query_id_a = query_id_of_hit_line( state->current_lines[ prm_index_a ] );
+					const string_ref query_id_b = query_id_of_hit_line( state->current_lines[ prm_index_b ] );
+					return ( query_id_a > query_id_b ) || ( query_id_a == query_id_b && prm_index_a > prm_index_b );
+				}
+
+				/// \brief Read the next line from the run with the specified index and, if there is one, add the run to the heap
+				void load_next_line_of_run(const size_t &prm_run_index ///< The index of the run from which to read
+				                           ) {
+					if ( state->run_readers[ prm_run_index ]( state->current_lines[ prm_run_index ] ) ) {
+						state->run_heap.push_back( prm_run_index );
+						std::push_heap(
+							state->run_heap.begin(),
+							state->run_heap.end(),
+							[&] (const size_t &x, const size_t &y) { return run_comes_after( x, y ); }
+						);
+					}
+				}
+
+				/// \brief Move the next merged line into pending or return false if all runs are exhausted
+				bool load_next_merged_line() {
+					if ( state->run_heap.empty() ) {
+						return false;
+					}
+					std::pop_heap(
+						state->run_heap.begin(),
+						state->run_heap.end(),
+						[&] (const size_t &x, const size_t &y) { return run_comes_after( x, y ); }
+					);
+					const size_t run_index = state->run_heap.back();
+					state->run_heap.pop_back();
+
+					state->pending.swap( state->current_lines[ run_index ] );
+					state->pending.push_back( '\n' );
+					state->pending_offset = 0;
+
+					load_next_line_of_run( run_index );
+					return true;
+				}
+
+			public:
+				/// \brief Ctor from the functions from which to read each run's lines
+				explicit merged_hit_runs_source(line_reader_fn_vec prm_run_readers ///< The functions from which to read each run's lines (in input order)
+				                                ) : state{ make_shared<merge_state>() } {
+					state->run_readers = std::move( prm_run_readers );
+					state->current_lines.resize( state->run_readers.size() );
+					for (size_t run_ctr = 0; run_ctr < state->run_readers.size(); ++run_ctr) {
+						load_next_line_of_run( run_ctr );
+					}
+				}
+
+				/// \brief Read up to the specified number of characters into the specified buffer,
+				///        returning the number read or -1 at the end of the data
+				streamsize read(char             *prm_buffer, ///< The buffer into which the characters should be read
+				                const streamsize &prm_size    ///< The maximum number of characters to read
+				                ) {
+					const size_t max_num_read = numeric_cast<size_t>( prm_size );
+					size_t       num_read     = 0;
+					while ( num_read < max_num_read ) {
+						if ( state->pending_offset >= state->pending.size() && ! load_next_merged_line() ) {
+							break;
+						}
+						const size_t num_to_copy = std::min( max_num_read - num_read, state->pending.size() - state->pending_offset );
+						std::copy_n( state->pending.data() + state->pending_offset, num_to_copy, prm_buffer + num_read );
+						state->pending_offset += num_to_copy;
+						num_read              += num_to_copy;
+					}
+					return ( num_read == 0 ) ? -1 : numeric_cast<streamsize>( num_read );
+				}
+			};
+
+			/// \brief Sort the specified run of hits lines by query ID and write them to the specified file
+			void write_sorted_run(str_vec     prm_lines, ///< The lines to sort and write
+			                      const path &prm_file   ///< The file to which the sorted lines should be written
+			                      ) {
+				sort_hit_lines_by_query( prm_lines );
+				ofstream run_ofstream;
+				open_ofstream( run_ofstream, prm_file );
+				for (const string &line : prm_lines) {
+					run_ofstream << line << '\n';
+				}
+				run_ofstream.close();
+			}
+
+			/// \brief Open each of the specified run files into the specified deque of ifstreams and
+			///        return functions from which to read each run's lines (in the same order)
+			///
+			/// The ifstreams are stored in a deque so that they aren't moved as more are added
+			line_reader_fn_vec open_run_readers(const deque<temp_file>::const_iterator &prm_begin,     ///< The begin of the range of run files to open
+			                                    const deque<temp_file>::const_iterator &prm_end,       ///< The end   of the range of run files to open
+			                                    deque<ifstream>                        &prm_ifstreams  ///< The deque to which the opened ifstreams should be added
+			                                    ) {
+				line_reader_fn_vec run_readers;
+				for (auto run_file_itr = prm_begin; run_file_itr != prm_end; ++run_file_itr) {
+					prm_ifstreams.emplace_back();
+					ifstream &run_ifstream = prm_ifstreams.back();
+					open_ifstream( run_ifstream, get_filename( *run_file_itr ) );
+					run_readers.push_back( [&] (string &prm_line) {
+						return static_cast<bool>( getline( run_ifstream, prm_line ) );
+					} );
+				}
+				return run_readers;
+			}
+
+			/// \brief Merge the specified (consecutive) run files into one run file
+			void merge_run_files(const deque<temp_file>::const_iterator &prm_begin, ///< The begin of the range of run files to merge
+			                     const deque<temp_file>::const_iterator &prm_end,   ///< The end   of the range of run files to merge
+			                     const path                             &prm_file   ///< The file to which the merged lines should be written
+			                     ) {
+				deque<ifstream> run_ifstreams;
+				stream<merged_hit_runs_source> merged_stream{ merged_hit_runs_source{ open_run_readers( prm_begin, prm_end, run_ifstreams ) } };
+
+				ofstream run_ofstream;
+				open_ofstream( run_ofstream, prm_file );
+				string line;
+				while ( getline( merged_stream, line ) ) {
+					run_ofstream << line << '\n';
+				}
+				run_ofstream.close();
+
+				merged_stream.close();
+				for (ifstream &run_ifstream : run_ifstreams) {
+					run_ifstream.close();
+				}
+			}
+
+		} // namespace detail
+	} // namespace rslv
+} // namespace cath
+
+/// \brief Get the query ID of the specified line of hits data (ie its first whitespace-delimited field)
+///
+/// This is the field by which both the raw formats and the HMMER domtblout format are grouped
+boost::string_ref cath::rslv::detail::query_id_of_hit_line(const string &prm_line ///< The line of hits data
+                                                           ) {
+	const auto is_space_char = [] (const char &x) { return ( x == ' ' || x == '\t' ); };
+	const auto begin_itr     = std::find_if_not( prm_line.begin(), prm_line.end(), is_space_char );
+	const auto end_itr       = std::find_if    ( begin_itr,        prm_line.end(), is_space_char );
+	return {
+		prm_line.data() + std::distance( prm_line.begin(), begin_itr ),
+		numeric_cast<size_t>( std::distance( begin_itr, end_itr ) )
+	};
+}
+
+/// \brief Stably sort the specified hits lines by their query IDs
+///
+/// The sort is stable so each query's hits remain in their original order
+void cath::rslv::detail::sort_hit_lines_by_query(str_vec &prm_lines ///< The hits lines to sort
+                                                 ) {
+	stable_sort(
+		prm_lines,
+		[] (const string &x, const string &y) {
+			return query_id_of_hit_line( x ) < query_id_of_hit_line( y );
+		}
+	);
+}
+
+/// \brief Sort the lines of hits data in the specified istream by query ID and pass an istream of the sorted lines
+///        to the specified function
+///
+/// This allows ungrouped input to be processed through the (memory-efficient) grouped path.
+///
+/// The input is read into runs of approximately prm_run_size bytes. If all the input fits in one run, it's just
+/// sorted in memory. Otherwise each run is sorted on a worker thread (with up to prm_num_threads in flight at once)
+/// and written to a temporary file, and then the runs are k-way merged as they are read from the istream that's
+/// passed to prm_fn. So memory usage is bounded by roughly ( 1 + prm_num_threads ) * prm_run_size.
+///
+/// At most prm_max_fan_in run files are open at once: whilst there are more runs than that, consecutive
+/// groups of up to prm_max_fan_in runs are merged into intermediate run files (which preserves the stability).
+///
+/// The temporary files are created in the system's temporary directory (eg as specified by TMPDIR)
+/// and are removed before this returns.
+void cath::rslv::sort_hits_by_query(istream          &prm_istream,     ///< The istream from which to read the lines of hits data
+                                    const istream_fn &prm_fn,          ///< The function to which the istream of sorted lines should be passed
+                                    const size_t     &prm_num_threads, ///< The maximum number of runs to sort concurrently
+                                    const size_t     &prm_run_size,    ///< The approximate size, in bytes, of each run of lines to sort in memory
+                                    const size_t     &prm_max_fan_in   ///< The maximum number of runs to merge at once
+                                    ) {
+	if ( prm_max_fan_in < 2 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot sort hits by query with a maximum merge fan-in of less than 2"));
+	}
+
+	// Declare the temp_files before the futures so that the futures are waited on before the files are removed
+	deque<temp_file>    run_files;
+	deque<future<void>> pending_runs;
+	str_vec             run_lines;
+	size_t              run_size = 0;
+
+	// Wait for the oldest run to be sorted and written (propagating any exception)
+	const auto complete_oldest_run_fn = [&] {
+		pending_runs.front().get();
+		pending_runs.pop_front();
+	};
+
+	// Hand the current run to a worker thread (first making space if the maximum number of runs are in flight)
+	const auto dispatch_run_fn = [&] {
+		if ( pending_runs.size() >= prm_num_threads ) {
+			complete_oldest_run_fn();
+		}
+		run_files.emplace_back( ".cath-resolve-hits.sort_run.%%%%-%%%%-%%%%-%%%%" );
+		pending_runs.push_back( std::async(
+			std::launch::async,
+			&write_sorted_run,
+			std::move( run_lines ),
+			get_filename( run_files.back() )
+		) );
+		run_lines = str_vec{};
+		run_size  = 0;
+	};
+
+	string line;
+	while ( getline( prm_istream, line ) ) {
+		run_size += line.size() + sizeof( string );
+		run_lines.push_back( std::move( line ) );
+		if ( run_size >= prm_run_size ) {
+			dispatch_run_fn();
+		}
+	}
+
+	line_reader_fn_vec run_readers;
+	deque<ifstream>    run_ifstreams;
+	if ( run_files.empty() ) {
+		// All the data fitted in a single run so just sort it in memory
+		sort_hit_lines_by_query( run_lines );
+		size_t line_ctr = 0;
+		run_readers.push_back( [&] (string &prm_line) {
+			if ( line_ctr >= run_lines.size() ) {
+				return false;
+			}
+			prm_line = std::move( run_lines[ line_ctr++ ] );
+			return true;
+		} );
+	}
+	else {
+		if ( ! run_lines.empty() ) {
+			dispatch_run_fn();
+		}
+		while ( ! pending_runs.empty() ) {
+			complete_oldest_run_fn();
+		}
+		while ( run_files.size() > prm_max_fan_in ) {
+			deque<temp_file> merged_run_files;
+			for (size_t begin = 0; begin < run_files.size(); begin += prm_max_fan_in) {
+				const size_t end = std::min( run_files.size(), begin + prm_max_fan_in );
+				merged_run_files.emplace_back( ".cath-resolve-hits.sort_run.%%%%-%%%%-%%%%-%%%%" );
+				merge_run_files(
+					std::next( run_files.cbegin(), numeric_cast<ptrdiff_t>( begin ) ),
+					std::next( run_files.cbegin(), numeric_cast<ptrdiff_t>( end   ) ),
+					get_filename( merged_run_files.back() )
+				);
+			}
+			run_files.swap( merged_run_files );
+		}
+		run_readers = open_run_readers( run_files.cbegin(), run_files.cend(), run_ifstreams );
+	}
+
+	stream<merged_hit_runs_source> merged_stream{ merged_hit_runs_source{ std::move( run_readers ) } };
+	prm_fn( merged_stream );
+	merged_stream.close();
+
+	for (ifstream &run_ifstream : run_ifstreams) {
+		run_ifstream.close();
+	}
+}
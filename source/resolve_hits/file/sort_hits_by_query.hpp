@@ -0,0 +1,65 @@
+/// \file
+/// \brief The sort_hits_by_query header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_FILE_SORT_HITS_BY_QUERY_HPP
+#define _CATH_TOOLS_SOURCE_RESOLVE_HITS_FILE_SORT_HITS_BY_QUERY_HPP
+
+#include <boost/utility/string_ref.hpp>
+
+#include "common/type_aliases.hpp"
+
+#include <functional>
+#include <iosfwd>
+
+namespace cath {
+	namespace rslv {
+
+		/// \brief The default number of threads to use to sort the runs of hits
+		constexpr size_t DEFAULT_SORT_HITS_NUM_THREADS = 1;
+
+		/// \brief The default (approximate) size, in bytes, of each run of hits lines that's sorted in memory
+		constexpr size_t DEFAULT_SORT_HITS_RUN_SIZE    = 256 * 1024 * 1024;
+
+		/// \brief The default maximum number of runs of hits that are merged at once
+		///
+		/// This keeps the number of simultaneously open run files well within typical file-descriptor limits
+		constexpr size_t DEFAULT_SORT_HITS_MAX_FAN_IN  = 64;
+
+		/// \brief Type alias for a function that's passed an istream from which to read sorted hits lines
+		using istream_fn = std::function<void(std::istream &)>;
+
+		namespace detail {
+
+			boost::string_ref query_id_of_hit_line(const std::string &);
+
+			void sort_hit_lines_by_query(str_vec &);
+
+		} // namespace detail
+
+		void sort_hits_by_query(std::istream &,
+		                        const istream_fn &,
+		                        const size_t & = DEFAULT_SORT_HITS_NUM_THREADS,
+		                        const size_t & = DEFAULT_SORT_HITS_RUN_SIZE,
+		                        const size_t & = DEFAULT_SORT_HITS_MAX_FAN_IN);
+
+	} // namespace rslv
+} // namespace cath
+
+#endif
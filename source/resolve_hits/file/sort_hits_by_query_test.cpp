@@ -0,0 +1,142 @@
+/// \file
+/// \brief The sort_hits_by_query test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/type_aliases.hpp"
+#include "resolve_hits/file/sort_hits_by_query.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+
+#include <sstream>
+#include <string>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::rslv::detail;
+
+using std::istream;
+using std::istringstream;
+using std::ostringstream;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The sort_hits_by_query_test_suite_fixture to assist in testing sort_hits_by_query
+		struct sort_hits_by_query_test_suite_fixture {
+		protected:
+			~sort_hits_by_query_test_suite_fixture() noexcept = default;
+
+			/// \brief Sort the specified hits string with the specified number of threads, run size and merge fan-in
+			///        and return the sorted string
+			static string sort_hits_string(const string &prm_hits,                                    ///< The hits string to sort
+			                               const size_t &prm_num_threads,                             ///< The maximum number of runs to sort concurrently
+			                               const size_t &prm_run_size,                                ///< The approximate size, in bytes, of each run
+			                               const size_t &prm_max_fan_in = DEFAULT_SORT_HITS_MAX_FAN_IN ///< The maximum number of runs to merge at once
+			                               ) {
+				istringstream in_ss{ prm_hits };
+				ostringstream out_ss;
+				sort_hits_by_query(
+					in_ss,
+					[&] (istream &x) { out_ss << x.rdbuf(); },
+					prm_num_threads,
+					prm_run_size,
+					prm_max_fan_in
+				);
+				return out_ss.str();
+			}
+
+			/// \brief Some ungrouped hits data with comments and a blank line
+			const string unsorted_hits = R"(# A comment
+qc match_1 1.0 1-10
+qa match_2 2.0 11-20
+  qb	match_3 3.0 21-30
+
+qa match_4 4.0 31-40
+qc match_5 5.0 41-50
+qa match_6 6.0 51-60
+)";
+
+			/// \brief The same data stably sorted by query ID
+			const string sorted_hits = R"(
+# A comment
+qa match_2 2.0 11-20
+qa match_4 4.0 31-40
+qa match_6 6.0 51-60
+  qb	match_3 3.0 21-30
+qc match_1 1.0 1-10
+qc match_5 5.0 41-50
+)";
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(sort_hits_by_query_test_suite, cath::test::sort_hits_by_query_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(query_id_of_hit_line_works) {
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( "qa match_2 2.0 11-20"     ), "qa"  );
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( " \tqb\tmatch_3 3.0 21-30" ), "qb"  );
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( "qc"                       ), "qc"  );
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( "# A comment"              ), "#"   );
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( ""                         ), ""    );
+	BOOST_CHECK_EQUAL( query_id_of_hit_line( " \t "                     ), ""    );
+}
+
+BOOST_AUTO_TEST_CASE(sort_hit_lines_by_query_is_stable) {
+	str_vec lines = { "b 1", "a 2", "b 3", "a 4" };
+	sort_hit_lines_by_query( lines );
+	const str_vec expected = { "a 2", "a 4", "b 1", "b 3" };
+	BOOST_CHECK_EQUAL_RANGES( lines, expected );
+}
+
+BOOST_AUTO_TEST_CASE(sorts_in_memory_when_input_fits_in_one_run) {
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 1, DEFAULT_SORT_HITS_RUN_SIZE ), sorted_hits );
+}
+
+BOOST_AUTO_TEST_CASE(merges_stably_when_each_line_is_its_own_run) {
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 1, 1 ), sorted_hits );
+}
+
+BOOST_AUTO_TEST_CASE(merges_stably_with_multiple_threads) {
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 3, 1   ), sorted_hits );
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 2, 100 ), sorted_hits );
+}
+
+BOOST_AUTO_TEST_CASE(merges_stably_in_passes_when_there_are_more_runs_than_the_max_fan_in) {
+	// Each of the 8 lines is its own run so each of these needs at least one intermediate merge pass
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 1, 1, 2 ), sorted_hits );
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 2, 1, 3 ), sorted_hits );
+	BOOST_CHECK_EQUAL( sort_hits_string( unsorted_hits, 1, 1, 7 ), sorted_hits );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_max_fan_in_of_less_than_two) {
+	istringstream in_ss{ unsorted_hits };
+	BOOST_CHECK_THROW( sort_hits_by_query( in_ss, [] (istream &) {}, 1, 1, 1 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(handles_empty_input) {
+	BOOST_CHECK_EQUAL( sort_hits_string( "", 1, 1                          ), "" );
+	BOOST_CHECK_EQUAL( sort_hits_string( "", 1, DEFAULT_SORT_HITS_RUN_SIZE ), "" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -61,11 +61,14 @@ namespace cath {
 		}
 
 
-		/// \brief Write the specified full_hit_list to the specified rapidjson_writer
-		template <common::json_style Style>
-		void write_to_rapidjson_with_compact_fullhits(common::rapidjson_writer<Style> &prm_writer,        ///< The rapidjson_writer to which the full_hit_list should be written
-		                                              const full_hit_list             &prm_full_hit_list, ///< The full_hit_list to write
-		                                              const crh_segment_spec_opt      &prm_segment_spec   ///< An optional crh_segment_spec which can be used for including each full_hit's trimmed boundaries and resolved boundaries
+		/// \brief Write the specified full_hit_list to the specified rapidjson_writer (or rapidjson_writer_list)
+		///
+		/// Each full_hit is rendered as a small compact string and written straight to the writer
+		/// so the whole list never needs to be rendered into a single string
+		template <typename Writer>
+		void write_to_rapidjson_with_compact_fullhits(Writer                     &prm_writer,        ///< The rapidjson_writer (or rapidjson_writer_list) to which the full_hit_list should be written
+		                                              const full_hit_list        &prm_full_hit_list, ///< The full_hit_list to write
+		                                              const crh_segment_spec_opt &prm_segment_spec   ///< An optional crh_segment_spec which can be used for including each full_hit's trimmed boundaries and resolved boundaries
 		                                              ) {
 			prm_writer.start_array();
 			for (const auto &the_full_hit : prm_full_hit_list) {
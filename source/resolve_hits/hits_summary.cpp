@@ -0,0 +1,413 @@
+/// \file
+/// \brief The hits_summary class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "hits_summary.hpp"
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include "common/boost_addenda/range/front.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/file/open_fstream.hpp"
+#include "resolve_hits/full_hit_fns.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace std::literals::string_literals;
+
+using boost::algorithm::is_any_of;
+using boost::algorithm::split;
+using boost::bad_lexical_cast;
+using boost::filesystem::path;
+using boost::format;
+using boost::lexical_cast;
+using boost::make_optional;
+using boost::none;
+using boost::numeric_cast;
+using std::getline;
+using std::ifstream;
+using std::istream;
+using std::ostream;
+using std::right;
+using std::setw;
+using std::string;
+
+namespace cath {
+	namespace rslv {
+		namespace detail {
+
+			/// \brief The header line that starts every partial summary
+			static const string PARTIAL_SUMMARY_HEADER      { "# cath-resolve-hits partial summary v1" };
+
+			/// \brief The key for the partial summary's line recording the number of hits
+			static const string PARTIAL_SUMMARY_NUM_HITS    { "num-hits"                               };
+
+			/// \brief The key for the partial summary's line recording the example hit
+			static const string PARTIAL_SUMMARY_EXAMPLE_HIT { "example-hit"                            };
+
+			/// \brief The key for the partial summary's lines recording the number of queries at each max-stop
+			static const string PARTIAL_SUMMARY_MAX_STOP    { "max-stop-count"                         };
+
+			/// \brief Get the max-stop at the specified index in the sorted list of all the queries' max-stops
+			///
+			/// \pre `prm_index < get_num_queries( prm_hits_summary )`
+			inline size_t max_stop_at_sorted_index(const size_size_map &prm_max_stop_counts, ///< The number of queries at each max-stop
+			                                       const size_t        &prm_index            ///< The index of the sorted max-stop to get
+			                                       ) {
+				size_t num_so_far = 0;
+				for (const auto &max_stop_count : prm_max_stop_counts) {
+					num_so_far += max_stop_count.second;
+					if ( prm_index < num_so_far ) {
+						return max_stop_count.first;
+					}
+				}
+				BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot get max-stop at index beyond the number of queries"));
+			}
+
+			/// \brief Parse a size_t from the specified field of a partial summary,
+			///        throwing a runtime_error_exception on failure
+			inline size_t parse_partial_summary_size(const string &prm_field ///< The field to parse
+			                                         ) {
+				try {
+					return lexical_cast<size_t>( prm_field );
+				}
+				catch (const bad_lexical_cast &) {
+					BOOST_THROW_EXCEPTION(runtime_error_exception(
+						"Unable to parse \"" + prm_field + "\" as a count in partial summary"
+					));
+				}
+			}
+
+		} // namespace detail
+	} // namespace rslv
+} // namespace cath
+
+using namespace cath::rslv::detail;
+
+/// \brief Ctor from all the data members
+hits_summary::hits_summary(size_size_map            prm_max_stop_counts, ///< The number of queries (with at least one hit) at each max-stop
+                           const size_t             &prm_num_hits,        ///< The number of hits
+                           hits_summary_example_opt  prm_example          ///< An optional example hit
+                           ) : max_stop_counts { std::move( prm_max_stop_counts ) },
+                               num_hits        { prm_num_hits                     },
+                               example         { std::move( prm_example         ) } {
+}
+
+/// \brief Getter for the number of queries (with at least one hit) at each max-stop
+const size_size_map & hits_summary::get_max_stop_counts() const {
+	return max_stop_counts;
+}
+
+/// \brief Getter for the number of hits
+const size_t & hits_summary::get_num_hits() const {
+	return num_hits;
+}
+
+/// \brief Getter for the optional example hit
+const hits_summary_example_opt & hits_summary::get_example() const {
+	return example;
+}
+
+/// \brief Add the specified query's hits to this summary
+hits_summary & hits_summary::add_query(const string        &prm_query_id, ///< The query ID
+                                       const full_hit_list &prm_full_hits ///< The query's hits
+                                       ) {
+	if ( ! example && ! prm_full_hits.empty() ) {
+		const auto &example_hit = front( prm_full_hits );
+		example = hits_summary_example{
+			prm_query_id,
+			example_hit.get_label(),
+			get_score_string   ( example_hit ),
+			get_segments_string( example_hit )
+		};
+	}
+
+	const auto max_stop_opt = get_max_stop( prm_full_hits );
+	if ( max_stop_opt ) {
+		++max_stop_counts[ *max_stop_opt ];
+	}
+
+	num_hits += prm_full_hits.size();
+	return *this;
+}
+
+/// \brief Merge the specified hits_summary into this one
+///
+/// The example hit is only taken from the other summary if this one doesn't already have one
+/// so merging a series of summaries in order gives the same example as a single run over all the data
+hits_summary & hits_summary::operator+=(const hits_summary &prm_rhs ///< The hits_summary to merge into this one
+                                        ) {
+	for (const auto &max_stop_count : prm_rhs.get_max_stop_counts() ) {
+		max_stop_counts[ max_stop_count.first ] += max_stop_count.second;
+	}
+	num_hits += prm_rhs.get_num_hits();
+	if ( ! example ) {
+		example = prm_rhs.get_example();
+	}
+	return *this;
+}
+
+/// \brief Get the number of queries (with at least one hit) in the specified hits_summary
+///
+/// \relates hits_summary
+size_t cath::rslv::get_num_queries(const hits_summary &prm_hits_summary ///< The hits_summary to query
+                                   ) {
+	size_t num_queries = 0;
+	for (const auto &max_stop_count : prm_hits_summary.get_max_stop_counts() ) {
+		num_queries += max_stop_count.second;
+	}
+	return num_queries;
+}
+
+/// \brief Get the minimum of the queries' max-stops in the specified hits_summary or none if there are no queries
+///
+/// \relates hits_summary
+size_opt cath::rslv::get_min_max_stop(const hits_summary &prm_hits_summary ///< The hits_summary to query
+                                      ) {
+	const auto &max_stop_counts = prm_hits_summary.get_max_stop_counts();
+	return max_stop_counts.empty() ? none : make_optional( max_stop_counts.begin()->first );
+}
+
+/// \brief Get the maximum of the queries' max-stops in the specified hits_summary or none if there are no queries
+///
+/// \relates hits_summary
+size_opt cath::rslv::get_max_max_stop(const hits_summary &prm_hits_summary ///< The hits_summary to query
+                                      ) {
+	const auto &max_stop_counts = prm_hits_summary.get_max_stop_counts();
+	return max_stop_counts.empty() ? none : make_optional( max_stop_counts.rbegin()->first );
+}
+
+/// \brief Get the median of the queries' max-stops in the specified hits_summary or none if there are no queries
+///
+/// \relates hits_summary
+doub_opt cath::rslv::get_median_max_stop(const hits_summary &prm_hits_summary ///< The hits_summary to query
+                                         ) {
+	const auto   &max_stop_counts = prm_hits_summary.get_max_stop_counts();
+	const size_t  num_queries     = get_num_queries( prm_hits_summary );
+	if ( num_queries == 0 ) {
+		return none;
+	}
+	const size_t half_size   = num_queries / 2;
+	const auto   halfway_arg = numeric_cast<double>( max_stop_at_sorted_index( max_stop_counts, half_size ) );
+	if ( num_queries % 2 == 1 ) {
+		return halfway_arg;
+	}
+	return 0.5 * ( halfway_arg + numeric_cast<double>( max_stop_at_sorted_index( max_stop_counts, half_size - 1 ) ) );
+}
+
+/// \brief Return whether the two specified hits_summary_example values are identical
+///
+/// \relates hits_summary_example
+bool cath::rslv::operator==(const hits_summary_example &prm_lhs, ///< The first  hits_summary_example to compare
+                            const hits_summary_example &prm_rhs  ///< The second hits_summary_example to compare
+                            ) {
+	return (
+		prm_lhs.query_id == prm_rhs.query_id
+		&&
+		prm_lhs.match_id == prm_rhs.match_id
+		&&
+		prm_lhs.score    == prm_rhs.score
+		&&
+		prm_lhs.segments == prm_rhs.segments
+	);
+}
+
+/// \brief Return whether the two specified hits_summary values are identical
+///
+/// \relates hits_summary
+bool cath::rslv::operator==(const hits_summary &prm_lhs, ///< The first  hits_summary to compare
+                            const hits_summary &prm_rhs  ///< The second hits_summary to compare
+                            ) {
+	return (
+		prm_lhs.get_max_stop_counts() == prm_rhs.get_max_stop_counts()
+		&&
+		prm_lhs.get_num_hits()        == prm_rhs.get_num_hits()
+		&&
+		prm_lhs.get_example()         == prm_rhs.get_example()
+	);
+}
+
+/// \brief Write the specified hits_summary to the specified ostream as a brief, human-readable summary
+///
+/// \relates hits_summary
+void cath::rslv::write_summary(ostream            &prm_os,          ///< The ostream to which the summary should be written
+                               const hits_summary &prm_hits_summary ///< The hits_summary to write
+                               ) {
+	const size_t    num_queries = get_num_queries    ( prm_hits_summary );
+	const size_opt  min_stop    = get_min_max_stop   ( prm_hits_summary );
+	const size_opt  max_stop    = get_max_max_stop   ( prm_hits_summary );
+	const doub_opt  median_stop = get_median_max_stop( prm_hits_summary );
+	const auto     &example     = prm_hits_summary.get_example();
+	prm_os
+		<< "Summary of input data\n"
+		<< "---------------------\n"
+		<< " * Number of queries : " << right << setw( 6 ) << num_queries << " (excludes any queries with no hits)\n"
+		<< " * Number of hits    : " << right << setw( 6 ) << prm_hits_summary.get_num_hits()
+		<< " (ie an average of " << ( numeric_cast<double>( prm_hits_summary.get_num_hits() ) / numeric_cast<double>( num_queries ) ) << " per query)\n"
+		<< " * Minimum max-stop  : " << right << setw( 6 ) << ( min_stop ? std::to_string( *min_stop ) : "<N/A>"s ) << "\n"
+		<< " * Median  max-stop  : "
+		<< (
+			median_stop
+				? ( format( "%8.1f" ) % *median_stop ).str()
+				: " <N/A>"s
+		)
+		<< "\n"
+		<< " * Maximum max-stop  : " << right << setw( 6 ) << ( max_stop ? std::to_string( *max_stop ) : "<N/A>"s ) << "\n"
+		<< " * Example hit       :\n"
+		<< (
+			example
+			?
+				  "    * Query ID : " + example->query_id + "\n"
+				+ "    * Match ID : " + example->match_id + "\n"
+				+ "    * Score    : " + example->score    + "\n"
+				+ "    * Segments : " + example->segments + "\n"
+			:
+				""
+		);
+}
+
+/// \brief Write the specified hits_summary to the specified ostream as a partial summary
+///        that can be read back in with read_partial_summary()
+///
+/// \relates hits_summary
+void cath::rslv::write_partial_summary(ostream            &prm_os,          ///< The ostream to which the partial summary should be written
+                                       const hits_summary &prm_hits_summary ///< The hits_summary to write
+                                       ) {
+	prm_os << PARTIAL_SUMMARY_HEADER << "\n";
+	prm_os << PARTIAL_SUMMARY_NUM_HITS << "\t" << prm_hits_summary.get_num_hits() << "\n";
+	const auto &example = prm_hits_summary.get_example();
+	if ( example ) {
+		prm_os << PARTIAL_SUMMARY_EXAMPLE_HIT
+			<< "\t" << example->query_id
+			<< "\t" << example->match_id
+			<< "\t" << example->score
+			<< "\t" << example->segments
+			<< "\n";
+	}
+	for (const auto &max_stop_count : prm_hits_summary.get_max_stop_counts() ) {
+		prm_os << PARTIAL_SUMMARY_MAX_STOP << "\t" << max_stop_count.first << "\t" << max_stop_count.second << "\n";
+	}
+}
+
+/// \brief Write the specified hits_summary to the specified ostream in the specified format
+///
+/// \relates hits_summary
+void cath::rslv::write_hits_summary(ostream                   &prm_os,           ///< The ostream to which the summary should be written
+                                    const hits_summary        &prm_hits_summary, ///< The hits_summary to write
+                                    const hits_summary_format &prm_format        ///< The format in which to write the summary
+                                    ) {
+	switch ( prm_format ) {
+		case ( hits_summary_format::SUMMARY ) : { write_summary        ( prm_os, prm_hits_summary ); return; }
+		case ( hits_summary_format::PARTIAL ) : { write_partial_summary( prm_os, prm_hits_summary ); return; }
+	}
+	BOOST_THROW_EXCEPTION(invalid_argument_exception("Value of hits_summary_format not recognised"));
+}
+
+/// \brief Read a partial summary (as written by write_partial_summary()) from the specified istream
+///
+/// Completely empty input is read as an empty summary (for robustness, though summarise_hits_processor
+/// writes a header and zero counts for a chunk of data with no hits)
+///
+/// \relates hits_summary
+hits_summary cath::rslv::read_partial_summary(istream &prm_istream ///< The istream from which to read the partial summary
+                                              ) {
+	string line;
+	if ( ! getline( prm_istream, line ) ) {
+		return {};
+	}
+	if ( line != PARTIAL_SUMMARY_HEADER ) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			"Partial summary does not start with the expected header line \"" + PARTIAL_SUMMARY_HEADER + "\""
+		));
+	}
+
+	size_size_map            max_stop_counts;
+	size_opt                 num_hits;
+	hits_summary_example_opt example;
+	str_vec                  fields;
+	while ( getline( prm_istream, line ) ) {
+		if ( line.empty() ) {
+			continue;
+		}
+		split( fields, line, is_any_of( "\t" ) );
+		const string &key = fields.front();
+		if ( key == PARTIAL_SUMMARY_MAX_STOP && fields.size() == 3 ) {
+			max_stop_counts[ parse_partial_summary_size( fields[ 1 ] ) ] += parse_partial_summary_size( fields[ 2 ] );
+		}
+		else if ( key == PARTIAL_SUMMARY_NUM_HITS && fields.size() == 2 && ! num_hits ) {
+			num_hits = parse_partial_summary_size( fields[ 1 ] );
+		}
+		else if ( key == PARTIAL_SUMMARY_EXAMPLE_HIT && fields.size() == 5 && ! example ) {
+			example = hits_summary_example{ fields[ 1 ], fields[ 2 ], fields[ 3 ], fields[ 4 ] };
+		}
+		else {
+			BOOST_THROW_EXCEPTION(runtime_error_exception(
+				"Unable to parse line \"" + line + "\" of partial summary"
+			));
+		}
+	}
+	if ( ! num_hits ) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			"Partial summary does not contain a " + PARTIAL_SUMMARY_NUM_HITS + " line"
+		));
+	}
+	return { std::move( max_stop_counts ), *num_hits, std::move( example ) };
+}
+
+/// \brief Read the partial summaries from the specified files and merge them (in order)
+///
+/// \relates hits_summary
+hits_summary cath::rslv::read_and_merge_partial_summaries(const path_vec &prm_files ///< The files from which the partial summaries should be read
+                                                          ) {
+	hits_summary merged;
+	for (const path &partial_file : prm_files) {
+		if ( ! exists( partial_file ) ) {
+			BOOST_THROW_EXCEPTION(runtime_error_exception(
+				"No such partial summary file \"" + partial_file.string() + "\""
+			));
+		}
+		ifstream partial_ifstream;
+		open_ifstream( partial_ifstream, partial_file );
+		try {
+			merged += read_partial_summary( partial_ifstream );
+		}
+		catch (const std::exception &prm_exception) {
+			BOOST_THROW_EXCEPTION(runtime_error_exception(
+				"Unable to read partial summary file \""
+				+ partial_file.string()
+				+ "\". Error was:\n"
+				+ prm_exception.what()
+			));
+		}
+		partial_ifstream.close();
+	}
+	return merged;
+}
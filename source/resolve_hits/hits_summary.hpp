@@ -0,0 +1,124 @@
+/// \file
+/// \brief The hits_summary class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_HITS_SUMMARY_HPP
+#define _CATH_TOOLS_SOURCE_RESOLVE_HITS_HITS_SUMMARY_HPP
+
+#include <boost/optional.hpp>
+
+#include "common/path_type_aliases.hpp"
+#include "common/type_aliases.hpp"
+
+#include <iosfwd>
+#include <string>
+
+namespace cath { namespace rslv { class full_hit_list; } }
+
+namespace cath {
+	namespace rslv {
+
+		/// \brief Whether a hits_summary should be written as the final, human-readable summary
+		///        or as a partial summary that can later be merged with others
+		enum class hits_summary_format : bool {
+			SUMMARY, ///< The final, human-readable summary
+			PARTIAL  ///< A partial summary that can be read back in and merged with others
+		};
+
+		/// \brief The details of an example hit, as recorded in a hits_summary
+		///
+		/// This just stores the strings that are output so that it can be round-tripped
+		/// through a partial summary file without any loss
+		struct hits_summary_example final {
+			/// \brief The query ID
+			std::string query_id;
+
+			/// \brief The match ID
+			std::string match_id;
+
+			/// \brief The score, as a string
+			std::string score;
+
+			/// \brief The segments, as a string
+			std::string segments;
+		};
+
+		/// \brief Type alias for an optional hits_summary_example
+		using hits_summary_example_opt = boost::optional<hits_summary_example>;
+
+		/// \brief A summary of some hits input data that can be merged with summaries of other data
+		///
+		/// The per-query max-stops are stored as a histogram so that the summary's
+		/// size depends on the range of max-stops rather than on the number of queries
+		/// whilst still allowing the exact median to be calculated after any number of merges.
+		///
+		/// This allows separate jobs to summarise separate chunks of the data and then
+		/// have their partial summaries merged into a global summary.
+		class hits_summary final {
+		private:
+			/// \brief The number of queries (with at least one hit) at each max-stop
+			size_size_map max_stop_counts;
+
+			/// \brief The number of hits
+			size_t num_hits = 0;
+
+			/// \brief An optional example hit
+			hits_summary_example_opt example;
+
+		public:
+			hits_summary() = default;
+			hits_summary(size_size_map,
+			             const size_t &,
+			             hits_summary_example_opt);
+
+			const size_size_map & get_max_stop_counts() const;
+			const size_t & get_num_hits() const;
+			const hits_summary_example_opt & get_example() const;
+
+			hits_summary & add_query(const std::string &,
+			                         const full_hit_list &);
+
+			hits_summary & operator+=(const hits_summary &);
+		};
+
+		size_t get_num_queries(const hits_summary &);
+		size_opt get_min_max_stop(const hits_summary &);
+		size_opt get_max_max_stop(const hits_summary &);
+		doub_opt get_median_max_stop(const hits_summary &);
+
+		bool operator==(const hits_summary_example &,
+		                const hits_summary_example &);
+		bool operator==(const hits_summary &,
+		                const hits_summary &);
+
+		void write_summary(std::ostream &,
+		                   const hits_summary &);
+		void write_partial_summary(std::ostream &,
+		                           const hits_summary &);
+		void write_hits_summary(std::ostream &,
+		                        const hits_summary &,
+		                        const hits_summary_format &);
+
+		hits_summary read_partial_summary(std::istream &);
+		hits_summary read_and_merge_partial_summaries(const path_vec &);
+
+	} // namespace rslv
+} // namespace cath
+
+#endif
@@ -0,0 +1,146 @@
+/// \file
+/// \brief The hits_summary test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/exception/runtime_error_exception.hpp"
+#include "resolve_hits/full_hit.hpp"
+#include "resolve_hits/full_hit_list.hpp"
+#include "resolve_hits/hits_summary.hpp"
+
+#include <sstream>
+
+namespace cath { namespace test { } }
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::rslv;
+using namespace cath::seq;
+using namespace cath::test;
+
+using std::istringstream;
+using std::ostringstream;
+using std::string;
+
+BOOST_TEST_DONT_PRINT_LOG_VALUE( hits_summary )
+
+namespace cath {
+	namespace test {
+
+		/// \brief The hits_summary_test_suite_fixture to assist in testing hits_summary
+		struct hits_summary_test_suite_fixture {
+		protected:
+			~hits_summary_test_suite_fixture() noexcept = default;
+
+			/// \brief Make a full_hit_list with one hit per specified stop
+			static full_hit_list make_hits_with_stops(const size_vec &prm_stops ///< The stops of the hits to make
+			                                          ) {
+				full_hit_vec the_hits;
+				for (const size_t &stop : prm_stops) {
+					the_hits.emplace_back( seq_seg_vec{ seq_seg{ 1, static_cast<residx_t>( stop ) } }, "match_" + std::to_string( stop ), 10.0 );
+				}
+				return full_hit_list{ the_hits };
+			}
+
+			/// \brief Make a hits_summary by adding queries with the specified hits' stops
+			static hits_summary make_summary(const size_vec_vec &prm_stops_of_queries ///< The stops of the hits of each query
+			                                 ) {
+				hits_summary the_summary;
+				size_t query_ctr = 0;
+				for (const size_vec &stops : prm_stops_of_queries) {
+					the_summary.add_query( "query_" + std::to_string( query_ctr++ ), make_hits_with_stops( stops ) );
+				}
+				return the_summary;
+			}
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(hits_summary_test_suite, hits_summary_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(is_initially_empty) {
+	const hits_summary the_summary;
+	BOOST_CHECK_EQUAL( get_num_queries( the_summary ), 0 );
+	BOOST_CHECK_EQUAL( the_summary.get_num_hits(),     0 );
+	BOOST_CHECK      ( ! get_min_max_stop   ( the_summary ) );
+	BOOST_CHECK      ( ! get_median_max_stop( the_summary ) );
+	BOOST_CHECK      ( ! the_summary.get_example() );
+}
+
+BOOST_AUTO_TEST_CASE(summarises_queries) {
+	const hits_summary the_summary = make_summary( { { 20, 30 }, {}, { 10 }, { 40 } } );
+	BOOST_CHECK_EQUAL( get_num_queries( the_summary ),       3    );
+	BOOST_CHECK_EQUAL( the_summary.get_num_hits(),           4    );
+	BOOST_CHECK_EQUAL( *get_min_max_stop   ( the_summary ), 10    );
+	BOOST_CHECK_EQUAL( *get_max_max_stop   ( the_summary ), 40    );
+	BOOST_CHECK_EQUAL( *get_median_max_stop( the_summary ), 30.0  );
+	BOOST_REQUIRE    ( the_summary.get_example() );
+	BOOST_CHECK_EQUAL( the_summary.get_example()->query_id, "query_0" );
+	BOOST_CHECK_EQUAL( the_summary.get_example()->match_id, "match_20" );
+}
+
+BOOST_AUTO_TEST_CASE(calculates_median_of_even_number_of_queries) {
+	BOOST_CHECK_EQUAL( *get_median_max_stop( make_summary( { { 10 }, { 10 }, { 20 }, { 40 } } ) ), 15.0 );
+}
+
+BOOST_AUTO_TEST_CASE(merging_matches_single_summary) {
+	hits_summary merged = make_summary( { { 20, 30 }, { 10 } } );
+	merged += make_summary( { { 40 }, { 10 }, { 25, 5 } } );
+
+	const hits_summary single = make_summary( { { 20, 30 }, { 10 }, { 40 }, { 10 }, { 25, 5 } } );
+	BOOST_CHECK      ( merged.get_max_stop_counts() == single.get_max_stop_counts()   );
+	BOOST_CHECK_EQUAL( merged.get_num_hits(),          single.get_num_hits()          );
+	BOOST_CHECK_EQUAL( *get_median_max_stop( merged ), *get_median_max_stop( single ) );
+	BOOST_REQUIRE    ( merged.get_example() );
+	BOOST_CHECK_EQUAL( merged.get_example()->match_id, "match_20" );
+}
+
+BOOST_AUTO_TEST_CASE(partial_summary_round_trips) {
+	const hits_summary the_summary = make_summary( { { 20, 30 }, {}, { 10 }, { 40 } } );
+	ostringstream partial_ss;
+	write_partial_summary( partial_ss, the_summary );
+
+	istringstream partial_iss{ partial_ss.str() };
+	BOOST_CHECK_EQUAL( read_partial_summary( partial_iss ), the_summary );
+}
+
+BOOST_AUTO_TEST_CASE(empty_partial_summary_round_trips) {
+	ostringstream partial_ss;
+	write_partial_summary( partial_ss, hits_summary{} );
+
+	istringstream partial_iss{ partial_ss.str() };
+	BOOST_CHECK_EQUAL( read_partial_summary( partial_iss ), hits_summary{} );
+}
+
+BOOST_AUTO_TEST_CASE(reads_empty_input_as_empty_summary) {
+	istringstream empty_iss{ "" };
+	BOOST_CHECK_EQUAL( read_partial_summary( empty_iss ), hits_summary{} );
+}
+
+BOOST_AUTO_TEST_CASE(read_partial_summary_throws_on_malformed_input) {
+	istringstream no_header_iss{ "num-hits\t3\n" };
+	BOOST_CHECK_THROW( read_partial_summary( no_header_iss ), runtime_error_exception );
+
+	istringstream bad_count_iss{ "# cath-resolve-hits partial summary v1\nnum-hits\tthree\n" };
+	BOOST_CHECK_THROW( read_partial_summary( bad_count_iss ), runtime_error_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -46,6 +46,8 @@
 #include "resolve_hits/scored_hit_arch.hpp"
 #include "resolve_hits/trim/trim_spec.hpp"
 
+#include <ostream>
+#include <sstream>
 #include <string>
 
 using namespace cath;
@@ -66,6 +68,8 @@ using boost::irange;
 using boost::make_optional;
 using boost::none;
 using std::make_pair;
+using std::ostream;
+using std::ostringstream;
 using std::string;
 using std::tie;
 
@@ -839,6 +843,36 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
                                                 const crh_filter_spec  &prm_filter_spec,      ///< The crh_filter_spec defining which input hits will be skipped by the algorithm
                                                 const size_t           &prm_batch_index       ///< The index of the batch of hits being output (used to allow hits' HTML to have unique data attributes)
                                                 ) {
+	ostringstream html_ss;
+	write_html(
+		html_ss,
+		prm_query_id,
+		prm_calc_hit_list,
+		prm_score_spec,
+		prm_segment_spec,
+		prm_html_spec,
+		prm_output_head_tail,
+		prm_filter_spec,
+		prm_batch_index
+	);
+	return html_ss.str();
+}
+
+/// \brief Write HTML to describe the specified full_hit_list with the specified trim_spec applied
+///        directly to the specified ostream
+///
+/// Each row is written as soon as it's generated so that the HTML for a query with many hits
+/// needn't be accumulated into a single string before being output.
+void resolve_hits_html_outputter::write_html(ostream                &prm_os,               ///< The ostream to which the HTML should be written
+                                             const string           &prm_query_id,         ///< The query ID
+                                             const calc_hit_list    &prm_calc_hit_list,    ///< The calc_hit_list to describe
+                                             const crh_score_spec   &prm_score_spec,       ///< The crh_score_spec to use to calculate the crh-score
+                                             const crh_segment_spec &prm_segment_spec,     ///< The crh_segment_spec defining how the segments will be handled (eg trimmed) by the algorithm
+                                             const crh_html_spec    &prm_html_spec,        ///< The specification for how to render the HTML
+                                             const bool             &prm_output_head_tail, ///< Whether to include the head and tail (ie prefix and suffix) in the output
+                                             const crh_filter_spec  &prm_filter_spec,      ///< The crh_filter_spec defining which input hits will be skipped by the algorithm
+                                             const size_t           &prm_batch_index       ///< The index of the batch of hits being output (used to allow hits' HTML to have unique data attributes)
+                                             ) {
 	const auto  filtered_grey     = display_colour{ 0.666, 0.666, 0.666 };
 	const auto &the_full_hit_list = prm_calc_hit_list.get_full_hits();
 	const auto  best_result       = resolve_hits( prm_calc_hit_list, prm_score_spec.get_naive_greedy() );
@@ -874,11 +908,36 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
 	const auto   orig_score_str = the_full_hit_list.empty() ? "Score"s
 	                                                        : upper_first_lower_rest( to_string( front( the_full_hit_list ).get_score_type() ) );
 
+	// Make an html_hit for a hit in the result
+	const auto result_html_hit_fn = [&] (const calc_hit &x) {
+		const auto &the_index    = x.get_label_idx();
+		const auto &the_full_hit = the_full_hit_list[ the_index ];
+		return html_hit{
+			the_full_hit,
+			prm_batch_index,
+			the_index,
+			score_passes_filter( prm_filter_spec, the_full_hit.get_score(), the_full_hit.get_score_type() )
+				? get_colour_of_fraction(
+					gradient,
+					get_crh_score( the_full_hit, prm_score_spec ) / *best_crh_score
+				)
+				: filtered_grey,
+			make_optional( resolved_boundaries(
+				the_full_hit,
+				chosen_full_hits,
+				prm_segment_spec
+			) )
+		};
+	};
+
 	// Variable to keep track of exclusions
 	size_set non_soln_hit_indices;
 	size_set excluded_non_soln_hit_indices;
 
-	const string main_return_string = ( prm_output_head_tail ? html_prefix() : string{} ) + R"(
+	if ( prm_output_head_tail ) {
+		prm_os << html_prefix();
+	}
+	prm_os << R"(
 <br /> <!-- This is required before the wrapper for providing a break after the expand/collapse link -->
 <div class="crh-results-wrapper">
 
@@ -889,7 +948,7 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
 	</span>
 </div>
 
-<h3 class="crh-query-header">)" + dumb_html_escape_copy( prm_query_id ) + R"(</h3>
+<h3 class="crh-query-header">)" << dumb_html_escape_copy( prm_query_id ) << R"(</h3>
 <table class="crh-table">
 
 <tr class="crh-row-subheading">
@@ -902,37 +961,18 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
 </tr>
 
 )"
-	+ markers_row( seq_length, none, table_section::RESULTS )
-	+ hits_row_html(
-		transform_build<html_hit_vec>(
-			best_result.get_arch(),
-			[&] (const calc_hit &x) {
-				const auto &the_index    = x.get_label_idx();
-				const auto &the_full_hit = the_full_hit_list[ the_index ];
-				return html_hit{
-					the_full_hit,
-					prm_batch_index,
-					the_index,
-					score_passes_filter( prm_filter_spec, the_full_hit.get_score(), the_full_hit.get_score_type() )
-						? get_colour_of_fraction(
-							gradient,
-							get_crh_score( the_full_hit, prm_score_spec ) / *best_crh_score
-						)
-						: filtered_grey,
-					make_optional( resolved_boundaries(
-						the_full_hit,
-						chosen_full_hits,
-						prm_segment_spec
-					) )
-				};
-			}
-		),
-		prm_segment_spec,
-		prm_score_spec,
-		seq_length,
-		hit_row_context::RESULT_FULL
-	)
-	+ R"(<tr class="crh-row-soln-break">
+		<< markers_row( seq_length, none, table_section::RESULTS )
+		<< hits_row_html(
+			transform_build<html_hit_vec>(
+				best_result.get_arch(),
+				result_html_hit_fn
+			),
+			prm_segment_spec,
+			prm_score_spec,
+			seq_length,
+			hit_row_context::RESULT_FULL
+		)
+		<< R"(<tr class="crh-row-soln-break">
 	<td />
 	<td class="crh-cell-soln-break">
 		<span class="crh-row-soln-break-uparrow">&#11014;</span>
@@ -944,39 +984,25 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
 		<span class="crh-row-soln-break-uparrow">&#11014;</span>
 	</td>
 </tr>
-)"
-	+ join(
-		best_result.get_arch()
-			| transformed( [&] (const calc_hit &x) {
-				const auto &the_index    = x.get_label_idx();
-				const auto &the_full_hit = the_full_hit_list[ the_index ];
-				return hits_row_html(
-					{ html_hit{
-						the_full_hit,
-						prm_batch_index,
-						the_index,
-						score_passes_filter( prm_filter_spec, the_full_hit.get_score(), the_full_hit.get_score_type() )
-							? get_colour_of_fraction(
-								gradient,
-								get_crh_score( the_full_hit, prm_score_spec ) / *best_crh_score
-							)
-							: filtered_grey,
-						make_optional( resolved_boundaries(
-							the_full_hit,
-							chosen_full_hits,
-							prm_segment_spec
-						) )
-					} },
-					prm_segment_spec,
-					prm_score_spec,
-					seq_length,
-					hit_row_context::RESULT
-				);
-			} ),
-		"\n"
-	)
-	+ total_score_row( best_result.get_score() )
-	+ R"(
+)";
+
+	bool is_first_result_row = true;
+	for (const calc_hit &x : best_result.get_arch() ) {
+		if ( ! is_first_result_row ) {
+			prm_os << "\n";
+		}
+		prm_os << hits_row_html(
+			{ result_html_hit_fn( x ) },
+			prm_segment_spec,
+			prm_score_spec,
+			seq_length,
+			hit_row_context::RESULT
+		);
+		is_first_result_row = false;
+	}
+
+	prm_os << total_score_row( best_result.get_score() )
+		<< R"(
 <tr class="crh-row-subheading">
 	<td colspan="6" class="crh-table-subheading-later">
 		<span class="crh-table-subheading-uparrow">&#11014;</span>
@@ -995,75 +1021,69 @@ string resolve_hits_html_outputter::output_html(const string           &prm_quer
 </tr>
 
 )"
-	+ markers_row( seq_length, make_optional( orig_score_str ), table_section::INPUTS )
-	+ "\n\n"
-	+ join(
-		sorted_indices
-			| transformed( [&] (const size_t &x) {
-				const auto            &hit_x     = the_full_hit_list[ x ];
-				const bool             in_result = any_of( best_result.get_arch(), [&] (const calc_hit &y) { return y.get_label_idx() == x; } );
-				const hit_row_context  context   = in_result ? hit_row_context::HIGHLIGHT
-				                                             : hit_row_context::NORMAL;
-				const bool             rejected  = ! score_passes_filter( prm_filter_spec, hit_x.get_score(), hit_x.get_score_type() );
-
-				if ( rejected && prm_html_spec.get_exclude_rejected_hits() ) {
-					return ""s;
-				}
-				if ( ! in_result ) {
-					if ( ! contains( non_soln_hit_indices, x ) ) {
-						if ( non_soln_hit_indices.size() >= prm_html_spec.get_max_num_non_soln_hits() ) {
-							excluded_non_soln_hit_indices.insert( x );
-							return ""s;
-						}
-						non_soln_hit_indices.insert( x );
-					}
+		<< markers_row( seq_length, make_optional( orig_score_str ), table_section::INPUTS )
+		<< "\n\n";
+
+	bool is_first_input_row = true;
+	for (const size_t &x : sorted_indices) {
+		const auto            &hit_x     = the_full_hit_list[ x ];
+		const bool             in_result = any_of( best_result.get_arch(), [&] (const calc_hit &y) { return y.get_label_idx() == x; } );
+		const hit_row_context  context   = in_result ? hit_row_context::HIGHLIGHT
+		                                             : hit_row_context::NORMAL;
+		const bool             rejected  = ! score_passes_filter( prm_filter_spec, hit_x.get_score(), hit_x.get_score_type() );
+
+		if ( rejected && prm_html_spec.get_exclude_rejected_hits() ) {
+			continue;
+		}
+		if ( ! in_result ) {
+			if ( ! contains( non_soln_hit_indices, x ) ) {
+				if ( non_soln_hit_indices.size() >= prm_html_spec.get_max_num_non_soln_hits() ) {
+					excluded_non_soln_hit_indices.insert( x );
+					continue;
 				}
-				return hits_row_html(
-					{ html_hit{
-						hit_x,
-						prm_batch_index,
-						x,
-						rejected
-							? filtered_grey
-							: get_colour_of_fraction(
-								gradient,
-								get_crh_score( hit_x, prm_score_spec ) / *best_crh_score
-							),
-						none
-					} },
-					prm_segment_spec,
-					prm_score_spec,
-					seq_length,
-					context
-				);
-			} )
-			| filtered( [] (const string &x) { return ! x.empty() ; } ),
-		"\n"
-	)
-	+ R"(
+				non_soln_hit_indices.insert( x );
+			}
+		}
+		if ( ! is_first_input_row ) {
+			prm_os << "\n";
+		}
+		prm_os << hits_row_html(
+			{ html_hit{
+				hit_x,
+				prm_batch_index,
+				x,
+				rejected
+					? filtered_grey
+					: get_colour_of_fraction(
+						gradient,
+						get_crh_score( hit_x, prm_score_spec ) / *best_crh_score
+					),
+				none
+			} },
+			prm_segment_spec,
+			prm_score_spec,
+			seq_length,
+			context
+		);
+		is_first_input_row = false;
+	}
+
+	prm_os << R"(
 </table>
 )";
-	// Have to fully calculate main_return_string and then concatenate extra stuff here
-	// because otherwise C++'s order of evaluation rules don't guarantee that the code above
-	// has run and potentially populated excluded_non_soln_hit_indices before it's used below.
-	// I have seen this issue exhibited in code compiled by GCC (but not by Clang).
-	return
-		main_return_string
-		+ (
-			excluded_non_soln_hit_indices.empty()
-				? ""s
-				: (
-					R"(<div class="crh-exclusion-note">...hiding another )"
-					+ std::to_string( excluded_non_soln_hit_indices.size() )
-					+ R"( non-solution results (current limit is )"
-					+ std::to_string( prm_html_spec.get_max_num_non_soln_hits() )
-					+ R"(; use <code>--)"
-					+ crh_html_options_block::PO_MAX_NUM_NON_SOLN_HITS
-					+ R"(</code> to change)</div>)"
-				)
-		)
-		+ R"(
+	if ( ! excluded_non_soln_hit_indices.empty() ) {
+		prm_os << R"(<div class="crh-exclusion-note">...hiding another )"
+			<< excluded_non_soln_hit_indices.size()
+			<< R"( non-solution results (current limit is )"
+			<< prm_html_spec.get_max_num_non_soln_hits()
+			<< R"(; use <code>--)"
+			<< crh_html_options_block::PO_MAX_NUM_NON_SOLN_HITS
+			<< R"(</code> to change)</div>)";
+	}
+	prm_os << R"(
 </div>
-)"
-		+ ( prm_output_head_tail ? html_suffix() : string{} );
+)";
+	if ( prm_output_head_tail ) {
+		prm_os << html_suffix();
+	}
 }
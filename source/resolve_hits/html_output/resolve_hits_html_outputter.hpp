@@ -117,6 +117,16 @@ namespace cath {
 			                               const crh_filter_spec & = make_accept_all_filter_spec(),
 			                               const size_t & = 0);
 
+			static void write_html(std::ostream &,
+			                       const std::string &,
+			                       const calc_hit_list &,
+			                       const crh_score_spec &,
+			                       const crh_segment_spec &,
+			                       const crh_html_spec & = crh_html_spec{},
+			                       const bool & = true,
+			                       const crh_filter_spec & = make_accept_all_filter_spec(),
+			                       const size_t & = 0);
+
 			
 		};
 
@@ -72,12 +72,32 @@ str_opt crh_options::do_get_error_or_help_string() const {
 
 	// If the user has specified neither an input file nor to read from stdin, then return an blank error string
 	// (so the error will just be the basic "See 'cath-resolve-hits --help' for usage." message)
-	if ( ! the_in_spec.get_input_file() && ! the_in_spec.get_read_from_stdin() && ! the_out_spec.get_export_css_file() ) {
+	if ( ! the_in_spec.get_input_file() && ! the_in_spec.get_read_from_stdin() && ! the_out_spec.get_export_css_file() && ! is_merging_partial_summaries( the_in_spec ) ) {
 		return string{};
 	}
 
+	// Check that if merging partial summaries, the only outputs requested are summaries
+	if ( is_merging_partial_summaries( the_in_spec ) && has_non_summary_output_files( the_out_spec ) ) {
+		return "Cannot output hits text, HTML or JSON when merging partial summaries with --"
+			+ crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY
+			+ " (only --"
+			+ crh_output_options_block::PO_SUMMARISE_TO_FILE
+			+ " and --"
+			+ crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE
+			+ " may be used)";
+	}
+
 	const variables_map &local_vm           = get_variables_map();
 	const auto          &input_format = get_crh_input_spec().get_input_format();
+
+	// Check that the input isn't being sorted if limiting queries (because sorting would change which queries come first)
+	if ( the_in_spec.get_sort_input_hits() && specifies_option( local_vm, crh_filter_options_block::PO_LIMIT_QUERIES ) ) {
+		return "Cannot use --"
+			+ crh_filter_options_block::PO_LIMIT_QUERIES
+			+ " with --"
+			+ crh_input_options_block::PO_SORT_INPUT_HITS
+			+ " (because sorting changes which queries come first)";
+	}
 	if ( specifies_option( local_vm, crh_score_options_block::PO_APPLY_CATH_RULES ) ) {
 		if ( input_format != hits_input_format_tag::HMMER_DOMTBLOUT && input_format != hits_input_format_tag::HMMSEARCH_OUT ) {
 			return "The --"
@@ -174,7 +194,8 @@ When <input_file> is -, the input is read from standard input.
 The input data may contain unsorted hits for different query protein sequences.
 
 However, if your input data is already grouped by query protein sequence, then
-specify the --)" + crh_input_options_block::PO_INPUT_HITS_ARE_GROUPED + R"( flag for faster runs that use less memory.)";
+specify the --)" + crh_input_options_block::PO_INPUT_HITS_ARE_GROUPED + R"( flag for faster runs that use less memory.
+If it isn't, the --)" + crh_input_options_block::PO_SORT_INPUT_HITS + R"( flag gives similar memory savings by sorting it first.)";
 }
 
 /// \brief Get a string to append to the standard help
@@ -25,6 +25,7 @@
 #include "common/boost_addenda/program_options/layout_values_with_descs.hpp"
 #include "common/clone/make_uptr_clone.hpp"
 #include "common/program_options/prog_opt_num_range.hpp"
+#include "resolve_hits/options/options_block/crh_output_options_block.hpp"
 
 #include <limits>
 
@@ -56,6 +57,18 @@ const string crh_input_options_block::PO_MIN_GAP_LENGTH         { "min-gap-lengt
 /// \brief The option name for whether the code can assume that the input data is pre-grouped by query_id
 const string crh_input_options_block::PO_INPUT_HITS_ARE_GROUPED { "input-hits-are-grouped" };
 
+/// \brief The option name for the number of threads to use when parsing the input data
+const string crh_input_options_block::PO_NUM_THREADS            { "num-threads"            };
+
+/// \brief The option name for whether to sort the input data by query_id before processing it
+const string crh_input_options_block::PO_SORT_INPUT_HITS        { "sort-input-hits"        };
+
+/// \brief The option name for the approximate size, in MB, of each run of input data to sort in memory
+const string crh_input_options_block::PO_SORT_RUN_MB            { "sort-run-mb"            };
+
+/// \brief The option name for any partial summary files that should be merged (instead of reading input data)
+const string crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY  { "merge-partial-summary"  };
+
 /// \brief A standard do_clone method
 unique_ptr<options_block> crh_input_options_block::do_clone() const {
 	return { make_uptr_clone( *this ) };
@@ -75,10 +88,17 @@ void crh_input_options_block::do_add_visible_options_to_description(options_desc
 
 	const string format_varname { "<format>" };
 	const string length_varname { "<length>" };
-
-	const auto input_format_notifier           = [&] (const hits_input_format_tag &x) { the_spec.set_input_format          ( x ); };
-	const auto min_gap_length_notifier         = [&] (const residx_t              &x) { the_spec.set_min_gap_length        ( x ); };
-	const auto input_hits_are_grouped_notifier = [&] (const bool                  &x) { the_spec.set_input_hits_are_grouped( x ); };
+	const string num_varname    { "<num>"    };
+	const string mb_varname     { "<mb>"     };
+	const string file_varname   { "<file>"   };
+
+	const auto input_format_notifier           = [&] (const hits_input_format_tag &x) { the_spec.set_input_format              ( x ); };
+	const auto min_gap_length_notifier         = [&] (const residx_t              &x) { the_spec.set_min_gap_length            ( x ); };
+	const auto input_hits_are_grouped_notifier = [&] (const bool                  &x) { the_spec.set_input_hits_are_grouped    ( x ); };
+	const auto num_threads_notifier            = [&] (const size_t                &x) { the_spec.set_num_threads               ( x ); };
+	const auto sort_input_hits_notifier        = [&] (const bool                  &x) { the_spec.set_sort_input_hits           ( x ); };
+	const auto sort_run_mb_notifier            = [&] (const size_t                &x) { the_spec.set_sort_run_mb               ( x ); };
+	const auto merge_partial_summary_notifier  = [&] (const path_vec              &x) { the_spec.set_partial_summaries_to_merge( x ); };
 
 	const str_vec input_format_descs = layout_values_with_descs(
 		all_hits_input_format_tags,
@@ -113,10 +133,47 @@ void crh_input_options_block::do_add_visible_options_to_description(options_desc
 				->default_value( crh_input_spec::DEFAULT_INPUT_HITS_ARE_GROUPED ),
 			"Rely on the input hits being grouped by query protein"
 			"\n(so the run is faster and uses less memory)"
+		)
+		(
+			( PO_NUM_THREADS ).c_str(),
+			value< prog_opt_num_range<size_t, 1, numeric_limits<uint32_t>::max(), int64_t> >()
+				->value_name   ( num_varname                                    )
+				->notifier     ( num_threads_notifier                           )
+				->default_value( crh_input_spec::DEFAULT_NUM_THREADS            ),
+			( "Use " + num_varname + " threads to parse the input data"
+				+ "\n(currently only used for hmmsearch_out/hmmscan_out input and for --" + PO_SORT_INPUT_HITS + ")" ).c_str()
+		)
+		(
+			( PO_SORT_INPUT_HITS ).c_str(),
+			bool_switch()
+				->notifier     ( sort_input_hits_notifier                       )
+				->default_value( crh_input_spec::DEFAULT_SORT_INPUT_HITS        ),
+			( "Sort the input hits by query protein before processing them (using temporary files in TMPDIR),"
+				"\nwhich gives the memory benefits of --" + PO_INPUT_HITS_ARE_GROUPED + " for ungrouped input"
+				"\n(not available for hmmsearch_out/hmmscan_out input)" ).c_str()
+		)
+		(
+			( PO_SORT_RUN_MB ).c_str(),
+			value< prog_opt_num_range<size_t, 1, numeric_limits<uint32_t>::max(), int64_t> >()
+				->value_name   ( mb_varname                                     )
+				->notifier     ( sort_run_mb_notifier                           )
+				->default_value( crh_input_spec::DEFAULT_SORT_RUN_MB            ),
+			( "When sorting the input hits, sort runs of about " + mb_varname + " MB of input in memory at a time"
+				+ "\n(memory use is roughly this multiplied by one more than --" + PO_NUM_THREADS + ")" ).c_str()
+		)
+		(
+			( PO_MERGE_PARTIAL_SUMMARY ).c_str(),
+			value<path_vec>()
+				->value_name   ( file_varname                                   )
+				->notifier     ( merge_partial_summary_notifier                 ),
+			( "Instead of reading input data, merge the partial summary in " + file_varname
+				+ " (may be specified multiple times)"
+				+ "\n(as written by --" + crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE + ")" ).c_str()
 		);
 
 	static_assert( ! crh_input_spec::DEFAULT_READ_FROM_STDIN,        "If crh_input_spec::DEFAULT_READ_FROM_STDIN        isn't false, it might mess up the bool switch in here" );
 	static_assert( ! crh_input_spec::DEFAULT_INPUT_HITS_ARE_GROUPED, "If crh_input_spec::DEFAULT_INPUT_HITS_ARE_GROUPED isn't false, it might mess up the bool switch in here" );
+	static_assert( ! crh_input_spec::DEFAULT_SORT_INPUT_HITS,        "If crh_input_spec::DEFAULT_SORT_INPUT_HITS        isn't false, it might mess up the bool switch in here" );
 }
 
 /// \brief Add a hidden option to the options_description for the input file
@@ -155,6 +212,22 @@ str_opt crh_input_options_block::do_invalid_string(const variables_map &prm_vari
 			return "Cannot specify the minimum gap length for input formats that don't involve parsing gaps out of an alignment"s;
 		}
 	}
+	const bool is_hmmer_out_format = (
+		the_spec.get_input_format() == hits_input_format_tag::HMMSCAN_OUT
+		||
+		the_spec.get_input_format() == hits_input_format_tag::HMMSEARCH_OUT
+	);
+	if ( specifies_option( prm_variables_map, PO_NUM_THREADS ) ) {
+		if ( ! is_hmmer_out_format && ! the_spec.get_sort_input_hits() ) {
+			return "Cannot specify the number of threads for input formats that can't currently be parsed in parallel (unless sorting the input hits)"s;
+		}
+	}
+	if ( the_spec.get_sort_input_hits() && is_hmmer_out_format ) {
+		return "Cannot sort the input hits for hmmsearch_out/hmmscan_out input (which isn't one hit per line)"s;
+	}
+	if ( specifies_option( prm_variables_map, PO_SORT_RUN_MB ) && ! the_spec.get_sort_input_hits() ) {
+		return "Cannot specify the sort run size without sorting the input hits (--" + PO_SORT_INPUT_HITS + ")";
+	}
 	return get_invalid_description( the_spec );
 }
 
@@ -165,6 +238,10 @@ str_vec crh_input_options_block::do_get_all_options_names() const {
 		crh_input_options_block::PO_INPUT_FORMAT,
 		crh_input_options_block::PO_MIN_GAP_LENGTH,
 		crh_input_options_block::PO_INPUT_HITS_ARE_GROUPED,
+		crh_input_options_block::PO_NUM_THREADS,
+		crh_input_options_block::PO_SORT_INPUT_HITS,
+		crh_input_options_block::PO_SORT_RUN_MB,
+		crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY,
 	};
 }
 
@@ -49,6 +49,10 @@ namespace cath {
 			static const std::string PO_INPUT_FORMAT;
 			static const std::string PO_MIN_GAP_LENGTH;
 			static const std::string PO_INPUT_HITS_ARE_GROUPED;
+			static const std::string PO_NUM_THREADS;
+			static const std::string PO_SORT_INPUT_HITS;
+			static const std::string PO_SORT_RUN_MB;
+			static const std::string PO_MERGE_PARTIAL_SUMMARY;
 
 			const crh_input_spec & get_crh_input_spec() const;
 		};
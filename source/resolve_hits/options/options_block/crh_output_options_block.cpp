@@ -26,6 +26,7 @@
 
 #include "common/algorithm/sort_uniq_build.hpp"
 #include "common/clone/make_uptr_clone.hpp"
+#include "resolve_hits/options/options_block/crh_input_options_block.hpp"
 
 using namespace cath;
 using namespace cath::common;
@@ -52,6 +53,9 @@ const string crh_output_options_block::PO_OUTPUT_TRIMMED_HITS  { "output-trimmed
 /// \brief The option name for an optional file to which a summary of the input data should be output
 const string crh_output_options_block::PO_SUMMARISE_TO_FILE    { "summarise-to-file"    };
 
+/// \brief The option name for an optional file to which a mergeable partial summary of the input data should be output
+const string crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE { "summarise-partial-to-file" };
+
 /// \brief The option name for an optional file to which HTML should be output
 const string crh_output_options_block::PO_HTML_OUTPUT_TO_FILE  { "html-output-to-file"  };
 
@@ -80,13 +84,14 @@ void crh_output_options_block::do_add_visible_options_to_description(options_des
                                                                      ) {
 	const string file_varname   { "<file>" };
 
-	const auto hits_text_files_notifier     = [&] (const path_vec &x) { the_spec.set_hits_text_files     ( x           ); };
-	const auto quiet_notifier               = [&] (const bool     &x) { the_spec.set_quiet               ( x           ); };
-	const auto output_trimmed_hits_notifier = [&] (const bool     &x) {          set_output_trimmed_hits ( the_spec, x ); };
-	const auto summarise_files_notifier     = [&] (const path_vec &x) { the_spec.set_summarise_files     ( x           ); };
-	const auto html_output_files_notifier   = [&] (const path_vec &x) { the_spec.set_html_output_files   ( x           ); };
-	const auto json_output_files_notifier   = [&] (const path_vec &x) { the_spec.set_json_output_files   ( x           ); };
-	const auto export_css_file_notifier     = [&] (const path     &x) { the_spec.set_export_css_file     ( x           ); };
+	const auto hits_text_files_notifier     = [&] (const path_vec &x) { the_spec.set_hits_text_files      ( x           ); };
+	const auto quiet_notifier               = [&] (const bool     &x) { the_spec.set_quiet                ( x           ); };
+	const auto output_trimmed_hits_notifier = [&] (const bool     &x) {          set_output_trimmed_hits  ( the_spec, x ); };
+	const auto summarise_files_notifier     = [&] (const path_vec &x) { the_spec.set_summarise_files      ( x           ); };
+	const auto partial_summary_notifier     = [&] (const path_vec &x) { the_spec.set_partial_summary_files( x           ); };
+	const auto html_output_files_notifier   = [&] (const path_vec &x) { the_spec.set_html_output_files    ( x           ); };
+	const auto json_output_files_notifier   = [&] (const path_vec &x) { the_spec.set_json_output_files    ( x           ); };
+	const auto export_css_file_notifier     = [&] (const path     &x) { the_spec.set_export_css_file      ( x           ); };
 
 	prm_desc.add_options()
 		(
@@ -120,6 +125,14 @@ void crh_output_options_block::do_add_visible_options_to_description(options_des
 				->notifier     ( summarise_files_notifier              ),
 			( "Write a brief text summary of the input data to file " + file_varname + " (or '-' for stdout)" ).c_str()
 		)
+		(
+			PO_SUMMARISE_PARTIAL_TO_FILE.c_str(),
+			value<path_vec>()
+				->value_name   ( file_varname                          )
+				->notifier     ( partial_summary_notifier              ),
+			( "Write a partial summary of the input data to file " + file_varname + " (or '-' for stdout)"
+				+ "\n(for merging with other partial summaries using --" + crh_input_options_block::PO_MERGE_PARTIAL_SUMMARY + ")" ).c_str()
+		)
 		(
 			PO_HTML_OUTPUT_TO_FILE.c_str(),
 			value<path_vec>()
@@ -238,6 +251,7 @@ str_vec crh_output_options_block::get_all_non_deprecated_option_names_that_do_no
 		crh_output_options_block::PO_OUTPUT_TRIMMED_HITS,
 		crh_output_options_block::PO_EXPORT_CSS_FILE,
 		crh_output_options_block::PO_OUTPUT_HMMER_ALN,
+		crh_output_options_block::PO_SUMMARISE_PARTIAL_TO_FILE,
 	};
 }
 
@@ -59,6 +59,7 @@ namespace cath {
 			static const std::string PO_QUIET;
 			static const std::string PO_OUTPUT_TRIMMED_HITS;
 			static const std::string PO_SUMMARISE_TO_FILE;
+			static const std::string PO_SUMMARISE_PARTIAL_TO_FILE;
 			static const std::string PO_HTML_OUTPUT_TO_FILE;
 			static const std::string PO_JSON_OUTPUT_TO_FILE;
 			static const std::string PO_EXPORT_CSS_FILE;
@@ -32,6 +32,9 @@ constexpr bool                  crh_input_spec::DEFAULT_READ_FROM_STDIN;
 constexpr hits_input_format_tag crh_input_spec::DEFAULT_INPUT_FORMAT;
 constexpr residx_t              crh_input_spec::DEFAULT_MIN_GAP_LENGTH;
 constexpr bool                  crh_input_spec::DEFAULT_INPUT_HITS_ARE_GROUPED;
+constexpr size_t                crh_input_spec::DEFAULT_NUM_THREADS;
+constexpr bool                  crh_input_spec::DEFAULT_SORT_INPUT_HITS;
+constexpr size_t                crh_input_spec::DEFAULT_SORT_RUN_MB;
 
 /// \brief Getter for the input file from which data should be read
 const path_opt & crh_input_spec::get_input_file() const {
@@ -58,6 +61,26 @@ const bool & crh_input_spec::get_input_hits_are_grouped() const {
 	return input_hits_are_grouped;
 }
 
+/// \brief Getter for the number of threads to use when parsing the input data
+const size_t & crh_input_spec::get_num_threads() const {
+	return num_threads;
+}
+
+/// \brief Getter for whether to sort the input data by query_id before processing it (so it can be processed as grouped)
+const bool & crh_input_spec::get_sort_input_hits() const {
+	return sort_input_hits;
+}
+
+/// \brief Getter for the approximate size, in MB, of each run of input data to sort in memory when sorting the input data
+const size_t & crh_input_spec::get_sort_run_mb() const {
+	return sort_run_mb;
+}
+
+/// \brief Getter for any partial summary files that should be merged (instead of reading input data)
+const path_vec & crh_input_spec::get_partial_summaries_to_merge() const {
+	return partial_summaries_to_merge;
+}
+
 /// \brief Setter for the input file from which data should be read
 crh_input_spec & crh_input_spec::set_input_file(const path &prm_input_file ///< The input file from which data should be read
                                                 ) {
@@ -93,6 +116,51 @@ crh_input_spec & crh_input_spec::set_input_hits_are_grouped(const bool &prm_inpu
 	return *this;
 }
 
+/// \brief Setter for the number of threads to use when parsing the input data
+crh_input_spec & crh_input_spec::set_num_threads(const size_t &prm_num_threads ///< The number of threads to use when parsing the input data
+                                                 ) {
+	num_threads = prm_num_threads;
+	return *this;
+}
+
+/// \brief Setter for whether to sort the input data by query_id before processing it (so it can be processed as grouped)
+crh_input_spec & crh_input_spec::set_sort_input_hits(const bool &prm_sort_input_hits ///< Whether to sort the input data by query_id before processing it (so it can be processed as grouped)
+                                                     ) {
+	sort_input_hits = prm_sort_input_hits;
+	return *this;
+}
+
+/// \brief Setter for the approximate size, in MB, of each run of input data to sort in memory when sorting the input data
+crh_input_spec & crh_input_spec::set_sort_run_mb(const size_t &prm_sort_run_mb ///< The approximate size, in MB, of each run of input data to sort in memory when sorting the input data
+                                                 ) {
+	sort_run_mb = prm_sort_run_mb;
+	return *this;
+}
+
+/// \brief Setter for any partial summary files that should be merged (instead of reading input data)
+crh_input_spec & crh_input_spec::set_partial_summaries_to_merge(const path_vec &prm_partial_summaries_to_merge ///< Any partial summary files that should be merged (instead of reading input data)
+                                                                ) {
+	partial_summaries_to_merge = prm_partial_summaries_to_merge;
+	return *this;
+}
+
+/// \brief Return whether the specified crh_input_spec specifies merging partial summaries (instead of reading input data)
+///
+/// \relates crh_input_spec
+bool cath::rslv::is_merging_partial_summaries(const crh_input_spec &prm_spec ///< The crh_input_spec to query
+                                              ) {
+	return ! prm_spec.get_partial_summaries_to_merge().empty();
+}
+
+/// \brief Return whether the hits will arrive grouped by query_id, either because the user has specified
+///        that they're pre-grouped or because they're being sorted before processing
+///
+/// \relates crh_input_spec
+bool cath::rslv::hits_arrive_grouped(const crh_input_spec &prm_spec ///< The crh_input_spec to query
+                                     ) {
+	return prm_spec.get_input_hits_are_grouped() || prm_spec.get_sort_input_hits();
+}
+
 /// \brief Generate a description of any problem that makes the specified crh_input_spec invalid
 ///        or none otherwise
 ///
@@ -103,5 +171,21 @@ str_opt cath::rslv::get_invalid_description(const crh_input_spec &prm_spec ///<
 		return "Cannot read from both a file and stdin"s;
 	}
 
+	if ( prm_spec.get_num_threads() == 0 ) {
+		return "Cannot parse the input data with zero threads"s;
+	}
+
+	if ( prm_spec.get_sort_run_mb() == 0 ) {
+		return "Cannot sort the input data in runs of zero MB"s;
+	}
+
+	if ( prm_spec.get_sort_input_hits() && prm_spec.get_input_hits_are_grouped() ) {
+		return "Cannot both sort the input data and specify that it's already grouped"s;
+	}
+
+	if ( is_merging_partial_summaries( prm_spec ) && ( prm_spec.get_input_file() || prm_spec.get_read_from_stdin() ) ) {
+		return "Cannot both merge partial summaries and read input data"s;
+	}
+
 	return none;
 }
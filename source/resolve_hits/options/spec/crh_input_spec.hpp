@@ -48,6 +48,18 @@ namespace cath {
 			/// \brief Whether the code can assume that the input data is pre-grouped by query_id
 			bool                  input_hits_are_grouped = DEFAULT_INPUT_HITS_ARE_GROUPED;
 
+			/// \brief The number of threads to use when parsing the input data
+			size_t                num_threads            = DEFAULT_NUM_THREADS;
+
+			/// \brief Whether to sort the input data by query_id before processing it (so it can be processed as grouped)
+			bool                  sort_input_hits        = DEFAULT_SORT_INPUT_HITS;
+
+			/// \brief The approximate size, in MB, of each run of input data to sort in memory when sorting the input data
+			size_t                sort_run_mb            = DEFAULT_SORT_RUN_MB;
+
+			/// \brief Any partial summary files that should be merged (instead of reading input data)
+			path_vec              partial_summaries_to_merge;
+
 		public:
 			/// \brief The default value for whether to read the input data from stdin
 			static constexpr bool                  DEFAULT_READ_FROM_STDIN        = false;
@@ -61,19 +73,40 @@ namespace cath {
 			/// \brief The default value for whether the code can assume that the input data is pre-grouped by query_id
 			static constexpr bool                  DEFAULT_INPUT_HITS_ARE_GROUPED = false;
 
+			/// \brief The default value for the number of threads to use when parsing the input data
+			static constexpr size_t                DEFAULT_NUM_THREADS            = 1;
+
+			/// \brief The default value for whether to sort the input data by query_id before processing it
+			static constexpr bool                  DEFAULT_SORT_INPUT_HITS        = false;
+
+			/// \brief The default value for the approximate size, in MB, of each run of input data to sort in memory
+			static constexpr size_t                DEFAULT_SORT_RUN_MB            = 256;
+
 			const path_opt & get_input_file() const;
 			const bool & get_read_from_stdin() const;
 			const hits_input_format_tag & get_input_format() const;
 			const seq::residx_t & get_min_gap_length() const;
 			const bool & get_input_hits_are_grouped() const;
+			const size_t & get_num_threads() const;
+			const bool & get_sort_input_hits() const;
+			const size_t & get_sort_run_mb() const;
+			const path_vec & get_partial_summaries_to_merge() const;
 
 			crh_input_spec & set_input_file(const boost::filesystem::path &);
 			crh_input_spec & set_read_from_stdin(const bool &);
 			crh_input_spec & set_input_format(const hits_input_format_tag &);
 			crh_input_spec & set_min_gap_length(const seq::residx_t &);
 			crh_input_spec & set_input_hits_are_grouped(const bool &);
+			crh_input_spec & set_num_threads(const size_t &);
+			crh_input_spec & set_sort_input_hits(const bool &);
+			crh_input_spec & set_sort_run_mb(const size_t &);
+			crh_input_spec & set_partial_summaries_to_merge(const path_vec &);
 		};
 
+		bool is_merging_partial_summaries(const crh_input_spec &);
+
+		bool hits_arrive_grouped(const crh_input_spec &);
+
 		str_opt get_invalid_description(const crh_input_spec &);
 
 	} // namespace rslv
@@ -64,6 +64,11 @@ const path_vec & crh_output_spec::get_summarise_files() const {
 	return summarise_files;
 }
 
+/// \brief Getter for any files to which a mergeable partial summary of the input should be output
+const path_vec & crh_output_spec::get_partial_summary_files() const {
+	return partial_summary_files;
+}
+
 /// \brief Getter for any files to which HTML should be output
 const path_vec & crh_output_spec::get_html_output_files() const {
 	return html_output_files;
@@ -112,6 +117,13 @@ crh_output_spec & crh_output_spec::set_summarise_files(const path_vec &prm_summa
 	return *this;
 }
 
+/// \brief Setter for any files to which a mergeable partial summary of the input should be output
+crh_output_spec & crh_output_spec::set_partial_summary_files(const path_vec &prm_partial_summary_files ///< Any files to which a mergeable partial summary of the input should be output
+                                                             ) {
+	partial_summary_files = prm_partial_summary_files;
+	return *this;
+}
+
 /// \brief Setter for any files to which HTML should be output
 crh_output_spec & crh_output_spec::set_html_output_files(const path_vec &prm_html_output_files ///< Any files to which HTML should be output
                                                          ) {
@@ -156,6 +168,21 @@ bool cath::rslv::has_hits_text_output(const crh_output_spec &prm_output_spec ///
 	return ! prm_output_spec.get_hits_text_files().empty();
 }
 
+/// \brief Return whether the specified crh_output_spec explicitly specifies any output files other than
+///        summary/partial-summary files (ie any output that requires the hits themselves rather than just a summary of them)
+///
+/// \relates crh_output_spec
+bool cath::rslv::has_non_summary_output_files(const crh_output_spec &prm_output_spec ///< The crh_output_spec to query
+                                              ) {
+	return (
+		! prm_output_spec.get_hits_text_files().empty()
+		||
+		! prm_output_spec.get_html_output_files().empty()
+		||
+		! prm_output_spec.get_json_output_files().empty()
+	);
+}
+
 /// \brief Return whether the specified crh_output_spec has any output files that match the specified file
 ///
 /// \relates crh_output_spec
@@ -163,13 +190,15 @@ bool cath::rslv::has_any_out_files_matching(const crh_output_spec &prm_output_sp
                                             const path            &prm_query_path   ///< The file being searched for
                                             ) {
 	return (
-		contains( prm_output_spec.get_hits_text_files(),   prm_query_path )
+		contains( prm_output_spec.get_hits_text_files(),       prm_query_path )
+		||
+		contains( prm_output_spec.get_summarise_files(),       prm_query_path )
 		||
-		contains( prm_output_spec.get_summarise_files(),   prm_query_path )
+		contains( prm_output_spec.get_partial_summary_files(), prm_query_path )
 		||
-		contains( prm_output_spec.get_html_output_files(), prm_query_path )
+		contains( prm_output_spec.get_html_output_files(),     prm_query_path )
 		||
-		contains( prm_output_spec.get_json_output_files(), prm_query_path )
+		contains( prm_output_spec.get_json_output_files(),     prm_query_path )
 		||
 		( prm_output_spec.get_export_css_file() == prm_query_path )
 	);
@@ -181,10 +210,11 @@ bool cath::rslv::has_any_out_files_matching(const crh_output_spec &prm_output_sp
 path_vec cath::rslv::get_all_output_paths(const crh_output_spec &prm_output_spec ///< The crh_output_spec to query
                                           ) {
 	path_vec the_paths;
-	append( the_paths, prm_output_spec.get_hits_text_files()   );
-	append( the_paths, prm_output_spec.get_summarise_files()   );
-	append( the_paths, prm_output_spec.get_html_output_files() );
-	append( the_paths, prm_output_spec.get_json_output_files() );
+	append( the_paths, prm_output_spec.get_hits_text_files()       );
+	append( the_paths, prm_output_spec.get_summarise_files()       );
+	append( the_paths, prm_output_spec.get_partial_summary_files() );
+	append( the_paths, prm_output_spec.get_html_output_files()     );
+	append( the_paths, prm_output_spec.get_json_output_files()     );
 	if ( prm_output_spec.get_export_css_file() ) {
 		the_paths.push_back( *prm_output_spec.get_export_css_file() );
 	}
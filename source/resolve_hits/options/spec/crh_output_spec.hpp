@@ -45,6 +45,9 @@ namespace cath {
 			/// \brief Any files to which a summary of the input should be output
 			path_vec            summarise_files;
 
+			/// \brief Any files to which a mergeable partial summary of the input should be output
+			path_vec            partial_summary_files;
+
 			/// \brief Any files to which HTML should be output
 			path_vec            html_output_files;
 
@@ -71,6 +74,7 @@ namespace cath {
 			const bool & get_quiet() const;
 			const hit_boundary_output & get_boundary_output() const;
 			const path_vec & get_summarise_files() const;
+			const path_vec & get_partial_summary_files() const;
 			const path_vec & get_html_output_files() const;
 			const path_vec & get_json_output_files() const;
 			const path_opt & get_export_css_file() const;
@@ -80,6 +84,7 @@ namespace cath {
 			crh_output_spec & set_quiet(const bool &);
 			crh_output_spec & set_boundary_output(const hit_boundary_output &);
 			crh_output_spec & set_summarise_files(const path_vec &);
+			crh_output_spec & set_partial_summary_files(const path_vec &);
 			crh_output_spec & set_html_output_files(const path_vec &);
 			crh_output_spec & set_json_output_files(const path_vec &);
 			crh_output_spec & set_export_css_file(const path_opt &);
@@ -90,6 +95,8 @@ namespace cath {
 
 		bool has_hits_text_output(const crh_output_spec &);
 
+		bool has_non_summary_output_files(const crh_output_spec &);
+
 		bool has_any_out_files_matching(const crh_output_spec &,
 		                                const boost::filesystem::path &);
 
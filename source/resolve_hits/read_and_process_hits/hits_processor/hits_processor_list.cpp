@@ -153,6 +153,7 @@ hits_processor_list cath::rslv::detail::make_hits_processors(ofstream_list
 	}
 	else {
 		const path_vec &summarise_files   = prm_output_spec.get_summarise_files();
+		const path_vec &partial_files     = prm_output_spec.get_partial_summary_files();
 		const path_vec &html_output_files = prm_output_spec.get_html_output_files();
 		const path_vec &json_output_files = prm_output_spec.get_json_output_files();
 		const path_vec  hits_text_files   = [&] {
@@ -169,6 +170,9 @@ hits_processor_list cath::rslv::detail::make_hits_processors(ofstream_list
 		if ( ! summarise_files.empty()   ) {
 			the_list.add_processor( make_unique< summarise_hits_processor     >( prm_ofstreams.open_ofstreams( summarise_files   )                ) );
 		}
+		if ( ! partial_files.empty()     ) {
+			the_list.add_processor( make_unique< summarise_hits_processor     >( prm_ofstreams.open_ofstreams( partial_files     ), hits_summary_format::PARTIAL ) );
+		}
 		if ( ! hits_text_files.empty() ) {
 			the_list.add_processor( make_unique< write_results_hits_processor >( prm_ofstreams.open_ofstreams( hits_text_files   ), bound_out     ) );
 		}
@@ -18,6 +18,7 @@
 /// You should have received a copy of the GNU General Public License
 /// along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/test/auto_unit_test.hpp>
 
 #include "resolve_hits/read_and_process_hits/hits_processor/summarise_hits_processor.hpp"
@@ -29,9 +30,11 @@
 
 namespace cath { namespace test { } }
 
+using namespace cath::rslv;
 using namespace cath::rslv::detail;
 using namespace cath::test;
 
+using std::istringstream;
 using std::ostream;
 using std::ostringstream;
 
@@ -84,4 +87,23 @@ BOOST_AUTO_TEST_SUITE_END()
 
 
 
+BOOST_AUTO_TEST_SUITE(summarise_without_hits)
+
+BOOST_AUTO_TEST_CASE(summarise_hits_processor_writes_nothing_for_summary_without_hits) {
+	summarise_hits_processor( ostreams ).finish_work();
+	BOOST_CHECK_EQUAL( test_ss.str(), "" );
+}
+
+BOOST_AUTO_TEST_CASE(summarise_hits_processor_writes_zero_counts_for_partial_summary_without_hits) {
+	summarise_hits_processor( ostreams, hits_summary_format::PARTIAL ).finish_work();
+	istringstream partial_iss{ test_ss.str() };
+	BOOST_CHECK( boost::algorithm::starts_with( test_ss.str(), "# cath-resolve-hits partial summary v1\n" ) );
+	BOOST_CHECK( read_partial_summary( partial_iss ) == hits_summary{} );
+	test_ss.str( "" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -20,29 +20,16 @@
 
 #include "summarise_hits_processor.hpp"
 
-#include <boost/format.hpp>
-#include <boost/lexical_cast.hpp>
-#include <boost/range/algorithm/max_element.hpp>
-#include <boost/range/algorithm/min_element.hpp>
-
-#include "common/boost_addenda/range/front.hpp"
 #include "common/clone/make_uptr_clone.hpp"
-#include "resolve_hits/full_hit_fns.hpp"
-#include "resolve_hits/full_hit_list.hpp"
+#include "resolve_hits/calc_hit_list.hpp"
 
 using namespace cath;
 using namespace cath::common;
+using namespace cath::rslv;
 using namespace cath::rslv::detail;
-using namespace std::literals::string_literals;
 
-using boost::format;
-using boost::numeric_cast;
-using boost::range::max_element;
-using boost::range::min_element;
 using std::move;
 using std::ostream;
-using std::right;
-using std::setw;
 using std::string;
 using std::unique_ptr;
 
@@ -60,77 +47,18 @@ void summarise_hits_processor::do_process_hits_for_query(const string
                                                          const crh_segment_spec &/*prm_segment_spec*/, ///< The segment spec to apply to the hits
                                                          const calc_hit_list    &prm_calc_hits         ///< The hits to process
                                                          ) {
-	const full_hit_list &full_hits = prm_calc_hits.get_full_hits();
-	if ( ! example_query_id_and_hit && ! full_hits.empty() ) {
-		example_query_id_and_hit = make_pair(
-			prm_query_id,
-			front( full_hits )
-		);
-	}
-
-	const auto max_stop_opt = get_max_stop( full_hits );
-	if ( max_stop_opt ) {
-		max_stops.push_back( *max_stop_opt );
-	}
-
-	num_hits += full_hits.size();
+	the_summary.add_query( prm_query_id, prm_calc_hits.get_full_hits() );
 }
 
-/// \brief Calculate the median of an unsorted bunch of size_t values
+/// \brief Write the summary to finish the work
 ///
-/// \TODO Move this into common/
-double median(size_vec &args ///< The bunch of unsorted size_t values for which to calculate the median
-              ) {
-	const size_t size      = args.size();
-	const size_t half_size = size / 2;
-	std::nth_element(
-		args.begin(),
-		args.begin() + numeric_cast<ptrdiff_t>( half_size ),
-		args.end()
-	);
-	const auto halfway_arg = numeric_cast<double>( args[ half_size ] );
-	if ( size % 2 == 1) {
-		return halfway_arg;
-	}
-
-	std::nth_element(
-		args.begin(),
-		args.begin() + numeric_cast<ptrdiff_t>( half_size ) - 1,
-		args.end()
-	);
-	return 0.5 * ( halfway_arg + numeric_cast<double>( args[ half_size - 1 ] ) );
-}
-
-/// \brief Write the HTML suffix to finish the work (if it has been started)
+/// A partial summary is always written (with zero counts if no hits have been processed) so that
+/// every shard's output can be merged but, as before, the human-readable summary is only written
+/// if some hits have been processed
 void summarise_hits_processor::do_finish_work() {
-	if ( num_hits > 0 ) {
+	if ( summary_format == hits_summary_format::PARTIAL || the_summary.get_num_hits() > 0 ) {
 		for (const ostream_ref &ostream_ref : get_ostreams() ) {
-			ostream_ref.get()
-				<< "Summary of input data\n"
-				<< "---------------------\n"
-				<< " * Number of queries : " << right << setw( 6 ) << max_stops.size() << " (excludes any queries with no hits)\n"
-				<< " * Number of hits    : " << right << setw( 6 ) << num_hits
-				<< " (ie an average of " << ( numeric_cast<double>( num_hits ) / numeric_cast<double>( max_stops.size() ) ) << " per query)\n"
-				<< " * Minimum max-stop  : " << right << setw( 6 ) << ( max_stops.empty() ? "<N/A>" : std::to_string( *min_element( max_stops ) ) ) << "\n"
-				<< " * Median  max-stop  : "
-				<< (
-					max_stops.empty()
-						? " <N/A>"
-						: ( format( "%8.1f" ) % median( max_stops ) ).str()
-				)
-				<< "\n"
-				<< " * Maximum max-stop  : " << right << setw( 6 ) << ( max_stops.empty() ? "<N/A>" : std::to_string( *max_element( max_stops ) ) ) << "\n"
-				<< " * Example hit       :\n"
-				<< (
-					example_query_id_and_hit
-					?
-						  "    * Query ID : " + example_query_id_and_hit->first                         + "\n"
-						+ "    * Match ID : " + example_query_id_and_hit->second.get_label()            + "\n"
-						+ "    * Score    : " + get_score_string   ( example_query_id_and_hit->second ) + "\n"
-						+ "    * Segments : " + get_segments_string( example_query_id_and_hit->second ) + "\n"
-					:
-						""
-				);
+			write_hits_summary( ostream_ref.get(), the_summary, summary_format );
 		}
 	}
 }
@@ -146,6 +74,8 @@ bool summarise_hits_processor::do_requires_strictly_worse_hits() const {
 }
 
 /// \brief Ctor for the summarise_hits_processor
-summarise_hits_processor::summarise_hits_processor(ref_vec<ostream> prm_ostreams ///< The ostream to which the results should be written
-                                                   ) noexcept : super{ move( prm_ostreams ) } {
+summarise_hits_processor::summarise_hits_processor(ref_vec<ostream>           prm_ostreams,      ///< The ostream to which the results should be written
+                                                   const hits_summary_format &prm_summary_format ///< The format in which the summary should be written
+                                                   ) noexcept : super         { move( prm_ostreams ) },
+                                                                summary_format{ prm_summary_format     } {
 }
@@ -21,7 +21,7 @@
 #ifndef _CATH_TOOLS_SOURCE_RESOLVE_HITS_READ_AND_PROCESS_HITS_HITS_PROCESSOR_SUMMARISE_HITS_PROCESSOR_HPP
 #define _CATH_TOOLS_SOURCE_RESOLVE_HITS_READ_AND_PROCESS_HITS_HITS_PROCESSOR_SUMMARISE_HITS_PROCESSOR_HPP
 
-#include "resolve_hits/full_hit.hpp"
+#include "resolve_hits/hits_summary.hpp"
 #include "resolve_hits/read_and_process_hits/hits_processor/hits_processor.hpp"
 
 namespace cath {
@@ -29,19 +29,19 @@ namespace cath {
 		namespace detail {
 
 			/// \brief A hits_processor to summarise the input data
+			///
+			/// This can either write the final summary or write a partial summary that can
+			/// later be merged with partial summaries of other chunks of the data
 			class summarise_hits_processor final : public hits_processor {
 			private:
 				/// \brief Convenience type alias for the parent class
 				using super = hits_processor;
 
-				/// \brief For each query, record the maximum stop of the hits
-				size_vec max_stops;
+				/// \brief The summary of the data processed so far
+				hits_summary the_summary;
 
-				/// \brief Record the number of hits
-				size_t num_hits = 0;
-
-				/// \brief Record an example query_id/full_hit pair
-				str_full_hit_pair_opt example_query_id_and_hit;
+				/// \brief The format in which the summary should be written
+				hits_summary_format summary_format = hits_summary_format::SUMMARY;
 
 				std::unique_ptr<hits_processor> do_clone() const final;
 
@@ -58,7 +58,8 @@ namespace cath {
 				bool do_requires_strictly_worse_hits() const final;
 
 			public:
-				explicit summarise_hits_processor(ref_vec<std::ostream>) noexcept;
+				explicit summarise_hits_processor(ref_vec<std::ostream>,
+				                                  const hits_summary_format & = hits_summary_format::SUMMARY) noexcept;
 			};
 
 
@@ -60,8 +60,13 @@ void write_html_hits_processor::do_process_hits_for_query(const string
 	}
 
 	// Output the HTML for this query and its hits
-	for (const ostream_ref &ostream_ref : get_ostreams() ) {
-		ostream_ref.get() << resolve_hits_html_outputter::output_html(
+	//
+	// When there's only one ostream, stream the HTML straight to it rather than building
+	// it in a string; otherwise build it once and write it to each of the ostreams
+	const auto &the_ostreams = get_ostreams();
+	if ( the_ostreams.size() == 1 ) {
+		resolve_hits_html_outputter::write_html(
+			the_ostreams.front().get(),
 			prm_query_id,
 			prm_calc_hits,
 			prm_score_spec,
@@ -72,6 +77,21 @@ void write_html_hits_processor::do_process_hits_for_query(const string
 			batch_counter
 		);
 	}
+	else if ( ! the_ostreams.empty() ) {
+		const string html_str = resolve_hits_html_outputter::output_html(
+			prm_query_id,
+			prm_calc_hits,
+			prm_score_spec,
+			prm_segment_spec,
+			html_spec,
+			false,
+			prm_filter_spec,
+			batch_counter
+		);
+		for (const ostream_ref &ostream_ref : the_ostreams ) {
+			ostream_ref.get() << html_str;
+		}
+	}
 	++batch_counter;
 }
 
@@ -24,12 +24,14 @@
 #include "common/exception/out_of_range_exception.hpp"
 #include "resolve_hits/calc_hit_list.hpp"
 #include "resolve_hits/full_hit_list_fns.hpp"
+#include "resolve_hits/full_hit_rapidjson.hpp"
 #include "resolve_hits/resolve/hit_resolver.hpp"
 #include "resolve_hits/scored_hit_arch.hpp"
 
 using namespace cath::common;
 using namespace cath::rslv::detail;
 
+using boost::make_optional;
 using std::move;
 using std::ostream;
 using std::string;
@@ -61,9 +63,10 @@ void write_json_hits_processor::do_process_hits_for_query(const string
 		prm_calc_hits.get_full_hits()
 	);
 
-	// Output the results to prm_ostream
+	// Output the results to the ostreams, hit by hit, rather than first rendering
+	// the whole list of hits to a string
 	json_writers.write_key( prm_query_id );
-	json_writers.write_raw_string( to_json_string_with_compact_fullhits( result_full_hits, prm_segment_spec, 1 ) );
+	write_to_rapidjson_with_compact_fullhits( json_writers, result_full_hits, make_optional( prm_segment_spec ) );
 }
 
 /// \brief Do nothing to finish the batch of work
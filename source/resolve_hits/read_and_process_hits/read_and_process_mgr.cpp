@@ -113,7 +113,7 @@ read_and_process_mgr cath::rslv::make_read_and_process_mgr(const hits_processor
 	return read_and_process_mgr{
 		hits_processor_list{ prm_crh_score_spec, prm_crh_segment_spec, { prm_hits_processor.clone() } },
 		prm_filter_spec,
-		prm_input_spec.get_input_hits_are_grouped()
+		hits_arrive_grouped( prm_input_spec )
 	};
 }
 
@@ -141,7 +141,7 @@ read_and_process_mgr cath::rslv::make_read_and_process_mgr(const hits_processor_
 	return read_and_process_mgr{
 		prm_hits_processors,
 		prm_spec.get_filter_spec(),
-		prm_spec.get_input_spec().get_input_hits_are_grouped()
+		hits_arrive_grouped( prm_spec.get_input_spec() )
 	};
 }
 
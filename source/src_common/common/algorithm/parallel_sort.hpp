@@ -0,0 +1,115 @@
+/// \file
+/// \brief The parallel_sort header
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_SRC_COMMON_COMMON_ALGORITHM_PARALLEL_SORT_HPP
+#define _CATH_TOOLS_SOURCE_SRC_COMMON_COMMON_ALGORITHM_PARALLEL_SORT_HPP
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace cath {
+	namespace common {
+
+		/// \brief The minimum number of elements per thread for which parallel_sort() will use multiple threads
+		///        (below this, the cost of the threads and the merges outweighs the benefit)
+		constexpr size_t PARALLEL_SORT_MIN_ELEMENTS_PER_THREAD = 32768;
+
+		/// \brief Sort the specified range with the specified less-than predicate, using up to the specified number of threads
+		///
+		/// This splits the range into equal chunks, sorts each chunk in its own thread and then merges
+		/// neighbouring pairs of chunks (in parallel) until the whole range is merged.
+		///
+		/// As with std::sort(), the order of equivalent elements is unspecified.
+		template <typename R, typename P>
+		void parallel_sort(R            &prm_range,      ///< The range to sort
+		                   P             prm_bin_pred,   ///< The binary predicate to use as a less-than operator for sorting
+		                   const size_t &prm_num_threads ///< The maximum number of threads to use
+		                   ) {
+			const auto   begin_itr    = boost::begin( prm_range );
+			const auto   end_itr      = boost::end  ( prm_range );
+			const size_t num_elements = static_cast<size_t>( std::distance( begin_itr, end_itr ) );
+			const size_t num_chunks   = std::min( prm_num_threads, num_elements / PARALLEL_SORT_MIN_ELEMENTS_PER_THREAD );
+			if ( num_chunks <= 1 ) {
+				std::sort( begin_itr, end_itr, prm_bin_pred );
+				return;
+			}
+
+			// Calculate the boundaries of the chunks and sort each chunk in its own thread
+			using itr_type = std::decay_t<decltype( begin_itr )>;
+			std::vector<itr_type> boundaries;
+			boundaries.reserve( num_chunks + 1 );
+			for (size_t chunk_ctr = 0; chunk_ctr <= num_chunks; ++chunk_ctr) {
+				boundaries.push_back( std::next( begin_itr, static_cast<std::ptrdiff_t>( ( chunk_ctr * num_elements ) / num_chunks ) ) );
+			}
+			std::vector<std::future<void>> futures;
+			futures.reserve( num_chunks );
+			for (size_t chunk_ctr = 0; chunk_ctr < num_chunks; ++chunk_ctr) {
+				futures.push_back( std::async(
+					std::launch::async,
+					[&, chunk_ctr] { std::sort( boundaries[ chunk_ctr ], boundaries[ chunk_ctr + 1 ], prm_bin_pred ); }
+				) );
+			}
+			for (std::future<void> &the_future : futures) {
+				the_future.get();
+			}
+
+			// Repeatedly merge neighbouring pairs of sorted chunks until one chunk remains
+			while ( boundaries.size() > 2 ) {
+				std::vector<itr_type> merged_boundaries;
+				futures.clear();
+				for (size_t boundary_ctr = 0; boundary_ctr + 1 < boundaries.size(); boundary_ctr += 2) {
+					merged_boundaries.push_back( boundaries[ boundary_ctr ] );
+					if ( boundary_ctr + 2 < boundaries.size() ) {
+						futures.push_back( std::async(
+							std::launch::async,
+							[&, boundary_ctr] {
+								std::inplace_merge( boundaries[ boundary_ctr ], boundaries[ boundary_ctr + 1 ], boundaries[ boundary_ctr + 2 ], prm_bin_pred );
+							}
+						) );
+					}
+				}
+				merged_boundaries.push_back( boundaries.back() );
+				for (std::future<void> &the_future : futures) {
+					the_future.get();
+				}
+				boundaries = std::move( merged_boundaries );
+			}
+		}
+
+		/// \overload
+		template <typename R>
+		void parallel_sort(R            &prm_range,      ///< The range to sort
+		                   const size_t &prm_num_threads ///< The maximum number of threads to use
+		                   ) {
+			parallel_sort( prm_range, std::less<>{}, prm_num_threads );
+		}
+
+	} // namespace common
+} // namespace cath
+
+#endif
@@ -0,0 +1,84 @@
+/// \file
+/// \brief The parallel_sort test suite
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "parallel_sort.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include "common/size_t_literal.hpp"
+
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace cath::common;
+
+using std::greater;
+using std::mt19937;
+using std::sort;
+using std::uniform_int_distribution;
+using std::vector;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The parallel_sort_test_suite_fixture to assist in testing parallel_sort
+		struct parallel_sort_test_suite_fixture {
+		protected:
+			~parallel_sort_test_suite_fixture() noexcept = default;
+
+			/// \brief Make a vector of the specified number of pseudo-random ints, with plenty of repeats
+			static vector<int> make_random_ints(const size_t &prm_num_ints ///< The number of ints to make
+			                                    ) {
+				mt19937 rng{ 42 };
+				uniform_int_distribution<int> dist{ 0, 1000 };
+				vector<int> ints;
+				ints.reserve( prm_num_ints );
+				for (size_t int_ctr = 0; int_ctr < prm_num_ints; ++int_ctr) {
+					ints.push_back( dist( rng ) );
+				}
+				return ints;
+			}
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(parallel_sort_test_suite, cath::test::parallel_sort_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(sorts_small_range_in_one_thread) {
+	vector<int>       ints     = { 3, 1, 2 };
+	const vector<int> expected = { 1, 2, 3 };
+	parallel_sort( ints, 4 );
+	BOOST_CHECK_EQUAL_COLLECTIONS( ints.begin(), ints.end(), expected.begin(), expected.end() );
+}
+
+BOOST_AUTO_TEST_CASE(sorts_large_range_like_sort) {
+	const vector<int> orig_ints = make_random_ints( 7 * PARALLEL_SORT_MIN_ELEMENTS_PER_THREAD + 11 );
+	vector<int> expected = orig_ints;
+	sort( expected.begin(), expected.end(), greater<int>{} );
+	for (const size_t &num_threads : { 1_z, 2_z, 3_z, 4_z, 7_z } ) {
+		vector<int> got = orig_ints;
+		parallel_sort( got, greater<int>{}, num_threads );
+		BOOST_CHECK( got == expected );
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
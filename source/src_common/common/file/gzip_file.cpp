@@ -0,0 +1,274 @@
+/// \file
+/// \brief The gzip_file definitions
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gzip_file.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+
+#include "common/exception/runtime_error_exception.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+
+using namespace cath::common;
+
+using boost::algorithm::to_lower_copy;
+using boost::filesystem::file_size;
+using boost::filesystem::is_regular_file;
+using boost::filesystem::path;
+using boost::iostreams::array_source;
+using boost::iostreams::file_source;
+using boost::iostreams::filtering_istream;
+using boost::iostreams::gzip_decompressor;
+using boost::iostreams::mapped_file_source;
+using boost::string_ref;
+using boost::system::error_code;
+using std::ifstream;
+using std::string;
+using std::vector;
+
+namespace cath {
+	namespace common {
+		namespace detail {
+
+			/// \brief The size of a gzip member's fixed header
+			constexpr size_t GZIP_HEADER_SIZE = 10;
+
+			/// \brief The gzip header flag indicating the presence of an extra field (as used by BGZF)
+			constexpr unsigned char GZIP_FLAG_FEXTRA = 4;
+
+			/// \brief Read a little-endian 16-bit unsigned integer from the specified position in the specified data
+			inline size_t read_little_endian_uint16(const string_ref &prm_data, ///< The data from which to read
+			                                        const size_t     &prm_index ///< The index of the first byte
+			                                        ) {
+				return static_cast<size_t>( static_cast<unsigned char>( prm_data[ prm_index     ] ) )
+				    + ( static_cast<size_t>( static_cast<unsigned char>( prm_data[ prm_index + 1 ] ) ) << 8 );
+			}
+
+			/// \brief Get the size of the BGZF block at the start of the specified data or 0 if it doesn't start with one
+			///
+			/// A BGZF block is a complete gzip member with a "BC" extra subfield holding the block's size, minus one
+			inline size_t bgzf_block_size(const string_ref &prm_data ///< The data to query
+			                              ) {
+				if ( prm_data.length() < GZIP_HEADER_SIZE + 2 || ! is_gzip_data( prm_data ) ) {
+					return 0;
+				}
+				if ( ( static_cast<unsigned char>( prm_data[ 3 ] ) & GZIP_FLAG_FEXTRA ) == 0 ) {
+					return 0;
+				}
+				const size_t extra_length = read_little_endian_uint16( prm_data, GZIP_HEADER_SIZE );
+				const size_t extra_end    = GZIP_HEADER_SIZE + 2 + extra_length;
+				if ( extra_end > prm_data.length() ) {
+					return 0;
+				}
+				size_t subfield_index = GZIP_HEADER_SIZE + 2;
+				while ( subfield_index + 4 <= extra_end ) {
+					const size_t subfield_length = read_little_endian_uint16( prm_data, subfield_index + 2 );
+					if ( prm_data[ subfield_index ] == 'B' && prm_data[ subfield_index + 1 ] == 'C' && subfield_length == 2 && subfield_index + 6 <= extra_end ) {
+						return read_little_endian_uint16( prm_data, subfield_index + 4 ) + 1;
+					}
+					subfield_index += 4 + subfield_length;
+				}
+				return 0;
+			}
+
+			/// \brief Decompress the specified gzip data (which may contain several concatenated members), appending to the specified string
+			///
+			/// \throws runtime_error_exception if the data can't be decompressed
+			inline void append_decompressed_gzip_data(string           &prm_result, ///< The string to which the decompressed data should be appended
+			                                          const string_ref &prm_data    ///< The gzip data to decompress
+			                                          ) {
+				try {
+					filtering_istream decompress_stream;
+					decompress_stream.push( gzip_decompressor{} );
+					decompress_stream.push( array_source{ prm_data.data(), prm_data.length() } );
+					boost::iostreams::copy( decompress_stream, boost::iostreams::back_inserter( prm_result ) );
+				}
+				catch (const std::exception &ex) {
+					BOOST_THROW_EXCEPTION(runtime_error_exception(
+						"Unable to decompress gzip data [" + string{ ex.what() } + "]"
+					));
+				}
+			}
+
+		} // namespace detail
+	} // namespace common
+} // namespace cath
+
+/// \brief Whether the specified data starts with the gzip magic number
+bool cath::common::is_gzip_data(const string_ref &prm_data ///< The data to query
+                                ) {
+	return prm_data.length() >= 2
+		&& static_cast<unsigned char>( prm_data[ 0 ] ) == 0x1F
+		&& static_cast<unsigned char>( prm_data[ 1 ] ) == 0x8B;
+}
+
+/// \brief Whether the specified file is a regular file that starts with the gzip magic number
+///
+/// This checks the contents rather than the extension so that it also catches compressed
+/// files with uninformative names (eg the entries in a local PDB mirror)
+bool cath::common::is_gzip_file(const path &prm_file ///< The file to query
+                                ) {
+	error_code error;
+	if ( ! is_regular_file( prm_file, error ) || error ) {
+		return false;
+	}
+	ifstream input_stream( prm_file.string(), std::ios::binary );
+	char magic[ 2 ] = { 0, 0 };
+	input_stream.read( &magic[ 0 ], 2 );
+	return input_stream.gcount() == 2 && is_gzip_data( string_ref{ &magic[ 0 ], 2 } );
+}
+
+/// \brief Split the specified data into its BGZF blocks or return an empty list if it isn't BGZF data
+///
+/// BGZF (as produced by bgzip) is a series of independent gzip members of at most 64KiB, each of
+/// which records its own size. That makes it possible to find all the blocks without decompressing
+/// any of them and then to decompress them in parallel.
+string_ref_vec cath::common::bgzf_blocks_of_data(const string_ref &prm_data ///< The data to split
+                                                 ) {
+	string_ref_vec blocks;
+	string_ref remaining = prm_data;
+	while ( ! remaining.empty() ) {
+		const size_t block_size = detail::bgzf_block_size( remaining );
+		if ( block_size == 0 || block_size > remaining.length() ) {
+			return {};
+		}
+		blocks.push_back( remaining.substr( 0, block_size ) );
+		remaining.remove_prefix( block_size );
+	}
+	return blocks;
+}
+
+/// \brief Decompress the specified gzip data
+///
+/// If the data is BGZF, its blocks are shared between up to the specified number of threads,
+/// each of which decompresses a contiguous run of blocks. Otherwise, the data's decompressed on this thread.
+///
+/// \throws runtime_error_exception if the data can't be decompressed
+string cath::common::decompress_gzip_data(const string_ref &prm_data,       ///< The gzip data to decompress
+                                          const size_t     &prm_num_threads ///< The maximum number of threads to use
+                                          ) {
+	const string_ref_vec blocks = bgzf_blocks_of_data( prm_data );
+	const size_t num_threads = std::min( std::max( prm_num_threads, static_cast<size_t>( 1 ) ), blocks.size() );
+
+	if ( num_threads <= 1 ) {
+		string result;
+		detail::append_decompressed_gzip_data( result, prm_data );
+		return result;
+	}
+
+	// Decompress contiguous runs of blocks concurrently and then concatenate the results in order
+	vector<std::future<string>> decompressed_runs;
+	decompressed_runs.reserve( num_threads );
+	for (size_t thread_ctr = 0; thread_ctr < num_threads; ++thread_ctr) {
+		const size_t begin_block = ( blocks.size() *   thread_ctr       ) / num_threads;
+		const size_t end_block   = ( blocks.size() * ( thread_ctr + 1 ) ) / num_threads;
+		decompressed_runs.push_back( std::async(
+			std::launch::async,
+			[&, begin_block, end_block] {
+				string run_result;
+				for (size_t block_ctr = begin_block; block_ctr < end_block; ++block_ctr) {
+					detail::append_decompressed_gzip_data( run_result, blocks[ block_ctr ] );
+				}
+				return run_result;
+			}
+		) );
+	}
+	string result;
+	for (std::future<string> &decompressed_run : decompressed_runs) {
+		result += decompressed_run.get();
+	}
+	return result;
+}
+
+/// \brief Read the contents of the specified file, decompressing them if they're gzipped
+///
+/// The file is memory-mapped so that gzipped data is decompressed directly from the mapping.
+///
+/// \throws runtime_error_exception if the file can't be read or decompressed
+string cath::common::read_decompressed_file(const path   &prm_file,       ///< The file to read
+                                            const size_t &prm_num_threads ///< The maximum number of threads to use to decompress BGZF data
+                                            ) {
+	try {
+		if ( file_size( prm_file ) == 0 ) {
+			return {};
+		}
+		const mapped_file_source mapped_file{ prm_file.string() };
+		const string_ref         contents   { mapped_file.data(), mapped_file.size() };
+		return is_gzip_data( contents ) ? decompress_gzip_data( contents, prm_num_threads )
+		                                : contents.to_string();
+	}
+	// Catch and immediately rethrow any boost::exceptions
+	// (so that it won't get caught in the next block if it's a std::exception)
+	catch (const boost::exception &ex) {
+		throw;
+	}
+	// Catch any I/O exceptions
+	catch (const std::exception &ex) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			  "Cannot read file \""
+			+ prm_file.string()
+			+ "\" ["
+			+ ex.what()
+			+ "]"
+		));
+	}
+}
+
+/// \brief Get the specified path without any gzip extension (".gz" or ".bgz", case-insensitively)
+///
+/// This allows the format of a compressed file to be determined from its name (eg "1abc.cif.gz" -> "1abc.cif")
+path cath::common::strip_gzip_extension(const path &prm_file ///< The path to strip
+                                        ) {
+	const string extension = to_lower_copy( prm_file.extension().string() );
+	return ( extension == ".gz" || extension == ".bgz" ) ? prm_file.parent_path() / prm_file.stem()
+	                                                     : prm_file;
+}
+
+/// \brief Open the specified file for reading via the specified filtering_istream,
+///        decompressing it on the fly if it's gzipped
+///
+/// This streams the data, so it's suited to files that are read line-by-line
+///
+/// \throws runtime_error_exception if the file can't be opened
+void cath::common::open_decompressing_istream(filtering_istream &prm_istream, ///< The filtering_istream to set up (which should be empty)
+                                              const path        &prm_file     ///< The file to open
+                                              ) {
+	const bool is_gzip = is_gzip_file( prm_file );
+	const file_source the_file_source{ prm_file.string(), std::ios::in | std::ios::binary };
+	if ( ! the_file_source.is_open() ) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			"Cannot open file \"" + prm_file.string() + "\" for reading"
+		));
+	}
+	if ( is_gzip ) {
+		prm_istream.push( gzip_decompressor{} );
+	}
+	prm_istream.push( the_file_source );
+	prm_istream.exceptions( std::ios::badbit );
+}
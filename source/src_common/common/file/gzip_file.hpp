@@ -0,0 +1,56 @@
+/// \file
+/// \brief The gzip_file header
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_SRC_COMMON_COMMON_FILE_GZIP_FILE_HPP
+#define _CATH_TOOLS_SOURCE_SRC_COMMON_COMMON_FILE_GZIP_FILE_HPP
+
+#include <boost/filesystem/path.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cath {
+	namespace common {
+
+		/// \brief Type alias for a vector of string_ref values
+		using string_ref_vec = std::vector<boost::string_ref>;
+
+		bool is_gzip_data(const boost::string_ref &);
+		bool is_gzip_file(const boost::filesystem::path &);
+
+		string_ref_vec bgzf_blocks_of_data(const boost::string_ref &);
+
+		std::string decompress_gzip_data(const boost::string_ref &,
+		                                 const size_t & = 1);
+
+		std::string read_decompressed_file(const boost::filesystem::path &,
+		                                   const size_t & = 1);
+
+		boost::filesystem::path strip_gzip_extension(const boost::filesystem::path &);
+
+		void open_decompressing_istream(boost::iostreams::filtering_istream &,
+		                                const boost::filesystem::path &);
+
+	} // namespace common
+} // namespace cath
+
+#endif
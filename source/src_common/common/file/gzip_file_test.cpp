@@ -0,0 +1,118 @@
+/// \file
+/// \brief The gzip_file test suite
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/file/gzip_file.hpp"
+#include "common/file/slurp.hpp"
+#include "common/size_t_literal.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <string>
+
+using namespace cath::common;
+
+using boost::filesystem::path;
+using boost::iostreams::filtering_istream;
+using boost::string_ref;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The gzip_file_test_suite_fixture to assist in testing gzip_file
+		struct gzip_file_test_suite_fixture : protected global_test_constants {
+		protected:
+			~gzip_file_test_suite_fixture() noexcept = default;
+
+			/// \brief The uncompressed file
+			const path uncompressed_file = TEST_SOURCE_DATA_DIR() / "1c0pA01";
+
+			/// \brief A plain gzipped version of uncompressed_file
+			const path gzip_file         = TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.gz";
+
+			/// \brief A BGZF version of uncompressed_file, in several blocks
+			const path bgzf_file         = TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.bgz";
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(gzip_file_test_suite, cath::test::gzip_file_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(detects_gzip_data_and_files) {
+	BOOST_CHECK(   is_gzip_data( string_ref{ "\x1f\x8b\x08", 3 } ) );
+	BOOST_CHECK( ! is_gzip_data( string_ref{ "\x1f",         1 } ) );
+	BOOST_CHECK( ! is_gzip_data( string_ref{ "ATOM  "          } ) );
+
+	BOOST_CHECK(   is_gzip_file( gzip_file                                ) );
+	BOOST_CHECK(   is_gzip_file( bgzf_file                                ) );
+	BOOST_CHECK( ! is_gzip_file( uncompressed_file                        ) );
+	BOOST_CHECK( ! is_gzip_file( TEST_SOURCE_DATA_DIR()                   ) );
+	BOOST_CHECK( ! is_gzip_file( TEST_SOURCE_DATA_DIR() / "does_not_exist" ) );
+}
+
+BOOST_AUTO_TEST_CASE(finds_bgzf_blocks_only_in_bgzf_data) {
+	const string bgzf_data = slurp( bgzf_file );
+	const string gzip_data = slurp( gzip_file );
+	BOOST_CHECK_GT( bgzf_blocks_of_data( bgzf_data ).size(), 2 );
+	BOOST_CHECK   ( bgzf_blocks_of_data( gzip_data ).empty()   );
+
+	// A truncated BGZF file isn't treated as BGZF
+	BOOST_CHECK( bgzf_blocks_of_data( string_ref{ bgzf_data }.substr( 0, bgzf_data.length() - 1 ) ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE(decompresses_gzip_and_bgzf_files_with_any_number_of_threads) {
+	const string expected = slurp( uncompressed_file );
+	for (const size_t &num_threads : { 0_z, 1_z, 2_z, 3_z, 8_z, 1000_z } ) {
+		BOOST_TEST_CONTEXT( "with " << num_threads << " threads" ) {
+			BOOST_CHECK( read_decompressed_file( gzip_file,         num_threads ) == expected );
+			BOOST_CHECK( read_decompressed_file( bgzf_file,         num_threads ) == expected );
+			BOOST_CHECK( read_decompressed_file( uncompressed_file, num_threads ) == expected );
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(streams_gzipped_and_uncompressed_files) {
+	for (const path &file : { uncompressed_file, gzip_file, bgzf_file } ) {
+		filtering_istream input_stream;
+		open_decompressing_istream( input_stream, file );
+		string first_line;
+		getline( input_stream, first_line );
+		BOOST_CHECK_EQUAL( first_line.substr( 0, 6 ), "ATOM  " );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(strips_gzip_extensions) {
+	BOOST_CHECK_EQUAL( strip_gzip_extension( "dir/1abc.cif.gz" ), path{ "dir/1abc.cif" } );
+	BOOST_CHECK_EQUAL( strip_gzip_extension( "1abc.GZ"         ), path{ "1abc"         } );
+	BOOST_CHECK_EQUAL( strip_gzip_extension( "1abc.bgz"        ), path{ "1abc"         } );
+	BOOST_CHECK_EQUAL( strip_gzip_extension( "1abc.pdb"        ), path{ "1abc.pdb"     } );
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_corrupt_or_missing_files) {
+	BOOST_CHECK_THROW( decompress_gzip_data( string_ref{ "\x1f\x8b\x08\x00garbage", 11 } ),                  runtime_error_exception );
+	BOOST_CHECK_THROW( read_decompressed_file( TEST_SOURCE_DATA_DIR() / "does_not_exist" ),                   runtime_error_exception );
+	filtering_istream input_stream;
+	BOOST_CHECK_THROW( open_decompressing_istream( input_stream, TEST_SOURCE_DATA_DIR() / "does_not_exist" ), runtime_error_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,8 +20,12 @@
 
 #include "ofstream_list.hpp"
 
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+
 #include "common/algorithm/transform_build.hpp"
 #include "common/exception/out_of_range_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
 #include "common/file/open_fstream.hpp"
 
 #include <fstream>
@@ -30,6 +34,10 @@ using namespace cath;
 using namespace cath::common;
 
 using boost::filesystem::path;
+using boost::iostreams::file_sink;
+using boost::iostreams::filtering_ostream;
+using boost::iostreams::gzip_compressor;
+using std::ios_base;
 using std::ofstream;
 using std::ostream;
 
@@ -49,6 +57,20 @@ ostream_ref_vec ofstream_list::open_ofstreams(const path_vec &prm_paths ///< The
 			if ( the_path == standard_outstream_flag && standard_outstream ) {
 				return *standard_outstream;
 			}
+			else if ( is_gzip_path( the_path ) ) {
+				const file_sink the_sink{ the_path.string(), ios_base::out | ios_base::binary };
+				if ( ! the_sink.is_open() ) {
+					BOOST_THROW_EXCEPTION(runtime_error_exception(
+						"Unable to open file \""
+						+ the_path.string()
+						+ "\" for gzip-compressed writing"
+					));
+				}
+				gzip_ostreams.emplace_back();
+				gzip_ostreams.back().push( gzip_compressor{} );
+				gzip_ostreams.back().push( the_sink );
+				return { gzip_ostreams.back() };
+			}
 			else {
 				ofstreams.emplace_back();
 				open_ofstream( ofstreams.back(), the_path );
@@ -64,10 +86,23 @@ const path & ofstream_list::get_flag() const {
 }
 
 /// \brief Close all ofstreams
+///
+/// This also flushes and closes any gzip-compressing ostreams, which writes their gzip footers
 void ofstream_list::close_all() {
 	for (ofstream &the_ofstream: ofstreams) {
 		the_ofstream.close();
 	}
+	for (filtering_ostream &the_gzip_ostream : gzip_ostreams) {
+		the_gzip_ostream.reset();
+	}
+}
+
+/// \brief Whether the specified path should be written with gzip compression (ie has a ".gz" extension)
+///
+/// \relates ofstream_list
+bool cath::common::is_gzip_path(const path &prm_path ///< The path to examine
+                                ) {
+	return ( prm_path.extension() == ".gz" );
 }
 
 /// \brief Open a single path and add it to the outputs in the specified ofstream_list
@@ -22,11 +22,13 @@
 #define _CATH_TOOLS_SOURCE_SRC_COMMON_COMMON_FILE_OFSTREAM_LIST_HPP
 
 #include <boost/filesystem.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/optional.hpp>
 
 #include "common/path_type_aliases.hpp"
 #include "common/type_aliases.hpp"
 
+#include <deque>
 #include <fstream>
 #include <functional>
 
@@ -39,6 +41,8 @@ namespace cath {
 		/// \brief A list of ostreams, with support for populating from paths, which get automatically opened,
 		///        and a special flag which indicates output to the ostream optionally specified on construction
 		///
+		/// Paths with a ".gz" extension are written through a gzip compressor.
+		///
 		/// Note: this has substantial overlap with path_or_istream and could perhaps share a common implementation
 		class ofstream_list {
 		private:
@@ -51,6 +55,9 @@ namespace cath {
 			/// \brief The standard list of ofstreams to which output should be sent
 			std::deque<std::ofstream> ofstreams;
 
+			/// \brief The list of gzip-compressing ostreams to which output should be sent
+			std::deque<boost::iostreams::filtering_ostream> gzip_ostreams;
+
 		public:
 			ofstream_list() = default;
 
@@ -62,6 +69,8 @@ namespace cath {
 			void close_all();
 		};
 
+		bool is_gzip_path(const boost::filesystem::path &);
+
 		ostream_ref open_ofstream(ofstream_list &,
 		                          const boost::filesystem::path &);
 
@@ -18,6 +18,9 @@
 /// You should have received a copy of the GNU General Public License
 /// along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/test/auto_unit_test.hpp>
 
 #include "common/file/ofstream_list.hpp"
@@ -25,12 +28,20 @@
 // #include "common/file/simple_file_read_write.hpp"
 #include "common/file/temp_file.hpp"
 
+#include <fstream>
+#include <sstream>
+
 namespace cath { namespace test { } }
 
 using namespace cath;
 using namespace cath::common;
 using namespace cath::test;
 
+using boost::iostreams::copy;
+using boost::iostreams::filtering_istream;
+using boost::iostreams::gzip_decompressor;
+using std::ifstream;
+using std::ios_base;
 using std::ostringstream;
 using std::string;
 
@@ -45,6 +56,7 @@ namespace cath {
 		public:
 			const temp_file test_out_1{ ".ofstream_list_test.temp_file.%%%%-%%%%-%%%%-%%%%" };
 			const temp_file test_out_2{ ".ofstream_list_test.temp_file.%%%%-%%%%-%%%%-%%%%" };
+			const temp_file test_gz   { ".ofstream_list_test.temp_file.%%%%-%%%%-%%%%-%%%%.gz" };
 			ostringstream   test_ostream;
 		};
 
@@ -76,5 +88,22 @@ BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_CHECK_EQUAL( read_string_from_file( get_filename( test_out_2 ) ), "three" );
 }
 
+BOOST_AUTO_TEST_CASE(writes_gzip_to_gz_paths) {
+	ofstream_list the_list( test_ostream, "-" );
+	open_ofstream( the_list, get_filename( test_gz ) ).get() << "compressed";
+	the_list.close_all();
+
+	ifstream          gz_ifstream( get_filename( test_gz ).string(), ios_base::in | ios_base::binary );
+	filtering_istream gz_istream;
+	gz_istream.push( gzip_decompressor{} );
+	gz_istream.push( gz_ifstream );
+	ostringstream decompressed_ss;
+	copy( gz_istream, decompressed_ss );
+
+	BOOST_CHECK_EQUAL( decompressed_ss.str(), "compressed" );
+	BOOST_CHECK( is_gzip_path( get_filename( test_gz ) ) );
+	BOOST_CHECK( ! is_gzip_path( get_filename( test_out_1 ) ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
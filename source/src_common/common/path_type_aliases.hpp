@@ -24,6 +24,7 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/optional/optional_fwd.hpp>
 
+#include <utility>
 #include <vector>
 
 namespace cath {
@@ -37,6 +38,12 @@ namespace cath {
 	/// \brief Type alias for an optional path_opt
 	using path_opt_opt = boost::optional<path_opt>;
 
+	/// \brief Type alias for a pair of paths
+	using path_path_pair     = std::pair<boost::filesystem::path, boost::filesystem::path>;
+
+	/// \brief Type alias for a vector of path_path_pairs
+	using path_path_pair_vec = std::vector<path_path_pair>;
+
 } // namespace cath
 
 #endif
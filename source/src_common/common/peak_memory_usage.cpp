@@ -0,0 +1,51 @@
+/// \file
+/// \brief The peak_memory_usage definitions
+
+/// \copyright
+/// Tony Lewis's Common C++ Library Code (here imported into the CATH Tools project and then tweaked, eg namespaced in cath)
+/// Copyright (C) 2007, Tony Lewis
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "peak_memory_usage.hpp"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/resource.h>
+#endif
+
+using namespace cath;
+using namespace cath::common;
+
+using boost::none;
+
+/// \brief Get the peak resident set size (ie the most physical memory used at any one time) of this process
+///        in bytes or none if that isn't available on this platform
+size_opt cath::common::peak_resident_set_size_bytes() {
+#if defined( __unix__ ) || defined( __APPLE__ )
+	rusage usage;
+	if ( getrusage( RUSAGE_SELF, &usage ) != 0 || usage.ru_maxrss < 0 ) {
+		return none;
+	}
+	const size_t max_rss = static_cast<size_t>( usage.ru_maxrss );
+#if defined( __APPLE__ )
+	// macOS reports ru_maxrss in bytes...
+	return max_rss;
+#else
+	// ...whereas Linux (and the BSDs) report it in kilobytes
+	return max_rss * 1024;
+#endif
+#else
+	return none;
+#endif
+}
@@ -37,7 +37,10 @@
 #include "common/exception/runtime_error_exception.hpp"
 #include "common/type_aliases.hpp"
 
+#include <cerrno>
+#include <cstdlib>
 #include <string>
+#include <typeinfo>
 
 using namespace std::literals::string_literals;
 
@@ -211,6 +214,90 @@ namespace cath {
 			);
 		}
 
+		/// \brief Populate the specified vector with the iterators wrapping each of the whitespace-separated fields in the specified string
+		///
+		/// This reuses the vector's memory (rather than allocating strings for the fields, as split() does)
+		/// so is fast when called repeatedly on many lines.
+		///
+		/// This is dumb about whitespace (explicitly compares to ' ' and '\t'; ignores locale) for the sake of speed
+		inline void split_into_field_itrs(const std::string          &prm_string,    ///< The string to split
+		                                  str_citr_str_citr_pair_vec &prm_field_itrs ///< The vector to populate with the iterators wrapping each of the fields
+		                                  ) {
+			prm_field_itrs.clear();
+			const auto end_itr   = common::cend( prm_string );
+			auto       field_itr = find_itr_before_first_non_space( common::cbegin( prm_string ), end_itr );
+			while ( field_itr != end_itr ) {
+				const auto field_end_itr = find_itr_before_first_space( field_itr, end_itr );
+				prm_field_itrs.emplace_back( field_itr, field_end_itr );
+				field_itr = find_itr_before_first_non_space( field_end_itr, end_itr );
+			}
+		}
+
+		namespace detail {
+
+			/// \brief Perform a C-style (strtod()/strtoul()) parse of the specified field of the specified string,
+			///        throw if it doesn't consume the whole field or is out of range and return the result
+			///
+			/// This performs the same conversion as std::stod()/std::stoul() (so gives identical values for valid fields)
+			/// without having to construct a std::string for the field. Unlike std::stod()/std::stoul(), this rejects
+			/// fields with trailing non-numeric characters (eg "12x") rather than ignoring them.
+			template <typename T, typename Fn>
+			inline T do_c_style_field_parse(const std::string            &prm_string,     ///< The string containing the field
+			                                const str_citr_str_citr_pair &prm_field_itrs, ///< The iterators wrapping the field within the string
+			                                Fn                          &&prm_parse_fn    ///< The C-style parse function (eg strtod())
+			                                ) {
+				const auto  field_offset = std::distance( common::cbegin( prm_string ), prm_field_itrs.first );
+				const auto  field_length = std::distance( prm_field_itrs.first,         prm_field_itrs.second );
+				const char *begin_ptr    = std::next( prm_string.c_str(), field_offset );
+				char       *end_ptr      = nullptr;
+
+				const int prev_errno = errno;
+				errno = 0;
+				const T result = std::forward<Fn>( prm_parse_fn )( begin_ptr, &end_ptr );
+				const bool out_of_range = ( errno == ERANGE );
+				errno = prev_errno;
+
+				if ( field_length == 0 || end_ptr != std::next( begin_ptr, field_length ) || out_of_range ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception(
+						"Failed to parse a number (of type "s
+						+ ::boost::core::demangle( typeid( T ).name() )
+						+ ") from "
+						+ std::string{ prm_field_itrs.first, prm_field_itrs.second }
+					));
+				}
+				return result;
+			}
+
+		} // namespace detail
+
+		/// \brief Parse a double from the specified whitespace-delimited field of the specified string
+		///        with the same conversion as std::stod() but without constructing a std::string
+		///
+		/// \throws invalid_argument_exception if the whole field isn't a valid double (including if it has trailing junk)
+		inline double strtod_field(const std::string            &prm_string,    ///< The string containing the field
+		                           const str_citr_str_citr_pair &prm_field_itrs ///< The iterators wrapping the field within the string (eg from split_into_field_itrs())
+		                           ) {
+			return detail::do_c_style_field_parse<double>(
+				prm_string,
+				prm_field_itrs,
+				[] (const char *x, char **y) { return std::strtod( x, y ); }
+			);
+		}
+
+		/// \brief Parse an unsigned long from the specified whitespace-delimited field of the specified string
+		///        with the same conversion as std::stoul() but without constructing a std::string
+		///
+		/// \throws invalid_argument_exception if the whole field isn't a valid unsigned long (including if it has trailing junk)
+		inline unsigned long int strtoul_field(const std::string            &prm_string,    ///< The string containing the field
+		                                       const str_citr_str_citr_pair &prm_field_itrs ///< The iterators wrapping the field within the string (eg from split_into_field_itrs())
+		                                       ) {
+			return detail::do_c_style_field_parse<unsigned long int>(
+				prm_string,
+				prm_field_itrs,
+				[] (const char *x, char **y) { return std::strtoul( x, y, 10 ); }
+			);
+		}
+
 		/// \brief Parse a (possibly space-padded) float from the specified region of string
 		///
 		/// Note: please benchmark any changes to these functions to ensure they stay fast
@@ -30,6 +30,8 @@ namespace cath { namespace test { } }
 using namespace cath::common;
 using namespace cath::test;
 
+using cath::str_citr_str_citr_pair_vec;
+
 using std::string;
 
 namespace cath {
@@ -94,6 +96,29 @@ BOOST_AUTO_TEST_CASE(parses_unsigned_long_int) {
 	BOOST_CHECK_EQUAL( parse_ulong_from_substring ( pdb_line,   6,  5 ), 189_z   );
 }
 
+BOOST_AUTO_TEST_CASE(splits_into_field_itrs) {
+	const string source = "  1cukA03 \t1hjpA03   48  94.92 ";
+	str_citr_str_citr_pair_vec field_itrs;
+	split_into_field_itrs( source, field_itrs );
+	BOOST_REQUIRE_EQUAL( field_itrs.size(), 4_z );
+	BOOST_CHECK_EQUAL( string( field_itrs[ 0 ].first, field_itrs[ 0 ].second ), "1cukA03" );
+	BOOST_CHECK_EQUAL( string( field_itrs[ 1 ].first, field_itrs[ 1 ].second ), "1hjpA03" );
+	BOOST_CHECK_EQUAL( strtoul_field( source, field_itrs[ 2 ] ), 48_z                   );
+	BOOST_CHECK_EQUAL( strtod_field ( source, field_itrs[ 3 ] ), std::stod( "94.92" )   );
+
+	split_into_field_itrs( "", field_itrs );
+	BOOST_CHECK( field_itrs.empty() );
+}
+
+BOOST_AUTO_TEST_CASE(strto_fields_reject_partial_fields) {
+	const string source = "94.92x 48.5";
+	str_citr_str_citr_pair_vec field_itrs;
+	split_into_field_itrs( source, field_itrs );
+	BOOST_REQUIRE_EQUAL( field_itrs.size(), 2_z );
+	BOOST_CHECK_THROW( strtod_field ( source, field_itrs[ 0 ] ), invalid_argument_exception );
+	BOOST_CHECK_THROW( strtoul_field( source, field_itrs[ 1 ] ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_CASE(dumb_trim_string_ref_works) {
 	const string source = " billy bob  ";
 	BOOST_CHECK_EQUAL( dumb_trim_string_ref( source ), "billy bob" );
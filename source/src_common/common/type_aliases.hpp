@@ -146,6 +146,9 @@ namespace cath {
 	/// \brief A type alias for a pair of str_ctirs
 	using str_citr_str_citr_pair        = std::pair<str_citr, str_citr>;
 
+	/// \brief A type alias for a vector of str_citr_str_citr_pairs
+	using str_citr_str_citr_pair_vec    = std::vector<str_citr_str_citr_pair>;
+
 	using str_vec                       = std::vector<std::string>;
 	using str_vec_citr                  = str_vec::const_iterator;
 	using str_vec_vec                   = std::vector<str_vec>;
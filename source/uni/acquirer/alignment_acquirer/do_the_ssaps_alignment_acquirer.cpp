@@ -30,27 +30,46 @@
 
 #include "acquirer/alignment_acquirer/ssap_scores_file_alignment_acquirer.hpp"
 #include "alignment/alignment.hpp"
+#include "alignment/io/alignment_io.hpp"
 #include "chopping/chopping_format/sillitoe_chopping_format.hpp"
 #include "chopping/domain/domain.hpp"
+#include "common/algorithm/transform_build.hpp"
+#include "common/boost_addenda/range/indices.hpp"
 #include "common/clone/make_uptr_clone.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
 #include "common/exception/not_implemented_exception.hpp"
 #include "common/exception/runtime_error_exception.hpp"
-#include "common/file/open_fstream.hpp"
 #include "common/file/slurp.hpp"
 #include "common/file/spew.hpp"
 #include "common/matrix/matrix_index.hpp"
+#include "common/size_t_literal.hpp"
 #include "common/test_or_exe_run_mode.hpp"
+#include "file/ssap_scores_file/ssap_scores_file.hpp"
 #include "file/strucs_context.hpp"
 #include "ssap/options/cath_ssap_options.hpp"
+#include "ssap/options/old_ssap_options_block.hpp"
 #include "ssap/ssap.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/protein_source_file_set/protein_source_file_set.hpp"
+#include "structure/protein/residue.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
 #include "superposition/options/align_regions_options_block.hpp"
 
+#include <deque>
+#include <future>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
 using namespace cath;
 using namespace cath::align;
 using namespace cath::chop;
 using namespace cath::common;
 using namespace cath::file;
 using namespace cath::opts;
+using namespace std::literals::string_literals;
 
 using boost::adaptors::transformed;
 using boost::algorithm::join;
@@ -59,14 +78,19 @@ using boost::filesystem::create_directories;
 using boost::filesystem::exists;
 using boost::filesystem::is_empty;
 using boost::filesystem::path;
-using boost::filesystem::temp_directory_path;
 using boost::format;
 using boost::irange;
-using std::ofstream;
+using boost::none;
+using boost::optional;
+using std::deque;
+using std::future;
+using std::istringstream;
+using std::map;
 using std::max;
 using std::pair;
 using std::string;
 using std::unique_ptr;
+using std::vector;
 
 /// \brief A standard do_clone method.
 unique_ptr<alignment_acquirer> do_the_ssaps_alignment_acquirer::do_clone() const {
@@ -79,137 +103,236 @@ bool do_the_ssaps_alignment_acquirer::do_requires_backbone_complete_input() cons
 }
 
 /// \brief Run the necessary cath-ssaps and then use them to get the alignment and spanning tree
+///
+/// The SSAPs are performed in memory, concurrently on up to num_threads threads. Each protein is
+/// read (at most) once and then shared between all the SSAPs in which it appears.
+///
+/// If directory_of_joy is set, it's used as a cache: the results of any SSAPs with non-empty
+/// scores/alignment files already in the directory are used rather than re-run and the results
+/// of the SSAPs that are run are written to it.
 pair<alignment, size_size_pair_vec> do_the_ssaps_alignment_acquirer::do_get_alignment_and_spanning_tree(const strucs_context &prm_strucs_context, ///< The details of the structures for which the alignment and spanning tree is required
                                                                                                         const align_refining &prm_align_refining  ///< How much refining should be done to the alignment
                                                                                                         ) const {
 	using std::to_string;
 
-	// Get the directory in which the cath-ssaps should be done
-	const path ssaps_dir = get_directory_of_joy().value_or(
-		make_temp_dir_for_doing_ssaps( prm_strucs_context )
-	);
-
-	// Ensure the directory exists
-	if ( ! exists( ssaps_dir ) ) {
-		BOOST_LOG_TRIVIAL( info ) << "About to create directory " << ssaps_dir;
-		if ( ! create_directories( ssaps_dir ) ) {
+	// If there's a cache directory, ensure it exists
+	const path_opt &ssaps_dir = get_directory_of_joy();
+	if ( ssaps_dir && ! exists( *ssaps_dir ) ) {
+		BOOST_LOG_TRIVIAL( info ) << "About to create directory " << *ssaps_dir;
+		if ( ! create_directories( *ssaps_dir ) ) {
 			BOOST_THROW_EXCEPTION(runtime_error_exception(
 				"Unable to create directory "
-				+ ssaps_dir.string()
+				+ ssaps_dir->string()
 				+ " for temporary cath-ssaps"
 			));
 		}
 	}
 
-	// Perform any necessary cath-ssaps
-	path_vec scores_files;
-	const size_t num_strucs        = size( prm_strucs_context );
+	// Get the IDs of the structures, as used in the SSAP scores and alignment file names
+	//
+	// \TODO: Abstract out functions for making these standard file names
+	const size_t  num_strucs = size( prm_strucs_context );
+	const str_vec ids        = transform_build<str_vec>(
+		indices( num_strucs ),
+		[&] (const size_t &x) { return get_domain_or_specified_or_name_from_acq( prm_strucs_context.get_name_sets()[ x ] ); }
+	);
+	const auto scores_file_of_indices = [&] (const size_t &x, const size_t &y) { return *ssaps_dir / ( ids[ x ] + ids[ y ] + ".scores" ); };
+	const auto alnmnt_file_of_indices = [&] (const size_t &x, const size_t &y) { return *ssaps_dir / ( ids[ x ] + ids[ y ] + ".list"   ); };
+
 	const size_t num_ssaps         = ( num_strucs * ( max( 1_z, num_strucs ) - 1_z ) ) / 2_z;
 	const string num_str           = to_string( num_ssaps );
 	const size_t num_str_width     = num_str.length();
 	const string num_str_width_str = "%" + to_string( num_str_width ) + "d";
-	BOOST_LOG_TRIVIAL( info ) << "About to check for and possibly run " << num_ssaps << " cath-ssaps in directory " << ssaps_dir;
+
+	// The scores output and (optional) legacy-SSAP-format alignment of each SSAP, in strict upper-half matrix order
+	using ssap_result = pair<string, str_opt>;
+	std::vector<ssap_result> ssap_results( num_ssaps );
+
+	// The SSAPs currently being performed, with the indices of the structures they're comparing
+	deque<pair<size_size_pair, future<ssap_result>>> pending_ssaps;
+
+	// The proteins for SSAPing, each read on first use and then shared between all the SSAPs that use it
+	// (this is sized up front so the references held by pending SSAPs aren't invalidated)
+	vector<optional<protein>> proteins( num_strucs );
+
+	// Store the results of the oldest pending SSAP (and write them to any cache directory)
+	const auto store_oldest_ssap_fn = [&] {
+		const size_t &struc_1_index = pending_ssaps.front().first.first;
+		const size_t &struc_2_index = pending_ssaps.front().first.second;
+		ssap_result  &the_result    = ssap_results[ get_zero_index_of_strict_upper_half_matrix( struc_1_index, struc_2_index, num_strucs ) ];
+		the_result = pending_ssaps.front().second.get();
+		if ( ssaps_dir ) {
+			spew( scores_file_of_indices( struc_1_index, struc_2_index ), the_result.first );
+			if ( the_result.second ) {
+				spew( alnmnt_file_of_indices( struc_1_index, struc_2_index ), *the_result.second );
+			}
+		}
+		pending_ssaps.pop_front();
+	};
+
+	// Perform any necessary cath-ssaps
+	BOOST_LOG_TRIVIAL( info ) << "About to check for and possibly run " << num_ssaps << " cath-ssaps"
+		<< ( ssaps_dir ? " in directory " + ssaps_dir->string() : " in memory"s )
+		<< " using " << num_threads << " thread(s)";
 	for (const size_t &struc_1_index : indices( num_strucs ) ) {
 		for (const size_t &struc_2_index : irange( struc_1_index + 1, num_strucs ) ) {
 
-			const size_t comp_ctr_offset_1 = get_zero_index_of_strict_upper_half_matrix(
+			const size_t comp_index   = get_zero_index_of_strict_upper_half_matrix(
 				struc_1_index,
 				struc_2_index,
 				num_strucs
-			) + 1;
-			const string progress_str = ( format( num_str_width_str ) % comp_ctr_offset_1 ).str()
+			);
+			const string progress_str = ( format( num_str_width_str ) % ( comp_index + 1 ) ).str()
 				+ "/"
 				+ num_str;
 
-			// \TODO: Abstract out functions for making these standard file names
-			const string id_1   = get_domain_or_specified_or_name_from_acq( prm_strucs_context.get_name_sets()[ struc_1_index ] );
-			const string id_2   = get_domain_or_specified_or_name_from_acq( prm_strucs_context.get_name_sets()[ struc_2_index ] );
-			const path   scores_file = ssaps_dir / ( id_1 + id_2 + ".scores" );
-			const path   alnmnt_file = ssaps_dir / ( id_1 + id_2 + ".list"   );
-
-			scores_files.push_back( scores_file );
-
-			if (   ! exists( scores_file ) || ! exists( alnmnt_file )
-				|| is_empty( scores_file ) || is_empty( alnmnt_file ) ) {
-
-				// \TODO Tighten up the interface with the ssap/ssap.cpp code here
-				//
-				// In particular, the name_set will know the location of the file that each
-				// PDB was loaded from (if it was loaded from a PDB) so cath-ssap should have
-				// a --pdb-infile option and it should be explicitly used here.
-				str_vec cath_ssap_args{
-					cath_ssap_options::PROGRAM_NAME,
-					"--" + old_ssap_options_block::PO_ALIGN_DIR, ssaps_dir.string()
-				};
-				for (const size_t &index : { struc_1_index, struc_2_index } ) {
-					const auto       &name_set   = prm_strucs_context.get_name_sets()[ index ];
-					const domain_opt  opt_domain = get_domain_opt_of_index( prm_strucs_context, index );
-					cath_ssap_args.push_back( name_set.get_name_from_acq() );
-					if ( opt_domain ) {
-						cath_ssap_args.push_back( "--" + align_regions_options_block::PO_ALN_REGIONS );
-						cath_ssap_args.push_back( sillitoe_chopping_format{}.write_domain( *opt_domain ) );
-					}
+			// If the cache directory already has non-empty results for this pair, use them
+			if ( ssaps_dir ) {
+				const path scores_file = scores_file_of_indices( struc_1_index, struc_2_index );
+				const path alnmnt_file = alnmnt_file_of_indices( struc_1_index, struc_2_index );
+				if (   exists( scores_file ) && exists( alnmnt_file )
+					&& ! is_empty( scores_file ) && ! is_empty( alnmnt_file ) ) {
+					BOOST_LOG_TRIVIAL( info ) << "[" << progress_str << "] Skipping " << ids[ struc_1_index ] << " versus " << ids[ struc_2_index ] << " - non-empty data files already exist";
+					ssap_results[ comp_index ] = ssap_result{ slurp( scores_file ), slurp( alnmnt_file ) };
+					continue;
 				}
-				BOOST_LOG_TRIVIAL( info ) << "[" << progress_str << "] Running : " << join( cath_ssap_args, " " ) << " and writing scores to " << scores_file;
-				ofstream out_scores_ofstream;
-				open_ofstream( out_scores_ofstream, scores_file );
-				run_ssap(
-					make_and_parse_options<cath_ssap_options>(
-						cath_ssap_args,
-						( run_mode_flag::value == run_mode::TEST )
-							? parse_sources::CMND_LINE_ONLY
-							: parse_sources::CMND_ENV_AND_FILE
-					),
-					std::cout,
-					std::cerr,
-					ostream_ref( out_scores_ofstream )
-				);
-				out_scores_ofstream.close();
 			}
-			else {
-				BOOST_LOG_TRIVIAL( info ) << "[" << progress_str << "] Skipping " << id_1 << " versus " << id_2 << " - non-empty data files already exist";
+
+			// \TODO Tighten up the interface with the ssap/ssap.cpp code here
+			//
+			// In particular, the name_set will know the location of the file that each
+			// PDB was loaded from (if it was loaded from a PDB) so cath-ssap should have
+			// a --pdb-infile option and it should be explicitly used here.
+			str_vec cath_ssap_args{ cath_ssap_options::PROGRAM_NAME };
+			for (const size_t &index : { struc_1_index, struc_2_index } ) {
+				const auto       &name_set   = prm_strucs_context.get_name_sets()[ index ];
+				const domain_opt  opt_domain = get_domain_opt_of_index( prm_strucs_context, index );
+				cath_ssap_args.push_back( name_set.get_name_from_acq() );
+				if ( opt_domain ) {
+					cath_ssap_args.push_back( "--" + align_regions_options_block::PO_ALN_REGIONS );
+					cath_ssap_args.push_back( sillitoe_chopping_format{}.write_domain( *opt_domain ) );
+				}
+			}
+			BOOST_LOG_TRIVIAL( info ) << "[" << progress_str << "] Running : " << join( cath_ssap_args, " " );
+			cath_ssap_options the_cath_ssap_options = make_and_parse_options<cath_ssap_options>(
+				cath_ssap_args,
+				( run_mode_flag::value == run_mode::TEST )
+					? parse_sources::CMND_LINE_ONLY
+					: parse_sources::CMND_ENV_AND_FILE
+			);
+			const auto &error_or_help_string = the_cath_ssap_options.get_error_or_help_string();
+			if ( error_or_help_string ) {
+				BOOST_THROW_EXCEPTION(invalid_argument_exception(
+					"Unable to perform the cath-ssaps with invalid options: " + *error_or_help_string
+				));
+			}
+			const old_ssap_options_block &the_ssap_options = the_cath_ssap_options.get_old_ssap_options();
+			if ( the_ssap_options.get_opt_domin_file() ) {
+				BOOST_THROW_EXCEPTION(invalid_argument_exception(
+					"Cannot perform the cath-ssaps with a domin file because it would only apply to the first protein of each pair"
+				));
 			}
+
+			// Read any of the pair's proteins that haven't already been read
+			for (const size_t &index : { struc_1_index, struc_2_index } ) {
+				if ( ! proteins[ index ] ) {
+					proteins[ index ] = read_protein_data_from_ssap_options_files(
+						the_cath_ssap_options.get_data_dirs_spec(),
+						prm_strucs_context.get_name_sets()[ index ].get_name_from_acq(),
+						*the_ssap_options.get_protein_source_files(),
+						none,
+						get_domain_opt_of_index( prm_strucs_context, index ),
+						std::cerr
+					);
+				}
+			}
+
+			// Make space for this SSAP if the maximum number are already being performed
+			if ( pending_ssaps.size() >= num_threads ) {
+				store_oldest_ssap_fn();
+			}
+			pending_ssaps.emplace_back(
+				size_size_pair{ struc_1_index, struc_2_index },
+				std::async(
+					std::launch::async,
+					[] (const protein &prm_protein_a, const protein &prm_protein_b, const cath_ssap_options &prm_cath_ssap_options) {
+						return run_ssap_in_memory( prm_protein_a, prm_protein_b, prm_cath_ssap_options );
+					},
+					std::cref( *proteins[ struc_1_index ] ),
+					std::cref( *proteins[ struc_2_index ] ),
+					std::move( the_cath_ssap_options )
+				)
+			);
 		}
 	}
+	while ( ! pending_ssaps.empty() ) {
+		store_oldest_ssap_fn();
+	}
 
-	// Concatenate the scores files into one big file
-	const path scores_file = ssaps_dir / "ssap_scores";
-	spew(
-		scores_file,
-		join(
-			scores_files
-				| transformed( [] (const path &x) { return trim_right_copy( slurp( x ) ); } ),
-			"\n"
-		)
-	);
+	// Gather the alignments by the IDs of the structures they align
+	map<str_str_pair, string> alignment_of_ids;
+	for (const size_t &struc_1_index : indices( num_strucs ) ) {
+		for (const size_t &struc_2_index : irange( struc_1_index + 1, num_strucs ) ) {
+			const auto &opt_alignment = ssap_results[ get_zero_index_of_strict_upper_half_matrix( struc_1_index, struc_2_index, num_strucs ) ].second;
+			if ( opt_alignment ) {
+				alignment_of_ids.emplace( str_str_pair{ ids[ struc_1_index ], ids[ struc_2_index ] }, *opt_alignment );
+			}
+		}
+	}
+
+	// Parse the concatenation of all the scores
+	istringstream scores_iss{ join(
+		ssap_results
+			| transformed( [] (const ssap_result &x) { return trim_right_copy( x.first ); } ),
+		"\n"
+	) };
+	const auto ssap_scores_data = ssap_scores_file::parse_ssap_scores_file( scores_iss );
 
-	// Use the ssap_scores_file_alignment_acquirer on the directory of data
-	return ssap_scores_file_alignment_acquirer{ scores_file }
-		.get_alignment_and_spanning_tree( prm_strucs_context, prm_align_refining );
+	// Glue the in-memory alignments together
+	return glue_ssap_alignments(
+		prm_strucs_context,
+		ssap_scores_data.first,
+		ssap_scores_data.second,
+		[&] (const string &prm_name_a, const string &prm_name_b, const protein &prm_protein_a, const protein &prm_protein_b) {
+			const auto alignment_itr = alignment_of_ids.find( str_str_pair{ prm_name_a, prm_name_b } );
+			if ( alignment_itr == alignment_of_ids.end() ) {
+				BOOST_THROW_EXCEPTION(runtime_error_exception(
+					"No SSAP alignment is available for "
+					+ prm_name_a
+					+ " versus "
+					+ prm_name_b
+					+ " (possibly because the SSAP score was too low for an alignment to be written)"
+				));
+			}
+			istringstream alignment_iss{ alignment_itr->second };
+			return read_alignment_from_cath_ssap_legacy_format(
+				alignment_iss,
+				prm_protein_a,
+				prm_protein_b,
+				ostream_ref{ std::cerr }
+			);
+		},
+		prm_align_refining,
+		"the SSAP scores from doing the SSAPs"
+	);
 }
 
 /// \brief Ctor for do_the_ssaps_alignment_acquirer
-do_the_ssaps_alignment_acquirer::do_the_ssaps_alignment_acquirer(const path_opt &prm_directory_of_joy ///< The directory in which the cath-ssaps should be performed
-                                                                 ) : directory_of_joy { prm_directory_of_joy } {
+do_the_ssaps_alignment_acquirer::do_the_ssaps_alignment_acquirer(const path_opt &prm_directory_of_joy, ///< The directory in which the cath-ssaps' results should be cached (or none to just do them in memory)
+                                                                 const size_t   &prm_num_threads       ///< The number of threads with which to perform the cath-ssaps
+                                                                 ) : directory_of_joy { prm_directory_of_joy },
+                                                                     num_threads      { prm_num_threads      } {
+	if ( num_threads == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot perform the cath-ssaps with zero threads"));
+	}
 }
 
-/// \brief Getter for the directory in which the cath-ssaps should be performed
+/// \brief Getter for the directory in which the cath-ssaps' results should be cached (or none to just do them in memory)
 const path_opt & do_the_ssaps_alignment_acquirer::get_directory_of_joy() const {
 	return directory_of_joy;
 }
 
-/// \brief Make a path with a temporary directory in which cath-ssaps for the specified strucs_context should be done
-///
-/// This aims to create a temporary directory that is likely to persist across multiple identical runs
-/// but very unlikely to clash amongst different inputs
-///
-/// This doesn't actually create the directory
-path do_the_ssaps_alignment_acquirer::make_temp_dir_for_doing_ssaps(const strucs_context &prm_strucs_context ///< The strucs_context for which the directory should make a cath-ssaps temporary directory
-                                                                    ) {
-	return temp_directory_path() / (
-		  "cath-tools.tmp."
-		+ ( boost::format( R"(%|08X|)" ) % non_crypto_hash_copy( 0, prm_strucs_context ) ).str()
-		+ "_"
-		+ ( boost::format( R"(%|08X|)" ) % non_crypto_hash_copy( 1, prm_strucs_context ) ).str()
-	);
+/// \brief Getter for the number of threads with which to perform the cath-ssaps
+const size_t & do_the_ssaps_alignment_acquirer::get_num_threads() const {
+	return num_threads;
 }
@@ -31,26 +31,29 @@ namespace cath { namespace align { class alignment; } }
 
 namespace cath { namespace align {
 
-	/// \brief Acquire the alignment by performing any necessary cath-ssaps in
-	///        a temp directory and then using ssap_scores_file_alignment_acquirer
+	/// \brief Acquire the alignment by performing the necessary cath-ssaps concurrently in memory
+	///        (optionally caching the results in a directory) and then gluing the resulting alignments together
 	class do_the_ssaps_alignment_acquirer final : public alignment_acquirer {
 	private:
 		using super = alignment_acquirer;
 
-		/// \brief Where the magic shall happen
+		/// \brief Where the magic shall happen (or none to do the cath-ssaps in memory without caching their results)
 		path_opt directory_of_joy;
 
+		/// \brief The number of threads with which to perform the cath-ssaps
+		size_t num_threads;
+
 		std::unique_ptr<alignment_acquirer> do_clone() const final;
 		bool do_requires_backbone_complete_input() const final;
 		std::pair<alignment, size_size_pair_vec> do_get_alignment_and_spanning_tree(const file::strucs_context &,
 		                                                                            const align_refining &) const final;
 
 	public:
-		explicit do_the_ssaps_alignment_acquirer(const path_opt & = boost::none);
+		explicit do_the_ssaps_alignment_acquirer(const path_opt & = boost::none,
+		                                         const size_t & = 1);
 
 		const path_opt & get_directory_of_joy() const;
-
-		static boost::filesystem::path make_temp_dir_for_doing_ssaps(const file::strucs_context &);
+		const size_t & get_num_threads() const;
 	};
 
 } } // namespace cath::align
@@ -22,11 +22,37 @@
 
 #include <boost/test/auto_unit_test.hpp>
 
+#include "common/exception/invalid_argument_exception.hpp"
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::common;
+
+using boost::filesystem::path;
+using boost::none;
+
 BOOST_AUTO_TEST_SUITE(do_the_ssaps_alignment_acquirer_test_suite)
 
 BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_TEST( true );
 }
 
+BOOST_AUTO_TEST_CASE(defaults_to_in_memory_and_one_thread) {
+	const do_the_ssaps_alignment_acquirer the_acquirer;
+	BOOST_TEST( ! the_acquirer.get_directory_of_joy() );
+	BOOST_TEST( the_acquirer.get_num_threads() == 1 );
+}
+
+BOOST_AUTO_TEST_CASE(stores_cache_dir_and_num_threads) {
+	const do_the_ssaps_alignment_acquirer the_acquirer{ path{ "ssaps_cache" }, 4 };
+	BOOST_REQUIRE( the_acquirer.get_directory_of_joy() );
+	BOOST_TEST( *the_acquirer.get_directory_of_joy() == path{ "ssaps_cache" } );
+	BOOST_TEST( the_acquirer.get_num_threads() == 4 );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_zero_threads) {
+	BOOST_CHECK_THROW( do_the_ssaps_alignment_acquirer( none, 0 ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
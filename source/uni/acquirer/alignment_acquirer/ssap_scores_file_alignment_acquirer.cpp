@@ -88,60 +88,26 @@ pair<alignment, size_size_pair_vec> ssap_scores_file_alignment_acquirer::do_get_
                                                                                                             const align_refining &prm_align_refining  ///< How much refining should be done to the alignment
                                                                                                             ) const {
 	// Parse the SSAP scores file
-	const pdb_list &the_pdbs         = prm_strucs_context.get_pdbs();
-	const size_t    num_pdbs         = the_pdbs.size();
 	const path      ssaps_filename   = get_ssap_scores_file();
+	const path      alignments_dir   = ssaps_filename.parent_path();
 	const auto      ssap_scores_data = ssap_scores_file::parse_ssap_scores_file( ssaps_filename );
-	const str_vec  &names            = ssap_scores_data.first;
-	const auto     &scores           = ssap_scores_data.second;
 
-	if ( names.size() != num_pdbs ) {
-		if ( names.size() != 0 && num_pdbs != 1 ) {
-			BOOST_THROW_EXCEPTION(runtime_error_exception(
-				"The number of PDBs is "
-				+ ::std::to_string( num_pdbs         )
-				+ ", which doesn't match the "
-				+ ::std::to_string( names.size() )
-				+ " structures required for combining with the SSAP scores file \""
-				+ ssaps_filename.string()
-				+ "\""
-			));
-		}
-	}
-
-	// Construct the new alignment
-	const auto aln_and_spantree = build_multi_alignment(
-		the_pdbs,
-		names,
-		scores,
-		ssaps_filename.parent_path(),
-		aln_glue_style_of_align_refining( prm_align_refining ),
-		ostream_ref{ cerr }
-	);
-	const alignment          &new_alignment = aln_and_spantree.first;
-	const size_size_pair_vec &spanning_tree = aln_and_spantree.second;
-
-	// TODOCUMENT
-	if ( names.empty() ) {
-		// Return the results
-		return make_pair( new_alignment, spanning_tree );
-	}
-
-//	BOOST_LOG_TRIVIAL( warning )<< "About to attempt to build protein list using data that's been read from ssaps_filename (with " << num_pdbs << " pdbs and " << names.size() << " names)";
-
-	const protein_list proteins_of_pdbs     = build_protein_list_of_pdb_list_and_names(
-		prm_strucs_context.get_pdbs(),
-		build_name_set_list( names )
+	// Glue the alignments together, reading each from its .list file in the same directory as the scores file
+	return glue_ssap_alignments(
+		prm_strucs_context,
+		ssap_scores_data.first,
+		ssap_scores_data.second,
+		[&] (const string &prm_name_a, const string &prm_name_b, const protein &prm_protein_a, const protein &prm_protein_b) {
+			return read_alignment_from_cath_ssap_legacy_format(
+				alignments_dir / ( prm_name_a + prm_name_b + ".list" ),
+				prm_protein_a,
+				prm_protein_b,
+				ostream_ref{ cerr }
+			);
+		},
+		prm_align_refining,
+		"the SSAP scores file \"" + ssaps_filename.string() + "\""
 	);
-	const alignment    scored_new_alignment = score_alignment_copy( residue_scorer(), new_alignment, proteins_of_pdbs );
-
-//	cerr << "Did generate alignment : \n";
-//	cerr << horiz_align_outputter( scored_new_alignment ) << endl;
-//	write_alignment_as_fasta_alignment( cerr, scored_new_alignment, build_protein_list_of_pdb_list( prm_strucs_context ) );
-//	cerr << endl;
-
-	// Return the results
-	return make_pair( scored_new_alignment, spanning_tree );
 }
 
 /// \brief Ctor for ssap_scores_file_alignment_acquirer
@@ -154,13 +120,12 @@ path ssap_scores_file_alignment_acquirer::get_ssap_scores_file() const {
 	return ssap_scores_filename;
 }
 
-/// \brief Build an alignment between the specified PDBs & names using the specified scores and directory of SSAP alignments
+/// \brief Build an alignment between the specified PDBs & names using the specified scores and function for getting pairwise alignments
 pair<alignment, size_size_pair_vec> cath::align::build_multi_alignment(const pdb_list               &prm_pdbs,           ///< The PDBs to be aligned
                                                                        const str_vec                &prm_names,          ///< The names of the structures to be aligned
                                                                        const size_size_doub_tpl_vec &prm_scores,         ///< The SSAP scores between the structures
-                                                                       const path                   &prm_alignments_dir, ///< The directory containing alignments for the structures
-                                                                       const aln_glue_style         &prm_aln_glue_style, ///< The approach that should be used for glueing alignments together
-                                                                       const ostream_ref_opt        &prm_ostream         ///< An (optional reference_wrapper of an) ostream to which warnings/errors should be written
+                                                                       const ssap_alignment_fn      &prm_alignment_fn,   ///< The function to get the pairwise alignment between the two proteins of the specified names
+                                                                       const aln_glue_style         &prm_aln_glue_style  ///< The approach that should be used for glueing alignments together
                                                                        ) {
 	const protein_list prots = build_protein_list_of_pdb_list( prm_pdbs );
 	auto aln_and_spantree = build_alignment(
@@ -173,11 +138,11 @@ pair<alignment, size_size_pair_vec> cath::align::build_multi_alignment(const pdb
 		[&] (const size_t  &prm_index_a, //< The index of the first  protein for which the alignment is required
 		     const size_t  &prm_index_b  //< The index of the second protein for which the alignment is required
 		     ) {
-			return read_alignment_from_cath_ssap_legacy_format(
-				prm_alignments_dir / ( prm_names[ prm_index_a ] + prm_names[ prm_index_b ] + ".list" ),
+			return prm_alignment_fn(
+				prm_names[ prm_index_a ],
+				prm_names[ prm_index_b ],
 				prots[ prm_index_a ],
-				prots[ prm_index_b ],
-				prm_ostream
+				prots[ prm_index_b ]
 			);
 		}
 	);
@@ -187,3 +152,88 @@ pair<alignment, size_size_pair_vec> cath::align::build_multi_alignment(const pdb
 		get_edges_of_spanning_tree( aln_and_spantree.second )
 	};
 }
+
+/// \brief Build an alignment between the specified PDBs & names using the specified scores and directory of SSAP alignments
+pair<alignment, size_size_pair_vec> cath::align::build_multi_alignment(const pdb_list               &prm_pdbs,           ///< The PDBs to be aligned
+                                                                       const str_vec                &prm_names,          ///< The names of the structures to be aligned
+                                                                       const size_size_doub_tpl_vec &prm_scores,         ///< The SSAP scores between the structures
+                                                                       const path                   &prm_alignments_dir, ///< The directory containing alignments for the structures
+                                                                       const aln_glue_style         &prm_aln_glue_style, ///< The approach that should be used for glueing alignments together
+                                                                       const ostream_ref_opt        &prm_ostream         ///< An (optional reference_wrapper of an) ostream to which warnings/errors should be written
+                                                                       ) {
+	return build_multi_alignment(
+		prm_pdbs,
+		prm_names,
+		prm_scores,
+		[&] (const string &prm_name_a, const string &prm_name_b, const protein &prm_protein_a, const protein &prm_protein_b) {
+			return read_alignment_from_cath_ssap_legacy_format(
+				prm_alignments_dir / ( prm_name_a + prm_name_b + ".list" ),
+				prm_protein_a,
+				prm_protein_b,
+				prm_ostream
+			);
+		},
+		prm_aln_glue_style
+	);
+}
+
+/// \brief Glue together the pairwise SSAP alignments between the structures in the specified strucs_context
+///        using the specified SSAP scores and function for getting pairwise alignments
+///
+/// This scores the resulting alignment if any names are specified
+pair<alignment, size_size_pair_vec> cath::align::glue_ssap_alignments(const strucs_context         &prm_strucs_context, ///< The details of the structures for which the alignment and spanning tree is required
+                                                                      const str_vec                &prm_names,          ///< The names of the structures in the SSAP scores
+                                                                      const size_size_doub_tpl_vec &prm_scores,         ///< The SSAP scores between the structures
+                                                                      const ssap_alignment_fn      &prm_alignment_fn,   ///< The function to get the pairwise alignment between the two proteins of the specified names
+                                                                      const align_refining         &prm_align_refining, ///< How much refining should be done to the alignment
+                                                                      const string                 &prm_source_desc     ///< A description of the source of the SSAP scores (for use in error messages)
+                                                                      ) {
+	const pdb_list &the_pdbs = prm_strucs_context.get_pdbs();
+	const size_t    num_pdbs = the_pdbs.size();
+
+	if ( prm_names.size() != num_pdbs ) {
+		if ( prm_names.size() != 0 && num_pdbs != 1 ) {
+			BOOST_THROW_EXCEPTION(runtime_error_exception(
+				"The number of PDBs is "
+				+ ::std::to_string( num_pdbs         )
+				+ ", which doesn't match the "
+				+ ::std::to_string( prm_names.size() )
+				+ " structures required for combining with "
+				+ prm_source_desc
+			));
+		}
+	}
+
+	// Construct the new alignment
+	const auto aln_and_spantree = build_multi_alignment(
+		the_pdbs,
+		prm_names,
+		prm_scores,
+		prm_alignment_fn,
+		aln_glue_style_of_align_refining( prm_align_refining )
+	);
+	const alignment          &new_alignment = aln_and_spantree.first;
+	const size_size_pair_vec &spanning_tree = aln_and_spantree.second;
+
+	// TODOCUMENT
+	if ( prm_names.empty() ) {
+		// Return the results
+		return make_pair( new_alignment, spanning_tree );
+	}
+
+//	BOOST_LOG_TRIVIAL( warning )<< "About to attempt to build protein list using data that's been read from ssaps_filename (with " << num_pdbs << " pdbs and " << names.size() << " names)";
+
+	const protein_list proteins_of_pdbs     = build_protein_list_of_pdb_list_and_names(
+		the_pdbs,
+		build_name_set_list( prm_names )
+	);
+	const alignment    scored_new_alignment = score_alignment_copy( residue_scorer(), new_alignment, proteins_of_pdbs );
+
+//	cerr << "Did generate alignment : \n";
+//	cerr << horiz_align_outputter( scored_new_alignment ) << endl;
+//	write_alignment_as_fasta_alignment( cerr, scored_new_alignment, build_protein_list_of_pdb_list( prm_strucs_context ) );
+//	cerr << endl;
+
+	// Return the results
+	return make_pair( scored_new_alignment, spanning_tree );
+}
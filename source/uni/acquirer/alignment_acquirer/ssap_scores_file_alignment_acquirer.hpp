@@ -28,6 +28,10 @@
 #include "alignment/align_type_aliases.hpp"
 #include "alignment/aln_glue_style.hpp"
 
+#include <functional>
+#include <string>
+
+namespace cath { class protein; }
 namespace cath { namespace align { class alignment; } }
 namespace cath { namespace file { class pdb_list; } }
 
@@ -51,6 +55,15 @@ namespace cath {
 			boost::filesystem::path get_ssap_scores_file() const;
 		};
 
+		/// \brief Type alias for a function to get the pairwise alignment between the two proteins of the specified names
+		using ssap_alignment_fn = std::function<alignment(const std::string &, const std::string &, const protein &, const protein &)>;
+
+		std::pair<alignment, size_size_pair_vec> build_multi_alignment(const file::pdb_list &,
+		                                                               const str_vec &,
+		                                                               const size_size_doub_tpl_vec &,
+		                                                               const ssap_alignment_fn &,
+		                                                               const aln_glue_style &);
+
 		std::pair<alignment, size_size_pair_vec> build_multi_alignment(const file::pdb_list &,
 		                                                               const str_vec &,
 		                                                               const size_size_doub_tpl_vec &,
@@ -58,6 +71,13 @@ namespace cath {
 		                                                               const aln_glue_style &,
 		                                                               const ostream_ref_opt & = boost::none);
 
+		std::pair<alignment, size_size_pair_vec> glue_ssap_alignments(const file::strucs_context &,
+		                                                              const str_vec &,
+		                                                              const size_size_doub_tpl_vec &,
+		                                                              const ssap_alignment_fn &,
+		                                                              const align_refining &,
+		                                                              const std::string &);
+
 	} // namespace align
 } // namespace cath
 
@@ -84,9 +84,10 @@ common_residue_select_min_score_policy::common_residue_select_min_score_policy(c
 	}
 }
 
-/// \brief TODOCUMENT
-bool common_residue_select_min_score_policy::do_less_than_with_same_dynamic_type(const common_residue_selection_policy &/*prm_common_residue_selection_policy*/ ///< TODOCUMENT
+/// \brief Less-than comparison with another common_residue_select_min_score_policy (by the parameter that determines which residues are selected)
+bool common_residue_select_min_score_policy::do_less_than_with_same_dynamic_type(const common_residue_selection_policy &prm_common_residue_selection_policy ///< The common_residue_selection_policy to compare (which must be a common_residue_select_min_score_policy)
                                                                                  ) const {
-	return false;
+	const auto &casted_policy = dynamic_cast< decltype( *this ) >( prm_common_residue_selection_policy );
+	return ( get_score_cutoff() < casted_policy.get_score_cutoff() );
 }
 
@@ -35,6 +35,7 @@
 
 #include "alignment/align_type_aliases.hpp"
 #include "alignment/pair_alignment.hpp"
+#include "common/algorithm/transform_build.hpp"
 #include "common/boost_addenda/log/log_to_ostream_guard.hpp"
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/boost_addenda/string_algorithm/split_build.hpp"
@@ -726,6 +727,44 @@ alignment cath::align::read_alignment_from_fasta(istream            &prm_istream
 	return read_alignment_from_fasta( prm_istream, get_amino_acid_lists( prm_proteins ), str_vec( prm_proteins.size() ), prm_stderr );
 }
 
+/// \brief Parse a FASTA format input into an alignment
+///
+/// This version of read_alignment_from_fasta() doesn't take names to find within the parsed IDS
+/// so it is less safe than the other version.
+///
+/// \relates alignment
+alignment cath::align::read_alignment_from_fasta_file(const path             &prm_fasta_file, ///< The file from which to read the FASTA input for parsing
+                                                      const protein_cref_vec &prm_proteins,   ///< References to the proteins corresponding to the alignment's entries
+                                                      ostream                &prm_stderr      ///< An ostream to which any warnings should be output (currently unused)
+                                                      ) {
+	return read_alignment_from_fasta_file( prm_fasta_file, prm_proteins, str_vec( prm_proteins.size() ), prm_stderr );
+}
+
+/// \brief Parse a FASTA format input into an alignment
+///
+/// This is equivalent to the protein_list version but it doesn't require the proteins to be copied into a protein_list
+///
+/// \relates alignment
+alignment cath::align::read_alignment_from_fasta_file(const path             &prm_fasta_file, ///< The file from which to read the FASTA input for parsing
+                                                      const protein_cref_vec &prm_proteins,   ///< References to the proteins corresponding to the alignment's entries
+                                                      const str_vec          &prm_names,      ///< A vector of names, each of which should be found within the corresponding sequence's ID
+                                                      ostream                &prm_stderr      ///< An ostream to which any warnings should be output (currently unused)
+                                                      ) {
+	ifstream my_aln_stream;
+	open_ifstream( my_aln_stream, prm_fasta_file );
+	const alignment new_alignment = read_alignment_from_fasta(
+		my_aln_stream,
+		transform_build<amino_acid_vec_vec>(
+			prm_proteins,
+			[] (const protein &x) { return get_amino_acid_list( x ); }
+		),
+		prm_names,
+		prm_stderr
+	);
+	my_aln_stream.close();
+	return new_alignment;
+}
+
 /// \brief Parse a FASTA format input into an alignment
 ///
 /// At present, each sequences must contain all of the residues of the corresponding PDB
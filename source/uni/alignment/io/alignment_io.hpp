@@ -102,6 +102,15 @@ namespace cath {
 		                                    const protein_list &,
 		                                    std::ostream & = std::cerr);
 
+		alignment read_alignment_from_fasta_file(const boost::filesystem::path &,
+		                                         const protein_cref_vec &,
+		                                         std::ostream & = std::cerr);
+
+		alignment read_alignment_from_fasta_file(const boost::filesystem::path &,
+		                                         const protein_cref_vec &,
+		                                         const str_vec &,
+		                                         std::ostream & = std::cerr);
+
 		alignment read_alignment_from_fasta(std::istream &,
 		                                    const amino_acid_vec_vec &,
 		                                    const str_vec &,
@@ -37,7 +37,6 @@ using namespace std::literals::string_literals;
 using boost::numeric_cast;
 using boost::algorithm::join;
 using boost::filesystem::path;
-using boost::none;
 using boost::program_options::bool_switch;
 using boost::program_options::options_description;
 using boost::program_options::value;
@@ -63,6 +62,9 @@ const string alignment_input_options_block::PO_SSAP_SCORE_INFILE { "ssap-scores-
 /// \brief The option name for a directory in which to do the necessary SSAPs and then use the scores to glue the resulting alignments together
 const string alignment_input_options_block::PO_DO_THE_SSAPS      { "do-the-ssaps"       };
 
+/// \brief The option name for the number of threads with which to perform the SSAPs under --do-the-ssaps
+const string alignment_input_options_block::PO_DO_THE_SSAPS_THREADS { "do-the-ssaps-threads" };
+
 /// \brief The option name for how much refining should be done to the alignment
 const string alignment_input_options_block::PO_REFINING          { "align-refining"     };
 
@@ -85,6 +87,7 @@ void alignment_input_options_block::do_add_visible_options_to_description(option
 
 	const string dir_varname      { "<dir>"  };
 	const string file_varname     { "<file>" };
+	const string num_varname      { "<num>"  };
 	const string refining_varname { "<refn>" };
 
 	const auto residue_name_align_notifier   = [&] (const bool           &x) { the_alignment_input_spec.set_residue_name_align  ( x ); };
@@ -95,6 +98,7 @@ void alignment_input_options_block::do_add_visible_options_to_description(option
 	const auto do_the_ssaps_notifier         = [&] (const path           &x) {
 		the_alignment_input_spec.set_do_the_ssaps_dir( make_optional_if( x != path{}, x ) );
 	};
+	const auto do_the_ssaps_threads_notifier = [&] (const size_t         &x) { the_alignment_input_spec.set_do_the_ssaps_num_threads( x ); };
 	const auto refining_notifier             = [&] (const align_refining &x) { the_alignment_input_spec.set_refining            ( x ); };
 
 	prm_desc.add_options()
@@ -140,7 +144,15 @@ void alignment_input_options_block::do_add_visible_options_to_description(option
 				->notifier      ( do_the_ssaps_notifier         )
 				->implicit_value( path{}                        ),
 			( "Do the required SSAPs in directory " + dir_varname + "; use results as with --" + PO_SSAP_SCORE_INFILE + "\n"
-				"Use a suitable temp directory if none is specified" ).c_str()
+				"Do them in memory (without writing any files) if no directory is specified" ).c_str()
+		)
+		(
+			PO_DO_THE_SSAPS_THREADS.c_str(),
+			value<size_t>()
+				->value_name    ( num_varname                                            )
+				->notifier      ( do_the_ssaps_threads_notifier                          )
+				->default_value ( alignment_input_spec::DEFAULT_DO_THE_SSAPS_NUM_THREADS ),
+			( "Use " + num_varname + " threads to perform the SSAPs under --" + PO_DO_THE_SSAPS ).c_str()
 		);
 
 	// Create and add a sub-block for alignment refining
@@ -169,11 +181,14 @@ void alignment_input_options_block::do_add_visible_options_to_description(option
 }
 
 /// \brief TODOCUMENT
-str_opt alignment_input_options_block::do_invalid_string(const variables_map &/*prm_variables_map*/ ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
+str_opt alignment_input_options_block::do_invalid_string(const variables_map &prm_variables_map ///< The variables map, which options_blocks can use to determine which options were specified, defaulted etc
                                                          ) const {
 	if ( get_num_acquirers( *this ) > 1 ) {
 		return "Cannot specify more than one alignment input"s;
 	}
+	if ( specifies_option( prm_variables_map, PO_DO_THE_SSAPS_THREADS ) && get_num_acquirers( *this ) > 0 && ! the_alignment_input_spec.get_do_the_ssaps_dir() ) {
+		return "Cannot specify the number of threads for doing the SSAPs (--" + PO_DO_THE_SSAPS_THREADS + ") with an alignment input other than --" + PO_DO_THE_SSAPS;
+	}
 	if ( ! the_alignment_input_spec.get_fasta_alignment_file().empty() && ! is_acceptable_input_file( the_alignment_input_spec.get_fasta_alignment_file()    ) ) {
 		return "FASTA alignment file " + the_alignment_input_spec.get_ssap_alignment_file().string() + " is not a valid input file";
 	}
@@ -186,7 +201,7 @@ str_opt alignment_input_options_block::do_invalid_string(const variables_map &/*
 	if ( ! the_alignment_input_spec.get_ssap_scores_file().empty()     && ! is_acceptable_input_file( the_alignment_input_spec.get_ssap_scores_file(), true ) ) {
 		return "SSAP scores file "    + the_alignment_input_spec.get_ssap_scores_file().string()    + " is not a valid input file";
 	}
-	return none;
+	return get_invalid_description( the_alignment_input_spec );
 }
 
 /// \brief Return all options names for this block
@@ -198,6 +213,7 @@ str_vec alignment_input_options_block::do_get_all_options_names() const {
 		alignment_input_options_block::PO_CORA_ALIGN_INFILE,
 		alignment_input_options_block::PO_SSAP_SCORE_INFILE,
 		alignment_input_options_block::PO_DO_THE_SSAPS,
+		alignment_input_options_block::PO_DO_THE_SSAPS_THREADS,
 		alignment_input_options_block::PO_REFINING
 	};
 }
@@ -49,6 +49,7 @@ namespace cath {
 			static const std::string PO_CORA_ALIGN_INFILE;
 			static const std::string PO_SSAP_SCORE_INFILE;
 			static const std::string PO_DO_THE_SSAPS;
+			static const std::string PO_DO_THE_SSAPS_THREADS;
 			static const std::string PO_REFINING;
 
 			alignment_input_options_block() = default;
@@ -32,11 +32,15 @@ using namespace cath::align;
 using namespace cath::common;
 using namespace cath::opts;
 
+using namespace std::literals::string_literals;
+
 using boost::filesystem::path;
+using boost::none;
 using boost::range::count;
 using std::array;
 
-constexpr bool alignment_input_spec::DEFAULT_RESIDUE_NAME_ALIGN;
+constexpr bool   alignment_input_spec::DEFAULT_RESIDUE_NAME_ALIGN;
+constexpr size_t alignment_input_spec::DEFAULT_DO_THE_SSAPS_NUM_THREADS;
 
 /// \brief Ctor from how much refining should be done to the alignment
 alignment_input_spec::alignment_input_spec(const align_refining &prm_refining ///< How much refining should be done to the alignment
@@ -69,11 +73,16 @@ const path & alignment_input_spec::get_ssap_scores_file() const {
 }
 
 /// \brief Getter for a directory in which SSAPs should be performed and then their alignments glued together
-///        or (inner) none for cath-tools to choose a directory to use
+///        or (inner) none for the SSAPs to be performed in memory
 const path_opt_opt & alignment_input_spec::get_do_the_ssaps_dir() const {
 	return do_the_ssaps_dir;
 }
 
+/// \brief Getter for the number of threads with which to perform the SSAPs under --do-the-ssaps
+const size_t & alignment_input_spec::get_do_the_ssaps_num_threads() const {
+	return do_the_ssaps_num_threads;
+}
+
 /// \brief Getter for how much refining should be done to the alignment
 const align_refining & alignment_input_spec::get_refining() const {
 	return refining;
@@ -115,13 +124,20 @@ alignment_input_spec & alignment_input_spec::set_ssap_scores_file(const path &pr
 }
 
 /// \brief Setter for a directory in which SSAPs should be performed and then their alignments glued together
-///        or (inner) none for cath-tools to choose a directory to use
-alignment_input_spec & alignment_input_spec::set_do_the_ssaps_dir(const path_opt &prm_do_the_ssaps_dir ///< A directory in which SSAPs should be performed and then their alignments glued together or (inner) none for cath-tools to choose a directory to use
+///        or (inner) none for the SSAPs to be performed in memory
+alignment_input_spec & alignment_input_spec::set_do_the_ssaps_dir(const path_opt &prm_do_the_ssaps_dir ///< A directory in which SSAPs should be performed and then their alignments glued together or (inner) none for the SSAPs to be performed in memory
                                                                   ) {
 	do_the_ssaps_dir = prm_do_the_ssaps_dir;
 	return *this;
 }
 
+/// \brief Setter for the number of threads with which to perform the SSAPs under --do-the-ssaps
+alignment_input_spec & alignment_input_spec::set_do_the_ssaps_num_threads(const size_t &prm_do_the_ssaps_num_threads ///< The number of threads with which to perform the SSAPs under --do-the-ssaps
+                                                                          ) {
+	do_the_ssaps_num_threads = prm_do_the_ssaps_num_threads;
+	return *this;
+}
+
 /// \brief Setter for how much refining should be done to the alignment
 alignment_input_spec & alignment_input_spec::set_refining(const align_refining &prm_refining
                                                           ) {
@@ -148,3 +164,15 @@ size_t cath::opts::get_num_acquirers(const alignment_input_spec &prm_alignment_i
 		true
 	) );
 }
+
+/// \brief Generate a description of any problem that makes the specified alignment_input_spec invalid
+///        or none otherwise
+///
+/// \relates alignment_input_spec
+str_opt cath::opts::get_invalid_description(const alignment_input_spec &prm_alignment_input_spec ///< The alignment_input_spec to query
+                                            ) {
+	if ( prm_alignment_input_spec.get_do_the_ssaps_num_threads() == 0 ) {
+		return "Cannot perform the SSAPs with zero threads"s;
+	}
+	return none;
+}
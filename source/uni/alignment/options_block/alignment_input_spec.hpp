@@ -26,6 +26,7 @@
 
 #include "acquirer/alignment_acquirer/align_refining.hpp"
 #include "common/path_type_aliases.hpp"
+#include "common/type_aliases.hpp"
 
 namespace cath {
 	namespace opts {
@@ -51,13 +52,16 @@ namespace cath {
 			boost::filesystem::path ssap_scores_file;
 
 			/// \brief A directory in which SSAPs should be performed and then their alignments glued together
-			///        or (inner) none for cath-tools to choose a directory to use
+			///        or (inner) none for the SSAPs to be performed in memory
 			///
 			/// The outer optional<> is used to determine if the option has been specified
 			/// The inner optional<> is used to determine if a specific directory should be used
-			/// (rather than cath-tools choosing)
+			/// to cache the SSAP results (rather than performing the SSAPs in memory)
 			path_opt_opt do_the_ssaps_dir;
 
+			/// \brief The number of threads with which to perform the SSAPs under --do-the-ssaps
+			size_t do_the_ssaps_num_threads = DEFAULT_DO_THE_SSAPS_NUM_THREADS;
+
 			/// \brief How much refining should be done to the alignment
 			align::align_refining refining = DEFAULT_REFINING;
 
@@ -65,6 +69,9 @@ namespace cath {
 			/// \brief The default value for whether to align based on matching residue names
 			static constexpr bool DEFAULT_RESIDUE_NAME_ALIGN = false;
 
+			/// \brief The default number of threads with which to perform the SSAPs under --do-the-ssaps
+			static constexpr size_t DEFAULT_DO_THE_SSAPS_NUM_THREADS = 1;
+
 			/// \brief The default value for how much refining should be done to the alignment
 			static constexpr align::align_refining DEFAULT_REFINING = align::align_refining::NO;
 
@@ -77,6 +84,7 @@ namespace cath {
 			const boost::filesystem::path & get_cora_alignment_file() const;
 			const boost::filesystem::path & get_ssap_scores_file() const;
 			const path_opt_opt & get_do_the_ssaps_dir() const;
+			const size_t & get_do_the_ssaps_num_threads() const;
 			const align::align_refining & get_refining() const;
 
 			alignment_input_spec & set_residue_name_align(const bool &);
@@ -85,11 +93,14 @@ namespace cath {
 			alignment_input_spec & set_cora_alignment_file(const boost::filesystem::path &);
 			alignment_input_spec & set_ssap_scores_file(const boost::filesystem::path &);
 			alignment_input_spec & set_do_the_ssaps_dir(const path_opt &);
+			alignment_input_spec & set_do_the_ssaps_num_threads(const size_t &);
 			alignment_input_spec & set_refining(const align::align_refining &);
 		};
 
 		size_t get_num_acquirers(const alignment_input_spec &);
 
+		str_opt get_invalid_description(const alignment_input_spec &);
+
 	} // namespace opts
 } // namespace cath
 
@@ -23,6 +23,8 @@
 #include <boost/filesystem/path.hpp> // ***** TEMPORARY *****
 #include <boost/log/trivial.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/range/algorithm/set_algorithm.hpp>
+#include <boost/range/algorithm/sort.hpp>
 #include <boost/type_traits/is_same.hpp>
 
 #include "alignment/alignment.hpp"
@@ -40,6 +42,7 @@
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/exception/not_implemented_exception.hpp"
 #include "common/file/open_fstream.hpp"
+#include "common/size_t_literal.hpp"
 #include "ssap/ssap.hpp"
 #include "structure/entry_querier/residue_querier.hpp" // ***** TEMPORARY *****
 #include "structure/protein/protein.hpp"
@@ -47,7 +50,10 @@
 #include "structure/view_cache/view_cache.hpp"
 #include "structure/view_cache/view_cache_list.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <future>
+#include <iterator>
 
 using namespace cath;
 using namespace cath::align;
@@ -57,6 +63,213 @@ using namespace cath::common;
 using namespace cath::index;
 using namespace std;
 
+using boost::range::set_difference;
+using boost::range::sort;
+
+namespace cath {
+	namespace align {
+		namespace detail {
+
+			/// \brief Make the refiner_anchors for the specified alignment and split mappings, in the order
+			///        in which their scores are accumulated (by alignment index, then entry in the first half,
+			///        then entry in the second half)
+			inline refiner_anchor_vec make_refiner_anchors(const alignment               &prm_alignment, ///< The alignment being refined
+			                                               const alignment_split_mapping &prm_mapping_a, ///< The mapping for the first half of the split
+			                                               const alignment_split_mapping &prm_mapping_b  ///< The mapping for the second half of the split
+			                                               ) {
+				refiner_anchor_vec anchors;
+				for (const size_t &aln_ctr : indices( prm_alignment.length() ) ) {
+					const size_opt mapping_index_a = prm_mapping_a.index_of_orig_aln_index( aln_ctr );
+					const size_opt mapping_index_b = prm_mapping_b.index_of_orig_aln_index( aln_ctr );
+					if ( ! mapping_index_a || ! mapping_index_b ) {
+						continue;
+					}
+					const size_vec present_orig_aln_entries_a = present_orig_aln_entries_of_index( prm_mapping_a, *mapping_index_a );
+					const size_vec present_orig_aln_entries_b = present_orig_aln_entries_of_index( prm_mapping_b, *mapping_index_b );
+					for (const size_t &present_orig_aln_entry_a : present_orig_aln_entries_a) {
+						for (const size_t &present_orig_aln_entry_b : present_orig_aln_entries_b) {
+							const size_t present_entry_a = * prm_mapping_a.entry_of_orig_aln_entry( present_orig_aln_entry_a );
+							const size_t present_entry_b = * prm_mapping_b.entry_of_orig_aln_entry( present_orig_aln_entry_b );
+							anchors.push_back( refiner_anchor{
+								present_orig_aln_entry_a,
+								present_orig_aln_entry_b,
+								present_entry_a,
+								present_entry_b,
+								get_position_of_entry_of_index( prm_mapping_a, present_entry_a, *mapping_index_a ),
+								get_position_of_entry_of_index( prm_mapping_b, present_entry_b, *mapping_index_b )
+							} );
+						}
+					}
+				}
+				return anchors;
+			}
+
+			/// \brief Make a list for each of the specified mapping's entries of the mapping index of each of that entry's residues
+			inline size_vec_vec make_refiner_index_maps(const alignment_split_mapping &prm_mapping,        ///< The mapping to query
+			                                            const size_vec                &prm_correct_lengths ///< The lengths of the proteins of the original alignment's entries
+			                                            ) {
+				size_vec_vec index_maps;
+				index_maps.reserve( prm_mapping.num_entries() );
+				for (const size_t &entry : indices( prm_mapping.num_entries() ) ) {
+					const size_t length = prm_correct_lengths[ prm_mapping.orig_aln_entry_of_entry( entry ) ];
+					size_vec index_map;
+					index_map.reserve( length );
+					for (const size_t &res_ctr : indices( length ) ) {
+						index_map.push_back( prm_mapping.index_of_protein_index( entry, res_ctr ) );
+					}
+					index_maps.push_back( std::move( index_map ) );
+				}
+				return index_maps;
+			}
+
+			/// \brief Accumulate the from/to scores of all the specified anchors into the rows of the specified
+			///        (row-major) score matrices within the specified range
+			///
+			/// Each cell receives its contributions in the order of the anchors regardless of the range of rows,
+			/// so partitioning the rows between threads gives exactly the same scores as a single pass over all the rows.
+			inline void accumulate_refiner_scores(const refiner_anchor_vec &prm_anchors,         ///< The anchors to score against
+			                                      const size_vec_vec       &prm_index_maps_a,    ///< The index maps of the entries of the first half of the split
+			                                      const size_vec_vec       &prm_index_maps_b,    ///< The index maps of the entries of the second half of the split
+			                                      const view_cache_list    &prm_view_cache_list, ///< The views between the residues of each protein
+			                                      const size_t             &prm_row_length,      ///< The length of each row of the score matrices
+			                                      const size_t             &prm_row_begin,       ///< The first row to accumulate
+			                                      const size_t             &prm_row_end,         ///< One past the last row to accumulate
+			                                      const float_score_type   &prm_factor,          ///< The factor by which to multiply each score before adding it (eg -1.0 to remove a previously added anchor's scores)
+			                                      float_score_vec          &prm_from_scores,     ///< The matrix of from scores to which scores should be added
+			                                      float_score_vec          &prm_to_scores        ///< The matrix of to scores to which scores should be added
+			                                      ) {
+				for (const refiner_anchor &anchor : prm_anchors) {
+					const view_cache &view_cache_a = prm_view_cache_list.get_view_cache( anchor.orig_entry_a );
+					const view_cache &view_cache_b = prm_view_cache_list.get_view_cache( anchor.orig_entry_b );
+					const size_vec   &index_map_a  = prm_index_maps_a[ anchor.entry_a ];
+					const size_vec   &index_map_b  = prm_index_maps_b[ anchor.entry_b ];
+					for (const size_t &res_ctr_a : indices( index_map_a.size() ) ) {
+						const size_t &row = index_map_a[ res_ctr_a ];
+						if ( res_ctr_a == anchor.position_a || row < prm_row_begin || row >= prm_row_end ) {
+							continue;
+						}
+						float_score_type * const from_row    = prm_from_scores.data() + row * prm_row_length;
+						float_score_type * const to_row      = prm_to_scores.data()   + row * prm_row_length;
+						const geom::coord       &from_view_a = view_cache_a.get_view( anchor.position_a, res_ctr_a         );
+						const geom::coord       &to_view_a   = view_cache_a.get_view( res_ctr_a,         anchor.position_a );
+						for (const size_t &res_ctr_b : indices( index_map_b.size() ) ) {
+							if ( res_ctr_b != anchor.position_b ) {
+								const size_t &col = index_map_b[ res_ctr_b ];
+								from_row[ col ] += prm_factor * simplified_context_res_vec( from_view_a, view_cache_b.get_view( anchor.position_b, res_ctr_b         ) );
+								to_row  [ col ] += prm_factor * simplified_context_res_vec( to_view_a,   view_cache_b.get_view( res_ctr_b,         anchor.position_b ) );
+							}
+						}
+					}
+				}
+			}
+
+			/// \brief Accumulate the from/to scores of all the specified anchors into the specified (row-major) score matrices,
+			///        partitioning the rows between up to the specified number of threads
+			inline void accumulate_refiner_scores_in_parallel(const refiner_anchor_vec &prm_anchors,         ///< The anchors to score against
+			                                                  const size_vec_vec       &prm_index_maps_a,    ///< The index maps of the entries of the first half of the split
+			                                                  const size_vec_vec       &prm_index_maps_b,    ///< The index maps of the entries of the second half of the split
+			                                                  const view_cache_list    &prm_view_cache_list, ///< The views between the residues of each protein
+			                                                  const size_t             &prm_length_a,        ///< The number of rows of the score matrices
+			                                                  const size_t             &prm_length_b,        ///< The length of each row of the score matrices
+			                                                  const float_score_type   &prm_factor,          ///< The factor by which to multiply each score before adding it
+			                                                  const size_t             &prm_num_threads,     ///< The maximum number of threads to use
+			                                                  float_score_vec          &prm_from_scores,     ///< The matrix of from scores to which scores should be added
+			                                                  float_score_vec          &prm_to_scores        ///< The matrix of to scores to which scores should be added
+			                                                  ) {
+				if ( prm_anchors.empty() ) {
+					return;
+				}
+				const size_t num_row_ranges  = min( prm_num_threads, max( 1_z, prm_length_a ) );
+				const auto   row_range_begin = [&] (const size_t &x) { return ( x * prm_length_a ) / num_row_ranges; };
+				const auto   accumulate_rows = [&] (const size_t &prm_range_ctr) {
+					accumulate_refiner_scores(
+						prm_anchors,
+						prm_index_maps_a,
+						prm_index_maps_b,
+						prm_view_cache_list,
+						prm_length_b,
+						row_range_begin( prm_range_ctr     ),
+						row_range_begin( prm_range_ctr + 1 ),
+						prm_factor,
+						prm_from_scores,
+						prm_to_scores
+					);
+				};
+				if ( num_row_ranges <= 1 ) {
+					accumulate_rows( 0 );
+				}
+				else {
+					vector<future<void>> range_futures;
+					for (const size_t &range_ctr : indices( num_row_ranges ) ) {
+						range_futures.push_back( async( launch::async, accumulate_rows, range_ctr ) );
+					}
+					for (future<void> &range_future : range_futures) {
+						range_future.get();
+					}
+				}
+			}
+
+		} // namespace detail
+	} // namespace align
+} // namespace cath
+
+constexpr double alignment_refiner::MAX_INCREMENTAL_CHANGE_FRACTION;
+
+/// \brief Ctor from the maximum number of threads with which to accumulate the scores for each alignment_split
+///
+/// The threads each accumulate a separate range of rows of the score matrices, so the results don't depend
+/// on the number of threads
+alignment_refiner::alignment_refiner(const size_t                 &prm_num_threads, ///< The maximum number of threads with which to accumulate the scores for each alignment_split
+                                     const alignment_refiner_mode &prm_mode         ///< Whether to update each alignment_split's scores from the previous iteration rather than recalculating them
+                                     ) : num_threads( max( 1_z, prm_num_threads ) ),
+                                         mode       ( prm_mode                     ) {
+}
+
+/// \brief Update the scores cached from the previous refinement of the specified alignment_split into
+///        from_alignment_scores and to_alignment_scores by removing the scores of the anchors that are
+///        no longer aligned and adding the scores of the anchors that are newly aligned
+///
+/// This returns false (and leaves the score matrices untouched) if there is no cache for the split, if the
+/// index maps have changed (which changes the meaning of the rows/columns) or if more than
+/// MAX_INCREMENTAL_CHANGE_FRACTION of the anchors have changed, in which case the caller should recalculate the scores.
+///
+/// Since the subtracted and added scores are summed in a different order from a full recalculation,
+/// the updated scores may differ from recalculated scores by rounding errors.
+bool alignment_refiner::update_scores_from_cache(const alignment_split    &prm_alignment_split, ///< The alignment_split being refined
+                                                 const refiner_anchor_vec &prm_sorted_anchors,  ///< The (sorted) anchors of the current alignment
+                                                 const size_vec_vec       &prm_index_maps_a,    ///< The index maps of the entries of the first half of the split
+                                                 const size_vec_vec       &prm_index_maps_b,    ///< The index maps of the entries of the second half of the split
+                                                 const view_cache_list    &prm_view_cache_list, ///< The views between the residues of each protein
+                                                 const size_t             &prm_length_a,        ///< The length of the first half of the split
+                                                 const size_t             &prm_length_b         ///< The length of the second half of the split
+                                                 ) {
+	const auto cache_itr = split_caches.find( prm_alignment_split );
+	if ( cache_itr == split_caches.end() ) {
+		return false;
+	}
+	refiner_split_cache &the_cache = cache_itr->second;
+	if ( the_cache.index_maps_a != prm_index_maps_a || the_cache.index_maps_b != prm_index_maps_b || the_cache.from_scores.size() != prm_length_a * prm_length_b ) {
+		return false;
+	}
+
+	refiner_anchor_vec removed_anchors;
+	refiner_anchor_vec added_anchors;
+	set_difference( the_cache.sorted_anchors, prm_sorted_anchors, back_inserter( removed_anchors ) );
+	set_difference( prm_sorted_anchors, the_cache.sorted_anchors, back_inserter( added_anchors   ) );
+	const size_t num_changed_anchors = removed_anchors.size() + added_anchors.size();
+	if ( static_cast<double>( num_changed_anchors ) > MAX_INCREMENTAL_CHANGE_FRACTION * static_cast<double>( prm_sorted_anchors.size() ) ) {
+		return false;
+	}
+
+	BOOST_LOG_TRIVIAL( info ) << "Incrementally updating scores for " << num_changed_anchors << " changed anchor(s) of " << prm_sorted_anchors.size();
+
+	swap( from_alignment_scores, the_cache.from_scores );
+	swap( to_alignment_scores,   the_cache.to_scores   );
+	accumulate_refiner_scores_in_parallel( removed_anchors, prm_index_maps_a, prm_index_maps_b, prm_view_cache_list, prm_length_a, prm_length_b, -1.0, num_threads, from_alignment_scores, to_alignment_scores );
+	accumulate_refiner_scores_in_parallel( added_anchors,   prm_index_maps_a, prm_index_maps_b, prm_view_cache_list, prm_length_a, prm_length_b,  1.0, num_threads, from_alignment_scores, to_alignment_scores );
+	return true;
+}
+
 /// \brief TODOCUMENT
 bool_aln_pair alignment_refiner::iterate_step(const alignment       &prm_alignment,       ///< TODOCUMENT
                                               const protein_list    &prm_proteins,        ///< TODOCUMENT
@@ -109,6 +322,15 @@ bool_aln_pair alignment_refiner::iterate_step_for_alignment_split(const alignmen
                                                                   const gap_penalty     &prm_gap_penalty,     ///< TODOCUMENT
                                                                   const alignment_split &prm_alignment_split  ///< TODOCUMENT
                                                                   ) {
+	// If this split has already been refined from this same alignment in incremental mode, reuse the result
+	const bool incremental = ( mode == alignment_refiner_mode::INCREMENTAL );
+	if ( incremental ) {
+		const auto cache_itr = split_caches.find( prm_alignment_split );
+		if ( cache_itr != split_caches.end() && cache_itr->second.input_alignment == prm_alignment ) {
+			return cache_itr->second.result;
+		}
+	}
+
 	const size_vec correct_lengths = get_protein_lengths( prm_proteins );
 
 	BOOST_LOG_TRIVIAL( info ) << "Iterating alignment with " << prm_alignment.num_entries() << " entries";
@@ -132,77 +354,50 @@ bool_aln_pair alignment_refiner::iterate_step_for_alignment_split(const alignmen
 	const size_t full_length_b     = mapping_b.length();
 	const size_t full_window_width = get_window_width_for_full_matrix( full_length_a, full_length_b );
 
-	from_alignment_scores.assign( full_length_a, float_score_vec( full_length_b, 0.0 ) );
-	to_alignment_scores.assign  ( full_length_a, float_score_vec( full_length_b, 0.0 ) );
-
 //	cerr << "number of entries in alignment is " << prm_alignment.num_entries() << endl;
 //	cerr << "number of entries in half a of split is " << mapping_a.num_entries() << endl;
 //	cerr << "number of entries in half b of split is " << mapping_b.num_entries() << endl;
 
-	const alignment::size_type alignment_length = prm_alignment.length();
-	for (const size_t &aln_ctr : indices( alignment_length ) ) {
-		const size_opt mapping_index_a = mapping_a.index_of_orig_aln_index( aln_ctr );
-		const size_opt mapping_index_b = mapping_b.index_of_orig_aln_index( aln_ctr );
-		if ( ! mapping_index_a || ! mapping_index_b ) {
-			continue;
-		}
-//		cerr << "At alignment counter " << aln_ctr << endl;
-
-		const size_vec present_orig_aln_entries_a = present_orig_aln_entries_of_index( mapping_a, *mapping_index_a );
-		const size_vec present_orig_aln_entries_b = present_orig_aln_entries_of_index( mapping_b, *mapping_index_b );
-
-		for (const size_t &present_orig_aln_entry_a : present_orig_aln_entries_a) {
-			for (const size_t &present_orig_aln_entry_b : present_orig_aln_entries_b) {
-				const size_t        present_entry_a = * mapping_a.entry_of_orig_aln_entry( present_orig_aln_entry_a );
-				const size_t        present_entry_b = * mapping_b.entry_of_orig_aln_entry( present_orig_aln_entry_b );
-				const aln_posn_type a_position      = get_position_of_entry_of_index( mapping_a, present_entry_a, *mapping_index_a );
-				const aln_posn_type b_position      = get_position_of_entry_of_index( mapping_b, present_entry_b, *mapping_index_b );
-
-	//			cerr << "Rescoring based on pair " << a_position << ", " << b_position << endl;
-				const protein &protein_a = prm_proteins[ present_orig_aln_entry_a ];
-				const protein &protein_b = prm_proteins[ present_orig_aln_entry_b ];
-				const size_t   length_a  = protein_a.get_length();
-				const size_t   length_b  = protein_b.get_length();
-//				const residue &residue_a = protein_a.get_residue_ref_of_index( a_position );
-//				const residue &residue_b = protein_b.get_residue_ref_of_index( b_position );
-
-				for (const size_t &res_ctr_a : indices( length_a ) ) {
-					for (const size_t &res_ctr_b : indices( length_b ) ) {
-						if ( res_ctr_a != a_position && res_ctr_b != b_position ) {
-							const size_t   other_mapping_index_a = mapping_a.index_of_protein_index( present_entry_a, res_ctr_a );
-							const size_t   other_mapping_index_b = mapping_b.index_of_protein_index( present_entry_b, res_ctr_b );
-//							const residue &other_residue_a       = protein_a.get_residue_ref_of_index( res_ctr_a );
-//							const residue &other_residue_b       = protein_b.get_residue_ref_of_index( res_ctr_b );
-
-							from_alignment_scores[ other_mapping_index_a ][ other_mapping_index_b ] += get_residue_context(
-								prm_view_cache_list,
-								present_orig_aln_entry_a,
-								present_orig_aln_entry_b,
-								a_position,
-								b_position,
-								res_ctr_a,
-								res_ctr_b
-							);
-							to_alignment_scores[ other_mapping_index_a ][ other_mapping_index_b ] += get_residue_context(
-								prm_view_cache_list,
-								present_orig_aln_entry_a,
-								present_orig_aln_entry_b,
-								res_ctr_a,
-								res_ctr_b,
-								a_position,
-								b_position
-							);
-						}
-					}
-				}
-			}
-		}
+	// Precompute the aligned pairs and the mapping indices of each entry's residues
+	// so that the inner loops are just array lookups into the flat score matrices
+	refiner_anchor_vec anchors      = make_refiner_anchors   ( prm_alignment, mapping_a, mapping_b );
+	size_vec_vec       index_maps_a = make_refiner_index_maps( mapping_a, correct_lengths );
+	size_vec_vec       index_maps_b = make_refiner_index_maps( mapping_b, correct_lengths );
+
+	if ( incremental ) {
+		sort( anchors );
+	}
+	const bool updated_from_cache = incremental && update_scores_from_cache(
+		prm_alignment_split,
+		anchors,
+		index_maps_a,
+		index_maps_b,
+		prm_view_cache_list,
+		full_length_a,
+		full_length_b
+	);
+	if ( ! updated_from_cache ) {
+		from_alignment_scores.assign( full_length_a * full_length_b, 0.0 );
+		to_alignment_scores.assign  ( full_length_a * full_length_b, 0.0 );
+		accumulate_refiner_scores_in_parallel(
+			anchors,
+			index_maps_a,
+			index_maps_b,
+			prm_view_cache_list,
+			full_length_a,
+			full_length_b,
+			1.0,
+			num_threads,
+			from_alignment_scores,
+			to_alignment_scores
+		);
 	}
 
 	float_score_vec_vec avg_scores( full_length_a, float_score_vec( full_length_b, 0 ) );
 	for (const size_t &ctr_a : indices( full_length_a ) ) {
 		for (const size_t &ctr_b : indices( full_length_b ) ) {
-			avg_scores[ctr_a][ctr_b] = (from_alignment_scores[ctr_a][ctr_b] + to_alignment_scores[ctr_a][ctr_b]) / 2.0;
+			const size_t cell_index = ctr_a * full_length_b + ctr_b;
+			avg_scores[ctr_a][ctr_b] = (from_alignment_scores[ cell_index ] + to_alignment_scores[ cell_index ]) / 2.0;
 		}
 	}
 
@@ -221,7 +416,25 @@ bool_aln_pair alignment_refiner::iterate_step_for_alignment_split(const alignmen
 			mapping_b
 		)
 	);
-	return make_pair( inserted_residues, new_alignment );
+	bool_aln_pair result = make_pair( inserted_residues, new_alignment );
+
+	// In incremental mode, store the state from which the next refinement of this split can be updated
+	if ( incremental ) {
+		split_caches.erase( prm_alignment_split );
+		split_caches.emplace(
+			prm_alignment_split,
+			refiner_split_cache{
+				prm_alignment,
+				result,
+				std::move( index_maps_a ),
+				std::move( index_maps_b ),
+				std::move( anchors ),
+				std::move( from_alignment_scores ),
+				std::move( to_alignment_scores )
+			}
+		);
+	}
+	return result;
 }
 
 /// \brief TODOCUMENT
@@ -251,6 +464,8 @@ alignment alignment_refiner::iterate(const alignment       &prm_alignment,
 
 	/// \todo Ensure that if using loops, a step that fills in alignment holes is always accepted
 
+	split_caches.clear();
+
 	size_t iter_ctr = 0;
 	alignment prev_alignment( alignment::NUM_ENTRIES_IN_PAIR_ALIGNMENT );
 	alignment curr_alignment( prm_alignment );
@@ -313,6 +528,7 @@ alignment alignment_refiner::iterate_join(const alignment       &prm_alignment,
                                           const gap_penalty     &prm_gap_penalty,     ///< TODOCUMENT
                                           const size_vec        &prm_group            ///< TODOCUMENT
                                           ) {
+	split_caches.clear();
 	return iterate_step_for_alignment_split_list(
 		prm_alignment,
 		prm_proteins,
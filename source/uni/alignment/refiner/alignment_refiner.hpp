@@ -22,10 +22,14 @@
 #define _CATH_TOOLS_SOURCE_UNI_ALIGNMENT_REFINER_ALIGNMENT_REFINER_HPP
 
 #include "alignment/align_type_aliases.hpp"
+#include "alignment/refiner/alignment_refiner_mode.hpp"
+#include "alignment/refiner/detail/alignment_split.hpp"
+#include "alignment/refiner/detail/refiner_split_cache.hpp"
 #include "common/type_aliases.hpp"
 
+#include <map>
+
 namespace cath { namespace align { class alignment; } }
-namespace cath { namespace align { namespace detail { class alignment_split; } } }
 namespace cath { namespace align { namespace detail { class alignment_split_list; } } }
 namespace cath { namespace align { namespace gap { class gap_penalty; } } }
 namespace cath { class protein_list; }
@@ -37,11 +41,31 @@ namespace cath {
 		/// \brief TODOCUMENT
 		class alignment_refiner final {
 		private:
-			/// \brief TODOCUMENT
-			float_score_vec_vec from_alignment_scores;
+			/// \brief The maximum number of threads with which to accumulate the scores for each alignment_split
+			size_t num_threads = 1;
+
+			/// \brief Whether to update each alignment_split's scores from the previous iteration rather than recalculating them
+			alignment_refiner_mode mode = alignment_refiner_mode::FULL;
+
+			/// \brief The state from the most recent refinement of each alignment_split within the current
+			///        call to iterate() / iterate_join() (only used in alignment_refiner_mode::INCREMENTAL)
+			std::map<detail::alignment_split, detail::refiner_split_cache> split_caches;
+
+			/// \brief The scores accumulated from each aligned pair to the other residue pairs
+			///        (stored row-major with a row for each index of the first half of the split)
+			float_score_vec from_alignment_scores;
 
-			/// \brief TODOCUMENT
-			float_score_vec_vec to_alignment_scores;
+			/// \brief The scores accumulated to each aligned pair from the other residue pairs
+			///        (stored row-major with a row for each index of the first half of the split)
+			float_score_vec to_alignment_scores;
+
+			bool update_scores_from_cache(const detail::alignment_split &,
+			                              const detail::refiner_anchor_vec &,
+			                              const size_vec_vec &,
+			                              const size_vec_vec &,
+			                              const index::view_cache_list &,
+			                              const size_t &,
+			                              const size_t &);
 
 			detail::bool_aln_pair iterate_step(const alignment &,
 			                                   const protein_list &,
@@ -61,6 +85,13 @@ namespace cath {
 			                                                       const detail::alignment_split &);
 
 		public:
+			/// \brief The maximum fraction of an alignment_split's anchors that may have changed since the previous iteration
+			///        for the scores to be updated incrementally (above this, recalculating is no more expensive)
+			static constexpr double MAX_INCREMENTAL_CHANGE_FRACTION = 0.5;
+
+			explicit alignment_refiner(const size_t & = 1,
+			                           const alignment_refiner_mode & = alignment_refiner_mode::FULL);
+
 			alignment iterate(const alignment &,
 			                  const protein_list &,
 			                  const gap::gap_penalty &);
@@ -0,0 +1,100 @@
+/// \file
+/// \brief The alignment_refiner_mode class definitions
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "alignment_refiner_mode.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/out_of_range_exception.hpp"
+#include "common/program_options/validator.hpp"
+
+using namespace cath::common;
+
+using boost::any;
+using boost::to_upper;
+using std::istream;
+using std::ostream;
+using std::string;
+
+/// \brief Generate a string describing the specified alignment_refiner_mode
+///
+/// \relates alignment_refiner_mode
+string cath::align::to_string(const alignment_refiner_mode &prm_alignment_refiner_mode ///< The alignment_refiner_mode to describe
+                              ) {
+	switch ( prm_alignment_refiner_mode ) {
+		case ( alignment_refiner_mode::FULL        ) : { return "FULL"        ; }
+		case ( alignment_refiner_mode::INCREMENTAL ) : { return "INCREMENTAL" ; }
+	}
+	BOOST_THROW_EXCEPTION(out_of_range_exception("alignment_refiner_mode value not recognised in to_string()"));
+}
+
+/// \brief Insert a description of the specified alignment_refiner_mode into the specified ostream
+///
+/// \relates alignment_refiner_mode
+ostream & cath::align::operator<<(ostream                      &prm_os,                     ///< The ostream into which the description should be inserted
+                                  const alignment_refiner_mode &prm_alignment_refiner_mode ///< The alignment_refiner_mode to describe
+                                  ) {
+	prm_os << to_string( prm_alignment_refiner_mode );
+	return prm_os;
+}
+
+/// \brief Simple extraction operator for alignment_refiner_mode
+///
+/// \relates alignment_refiner_mode
+istream & cath::align::operator>>(istream                &prm_is,                     ///< The istream from which to extract the alignment_refiner_mode
+                                  alignment_refiner_mode &prm_alignment_refiner_mode ///< The alignment_refiner_mode to populate
+                                  ) {
+	string input_string;
+	prm_is >> input_string;
+	to_upper( input_string );
+	if (      input_string == "FULL"        ) {
+		prm_alignment_refiner_mode = alignment_refiner_mode::FULL;
+	}
+	else if ( input_string == "INCREMENTAL" ) {
+		prm_alignment_refiner_mode = alignment_refiner_mode::INCREMENTAL;
+	}
+	else {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot parse alignment_refiner_mode from string \""+ input_string + "\"" ));
+	}
+	return prm_is;
+}
+
+/// \brief Generate a string containing a description of the specified alignment_refiner_mode
+///
+/// \relates alignment_refiner_mode
+string cath::align::description_of_alignment_refiner_mode(const alignment_refiner_mode &prm_alignment_refiner_mode ///< The alignment_refiner_mode to describe
+                                                          ) {
+	switch ( prm_alignment_refiner_mode ) {
+		case ( alignment_refiner_mode::FULL        ) : { return "Recalculate all the scores on every iteration" ; }
+		case ( alignment_refiner_mode::INCREMENTAL ) : { return "Update the previous iteration's scores with the alignment's changes (faster but the float rounding can make the results differ slightly)" ; }
+	}
+	BOOST_THROW_EXCEPTION(out_of_range_exception("alignment_refiner_mode value not recognised in description_of_alignment_refiner_mode()"));
+}
+
+/// \brief Provide Boost program_options validation for alignment_refiner_mode
+///
+/// \relates alignment_refiner_mode
+void cath::align::validate(any           &prm_value,         ///< The value to populate
+                           const str_vec &prm_value_strings, ///< The string values to validate
+                           alignment_refiner_mode *, int) {
+	prm_value = lex_castable_validator<alignment_refiner_mode>::perform_validate( prm_value, prm_value_strings );
+}
@@ -0,0 +1,66 @@
+/// \file
+/// \brief The alignment_refiner_mode header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_ALIGNMENT_REFINER_ALIGNMENT_REFINER_MODE_HPP
+#define _CATH_TOOLS_SOURCE_UNI_ALIGNMENT_REFINER_ALIGNMENT_REFINER_MODE_HPP
+
+#include <boost/any.hpp>
+
+#include "common/cpp20/make_array.hpp"
+#include "common/type_aliases.hpp"
+
+#include <array>
+#include <string>
+
+namespace cath {
+	namespace align {
+
+		/// \brief Whether an alignment_refiner recalculates all the scores for each alignment_split on every
+		///        iteration or just updates the previous iteration's scores with the alignment's changes
+		enum class alignment_refiner_mode : bool {
+			FULL,       ///< Recalculate all the scores for each alignment_split on every iteration
+			INCREMENTAL ///< Update the scores of each alignment_split with the changes since the previous iteration (and skip unchanged splits)
+		};
+
+		/// \brief A constexpr list of all alignment_refiner_modes
+		static constexpr auto all_alignment_refiner_modes = common::make_array(
+			alignment_refiner_mode::FULL,
+			alignment_refiner_mode::INCREMENTAL
+		);
+
+		std::string to_string(const alignment_refiner_mode &);
+
+		std::ostream & operator<<(std::ostream &,
+		                          const alignment_refiner_mode &);
+
+		std::istream & operator>>(std::istream &,
+		                          alignment_refiner_mode &);
+
+		std::string description_of_alignment_refiner_mode(const alignment_refiner_mode &);
+
+		void validate(boost::any &,
+		              const str_vec &,
+		              alignment_refiner_mode*,
+		              int);
+
+	} // namespace align
+} // namespace cath
+
+#endif
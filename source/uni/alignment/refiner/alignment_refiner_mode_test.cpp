@@ -0,0 +1,52 @@
+/// \file
+/// \brief The alignment_refiner_mode test suite
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "alignment_refiner_mode.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <boost/test/auto_unit_test.hpp>
+
+using namespace cath::align;
+
+using boost::lexical_cast;
+using std::string;
+
+BOOST_AUTO_TEST_SUITE(alignment_refiner_mode_test_suite)
+
+BOOST_AUTO_TEST_CASE(to_string_works) {
+	BOOST_TEST( to_string( alignment_refiner_mode::FULL        ) == "FULL"        );
+	BOOST_TEST( to_string( alignment_refiner_mode::INCREMENTAL ) == "INCREMENTAL" );
+}
+
+BOOST_AUTO_TEST_CASE(insertion_operator_works) {
+	BOOST_TEST( lexical_cast<string>( alignment_refiner_mode::FULL        ) == "FULL"        );
+	BOOST_TEST( lexical_cast<string>( alignment_refiner_mode::INCREMENTAL ) == "INCREMENTAL" );
+}
+
+BOOST_AUTO_TEST_CASE(extraction_operator_works) {
+	BOOST_TEST( lexical_cast<alignment_refiner_mode>( "FULL"        ) == alignment_refiner_mode::FULL        );
+	BOOST_TEST( lexical_cast<alignment_refiner_mode>( "full"        ) == alignment_refiner_mode::FULL        );
+
+	BOOST_TEST( lexical_cast<alignment_refiner_mode>( "INCREMENTAL" ) == alignment_refiner_mode::INCREMENTAL );
+	BOOST_TEST( lexical_cast<alignment_refiner_mode>( "incremental" ) == alignment_refiner_mode::INCREMENTAL );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,15 +22,47 @@
 
 #include "alignment/refiner/alignment_refiner.hpp"
 
+#include "alignment/alignment.hpp"
+#include "alignment/gap/gap_penalty.hpp"
+#include "alignment/io/alignment_io.hpp"
+#include "alignment/refiner/alignment_refiner_mode.hpp"
+#include "score/aligned_pair_score/ssap_score.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/protein_list.hpp"
+#include "structure/protein/protein_source_file_set/protein_from_pdb.hpp"
+#include "structure/protein/protein_source_file_set/protein_source_file_set.hpp"
+#include "structure/protein/residue.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
 using namespace cath::align;
+using namespace cath::align::gap;
+using namespace cath::score;
 
 namespace cath {
 	namespace test {
 
 		/// \brief The alignment_refiner_test_suite_fixture to assist in testing alignment_refiner
-		struct alignment_refiner_test_suite_fixture {
+		struct alignment_refiner_test_suite_fixture : protected global_test_constants {
 		protected:
 			~alignment_refiner_test_suite_fixture() noexcept = default;
+
+			/// \brief Two example proteins
+			const protein_list proteins = read_proteins_from_files(
+				protein_from_pdb(),
+				TEST_SOURCE_DATA_DIR(),
+				{ "1c0pA01", "1hdoA00" }
+			);
+
+			/// \brief A partial alignment between the two example proteins
+			const alignment partial_alignment = read_alignment_from_cath_ssap_legacy_format(
+				TEST_SOURCE_DATA_DIR() / "1c0pA01_1hdoA00.partial_aln.ssap",
+				proteins[ 0 ],
+				proteins[ 1 ],
+				boost::none
+			);
 		};
 
 	}
@@ -44,4 +76,31 @@ BOOST_AUTO_TEST_CASE(basic){
 	BOOST_CHECK( true );
 }
 
+BOOST_AUTO_TEST_CASE(refines_identically_with_multiple_threads) {
+	const alignment single_threaded = alignment_refiner{ 1 }.iterate( partial_alignment, proteins, gap_penalty( 50, 0 ) );
+	const alignment multi_threaded  = alignment_refiner{ 3 }.iterate( partial_alignment, proteins, gap_penalty( 50, 0 ) );
+	BOOST_CHECK_EQUAL( single_threaded.num_entries(), 2 );
+	BOOST_CHECK_GT   ( single_threaded.length(),      0 );
+	BOOST_CHECK( multi_threaded == single_threaded );
+}
+
+BOOST_AUTO_TEST_CASE(refines_similarly_incrementally) {
+	// Incrementally updating the float scores can round differently from recalculating them,
+	// which can tip a close choice the other way, so only require a similarly good alignment
+	const alignment full        = alignment_refiner{ 1, alignment_refiner_mode::FULL        }.iterate( partial_alignment, proteins, gap_penalty( 50, 0 ) );
+	const alignment incremental = alignment_refiner{ 2, alignment_refiner_mode::INCREMENTAL }.iterate( partial_alignment, proteins, gap_penalty( 50, 0 ) );
+	BOOST_CHECK_CLOSE(
+		ssap_score{}.calculate( incremental, proteins[ 0 ], proteins[ 1 ] ),
+		ssap_score{}.calculate( full,        proteins[ 0 ], proteins[ 1 ] ),
+		0.5
+	);
+}
+
+BOOST_AUTO_TEST_CASE(refines_refined_alignment_to_itself_incrementally) {
+	alignment_refiner the_refiner{ 1, alignment_refiner_mode::INCREMENTAL };
+	const alignment refined    = the_refiner.iterate( partial_alignment, proteins, gap_penalty( 50, 0 ) );
+	const alignment re_refined = the_refiner.iterate( refined,           proteins, gap_penalty( 50, 0 ) );
+	BOOST_CHECK( re_refined == refined );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+/// \file
+/// \brief The refiner_split_cache header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_ALIGNMENT_REFINER_DETAIL_REFINER_SPLIT_CACHE_HPP
+#define _CATH_TOOLS_SOURCE_UNI_ALIGNMENT_REFINER_DETAIL_REFINER_SPLIT_CACHE_HPP
+
+#include "alignment/align_type_aliases.hpp"
+#include "alignment/alignment.hpp"
+#include "common/type_aliases.hpp"
+
+#include <tuple>
+#include <vector>
+
+namespace cath {
+	namespace align {
+		namespace detail {
+
+			/// \brief A pair of residues aligned across the two halves of an alignment_split, against which
+			///        all the other pairs of residues from the same two entries are scored
+			struct refiner_anchor final {
+				/// \brief The entry in the original alignment of the residue in the first half
+				size_t orig_entry_a;
+
+				/// \brief The entry in the original alignment of the residue in the second half
+				size_t orig_entry_b;
+
+				/// \brief The entry in the first half's alignment_split_mapping
+				size_t entry_a;
+
+				/// \brief The entry in the second half's alignment_split_mapping
+				size_t entry_b;
+
+				/// \brief The residue's position in the first half's protein
+				size_t position_a;
+
+				/// \brief The residue's position in the second half's protein
+				size_t position_b;
+			};
+
+			/// \brief Type alias for a vector of refiner_anchor
+			using refiner_anchor_vec = std::vector<refiner_anchor>;
+
+			/// \brief Less-than operator for refiner_anchor
+			///
+			/// The entries within each half are determined by the entries in the original alignment,
+			/// so this only needs to compare the original entries and positions
+			inline bool operator<(const refiner_anchor &prm_anchor_a, ///< The first refiner_anchor to compare
+			                      const refiner_anchor &prm_anchor_b  ///< The second refiner_anchor to compare
+			                      ) {
+				return (
+					std::tie( prm_anchor_a.orig_entry_a, prm_anchor_a.orig_entry_b, prm_anchor_a.position_a, prm_anchor_a.position_b )
+					<
+					std::tie( prm_anchor_b.orig_entry_a, prm_anchor_b.orig_entry_b, prm_anchor_b.position_a, prm_anchor_b.position_b )
+				);
+			}
+
+			/// \brief The state from the previous refinement of an alignment_split, from which an
+			///        incremental alignment_refiner can update the scores rather than recalculating them
+			struct refiner_split_cache final {
+				/// \brief The alignment that was refined
+				alignment input_alignment;
+
+				/// \brief Whether the refinement inserted residues and the refined alignment
+				bool_aln_pair result;
+
+				/// \brief The index maps of the entries of the first half of the split
+				size_vec_vec index_maps_a;
+
+				/// \brief The index maps of the entries of the second half of the split
+				size_vec_vec index_maps_b;
+
+				/// \brief The anchors against which the scores were accumulated, sorted
+				refiner_anchor_vec sorted_anchors;
+
+				/// \brief The accumulated from scores (stored row-major with a row for each index of the first half of the split)
+				float_score_vec from_scores;
+
+				/// \brief The accumulated to scores (stored row-major with a row for each index of the first half of the split)
+				float_score_vec to_scores;
+			};
+
+		} // namespace detail
+	} // namespace align
+} // namespace cath
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "residue_name_aligner.hpp"
 
+#include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -27,6 +28,7 @@
 #include "alignment/residue_name_align/detail/residue_name_align_map.hpp"
 #include "alignment/residue_score/residue_scorer.hpp"
 #include "biocore/residue_name.hpp"
+#include "common/algorithm/transform_build.hpp"
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 
@@ -37,6 +39,7 @@ using namespace cath::align::detail;
 using namespace cath::common;
 using namespace std;
 
+using boost::algorithm::all_of;
 using boost::lexical_cast;
 using boost::none;
 
@@ -77,6 +80,20 @@ alignment residue_name_aligner::residue_name_align(const residue_name_vec_vec &p
 		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot residue_name_align() residue lists that are all empty"));
 	}
 
+	// If all the lists are identical (eg several models or copies of the same chain), the alignment
+	// just pairs up each position so skip the work below (but still reject duplicate names as below)
+	const residue_name_vec &first_residue_list = prm_residue_lists.front();
+	if ( all_of( prm_residue_lists, [&] (const residue_name_vec &x) { return ( x == first_residue_list ); } ) ) {
+		make_residue_name_align_map( first_residue_list );
+		return alignment( aln_posn_opt_vec_vec(
+			num_lists,
+			transform_build<aln_posn_opt_vec>(
+				indices( first_residue_list.size() ),
+				[] (const size_t &x) { return aln_posn_opt{ x }; }
+			)
+		) );
+	}
+
 	// Build a vector of residue_name_align_map objects, one for each prm_residue_list
 	vector<residue_name_align_map> maps;
 	maps.reserve(num_lists);
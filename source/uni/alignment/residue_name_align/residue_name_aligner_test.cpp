@@ -166,6 +166,29 @@ BOOST_AUTO_TEST_CASE(identical) {
 	);
 }
 
+/// \brief Check that the residue_name_aligner still throws on duplicate residue names if two lists are completely identical
+BOOST_AUTO_TEST_CASE(identical_with_duplicates) {
+	check_residue_name_aligner_throws(
+		{
+			{ residue_name( 0 ), residue_name( 1 ), residue_name( 0 ) },
+			{ residue_name( 0 ), residue_name( 1 ), residue_name( 0 ) }
+		}
+	);
+}
+
+/// \brief Check that the residue_name_aligner works correctly for more than two identical lists
+BOOST_AUTO_TEST_CASE(multiple_identical) {
+	const residue_name_vec residue_names = { residue_name( 3 ), residue_name( 1 ), residue_name( 2 ) };
+	const alignment my_alignment = residue_name_aligner::residue_name_align( { residue_names, residue_names, residue_names } );
+	BOOST_REQUIRE_EQUAL( my_alignment.num_entries(), 3 );
+	BOOST_REQUIRE_EQUAL( my_alignment.length(),      3 );
+	for (const size_t &entry_ctr : indices( 3_z ) ) {
+		for (const size_t &position_ctr : indices( 3_z ) ) {
+			BOOST_CHECK_EQUAL( my_alignment.position_of_entry_of_index( entry_ctr, position_ctr ).value_or( 9999 ), position_ctr );
+		}
+	}
+}
+
 /// \brief Check that the residue_name_aligner works correctly if the two lists each partially overlap with the other
 BOOST_AUTO_TEST_CASE(partial_overlap) {
 	check_residue_name_aligner_results(
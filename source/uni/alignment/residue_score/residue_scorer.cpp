@@ -44,130 +44,157 @@ using namespace std;
 using boost::filesystem::path;
 using boost::range::set_intersection;
 
-/// \brief TODOCUMENT
-alignment_residue_scores residue_scorer::get_alignment_residue_scores(const alignment    &prm_alignment, ///< TODOCUMENT
-                                                                      const protein_list &prm_proteins   ///< TODOCUMENT
-                                                                      ) const {
-	// Grab the num_entries and length of the alignment and sanity check that there are at least two entries
-	const size_t num_entries = prm_alignment.num_entries();
-	const size_t length      = prm_alignment.length();
-	if ( num_entries <= 1 ) {
-		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot score alignment with fewer than two entries"));
-	}
-
-	float_score_vec_vec numerators  ( num_entries, float_score_vec( length, 0.0 ) );
-	float_score_vec_vec denominators( num_entries, float_score_vec( length, 0.0 ) );
-
-//	cerr << "Attempting to residue score : " << endl;
-//	cerr << horiz_align_outputter( prm_alignment ) << endl;
-
-	/// Loop down the length of the alignment
-	for (const size_t &from_index : indices( length ) ) {
-		const size_vec from_entries = entries_present_at_index( prm_alignment, from_index );
-		if ( from_entries.size() <= 1 ) {
-			continue;
-		}
-
-		for (const size_t &to_index : indices( length ) ) {
-			const size_vec to_entries = entries_present_at_index( prm_alignment, to_index );
-			if ( to_entries.size() <= 1 ) {
-				continue;
-			}
+namespace cath {
+	namespace align {
+		namespace detail {
+
+			/// \brief Implementation of residue_scorer::get_alignment_residue_scores() for any PROTEINS type
+			///        whose operator[] returns something that binds to a const protein &
+			///        (eg protein_list or protein_cref_vec)
+			template <typename PROTEINS>
+			alignment_residue_scores get_alignment_residue_scores_impl(const alignment &prm_alignment, ///< The alignment to score
+			                                                           const PROTEINS  &prm_proteins   ///< The proteins corresponding to the alignment's entries
+			                                                           ) {
+				// Grab the num_entries and length of the alignment and sanity check that there are at least two entries
+				const size_t num_entries = prm_alignment.num_entries();
+				const size_t length      = prm_alignment.length();
+				if ( num_entries <= 1 ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot score alignment with fewer than two entries"));
+				}
+
+				float_score_vec_vec numerators  ( num_entries, float_score_vec( length, 0.0 ) );
+				float_score_vec_vec denominators( num_entries, float_score_vec( length, 0.0 ) );
+
+			//	cerr << "Attempting to residue score : " << endl;
+			//	cerr << horiz_align_outputter( prm_alignment ) << endl;
+
+				/// Loop down the length of the alignment
+				for (const size_t &from_index : indices( length ) ) {
+					const size_vec from_entries = entries_present_at_index( prm_alignment, from_index );
+					if ( from_entries.size() <= 1 ) {
+						continue;
+					}
 
-			size_vec common_entries;
-			common_entries.reserve( min( from_entries.size(), to_entries.size() ) );
-			set_intersection(
-				from_entries,
-				to_entries,
-				back_inserter( common_entries )
-			);
-
-//			fprintf( stderr, "after common_entries\n" );
-//			fprintf( stderr, "from_entries has %ld entries\n", from_entries.size() );
-//			fprintf( stderr, "to_entries has %ld entries\n", to_entries.size() );
-//			fprintf( stderr, "common_entries has %ld entries\n", common_entries.size() );
-
-//			cerr << "From index\t" << from_index << " to index\t" << to_index << endl;
-//			cerr << "\t\tCommon entries are :";
-//			for (const size_t &common_entry : common_entries) {
-//				cerr << "\t" << common_entry;
-//			}
-//			cerr << endl;
-
-			// For some reason, using the following commented code lead to a crash on the release build on orengobuild64.
-			// The crash didn't occur on debug/relwithdebinfo builds on ob64 or any build on bsmlx62 (Ubuntu).
-			// I couldn't see any other problems when using the code without BOOST_FOREACH() (eg valgrind ran clean).
-			// When using the BOOST_FOREACH() code, the crash disappeared on adding a bunch of debug statements.
-			//
-			//
-			//			for (const size_t &common_entry_a : common_entries) {
-			////				fprintf(stderr, "common_entry_a   : %ld\n", common_entry_a);
-			//				for (const size_t &common_entry_b : common_entries) {
-			//					fprintf(stderr, "common_entry_b : %ld\n", common_entry_b);
-			//					if ( common_entry_a < common_entry_b ) {
-			////						fprintf(stderr, "yes\n");
-
-			const size_t common_entries_size = common_entries.size();
-			for (const size_t &comm_ent_ctr_a : indices( common_entries_size ) ) {
-//				fprintf(stderr, "comm_ent_ctr_a : %ld\n", comm_ent_ctr_a);
-				for (const size_t &comm_ent_ctr_b : indices( common_entries_size ) ) {
-//					fprintf(stderr, "comm_ent_ctr_b : %ld\n", comm_ent_ctr_b);
-					if ( comm_ent_ctr_a < comm_ent_ctr_b ) {
-//						fprintf(stderr, "comm_ent_ctr_a <  comm_ent_ctr_b\n" );
-
-						const size_t &common_entry_a = common_entries[comm_ent_ctr_a];
-						const size_t &common_entry_b = common_entries[comm_ent_ctr_b];
-
-//						cerr << "\t\tEntry\t" << common_entry_a << " and\t" << common_entry_b << endl;
-
-						const protein       &protein_a   = prm_proteins[ common_entry_a ];
-						const protein       &protein_b   = prm_proteins[ common_entry_b ];
-
-						const aln_posn_type  posn_a_from = get_position_of_entry_of_index( prm_alignment, common_entry_a, from_index );
-						const aln_posn_type  posn_b_from = get_position_of_entry_of_index( prm_alignment, common_entry_b, from_index );
-
-						const aln_posn_type  posn_a_to   = get_position_of_entry_of_index( prm_alignment, common_entry_a, to_index   );
-						const aln_posn_type  posn_b_to   = get_position_of_entry_of_index( prm_alignment, common_entry_b, to_index   );
-
-						const residue       &res_a_from  = protein_a.get_residue_ref_of_index( posn_a_from );
-						const residue       &res_b_from  = protein_b.get_residue_ref_of_index( posn_b_from );
-						const residue       &res_a_to    = protein_a.get_residue_ref_of_index( posn_a_to   );
-						const residue       &res_b_to    = protein_b.get_residue_ref_of_index( posn_b_to   );
-
-						const float_score_type max_score = residue_querier::RESIDUE_A_VALUE / residue_querier::RESIDUE_B_VALUE;
-						const float_score_type score     = context_res(
-							res_a_from,
-							res_b_from,
-							res_a_to,
-							res_b_to
+					for (const size_t &to_index : indices( length ) ) {
+						const size_vec to_entries = entries_present_at_index( prm_alignment, to_index );
+						if ( to_entries.size() <= 1 ) {
+							continue;
+						}
+
+						size_vec common_entries;
+						common_entries.reserve( min( from_entries.size(), to_entries.size() ) );
+						set_intersection(
+							from_entries,
+							to_entries,
+							back_inserter( common_entries )
 						);
-						numerators  [ common_entry_a ][ from_index ] += score;
-						numerators  [ common_entry_b ][ from_index ] += score;
-						denominators[ common_entry_a ][ from_index ] += max_score;
-						denominators[ common_entry_b ][ from_index ] += max_score;
-
-						numerators  [ common_entry_a ][ to_index   ] += score;
-						numerators  [ common_entry_b ][ to_index   ] += score;
-						denominators[ common_entry_a ][ to_index   ] += max_score;
-						denominators[ common_entry_b ][ to_index   ] += max_score;
+
+			//			fprintf( stderr, "after common_entries\n" );
+			//			fprintf( stderr, "from_entries has %ld entries\n", from_entries.size() );
+			//			fprintf( stderr, "to_entries has %ld entries\n", to_entries.size() );
+			//			fprintf( stderr, "common_entries has %ld entries\n", common_entries.size() );
+
+			//			cerr << "From index\t" << from_index << " to index\t" << to_index << endl;
+			//			cerr << "\t\tCommon entries are :";
+			//			for (const size_t &common_entry : common_entries) {
+			//				cerr << "\t" << common_entry;
+			//			}
+			//			cerr << endl;
+
+						// For some reason, using the following commented code lead to a crash on the release build on orengobuild64.
+						// The crash didn't occur on debug/relwithdebinfo builds on ob64 or any build on bsmlx62 (Ubuntu).
+						// I couldn't see any other problems when using the code without BOOST_FOREACH() (eg valgrind ran clean).
+						// When using the BOOST_FOREACH() code, the crash disappeared on adding a bunch of debug statements.
+						//
+						//
+						//			for (const size_t &common_entry_a : common_entries) {
+						////				fprintf(stderr, "common_entry_a   : %ld\n", common_entry_a);
+						//				for (const size_t &common_entry_b : common_entries) {
+						//					fprintf(stderr, "common_entry_b : %ld\n", common_entry_b);
+						//					if ( common_entry_a < common_entry_b ) {
+						////						fprintf(stderr, "yes\n");
+
+						const size_t common_entries_size = common_entries.size();
+						for (const size_t &comm_ent_ctr_a : indices( common_entries_size ) ) {
+			//				fprintf(stderr, "comm_ent_ctr_a : %ld\n", comm_ent_ctr_a);
+							for (const size_t &comm_ent_ctr_b : indices( common_entries_size ) ) {
+			//					fprintf(stderr, "comm_ent_ctr_b : %ld\n", comm_ent_ctr_b);
+								if ( comm_ent_ctr_a < comm_ent_ctr_b ) {
+			//						fprintf(stderr, "comm_ent_ctr_a <  comm_ent_ctr_b\n" );
+
+									const size_t &common_entry_a = common_entries[comm_ent_ctr_a];
+									const size_t &common_entry_b = common_entries[comm_ent_ctr_b];
+
+			//						cerr << "\t\tEntry\t" << common_entry_a << " and\t" << common_entry_b << endl;
+
+									const protein       &protein_a   = prm_proteins[ common_entry_a ];
+									const protein       &protein_b   = prm_proteins[ common_entry_b ];
+
+									const aln_posn_type  posn_a_from = get_position_of_entry_of_index( prm_alignment, common_entry_a, from_index );
+									const aln_posn_type  posn_b_from = get_position_of_entry_of_index( prm_alignment, common_entry_b, from_index );
+
+									const aln_posn_type  posn_a_to   = get_position_of_entry_of_index( prm_alignment, common_entry_a, to_index   );
+									const aln_posn_type  posn_b_to   = get_position_of_entry_of_index( prm_alignment, common_entry_b, to_index   );
+
+									const residue       &res_a_from  = protein_a.get_residue_ref_of_index( posn_a_from );
+									const residue       &res_b_from  = protein_b.get_residue_ref_of_index( posn_b_from );
+									const residue       &res_a_to    = protein_a.get_residue_ref_of_index( posn_a_to   );
+									const residue       &res_b_to    = protein_b.get_residue_ref_of_index( posn_b_to   );
+
+									const float_score_type max_score = residue_querier::RESIDUE_A_VALUE / residue_querier::RESIDUE_B_VALUE;
+									const float_score_type score     = context_res(
+										res_a_from,
+										res_b_from,
+										res_a_to,
+										res_b_to
+									);
+									numerators  [ common_entry_a ][ from_index ] += score;
+									numerators  [ common_entry_b ][ from_index ] += score;
+									denominators[ common_entry_a ][ from_index ] += max_score;
+									denominators[ common_entry_b ][ from_index ] += max_score;
+
+									numerators  [ common_entry_a ][ to_index   ] += score;
+									numerators  [ common_entry_b ][ to_index   ] += score;
+									denominators[ common_entry_a ][ to_index   ] += max_score;
+									denominators[ common_entry_b ][ to_index   ] += max_score;
+								}
+							}
+						}
 					}
 				}
+
+				score_opt_vec_vec scores( num_entries, score_opt_vec( length ) );
+				for (const size_t &index_ctr : indices( length ) ) {
+					for (const size_t &entry_ctr : indices( num_entries ) ) {
+						if ( has_position_of_entry_of_index( prm_alignment, entry_ctr, index_ctr ) ) {
+							const float_score_type &numerator   = numerators  [ entry_ctr ][ index_ctr ];
+							const float_score_type &denominator = denominators[ entry_ctr ][ index_ctr ];
+							scores[ entry_ctr ][ index_ctr ] = ( denominator != 0.0 ) ? ( numerator / denominator ) : 0.0;
+						}
+					}
+				}
+
+				return make_alignment_residue_scores( prm_alignment, scores );
 			}
-		}
-	}
-
-	score_opt_vec_vec scores( num_entries, score_opt_vec( length ) );
-	for (const size_t &index_ctr : indices( length ) ) {
-		for (const size_t &entry_ctr : indices( num_entries ) ) {
-			if ( has_position_of_entry_of_index( prm_alignment, entry_ctr, index_ctr ) ) {
-				const float_score_type &numerator   = numerators  [ entry_ctr ][ index_ctr ];
-				const float_score_type &denominator = denominators[ entry_ctr ][ index_ctr ];
-				scores[ entry_ctr ][ index_ctr ] = ( denominator != 0.0 ) ? ( numerator / denominator ) : 0.0;
-			}
-		}
-	}
 
-	return make_alignment_residue_scores( prm_alignment, scores );
+		} // namespace detail
+	} // namespace align
+} // namespace cath
+
+/// \brief TODOCUMENT
+alignment_residue_scores residue_scorer::get_alignment_residue_scores(const alignment    &prm_alignment, ///< TODOCUMENT
+                                                                      const protein_list &prm_proteins   ///< TODOCUMENT
+                                                                      ) const {
+	return detail::get_alignment_residue_scores_impl( prm_alignment, prm_proteins );
+}
+
+/// \brief Get the residue scores of the specified alignment against the specified references to proteins
+///
+/// This is useful for scoring against proteins that are held elsewhere without copying them into a protein_list
+alignment_residue_scores residue_scorer::get_alignment_residue_scores(const alignment        &prm_alignment, ///< The alignment to score
+                                                                      const protein_cref_vec &prm_proteins   ///< The proteins corresponding to the alignment's entries
+                                                                      ) const {
+	return detail::get_alignment_residue_scores_impl( prm_alignment, prm_proteins );
 }
 
 
@@ -214,3 +241,18 @@ alignment cath::align::read_and_rescore_fasta_alignment(const path           &pr
 		prm_proteins
 	);
 }
+
+/// \brief Read a FASTA alignment from the specified file against the specified references to proteins and score it
+///
+/// This is equivalent to the protein_list version but it doesn't require the proteins to be copied into a protein_list
+///
+/// \relates residue_scorer
+alignment cath::align::read_and_rescore_fasta_alignment(const path             &prm_fasta_aln_file, ///< The FASTA alignment file to read
+                                                        const protein_cref_vec &prm_proteins,       ///< The proteins corresponding to the alignment's entries
+                                                        const residue_scorer   &prm_residue_scorer, ///< The residue_scorer with which to score the alignment
+                                                        ostream                &prm_stderr          ///< An ostream to which any warnings should be written
+                                                        ) {
+	alignment the_alignment = read_alignment_from_fasta_file( prm_fasta_aln_file, prm_proteins, prm_stderr );
+	the_alignment.set_scores( prm_residue_scorer.get_alignment_residue_scores( the_alignment, prm_proteins ) );
+	return the_alignment;
+}
@@ -23,6 +23,8 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include "structure/structure_type_aliases.hpp"
+
 namespace cath {
 	namespace align {
 		class alignment;
@@ -48,6 +50,9 @@ namespace cath {
 		public:
 			alignment_residue_scores get_alignment_residue_scores(const alignment &,
 			                                                      const protein_list &) const;
+
+			alignment_residue_scores get_alignment_residue_scores(const alignment &,
+			                                                      const protein_cref_vec &) const;
 		};
 
 		void score_alignment(const residue_scorer &,
@@ -63,6 +68,11 @@ namespace cath {
 		                                           const residue_scorer &,
 		                                           std::ostream &);
 
+		alignment read_and_rescore_fasta_alignment(const boost::filesystem::path &,
+		                                           const protein_cref_vec &,
+		                                           const residue_scorer &,
+		                                           std::ostream &);
+
 	} // namespace align
 } // namespace cath
 
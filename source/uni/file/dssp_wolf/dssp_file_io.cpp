@@ -28,7 +28,7 @@
 
 #include "biocore/chain_label.hpp"
 #include "common/exception/runtime_error_exception.hpp"
-#include "common/file/open_fstream.hpp"
+#include "common/file/gzip_file.hpp"
 #include "common/size_t_literal.hpp"
 #include "file/dssp_wolf/dssp_file.hpp"
 #include "structure/protein/residue.hpp"
@@ -48,17 +48,16 @@ using boost::algorithm::is_space;
 using boost::algorithm::starts_with;
 using boost::algorithm::trim_copy;
 using boost::filesystem::path;
+using boost::iostreams::filtering_istream;
 
-/// \brief Parse a dssp_file object from an istream
+/// \brief Parse a dssp_file object from a file, which may be gzipped
 ///
 /// \relates dssp_file
 dssp_file cath::file::read_dssp_file(const path &prm_dssp_file ///< The DSSP file from which to parse a dssp_file object
                                      ) {
-	ifstream my_dssp_istream;
-	open_ifstream( my_dssp_istream, prm_dssp_file );
-	const dssp_file the_dssp_file = read_dssp( my_dssp_istream );
-	my_dssp_istream.close();
-	return the_dssp_file;
+	filtering_istream my_dssp_istream;
+	open_decompressing_istream( my_dssp_istream, prm_dssp_file );
+	return read_dssp( my_dssp_istream );
 }
 
 /// \brief Parse a dssp_file object from an istream
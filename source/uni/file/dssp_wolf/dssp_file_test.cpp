@@ -401,4 +401,13 @@ BOOST_AUTO_TEST_CASE(handles_dssp_using_x_if_any_unknown_hetatm_records) {
 	BOOST_CHECK_EQUAL( log_sink.str(), "" );
 }
 
+BOOST_AUTO_TEST_CASE(reads_gzipped_file_as_uncompressed) {
+	const dssp_file uncompressed_dssp = read_dssp_file( TEST_SOURCE_DATA_DIR() / "1c0pA01.dssp"                   );
+	const dssp_file gzipped_dssp      = read_dssp_file( TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.dssp.gz" );
+	BOOST_REQUIRE_EQUAL( gzipped_dssp.get_num_residues(), uncompressed_dssp.get_num_residues() );
+	for (const size_t &residue_ctr : indices( uncompressed_dssp.get_num_residues() ) ) {
+		BOOST_CHECK( gzipped_dssp.get_residue_of_index( residue_ctr ) == uncompressed_dssp.get_residue_of_index( residue_ctr ) );
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -22,6 +22,7 @@
 #define _CATH_TOOLS_SOURCE_UNI_FILE_FILE_TYPE_ALIASES_HPP
 
 #include <boost/filesystem/path.hpp>
+#include <boost/optional.hpp>
 
 #include "common/type_aliases.hpp"
 #include "file/pdb/pdb_atom_parse_status.hpp"
@@ -100,6 +101,9 @@ namespace cath {
 		/// \brief Type alias for pair of residue_id and pdb_atom
 		using res_id_pdb_atom_pair     = std::pair<residue_id, pdb_atom>;
 
+		/// \brief Type alias for an optional res_id_pdb_atom_pair
+		using res_id_pdb_atom_pair_opt = boost::optional<res_id_pdb_atom_pair>;
+
 		/// \brief Type alias for a vector of res_id_pdb_atom_pair values
 		using res_id_pdb_atom_pair_vec = std::vector<res_id_pdb_atom_pair>;
 
@@ -0,0 +1,98 @@
+/// \file
+/// \brief The hmmer_scores_line_parser class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_HMMER_SCORES_FILE_DETAIL_HMMER_SCORES_LINE_PARSER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_HMMER_SCORES_FILE_DETAIL_HMMER_SCORES_LINE_PARSER_HPP
+
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/string/string_parse_tools.hpp"
+#include "common/type_aliases.hpp"
+#include "file/hmmer_scores_file/hmmer_name_handling.hpp"
+#include "file/hmmer_scores_file/hmmer_scores_entry.hpp"
+
+#include <string>
+
+namespace cath {
+	namespace file {
+
+		/// \brief Helper for parsing HMMER scores lines that, when reused over multiple lines,
+		///        reuses a vector of field iterators and hence avoids wasting time on needless reallocations
+		class hmmer_scores_line_parser final {
+		private:
+			/// \brief Reused vector of iterators wrapping the fields parsed from lines
+			str_citr_str_citr_pair_vec field_itrs;
+
+			std::string field_string(const size_t &) const;
+
+		public:
+			hmmer_scores_entry parse_line(const std::string &,
+			                              const hmmer_name_handling &);
+		};
+
+		/// \brief Get a string of the field of the specified index in the most recently parsed line
+		inline std::string hmmer_scores_line_parser::field_string(const size_t &prm_index ///< The index of the field to get
+		                                                          ) const {
+			return { field_itrs[ prm_index ].first, field_itrs[ prm_index ].second };
+		}
+
+		/// \brief Parse the specified string into a hmmer_scores_entry
+		///
+		/// This avoids splitting the line into strings (as split_build() does) and instead
+		/// parses the numbers directly from the fields of the line.
+		inline hmmer_scores_entry hmmer_scores_line_parser::parse_line(const std::string         &prm_hmmer_line,         ///< The HMMER scores file line to be parsed
+		                                                               const hmmer_name_handling &prm_hmmer_name_handling ///< Whether to strip CATH headers from the names
+		                                                               ) {
+			common::split_into_field_itrs( prm_hmmer_line, field_itrs );
+			if ( field_itrs.size() != 19 ) {
+				BOOST_THROW_EXCEPTION(common::runtime_error_exception("Unable to parse hmmer_scores_entry from line that doesn't contain 19 parts"));
+			}
+
+			const bool strip_headers = ( prm_hmmer_name_handling == hmmer_name_handling::STRIP );
+			const auto raw_name1     = field_string( 0 );
+			const auto raw_name2     = field_string( 2 );
+
+			/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
+			return hmmer_scores_entry{
+				strip_headers ? detail::strip_header_name( raw_name1 ) : raw_name1,
+				field_string( 1 ),
+				strip_headers ? detail::strip_header_name( raw_name2 ) : raw_name2,
+				field_string( 3 ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  4 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  5 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  6 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  7 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  8 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[  9 ] ),
+				common::strtod_field ( prm_hmmer_line, field_itrs[ 10 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 11 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 12 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 13 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 14 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 15 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 16 ] ),
+				common::strtoul_field( prm_hmmer_line, field_itrs[ 17 ] ),
+				field_string( 18 )
+			};
+		}
+
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -18,14 +18,10 @@
 /// You should have received a copy of the GNU General Public License
 /// along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/finder.hpp>
-#include <boost/algorithm/string/predicate.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
-#include "common/boost_addenda/string_algorithm/split_build.hpp"
-#include "common/exception/runtime_error_exception.hpp"
 #include "common/type_aliases.hpp"
+#include "file/hmmer_scores_file/detail/hmmer_scores_line_parser.hpp"
 #include "file/hmmer_scores_file/hmmer_scores_entry.hpp"
 
 #include <iostream> /// ***** TEMPORARY *****
@@ -35,15 +31,14 @@ using namespace cath::common;
 using namespace cath::file;
 using namespace std;
 
-using boost::algorithm::is_space;
-using boost::algorithm::starts_with;
 using boost::numeric_cast;
-using boost::token_compress_on;
 
 /// \brief TODOCUMENT
 string cath::file::detail::strip_header_name(const string &prm_string ///< TODOCUMENT
                                              ) {
-	const regex the_regex( R"(^cath\|\d_\d_\d\|(\d\w{3}\S\d{2})/)" );
+	// Only construct the regex once because that's expensive relative to the search
+	// (and a const regex can safely be searched from multiple threads)
+	static const regex the_regex( R"(^cath\|\d_\d_\d\|(\d\w{3}\S\d{2})/)" );
 	smatch the_smatch;
 	if ( regex_search( prm_string, the_smatch, the_regex ) ) {
 		return prm_string.substr(
@@ -247,39 +242,7 @@ bool cath::file::operator==(const hmmer_scores_entry &prm_entry_a, ///< The firs
 hmmer_scores_entry cath::file::hmmer_scores_entry_from_line(const string              &prm_hmmer_line,         ///< The line from which to parse the data
                                                             const hmmer_name_handling &prm_hmmer_name_handling ///< TODOCUMENT
                                                             ) {
-	const auto line_parts = split_build<str_vec>( prm_hmmer_line, is_space(), token_compress_on );
-	if ( line_parts.size() != 19 ) {
-		BOOST_THROW_EXCEPTION(runtime_error_exception("Unable to parse hmmer_scores_entry from line that doesn't contain 19 parts"));
-	}
-
-	const auto &raw_name1     = line_parts[ 0 ];
-	const auto &raw_name2     = line_parts[ 2 ];
-	const bool  strip_headers = ( prm_hmmer_name_handling == hmmer_name_handling::STRIP );
-	const auto  name1         = strip_headers ? detail::strip_header_name( raw_name1 ) : raw_name1;
-	const auto  name2         = strip_headers ? detail::strip_header_name( raw_name2 ) : raw_name2;
-
-	/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
-	return hmmer_scores_entry{
-		       name1,
-		       line_parts[  1 ],
-		       name2,
-		       line_parts[  3 ],
-		stod ( line_parts[  4 ] ),
-		stod ( line_parts[  5 ] ),
-		stod ( line_parts[  6 ] ),
-		stod ( line_parts[  7 ] ),
-		stod ( line_parts[  8 ] ),
-		stod ( line_parts[  9 ] ),
-		stod ( line_parts[ 10 ] ),
-		stoul( line_parts[ 11 ] ),
-		stoul( line_parts[ 12 ] ),
-		stoul( line_parts[ 13 ] ),
-		stoul( line_parts[ 14 ] ),
-		stoul( line_parts[ 15 ] ),
-		stoul( line_parts[ 16 ] ),
-		stoul( line_parts[ 17 ] ),
-		       line_parts[ 18 ]
-	};
+	return hmmer_scores_line_parser{}.parse_line( prm_hmmer_line, prm_hmmer_name_handling );
 }
 
 /// \brief Simple to_string() overload for hmmer_scores_entry
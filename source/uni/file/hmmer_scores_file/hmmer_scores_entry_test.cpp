@@ -21,6 +21,7 @@
 #include <boost/test/auto_unit_test.hpp>
 
 #include "file/hmmer_scores_file/hmmer_scores_entry.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
 #include "test/test_tools.hpp"
 
 #include <vector>
@@ -30,6 +31,8 @@ using namespace cath::file;
 using namespace cath::file::detail;
 using namespace std;
 
+using cath::common::invalid_argument_exception;
+
 namespace cath {
 	namespace test {
 
@@ -92,6 +95,14 @@ BOOST_AUTO_TEST_CASE(parses_from_line) {
 	);
 }
 
+BOOST_AUTO_TEST_CASE(rejects_line_with_trailing_junk_in_numeric_field) {
+	// std::stoul()/std::stod() used to accept (and ignore) trailing junk such as this but the fields must now be wholly numeric
+	BOOST_CHECK_THROW(
+		hmmer_scores_entry_from_line( "cath|4_0_0|102mA00/0-153-i5                                   -          cath|4_0_0|3ixfA00/1-137 -            5.4e-09   34.1x  0.1   1.1e-08   33.1   0.1   1.4   1   1   0   1   1   1   1 -" ),
+		invalid_argument_exception
+	);
+}
+
 BOOST_AUTO_TEST_CASE(getters) {
 	BOOST_CHECK_EQUAL( eg_entry.get_name_1(),               "102mA00" );
 	BOOST_CHECK_EQUAL( eg_entry.get_accession_1(),          "-"       );
@@ -30,6 +30,7 @@
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "common/file/open_fstream.hpp"
+#include "file/hmmer_scores_file/detail/hmmer_scores_line_parser.hpp"
 #include "file/hmmer_scores_file/hmmer_scores_entry.hpp"
 
 #include <fstream>
@@ -99,14 +100,15 @@ hmmer_scores_entry_vec hmmer_scores_file::remove_duplicates(const hmmer_scores_e
 hmmer_scores_entry_vec hmmer_scores_file::parse_hmmer_scores_file(istream                   &prm_hmmer_scores_is,    ///< The istream of prc scores data from which to parse the hmmer_scores_entry objects
                                                                   const hmmer_name_handling &prm_hmmer_name_handling ///< TODOCUMENT
                                                                   ) {
-	string               line_string;
-	hmmer_scores_entry_vec results;
+	string                   line_string;
+	hmmer_scores_entry_vec   results;
+	hmmer_scores_line_parser parser;
 	while ( getline( prm_hmmer_scores_is, line_string ) ) {
 
 		// If this line is neither empty nor a comment line (a comment line is a line with a '#' character as the first non-whitespace character)
 		trim_left( line_string );
 		if ( ! line_string.empty() && line_string.front() != '#' ) {
-			results.push_back( hmmer_scores_entry_from_line( line_string, prm_hmmer_name_handling ) );
+			results.push_back( parser.parse_line( line_string, prm_hmmer_name_handling ) );
 		}
 	}
 	return results;
@@ -0,0 +1,232 @@
+/// \file
+/// \brief The BinaryCIF reader definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "bcif_reader.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "file/mmcif/detail/atom_site_field.hpp"
+#include "file/mmcif/detail/atom_site_pdb_builder.hpp"
+#include "file/mmcif/detail/bcif_column.hpp"
+#include "file/mmcif/detail/msgpack_value.hpp"
+#include "file/pdb/pdb.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::algorithm::to_lower_copy;
+using boost::filesystem::file_size;
+using boost::filesystem::path;
+using boost::iostreams::mapped_file_source;
+using boost::none;
+using boost::optional;
+using boost::string_ref;
+using std::string;
+using std::vector;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The decoded columns of a BinaryCIF _atom_site category, with access to the values of one row at a time,
+			///        as required by make_atom_site_row()
+			class bcif_atom_site_row final {
+			private:
+				/// \brief The decoded columns
+				vector<bcif_column>                                columns;
+
+				/// \brief The index in columns of each of the fields (or none if the field is absent)
+				std::array<optional<size_t>, NUM_ATOM_SITE_FIELDS> column_index_of_field;
+
+				/// \brief The index of the current row
+				size_t                                             row_index = 0;
+
+				/// \brief Get the column for the specified field, which must be present
+				const bcif_column & column_of_field(const atom_site_field &prm_field ///< The field to query
+				                                    ) const {
+					return columns[ *column_index_of_field[ index_of_atom_site_field( prm_field ) ] ];
+				}
+
+			public:
+				/// \brief Ctor from the msgpack_value of the _atom_site category
+				///
+				/// This decodes all the columns that are used, each in one go.
+				explicit bcif_atom_site_row(const msgpack_value &prm_category ///< The msgpack_value of the _atom_site category
+				                            ) {
+					const auto row_count = static_cast<size_t>( prm_category.at( "rowCount" ).get_integer() );
+					for (const msgpack_value &column : prm_category.at( "columns" ).get_array()) {
+						const atom_site_field_opt field = atom_site_field_of_name( column.at( "name" ).get_string() );
+						if ( field ) {
+							columns.emplace_back( column, atom_site_field_is_numeric( *field ) );
+							if ( columns.back().size() != row_count ) {
+								BOOST_THROW_EXCEPTION(invalid_argument_exception(
+									"BinaryCIF _atom_site column \""
+									+ column.at( "name" ).get_string().to_string()
+									+ "\" doesn't have the category's number of rows"
+								));
+							}
+							column_index_of_field[ index_of_atom_site_field( *field ) ] = columns.size() - 1;
+						}
+					}
+					atom_site_field_presence presence;
+					for (size_t field_ctr = 0; field_ctr < NUM_ATOM_SITE_FIELDS; ++field_ctr) {
+						presence[ field_ctr ] = static_cast<bool>( column_index_of_field[ field_ctr ] );
+					}
+					check_required_atom_site_fields_present( presence );
+				}
+
+				/// \brief Set the index of the current row
+				void set_row_index(const size_t &prm_row_index ///< The index of the row
+				                   ) {
+					row_index = prm_row_index;
+				}
+
+				/// \brief Whether the specified field is present in the category
+				bool has_field(const atom_site_field &prm_field ///< The field to query
+				               ) const {
+					return static_cast<bool>( column_index_of_field[ index_of_atom_site_field( prm_field ) ] );
+				}
+
+				/// \brief Whether the specified field is present and non-null in the current row
+				bool has_value(const atom_site_field &prm_field ///< The field to query
+				               ) const {
+					return has_field( prm_field ) && ! column_of_field( prm_field ).is_null( row_index );
+				}
+
+				/// \brief Get the text of the specified field in the current row
+				string_ref get_text(const atom_site_field &prm_field ///< The field to query
+				                    ) const {
+					return column_of_field( prm_field ).get_text( row_index );
+				}
+
+				/// \brief Get the number in the specified field in the current row
+				double get_number(const atom_site_field &prm_field ///< The field to query
+				                  ) const {
+					return column_of_field( prm_field ).get_number( row_index );
+				}
+			};
+
+			/// \brief Find the _atom_site category in the first data block of the specified BinaryCIF file msgpack_value
+			///
+			/// \returns A pointer to the category or nullptr if there isn't one
+			inline const msgpack_value * find_bcif_atom_site_category(const msgpack_value &prm_file ///< The msgpack_value of the whole BinaryCIF file
+			                                                          ) {
+				const vector<msgpack_value> &data_blocks = prm_file.at( "dataBlocks" ).get_array();
+				if ( data_blocks.empty() ) {
+					return nullptr;
+				}
+				for (const msgpack_value &category : data_blocks.front().at( "categories" ).get_array()) {
+					const string_ref &name = category.at( "name" ).get_string();
+					if ( name == "_atom_site" || name == "atom_site" ) {
+						return &category;
+					}
+				}
+				return nullptr;
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Whether the specified filename has a BinaryCIF extension (".bcif", case-insensitively)
+bool cath::file::is_bcif_filename(const path &prm_filename ///< The filename to query
+                                  ) {
+	return ( to_lower_copy( prm_filename.extension().string() ) == ".bcif" );
+}
+
+/// \brief Read the _atom_site data from the specified BinaryCIF data into the specified pdb
+///
+/// BinaryCIF stores each column as a (MessagePack) block of encoded binary data. Each column that's used
+/// is decoded in one go (without ever formatting/parsing text for the numeric columns) and the strings
+/// refer directly into the data.
+///
+/// The resulting pdb is the same as would be read from the equivalent PDB-format file
+/// (see atom_site_pdb_builder for details)
+///
+/// \throws invalid_argument_exception if the data is malformed or can't be represented
+void cath::file::read_bcif_data(const string_ref &prm_data, ///< The BinaryCIF data (eg from a memory-mapped file)
+                                pdb              &prm_pdb   ///< The pdb to populate
+                                ) {
+	const msgpack_value         bcif_file          = parse_msgpack( prm_data );
+	const msgpack_value * const atom_site_category = find_bcif_atom_site_category( bcif_file );
+	atom_site_pdb_builder builder;
+	if ( atom_site_category != nullptr ) {
+		bcif_atom_site_row row{ *atom_site_category };
+		const auto row_count = static_cast<size_t>( atom_site_category->at( "rowCount" ).get_integer() );
+		for (size_t row_ctr = 0; row_ctr < row_count; ++row_ctr) {
+			row.set_row_index( row_ctr );
+			if ( ! builder.add_row( make_atom_site_row( row ) ) ) {
+				break;
+			}
+		}
+	}
+	builder.finish_into( prm_pdb );
+}
+
+/// \brief Read the specified BinaryCIF file into the specified pdb
+///
+/// The file is memory-mapped to avoid copying its contents.
+///
+/// \throws runtime_error_exception if the file can't be read
+void cath::file::read_bcif_file(const path &prm_filename, ///< The BinaryCIF file to read
+                                pdb        &prm_pdb       ///< The pdb to populate
+                                ) {
+	try {
+		if ( file_size( prm_filename ) == 0 ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF file is empty"));
+		}
+		const mapped_file_source bcif_file{ prm_filename.string() };
+		read_bcif_data( string_ref{ bcif_file.data(), bcif_file.size() }, prm_pdb );
+	}
+	// Catch and immediately rethrow any boost::exceptions
+	// (so that it won't get caught in the next block if it's a std::exception)
+	catch (const boost::exception &ex) {
+		throw;
+	}
+	// Catch any I/O exceptions
+	catch (const std::exception &ex) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			  "Cannot read BinaryCIF file \""
+			+ prm_filename.string()
+			+ "\" ["
+			+ ex.what()
+			+ "]"
+		));
+	}
+}
+
+/// \brief Read a pdb from the specified BinaryCIF file
+///
+/// \throws runtime_error_exception if the file can't be read
+pdb cath::file::read_bcif_file(const path &prm_filename ///< The BinaryCIF file to read
+                               ) {
+	pdb new_pdb;
+	read_bcif_file( prm_filename, new_pdb );
+	return new_pdb;
+}
@@ -0,0 +1,135 @@
+/// \file
+/// \brief The bcif_reader test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "chopping/region/region.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "file/mmcif/bcif_reader.hpp"
+#include "file/mmcif/detail/bcif_column.hpp"
+#include "file/mmcif/detail/msgpack_value.hpp"
+#include "file/mmcif/mmcif_reader.hpp"
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_residue.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::string_ref;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The bcif_reader_test_suite_fixture to assist in testing bcif_reader
+		struct bcif_reader_test_suite_fixture : protected global_test_constants {
+		protected:
+			~bcif_reader_test_suite_fixture() noexcept = default;
+
+			/// \brief Check that the two specified pdbs have the same residues and post-TER residues
+			void check_pdbs_match(const pdb &prm_got,     ///< The pdb that was read
+			                      const pdb &prm_expected ///< The expected pdb
+			                      ) {
+				BOOST_CHECK_EQUAL( prm_got.get_num_residues(),              prm_expected.get_num_residues()              );
+				BOOST_CHECK_EQUAL( prm_got.get_post_ter_residues().size(),  prm_expected.get_post_ter_residues().size()  );
+				BOOST_CHECK_EQUAL( to_pdb_file_string( prm_got ),           to_pdb_file_string( prm_expected )           );
+				BOOST_CHECK_EQUAL(
+					to_pdb_file_string( pdb{}.set_residues( prm_got.get_post_ter_residues()      ) ),
+					to_pdb_file_string( pdb{}.set_residues( prm_expected.get_post_ter_residues() ) )
+				);
+			}
+
+			/// \brief Parse the specified MessagePack bytes
+			static msgpack_value parse_bytes(const string &prm_bytes ///< The MessagePack bytes
+			                                 ) {
+				return parse_msgpack( string_ref{ prm_bytes } );
+			}
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(bcif_reader_test_suite, cath::test::bcif_reader_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(recognises_bcif_filenames) {
+	BOOST_CHECK(   is_bcif_filename( "1bdh.bcif"     ) );
+	BOOST_CHECK(   is_bcif_filename( "dir/1BDH.BCIF" ) );
+	BOOST_CHECK( ! is_bcif_filename( "1bdh.cif"      ) );
+	BOOST_CHECK( ! is_bcif_filename( "1bdh"          ) );
+}
+
+BOOST_AUTO_TEST_CASE(reads_file_as_equivalent_pdb_file) {
+	check_pdbs_match(
+		read_bcif_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.bcif" ),
+		read_pdb_file ( TEST_SOURCE_DATA_DIR() / "supn_content" / "1bdh" )
+	);
+}
+
+BOOST_AUTO_TEST_CASE(reads_file_as_equivalent_mmcif_file) {
+	check_pdbs_match(
+		read_pdb_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.bcif" ),
+		read_pdb_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.cif"  )
+	);
+}
+
+BOOST_AUTO_TEST_CASE(parses_msgpack_values) {
+	// {"a": 1, "bb": [true, nil, -2, 1.5, bin("xy")]}
+	// (the parsed value refers into the bytes, so they must outlive it)
+	const string        bytes{ "\x82\xa1\x61\x01\xa2\x62\x62\x95\xc3\xc0\xfe\xcb\x3f\xf8\x00\x00\x00\x00\x00\x00\xc4\x02\x78\x79", 24 };
+	const msgpack_value value = parse_bytes( bytes );
+	BOOST_CHECK( value.get_type() == msgpack_type::MAP );
+	BOOST_CHECK_EQUAL( value.at( "a" ).get_integer(), 1 );
+	BOOST_CHECK( value.find( "c" ) == nullptr );
+	const auto &array = value.at( "bb" ).get_array();
+	BOOST_REQUIRE_EQUAL( array.size(), 5 );
+	BOOST_CHECK      ( array[ 0 ].get_boolean()                             );
+	BOOST_CHECK      ( array[ 1 ].is_nil()                                  );
+	BOOST_CHECK_EQUAL( array[ 2 ].get_integer(),                       -2   );
+	BOOST_CHECK_EQUAL( array[ 3 ].get_number(),                        1.5  );
+	BOOST_CHECK_EQUAL( array[ 4 ].get_binary().to_string(),            "xy" );
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_malformed_msgpack) {
+	BOOST_CHECK_THROW( parse_bytes( string{ "\x92\x01",     2 } ), invalid_argument_exception ); // Truncated array
+	BOOST_CHECK_THROW( parse_bytes( string{ "\xa3\x61\x62", 3 } ), invalid_argument_exception ); // Truncated string
+	BOOST_CHECK_THROW( parse_bytes( string{ "\x01\x02",     2 } ), invalid_argument_exception ); // Trailing bytes
+	BOOST_CHECK_THROW( parse_bytes( string{ "\x81\x01\x01", 3 } ), invalid_argument_exception ); // Non-string key
+}
+
+BOOST_AUTO_TEST_CASE(decodes_integer_packing) {
+	BOOST_CHECK_EQUAL_RANGES( decode_bcif_integer_packing( { 127, 3, -128, -5, 1 }, false, 1, 3 ), int64_vec( { 130, -133, 1 } ) );
+	BOOST_CHECK_EQUAL_RANGES( decode_bcif_integer_packing( { 255, 255, 2         }, true,  1, 1 ), int64_vec( { 512          } ) );
+	BOOST_CHECK_EQUAL_RANGES( decode_bcif_integer_packing( { 32767, 1            }, false, 2, 1 ), int64_vec( { 32768        } ) );
+	BOOST_CHECK_THROW( decode_bcif_integer_packing( { 127                 }, false, 1, 1 ), invalid_argument_exception );
+	BOOST_CHECK_THROW( decode_bcif_integer_packing( { 1, 2                }, false, 1, 1 ), invalid_argument_exception );
+	BOOST_CHECK_THROW( decode_bcif_integer_packing( { 1                   }, false, 4, 1 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_invalid_files) {
+	BOOST_CHECK_THROW( read_bcif_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "does_not_exist.bcif" ), runtime_error_exception    );
+	BOOST_CHECK_THROW( read_bcif_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.cif"            ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
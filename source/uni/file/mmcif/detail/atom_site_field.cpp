@@ -0,0 +1,128 @@
+/// \file
+/// \brief The atom_site_field definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "atom_site_field.hpp"
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+
+#include <utility>
+
+using namespace cath::common;
+using namespace cath::file::detail;
+
+using boost::algorithm::iequals;
+using boost::none;
+using boost::string_ref;
+using std::make_pair;
+using std::pair;
+
+/// \brief Get the atom_site_field with the specified name (without any "_atom_site." prefix) or none if it isn't one of the fields that's used
+///
+/// As for all CIF data names, the comparison is case-insensitive.
+atom_site_field_opt cath::file::detail::atom_site_field_of_name(const string_ref &prm_name ///< The name of the field (eg "Cartn_x")
+                                                                ) {
+	static const std::array<pair<string_ref, atom_site_field>, NUM_ATOM_SITE_FIELDS> names_and_fields = { {
+		make_pair( string_ref{ "group_PDB"          }, atom_site_field::GROUP_PDB          ),
+		make_pair( string_ref{ "id"                 }, atom_site_field::ID                 ),
+		make_pair( string_ref{ "type_symbol"        }, atom_site_field::TYPE_SYMBOL        ),
+		make_pair( string_ref{ "label_atom_id"      }, atom_site_field::LABEL_ATOM_ID      ),
+		make_pair( string_ref{ "label_alt_id"       }, atom_site_field::LABEL_ALT_ID       ),
+		make_pair( string_ref{ "label_comp_id"      }, atom_site_field::LABEL_COMP_ID      ),
+		make_pair( string_ref{ "label_asym_id"      }, atom_site_field::LABEL_ASYM_ID      ),
+		make_pair( string_ref{ "label_seq_id"       }, atom_site_field::LABEL_SEQ_ID       ),
+		make_pair( string_ref{ "pdbx_PDB_ins_code"  }, atom_site_field::PDBX_PDB_INS_CODE  ),
+		make_pair( string_ref{ "Cartn_x"            }, atom_site_field::CARTN_X            ),
+		make_pair( string_ref{ "Cartn_y"            }, atom_site_field::CARTN_Y            ),
+		make_pair( string_ref{ "Cartn_z"            }, atom_site_field::CARTN_Z            ),
+		make_pair( string_ref{ "occupancy"          }, atom_site_field::OCCUPANCY          ),
+		make_pair( string_ref{ "B_iso_or_equiv"     }, atom_site_field::B_ISO_OR_EQUIV     ),
+		make_pair( string_ref{ "pdbx_formal_charge" }, atom_site_field::PDBX_FORMAL_CHARGE ),
+		make_pair( string_ref{ "auth_seq_id"        }, atom_site_field::AUTH_SEQ_ID        ),
+		make_pair( string_ref{ "auth_comp_id"       }, atom_site_field::AUTH_COMP_ID       ),
+		make_pair( string_ref{ "auth_asym_id"       }, atom_site_field::AUTH_ASYM_ID       ),
+		make_pair( string_ref{ "auth_atom_id"       }, atom_site_field::AUTH_ATOM_ID       ),
+		make_pair( string_ref{ "pdbx_PDB_model_num" }, atom_site_field::PDBX_PDB_MODEL_NUM ),
+	} };
+	for (const pair<string_ref, atom_site_field> &name_and_field : names_and_fields) {
+		if ( iequals( name_and_field.first, prm_name ) ) {
+			return name_and_field.second;
+		}
+	}
+	return none;
+}
+
+/// \brief Whether the specified atom_site_field holds numeric values (rather than text)
+bool cath::file::detail::atom_site_field_is_numeric(const atom_site_field &prm_field ///< The field to query
+                                                    ) {
+	switch ( prm_field ) {
+		case ( atom_site_field::ID                 ) :
+		case ( atom_site_field::LABEL_SEQ_ID       ) :
+		case ( atom_site_field::CARTN_X            ) :
+		case ( atom_site_field::CARTN_Y            ) :
+		case ( atom_site_field::CARTN_Z            ) :
+		case ( atom_site_field::OCCUPANCY          ) :
+		case ( atom_site_field::B_ISO_OR_EQUIV     ) :
+		case ( atom_site_field::PDBX_FORMAL_CHARGE ) :
+		case ( atom_site_field::AUTH_SEQ_ID        ) :
+		case ( atom_site_field::PDBX_PDB_MODEL_NUM ) : {
+			return true;
+		}
+		case ( atom_site_field::GROUP_PDB          ) :
+		case ( atom_site_field::TYPE_SYMBOL        ) :
+		case ( atom_site_field::LABEL_ATOM_ID      ) :
+		case ( atom_site_field::LABEL_ALT_ID       ) :
+		case ( atom_site_field::LABEL_COMP_ID      ) :
+		case ( atom_site_field::LABEL_ASYM_ID      ) :
+		case ( atom_site_field::PDBX_PDB_INS_CODE  ) :
+		case ( atom_site_field::AUTH_COMP_ID       ) :
+		case ( atom_site_field::AUTH_ASYM_ID       ) :
+		case ( atom_site_field::AUTH_ATOM_ID       ) : {
+			return false;
+		}
+	}
+	BOOST_THROW_EXCEPTION(invalid_argument_exception("Value of atom_site_field not recognised whilst checking whether it's numeric"));
+}
+
+/// \brief Check that the fields required to build a pdb are present
+///
+/// \throws invalid_argument_exception if any required fields are missing
+void cath::file::detail::check_required_atom_site_fields_present(const atom_site_field_presence &prm_presence ///< Which fields are present
+                                                                 ) {
+	const auto has_fn = [&] (const atom_site_field &x) {
+		return prm_presence[ index_of_atom_site_field( x ) ];
+	};
+	if ( ! has_fn( atom_site_field::CARTN_X ) || ! has_fn( atom_site_field::CARTN_Y ) || ! has_fn( atom_site_field::CARTN_Z ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read mmCIF _atom_site data without the Cartn_x, Cartn_y and Cartn_z fields"));
+	}
+	if ( ! has_fn( atom_site_field::AUTH_ATOM_ID ) && ! has_fn( atom_site_field::LABEL_ATOM_ID ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read mmCIF _atom_site data without either an auth_atom_id or a label_atom_id field"));
+	}
+	if ( ! has_fn( atom_site_field::AUTH_COMP_ID ) && ! has_fn( atom_site_field::LABEL_COMP_ID ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read mmCIF _atom_site data without either an auth_comp_id or a label_comp_id field"));
+	}
+	if ( ! has_fn( atom_site_field::AUTH_ASYM_ID ) && ! has_fn( atom_site_field::LABEL_ASYM_ID ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read mmCIF _atom_site data without either an auth_asym_id or a label_asym_id field"));
+	}
+	if ( ! has_fn( atom_site_field::AUTH_SEQ_ID ) && ! has_fn( atom_site_field::LABEL_SEQ_ID ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read mmCIF _atom_site data without either an auth_seq_id or a label_seq_id field"));
+	}
+}
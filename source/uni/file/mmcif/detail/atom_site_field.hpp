@@ -0,0 +1,84 @@
+/// \file
+/// \brief The atom_site_field header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_ATOM_SITE_FIELD_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_ATOM_SITE_FIELD_HPP
+
+#include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <array>
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The fields of the mmCIF _atom_site category that are used to build a pdb
+			///
+			/// The auth_ fields are preferred (because they match the PDB-format files) with the label_ fields as fall-backs.
+			enum class atom_site_field : char {
+				GROUP_PDB,          ///< "ATOM" or "HETATM"
+				ID,                 ///< The atom serial number
+				TYPE_SYMBOL,        ///< The element symbol
+				LABEL_ATOM_ID,      ///< The atom name
+				LABEL_ALT_ID,       ///< The alternate location indicator
+				LABEL_COMP_ID,      ///< The residue name
+				LABEL_ASYM_ID,      ///< The chain identifier
+				LABEL_SEQ_ID,       ///< The residue number within the polymer entity (null for non-polymer entities)
+				PDBX_PDB_INS_CODE,  ///< The insertion code
+				CARTN_X,            ///< The x coordinate
+				CARTN_Y,            ///< The y coordinate
+				CARTN_Z,            ///< The z coordinate
+				OCCUPANCY,          ///< The occupancy
+				B_ISO_OR_EQUIV,     ///< The temperature factor
+				PDBX_FORMAL_CHARGE, ///< The formal charge
+				AUTH_SEQ_ID,        ///< The author's residue number (as used in PDB-format files)
+				AUTH_COMP_ID,       ///< The author's residue name
+				AUTH_ASYM_ID,       ///< The author's chain identifier (as used in PDB-format files)
+				AUTH_ATOM_ID,       ///< The author's atom name
+				PDBX_PDB_MODEL_NUM  ///< The model number
+			};
+
+			/// \brief The number of atom_site_field values
+			constexpr size_t NUM_ATOM_SITE_FIELDS = 20;
+
+			/// \brief Type alias for an optional atom_site_field
+			using atom_site_field_opt = boost::optional<atom_site_field>;
+
+			/// \brief Type alias for an array of bools indicating which of the atom_site_field values are present
+			using atom_site_field_presence = std::array<bool, NUM_ATOM_SITE_FIELDS>;
+
+			/// \brief Get the index of the specified atom_site_field (for indexing into arrays over the fields)
+			inline constexpr size_t index_of_atom_site_field(const atom_site_field &prm_field ///< The field to query
+			                                                 ) {
+				return static_cast<size_t>( prm_field );
+			}
+
+			atom_site_field_opt atom_site_field_of_name(const boost::string_ref &);
+
+			bool atom_site_field_is_numeric(const atom_site_field &);
+
+			void check_required_atom_site_fields_present(const atom_site_field_presence &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
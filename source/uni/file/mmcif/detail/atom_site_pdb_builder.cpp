@@ -0,0 +1,212 @@
+/// \file
+/// \brief The atom_site_pdb_builder class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "atom_site_pdb_builder.hpp"
+
+#include <boost/log/trivial.hpp>
+
+#include "biocore/chain_label.hpp"
+#include "biocore/residue_id.hpp"
+#include "biocore/residue_name.hpp"
+#include "common/algorithm/contains.hpp"
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_atom.hpp"
+#include "structure/geometry/coord.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+using namespace cath::geom;
+
+using boost::none;
+using boost::optional;
+using boost::string_ref;
+using std::string;
+
+/// \brief Get the amino_acid for the specified row, reusing the previous one if the residue name and record type are unchanged
+///
+/// \returns The amino_acid or none if the residue name isn't recognised
+optional<amino_acid> atom_site_pdb_builder::get_amino_acid(const atom_site_row &prm_row ///< The row
+                                                           ) {
+	const auto residue_name_chars = pdb_residue_name_of_mmcif_comp_id( prm_row.residue_name );
+	if ( ! residue_name_chars ) {
+		return none;
+	}
+	if ( ! prev_amino_acid || prm_row.record_type != prev_record_type || *residue_name_chars != prev_residue_name_chars ) {
+		prev_residue_name_chars = *residue_name_chars;
+		prev_record_type        = prm_row.record_type;
+		try {
+			prev_amino_acid = get_amino_acid_of_string_and_record(
+				string{ residue_name_chars->begin(), residue_name_chars->end() },
+				prm_row.record_type
+			);
+		}
+		catch (...) {
+			prev_amino_acid = none;
+		}
+	}
+	return prev_amino_acid;
+}
+
+/// \brief Add the specified row
+///
+/// \returns Whether further rows should be added (ie false once a row from a second model is reached)
+bool atom_site_pdb_builder::add_row(const atom_site_row &prm_row ///< The row to add
+                                    ) {
+	// Only read the first model, as for PDB-format files
+	if ( ! first_model_number ) {
+		first_model_number = prm_row.model_number;
+	}
+	else if ( prm_row.model_number != *first_model_number ) {
+		return false;
+	}
+
+	const auto the_amino_acid = get_amino_acid( prm_row );
+	const auto atom_name      = pdb_atom_name_of_mmcif_atom_id( prm_row.atom_name, prm_row.element_symbol );
+	if ( ! the_amino_acid || ! atom_name ) {
+		BOOST_LOG_TRIVIAL( warning ) << "Skipping mmCIF atom_site entry for atom "
+		                             << prm_row.atom_serial
+		                             << " with message: "
+		                             << ( ! atom_name ? "Cannot represent atom name \"" : "Do not recognise amino acid entry: \"" )
+		                             << ( ! atom_name ? prm_row.atom_name               : prm_row.residue_name                    )
+		                             << "\"";
+		return true;
+	}
+
+	// Skip (with a single warning per chain) the atoms of any chain whose identifier can't be represented
+	const auto chain_label_opt = chain_label_of_mmcif_chain_id( prm_row.chain_id );
+	if ( ! chain_label_opt ) {
+		if ( skipped_chain_ids.insert( prm_row.chain_id.to_string() ).second ) {
+			BOOST_LOG_TRIVIAL( warning ) << "Skipping mmCIF atom_site entries for chain \""
+			                             << prm_row.chain_id
+			                             << "\" because cath-tools' structures only support single-character chain labels (as for PDB-format files)";
+		}
+		return true;
+	}
+
+	// Treat the first non-polymer atom in each chain as following a TER record for that chain
+	const chain_label &the_chain_label = *chain_label_opt;
+	if ( ! prm_row.is_polymer && ! contains( non_polymer_chains, the_chain_label ) ) {
+		non_polymer_chains.insert( the_chain_label );
+		residues_builder.add_ter_of_chain( the_chain_label );
+	}
+
+	residues_builder.add_atom(
+		residue_id{
+			the_chain_label,
+			make_residue_name_with_non_insert_char( prm_row.residue_number, prm_row.insert_code, ' ' )
+		},
+		pdb_atom(
+			prm_row.record_type,
+			prm_row.atom_serial,
+			*atom_name,
+			prm_row.alt_locn,
+			*the_amino_acid,
+			coord{ prm_row.coord_x, prm_row.coord_y, prm_row.coord_z },
+			prm_row.occupancy,
+			prm_row.temp_factor,
+			pdb_element_symbol_of_mmcif_type_symbol( prm_row.element_symbol ),
+			pdb_charge_of_mmcif_formal_charge( prm_row.charge )
+		)
+	);
+	return true;
+}
+
+/// \brief Complete any residue currently being read and set the residues in the specified pdb
+void atom_site_pdb_builder::finish_into(pdb &prm_pdb ///< The pdb to populate
+                                        ) {
+	residues_builder.finish_into( prm_pdb );
+}
+
+/// \brief Get the chain_label for the specified mmCIF chain identifier
+///
+/// \returns The chain_label or none if the identifier has more than one character because
+///          that can't be represented in the PDB-based structures (as for PDB-format files)
+optional<chain_label> cath::file::detail::chain_label_of_mmcif_chain_id(const string_ref &prm_chain_id ///< The mmCIF chain identifier (eg auth_asym_id)
+                                                                        ) {
+	if ( prm_chain_id.length() > 1 ) {
+		return none;
+	}
+	return chain_label( prm_chain_id.empty() ? ' ' : prm_chain_id.front() );
+}
+
+/// \brief Get the three-character PDB residue name for the specified mmCIF comp_id
+///
+/// As in PDB-format files, shorter names are right-justified (eg "DT" becomes " DT").
+///
+/// \returns The residue name or none if the comp_id is too long to be represented
+optional<char_3_arr> cath::file::detail::pdb_residue_name_of_mmcif_comp_id(const string_ref &prm_comp_id ///< The mmCIF comp_id (eg "SER")
+                                                                           ) {
+	if ( prm_comp_id.length() > 3 ) {
+		return none;
+	}
+	char_3_arr residue_name = { { ' ', ' ', ' ' } };
+	std::copy( prm_comp_id.begin(), prm_comp_id.end(), residue_name.end() - static_cast<ptrdiff_t>( prm_comp_id.length() ) );
+	return residue_name;
+}
+
+/// \brief Get the four-character PDB atom name for the specified mmCIF atom_id and element symbol
+///
+/// This follows the PDB-format convention of starting names in the second column unless they have
+/// four characters or a two-character element symbol (eg " CA " for an alpha carbon but "CA  " for calcium).
+///
+/// \returns The atom name or none if the atom_id is too long to be represented
+optional<char_4_arr> cath::file::detail::pdb_atom_name_of_mmcif_atom_id(const string_ref &prm_atom_id,    ///< The mmCIF atom_id (eg "CA")
+                                                                        const string_ref &prm_type_symbol ///< The mmCIF type_symbol (eg "C")
+                                                                        ) {
+	if ( prm_atom_id.length() > 4 ) {
+		return none;
+	}
+	const bool starts_in_first_col = ( prm_atom_id.length() == 4 || prm_type_symbol.length() == 2 );
+	char_4_arr atom_name = { { ' ', ' ', ' ', ' ' } };
+	std::copy( prm_atom_id.begin(), prm_atom_id.end(), atom_name.begin() + ( starts_in_first_col ? 0 : 1 ) );
+	return atom_name;
+}
+
+/// \brief Get the right-justified, upper-case, two-character PDB element symbol for the specified mmCIF type_symbol
+char_2_arr cath::file::detail::pdb_element_symbol_of_mmcif_type_symbol(const string_ref &prm_type_symbol ///< The mmCIF type_symbol (eg "C" or "Fe")
+                                                                       ) {
+	const auto upper_fn = [] (const char &x) { return static_cast<char>( std::toupper( x ) ); };
+	switch ( prm_type_symbol.length() ) {
+		case ( 0 ) : { return { { ' ',                                ' '                               } }; }
+		case ( 1 ) : { return { { ' ',                                upper_fn( prm_type_symbol[ 0 ] ) } }; }
+		default    : { return { { upper_fn( prm_type_symbol[ 0 ] ),   upper_fn( prm_type_symbol[ 1 ] ) } }; }
+	}
+}
+
+/// \brief Get the two-character PDB charge (eg "2+") for the specified mmCIF formal charge
+///
+/// Zero and charges too large to represent give a blank charge.
+char_2_arr cath::file::detail::pdb_charge_of_mmcif_formal_charge(const int &prm_charge ///< The formal charge (eg -1)
+                                                                 ) {
+	if ( prm_charge == 0 || std::abs( prm_charge ) > 9 ) {
+		return { { ' ', ' ' } };
+	}
+	return { {
+		static_cast<char>( '0' + std::abs( prm_charge ) ),
+		( prm_charge > 0 ) ? '+' : '-'
+	} };
+}
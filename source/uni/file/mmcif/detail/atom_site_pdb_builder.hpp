@@ -0,0 +1,208 @@
+/// \file
+/// \brief The atom_site_pdb_builder class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_ATOM_SITE_PDB_BUILDER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_ATOM_SITE_PDB_BUILDER_HPP
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include "common/char_arr_type_aliases.hpp"
+#include "file/mmcif/detail/atom_site_field.hpp"
+#include "file/pdb/detail/pdb_residues_builder.hpp"
+#include "file/pdb/pdb_record.hpp"
+#include "structure/protein/amino_acid.hpp"
+#include "structure/structure_type_aliases.hpp"
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The values from one row of an mmCIF _atom_site category that are used to build a pdb
+			///
+			/// The text values refer to memory owned elsewhere (eg the memory-mapped file) and are empty for null ('.' or '?') values.
+			struct atom_site_row final {
+				/// \brief Whether this is an ATOM or HETATM entry
+				pdb_record        record_type    = pdb_record::ATOM;
+
+				/// \brief The atom serial number
+				uint              atom_serial    = 0;
+
+				/// \brief The atom name (eg "CA")
+				boost::string_ref atom_name;
+
+				/// \brief The alternate location indicator
+				char              alt_locn       = ' ';
+
+				/// \brief The residue name (eg "SER")
+				boost::string_ref residue_name;
+
+				/// \brief The chain identifier
+				boost::string_ref chain_id;
+
+				/// \brief The residue number
+				int               residue_number = 0;
+
+				/// \brief The insertion code
+				char              insert_code    = ' ';
+
+				/// \brief The x coordinate
+				double            coord_x        = 0.0;
+
+				/// \brief The y coordinate
+				double            coord_y        = 0.0;
+
+				/// \brief The z coordinate
+				double            coord_z        = 0.0;
+
+				/// \brief The occupancy
+				float             occupancy      = 1.0;
+
+				/// \brief The temperature factor
+				float             temp_factor    = 0.0;
+
+				/// \brief The element symbol (eg "C")
+				boost::string_ref element_symbol;
+
+				/// \brief The formal charge
+				int               charge         = 0;
+
+				/// \brief The model number
+				int               model_number   = 1;
+
+				/// \brief Whether this atom is part of a polymer (rather than a ligand, water etc)
+				bool              is_polymer     = true;
+			};
+
+			/// \brief Make an atom_site_row from the specified source of values for the current row
+			///
+			/// The source must provide:
+			///  * `bool has_field(const atom_site_field &) const` (whether the field is present in the category)
+			///  * `bool has_value(const atom_site_field &) const` (whether the field is present and non-null in this row)
+			///  * `boost::string_ref get_text(const atom_site_field &) const`
+			///  * `double get_number(const atom_site_field &) const`
+			///
+			/// This uses the auth_ fields where present (because they match the PDB-format files) and otherwise the label_ fields.
+			template <typename SRC>
+			atom_site_row make_atom_site_row(const SRC &prm_source ///< The source of values for the row
+			                                 ) {
+				const auto text_fn = [&] (const atom_site_field &prm_field, const atom_site_field &prm_fallback_field) {
+					return prm_source.has_value( prm_field          ) ? prm_source.get_text( prm_field          ) :
+					       prm_source.has_value( prm_fallback_field ) ? prm_source.get_text( prm_fallback_field ) :
+					                                                    boost::string_ref{};
+				};
+				const auto char_fn = [&] (const atom_site_field &prm_field) {
+					return ( prm_source.has_value( prm_field ) && ! prm_source.get_text( prm_field ).empty() )
+						? prm_source.get_text( prm_field ).front()
+						: ' ';
+				};
+				const auto number_fn = [&] (const atom_site_field &prm_field, const double &prm_default) {
+					return prm_source.has_value( prm_field ) ? prm_source.get_number( prm_field ) : prm_default;
+				};
+
+				atom_site_row row;
+				row.record_type    = ( prm_source.has_value( atom_site_field::GROUP_PDB )
+				                       && boost::algorithm::iequals( prm_source.get_text( atom_site_field::GROUP_PDB ), "HETATM" ) )
+				                     ? pdb_record::HETATM
+				                     : pdb_record::ATOM;
+				row.atom_serial    = static_cast<uint >( number_fn( atom_site_field::ID,                 0.0 ) );
+				row.atom_name      =                     text_fn  ( atom_site_field::AUTH_ATOM_ID, atom_site_field::LABEL_ATOM_ID );
+				row.alt_locn       =                     char_fn  ( atom_site_field::LABEL_ALT_ID                                 );
+				row.residue_name   =                     text_fn  ( atom_site_field::AUTH_COMP_ID, atom_site_field::LABEL_COMP_ID );
+				row.chain_id       =                     text_fn  ( atom_site_field::AUTH_ASYM_ID, atom_site_field::LABEL_ASYM_ID );
+				row.residue_number = static_cast<int  >( prm_source.has_value( atom_site_field::AUTH_SEQ_ID )
+				                                         ? prm_source.get_number( atom_site_field::AUTH_SEQ_ID  )
+				                                         : number_fn( atom_site_field::LABEL_SEQ_ID, 0.0 ) );
+				row.insert_code    =                     char_fn  ( atom_site_field::PDBX_PDB_INS_CODE                            );
+				row.coord_x        =                     number_fn( atom_site_field::CARTN_X,            0.0 );
+				row.coord_y        =                     number_fn( atom_site_field::CARTN_Y,            0.0 );
+				row.coord_z        =                     number_fn( atom_site_field::CARTN_Z,            0.0 );
+				row.occupancy      = static_cast<float>( number_fn( atom_site_field::OCCUPANCY,          1.0 ) );
+				row.temp_factor    = static_cast<float>( number_fn( atom_site_field::B_ISO_OR_EQUIV,     0.0 ) );
+				row.element_symbol = prm_source.has_value( atom_site_field::TYPE_SYMBOL ) ? prm_source.get_text( atom_site_field::TYPE_SYMBOL )
+				                                                                           : boost::string_ref{};
+				row.charge         = static_cast<int  >( number_fn( atom_site_field::PDBX_FORMAL_CHARGE, 0.0 ) );
+				row.model_number   = static_cast<int  >( number_fn( atom_site_field::PDBX_PDB_MODEL_NUM, 1.0 ) );
+
+				// Non-polymer entities (ligands, waters etc) have a null label_seq_id
+				row.is_polymer     = ! prm_source.has_field( atom_site_field::LABEL_SEQ_ID ) || prm_source.has_value( atom_site_field::LABEL_SEQ_ID );
+				return row;
+			}
+
+			/// \brief Build a pdb from the rows of an mmCIF _atom_site category, in order
+			///
+			/// This gives the same pdb as reading the equivalent PDB-format file:
+			///  * only the first model is read (as for a PDB file's first ENDMDL)
+			///  * the non-polymer atoms (ligands, waters etc) of each chain are treated as following a TER record
+			///    for that chain (as they do in PDB-format files) and so become post-TER residues
+			///  * entries with residue names that aren't recognised are skipped with a warning
+			///  * chains with multi-character identifiers (eg in large assemblies) are skipped with a warning
+			///
+			/// The grouping of atoms into residues is done with the same pdb_residues_builder as is used for PDB-format files.
+			class atom_site_pdb_builder final {
+			private:
+				/// \brief The builder that groups the atoms into residues
+				pdb_residues_builder         residues_builder;
+
+				/// \brief The model number of the first model, once a row has been read
+				boost::optional<int>         first_model_number;
+
+				/// \brief The chains for which non-polymer atoms have been reached
+				chain_label_set              non_polymer_chains;
+
+				/// \brief The identifiers of the chains that have been skipped because they can't be represented
+				str_set                      skipped_chain_ids;
+
+				/// \brief The residue name of the most recent row, padded to the three PDB columns
+				char_3_arr                   prev_residue_name_chars = { { 0, 0, 0 } };
+
+				/// \brief The record type of the most recent row
+				pdb_record                   prev_record_type        = pdb_record::ATOM;
+
+				/// \brief The amino_acid of the most recent row (or none if it wasn't recognised or there hasn't been one)
+				boost::optional<amino_acid>  prev_amino_acid;
+
+				boost::optional<amino_acid> get_amino_acid(const atom_site_row &);
+
+			public:
+				bool add_row(const atom_site_row &);
+
+				void finish_into(pdb &);
+			};
+
+			boost::optional<chain_label> chain_label_of_mmcif_chain_id(const boost::string_ref &);
+
+			boost::optional<char_3_arr> pdb_residue_name_of_mmcif_comp_id(const boost::string_ref &);
+
+			boost::optional<char_4_arr> pdb_atom_name_of_mmcif_atom_id(const boost::string_ref &,
+			                                                           const boost::string_ref &);
+
+			char_2_arr pdb_element_symbol_of_mmcif_type_symbol(const boost::string_ref &);
+
+			char_2_arr pdb_charge_of_mmcif_formal_charge(const int &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,441 @@
+/// \file
+/// \brief The bcif_column class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "bcif_column.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/string/string_parse_tools.hpp"
+#include "file/mmcif/detail/msgpack_value.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+using namespace cath::common;
+using namespace cath::file::detail;
+
+using boost::string_ref;
+using std::int64_t;
+using std::string;
+using std::uint64_t;
+using std::vector;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The BinaryCIF ByteArray type codes
+			enum class bcif_byte_array_type : int {
+				INT8    =  1, ///< Signed 8-bit integers
+				INT16   =  2, ///< Signed 16-bit integers
+				INT32   =  3, ///< Signed 32-bit integers
+				UINT8   =  4, ///< Unsigned 8-bit integers
+				UINT16  =  5, ///< Unsigned 16-bit integers
+				UINT32  =  6, ///< Unsigned 32-bit integers
+				FLOAT32 = 32, ///< 32-bit floats
+				FLOAT64 = 33  ///< 64-bit floats
+			};
+
+			/// \brief Read a little-endian value of the specified number of bytes from the specified position as an unsigned integer
+			inline uint64_t read_bcif_little_endian(const char   *prm_ptr,      ///< The position of the value
+			                                        const size_t &prm_num_bytes ///< The number of bytes in the value
+			                                        ) {
+				uint64_t value = 0;
+				for (size_t byte_ctr = prm_num_bytes; byte_ctr > 0; --byte_ctr) {
+					value = ( value << 8 ) | static_cast<unsigned char>( prm_ptr[ byte_ctr - 1 ] );
+				}
+				return value;
+			}
+
+			/// \brief Decode a BinaryCIF ByteArray encoding (ie raw little-endian bytes into numbers)
+			inline bcif_data decode_bcif_byte_array(const bcif_data     &prm_data,    ///< The data to decode
+			                                        const msgpack_value &prm_encoding ///< The encoding
+			                                        ) {
+				const auto   type       = static_cast<bcif_byte_array_type>( prm_encoding.at( "type" ).get_integer() );
+				const bool   is_float   = ( type == bcif_byte_array_type::FLOAT32 || type == bcif_byte_array_type::FLOAT64 );
+				const bool   is_signed  = ( type == bcif_byte_array_type::INT8 || type == bcif_byte_array_type::INT16 || type == bcif_byte_array_type::INT32 );
+				const size_t num_bytes  = [&] () -> size_t {
+					switch ( type ) {
+						case ( bcif_byte_array_type::INT8    ) : case ( bcif_byte_array_type::UINT8   ) : { return 1; }
+						case ( bcif_byte_array_type::INT16   ) : case ( bcif_byte_array_type::UINT16  ) : { return 2; }
+						case ( bcif_byte_array_type::INT32   ) : case ( bcif_byte_array_type::UINT32  ) :
+						case ( bcif_byte_array_type::FLOAT32 ) : { return 4; }
+						case ( bcif_byte_array_type::FLOAT64 ) : { return 8; }
+					}
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("Unrecognised BinaryCIF ByteArray type"));
+				} ();
+				if ( prm_data.kind != bcif_data_kind::BYTES || prm_data.bytes.length() % num_bytes != 0 ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF ByteArray data is not a whole number of values"));
+				}
+
+				const size_t num_values = prm_data.bytes.length() / num_bytes;
+				bcif_data result;
+				result.kind = is_float ? bcif_data_kind::FLOATS : bcif_data_kind::INTEGERS;
+				if ( is_float ) {
+					result.floats.reserve( num_values );
+				}
+				else {
+					result.integers.reserve( num_values );
+				}
+				for (size_t value_ctr = 0; value_ctr < num_values; ++value_ctr) {
+					const uint64_t bits = read_bcif_little_endian( prm_data.bytes.data() + value_ctr * num_bytes, num_bytes );
+					if ( type == bcif_byte_array_type::FLOAT32 ) {
+						const auto bits_32 = static_cast<std::uint32_t>( bits );
+						float      value   = 0.0;
+						std::memcpy( &value, &bits_32, sizeof( value ) );
+						result.floats.push_back( static_cast<double>( value ) );
+					}
+					else if ( type == bcif_byte_array_type::FLOAT64 ) {
+						double value = 0.0;
+						std::memcpy( &value, &bits, sizeof( value ) );
+						result.floats.push_back( value );
+					}
+					else {
+						const uint64_t sign_bit = ( uint64_t{ 1 } << ( 8 * num_bytes - 1 ) );
+						const bool     negative = is_signed && ( ( bits & sign_bit ) != 0 );
+						result.integers.push_back(
+							negative ? ( static_cast<int64_t>( bits & ( sign_bit - 1 ) ) - static_cast<int64_t>( sign_bit ) )
+							         :   static_cast<int64_t>( bits )
+						);
+					}
+				}
+				return result;
+			}
+
+			/// \brief Check that the specified data contains integers
+			///
+			/// \throws invalid_argument_exception if not
+			inline void check_bcif_integers(const bcif_data &prm_data,         ///< The data to check
+			                                const char      *prm_encoding_name ///< The name of the encoding that requires integers
+			                                ) {
+				if ( prm_data.kind != bcif_data_kind::INTEGERS ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception(
+						"BinaryCIF " + string{ prm_encoding_name } + " encoding must be applied to integers"
+					));
+				}
+			}
+
+			/// \brief Decode a BinaryCIF FixedPoint encoding (ie integers that are floats multiplied by a factor)
+			///
+			/// Dividing the exact integers by the factor gives the nearest double to the intended decimal
+			/// values (eg 11104 / 1000.0 gives the same double as parsing "11.104"). This deliberately keeps the doubles
+			/// even when the source type was Float32 so that coordinates match those read from the equivalent text files.
+			inline bcif_data decode_bcif_fixed_point(const bcif_data     &prm_data,    ///< The data to decode
+			                                         const msgpack_value &prm_encoding ///< The encoding
+			                                         ) {
+				check_bcif_integers( prm_data, "FixedPoint" );
+				const double factor = prm_encoding.at( "factor" ).get_number();
+				bcif_data result;
+				result.kind = bcif_data_kind::FLOATS;
+				result.floats.reserve( prm_data.integers.size() );
+				for (const int64_t &value : prm_data.integers) {
+					result.floats.push_back( static_cast<double>( value ) / factor );
+				}
+				return result;
+			}
+
+			/// \brief Decode a BinaryCIF IntervalQuantization encoding (ie integers that index steps between a minimum and maximum)
+			inline bcif_data decode_bcif_interval_quantization(const bcif_data     &prm_data,    ///< The data to decode
+			                                                   const msgpack_value &prm_encoding ///< The encoding
+			                                                   ) {
+				check_bcif_integers( prm_data, "IntervalQuantization" );
+				const double min       = prm_encoding.at( "min"      ).get_number();
+				const double max       = prm_encoding.at( "max"      ).get_number();
+				const double num_steps = prm_encoding.at( "numSteps" ).get_number();
+				const double step_size = ( num_steps > 1.0 ) ? ( max - min ) / ( num_steps - 1.0 ) : 0.0;
+				bcif_data result;
+				result.kind = bcif_data_kind::FLOATS;
+				result.floats.reserve( prm_data.integers.size() );
+				for (const int64_t &value : prm_data.integers) {
+					result.floats.push_back( min + step_size * static_cast<double>( value ) );
+				}
+				return result;
+			}
+
+			/// \brief Decode a BinaryCIF RunLength encoding (ie pairs of value and number of repeats)
+			inline bcif_data decode_bcif_run_length(const bcif_data     &prm_data,    ///< The data to decode
+			                                        const msgpack_value &prm_encoding ///< The encoding
+			                                        ) {
+				check_bcif_integers( prm_data, "RunLength" );
+				if ( prm_data.integers.size() % 2 != 0 ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF RunLength data must contain value/count pairs"));
+				}
+				const auto src_size = static_cast<size_t>( prm_encoding.at( "srcSize" ).get_integer() );
+				bcif_data result;
+				result.kind = bcif_data_kind::INTEGERS;
+				result.integers.reserve( src_size );
+				for (size_t pair_ctr = 0; pair_ctr < prm_data.integers.size(); pair_ctr += 2) {
+					const int64_t &count = prm_data.integers[ pair_ctr + 1 ];
+					if ( count < 0 || result.integers.size() + static_cast<size_t>( count ) > src_size ) {
+						BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF RunLength data exceeds its source size"));
+					}
+					result.integers.insert( result.integers.end(), static_cast<size_t>( count ), prm_data.integers[ pair_ctr ] );
+				}
+				if ( result.integers.size() != src_size ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF RunLength data doesn't match its source size"));
+				}
+				return result;
+			}
+
+			/// \brief Decode a BinaryCIF Delta encoding (ie differences from the previous values, starting from an origin)
+			inline bcif_data decode_bcif_delta(const bcif_data     &prm_data,    ///< The data to decode
+			                                   const msgpack_value &prm_encoding ///< The encoding
+			                                   ) {
+				check_bcif_integers( prm_data, "Delta" );
+				bcif_data result = prm_data;
+				int64_t   total  = prm_encoding.at( "origin" ).get_integer();
+				for (int64_t &value : result.integers) {
+					total += value;
+					value  = total;
+				}
+				return result;
+			}
+
+			/// \brief Decode a BinaryCIF IntegerPacking encoding
+			inline bcif_data decode_bcif_integer_packing(const bcif_data     &prm_data,    ///< The data to decode
+			                                             const msgpack_value &prm_encoding ///< The encoding
+			                                             ) {
+				check_bcif_integers( prm_data, "IntegerPacking" );
+				bcif_data result;
+				result.kind     = bcif_data_kind::INTEGERS;
+				result.integers = decode_bcif_integer_packing(
+					prm_data.integers,
+					prm_encoding.at( "isUnsigned" ).get_boolean(),
+					static_cast<size_t>( prm_encoding.at( "byteCount" ).get_integer() ),
+					static_cast<size_t>( prm_encoding.at( "srcSize"   ).get_integer() )
+				);
+				return result;
+			}
+
+			/// \brief Decode a BinaryCIF StringArray encoding (ie indices into a list of distinct strings)
+			///
+			/// The strings refer into the BinaryCIF data's string of concatenated distinct strings, so they aren't copied.
+			inline bcif_data decode_bcif_string_array(const bcif_data     &prm_data,    ///< The data to decode
+			                                          const msgpack_value &prm_encoding ///< The encoding
+			                                          ) {
+				const string_ref &string_data = prm_encoding.at( "stringData" ).get_string();
+
+				if ( prm_data.kind != bcif_data_kind::BYTES ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF StringArray encoding must be applied to raw bytes"));
+				}
+				bcif_data offsets_raw;
+				offsets_raw.bytes = prm_encoding.at( "offsets" ).get_binary();
+				const bcif_data offsets = decode_bcif_data( offsets_raw, prm_encoding.at( "offsetEncoding" ) );
+				const bcif_data indices = decode_bcif_data( prm_data,    prm_encoding.at( "dataEncoding"   ) );
+				check_bcif_integers( offsets, "StringArray offset" );
+				check_bcif_integers( indices, "StringArray data"   );
+
+				// Make a string_ref for each of the distinct strings
+				str_ref_vec distinct_strings;
+				distinct_strings.reserve( offsets.integers.size() );
+				for (size_t offset_ctr = 0; offset_ctr + 1 < offsets.integers.size(); ++offset_ctr) {
+					const int64_t &begin = offsets.integers[ offset_ctr     ];
+					const int64_t &end   = offsets.integers[ offset_ctr + 1 ];
+					if ( begin < 0 || end < begin || static_cast<size_t>( end ) > string_data.length() ) {
+						BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF StringArray offsets are invalid"));
+					}
+					distinct_strings.push_back( string_data.substr( static_cast<size_t>( begin ), static_cast<size_t>( end - begin ) ) );
+				}
+
+				bcif_data result;
+				result.kind = bcif_data_kind::STRINGS;
+				result.strings.reserve( indices.integers.size() );
+				for (const int64_t &index : indices.integers) {
+					if ( index >= static_cast<int64_t>( distinct_strings.size() ) ) {
+						BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF StringArray index is out of range"));
+					}
+					result.strings.push_back( ( index < 0 ) ? string_ref{} : distinct_strings[ static_cast<size_t>( index ) ] );
+				}
+				return result;
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Decode a BinaryCIF IntegerPacking encoding, in which larger values are represented by runs of
+///        the limiting value of the smaller integer type, which should be summed
+///
+/// \throws invalid_argument_exception if the byte count is invalid or the result doesn't match the source size
+int64_vec cath::file::detail::decode_bcif_integer_packing(const int64_vec &prm_packed,      ///< The packed integers
+                                                          const bool      &prm_is_unsigned, ///< Whether the packed integers are unsigned
+                                                          const size_t    &prm_byte_count,  ///< The number of bytes in each packed integer (1 or 2)
+                                                          const size_t    &prm_src_size     ///< The number of unpacked integers
+                                                          ) {
+	if ( prm_byte_count != 1 && prm_byte_count != 2 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF IntegerPacking byte count must be 1 or 2"));
+	}
+	const int64_t upper_limit = prm_is_unsigned ? ( ( prm_byte_count == 1 ) ? 0xFF : 0xFFFF )
+	                                            : ( ( prm_byte_count == 1 ) ? 0x7F : 0x7FFF );
+	const int64_t lower_limit = prm_is_unsigned ? 0
+	                                            : ( ( prm_byte_count == 1 ) ? -0x80 : -0x8000 );
+	int64_vec unpacked;
+	unpacked.reserve( prm_src_size );
+	size_t packed_ctr = 0;
+	while ( packed_ctr < prm_packed.size() ) {
+		int64_t value = 0;
+		while ( packed_ctr < prm_packed.size() && ( prm_packed[ packed_ctr ] == upper_limit || ( ! prm_is_unsigned && prm_packed[ packed_ctr ] == lower_limit ) ) ) {
+			value += prm_packed[ packed_ctr ];
+			++packed_ctr;
+		}
+		if ( packed_ctr == prm_packed.size() ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF IntegerPacking data ends with an incomplete value"));
+		}
+		value += prm_packed[ packed_ctr ];
+		++packed_ctr;
+		unpacked.push_back( value );
+	}
+	if ( unpacked.size() != prm_src_size ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF IntegerPacking data doesn't match its source size"));
+	}
+	return unpacked;
+}
+
+/// \brief Decode the specified data with the specified list of BinaryCIF encodings
+///        (which are applied in reverse order)
+///
+/// \throws invalid_argument_exception if the data is malformed or uses unsupported encodings
+bcif_data cath::file::detail::decode_bcif_data(const bcif_data     &prm_data,     ///< The data to decode
+                                               const msgpack_value &prm_encodings ///< The list of encodings that were used to encode the data
+                                               ) {
+	bcif_data data = prm_data;
+	const vector<msgpack_value> &encodings = prm_encodings.get_array();
+	for (auto encoding_itr = encodings.rbegin(); encoding_itr != encodings.rend(); ++encoding_itr) {
+		const string_ref &kind = encoding_itr->at( "kind" ).get_string();
+		if      ( kind == "ByteArray"            ) { data = decode_bcif_byte_array           ( data, *encoding_itr ); }
+		else if ( kind == "FixedPoint"           ) { data = decode_bcif_fixed_point          ( data, *encoding_itr ); }
+		else if ( kind == "IntervalQuantization" ) { data = decode_bcif_interval_quantization( data, *encoding_itr ); }
+		else if ( kind == "RunLength"            ) { data = decode_bcif_run_length           ( data, *encoding_itr ); }
+		else if ( kind == "Delta"                ) { data = decode_bcif_delta                ( data, *encoding_itr ); }
+		else if ( kind == "IntegerPacking"       ) { data = decode_bcif_integer_packing      ( data, *encoding_itr ); }
+		else if ( kind == "StringArray"          ) { data = decode_bcif_string_array         ( data, *encoding_itr ); }
+		else {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("Unsupported BinaryCIF encoding \"" + kind.to_string() + "\""));
+		}
+	}
+	return data;
+}
+
+/// \brief Decode the specified BinaryCIF encoded data (a map with the "data" bytes and the list of "encoding"s)
+///
+/// \throws invalid_argument_exception if the data is malformed or uses unsupported encodings
+bcif_data cath::file::detail::decode_bcif_data(const msgpack_value &prm_encoded_data ///< The encoded data
+                                               ) {
+	bcif_data raw_data;
+	raw_data.bytes = prm_encoded_data.at( "data" ).get_binary();
+	return decode_bcif_data( raw_data, prm_encoded_data.at( "encoding" ) );
+}
+
+/// \brief Ctor from the msgpack_value for a BinaryCIF column (a map with its "name", "data" and "mask")
+///
+/// \throws invalid_argument_exception if the column is malformed or its values can't be converted to the required kind
+bcif_column::bcif_column(const msgpack_value &prm_column,    ///< The msgpack_value for the column
+                         const bool          &prm_is_numeric ///< Whether numbers (rather than text) are required from the column
+                         ) {
+	bcif_data data = decode_bcif_data( prm_column.at( "data" ) );
+
+	const msgpack_value * const mask_ptr = prm_column.find( "mask" );
+	if ( mask_ptr != nullptr && ! mask_ptr->is_nil() ) {
+		bcif_data mask_data = decode_bcif_data( *mask_ptr );
+		if ( mask_data.kind != bcif_data_kind::INTEGERS ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF column mask must contain integers"));
+		}
+		mask = std::move( mask_data.integers );
+	}
+
+	switch ( data.kind ) {
+		case ( bcif_data_kind::INTEGERS ) : { num_rows = data.integers.size(); break; }
+		case ( bcif_data_kind::FLOATS   ) : { num_rows = data.floats.size();   break; }
+		case ( bcif_data_kind::STRINGS  ) : { num_rows = data.strings.size();  break; }
+		case ( bcif_data_kind::BYTES    ) : {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF column data did not decode to values"));
+		}
+	}
+	if ( ! mask.empty() && mask.size() != num_rows ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("BinaryCIF column mask size doesn't match the column's data size"));
+	}
+
+	if ( prm_is_numeric ) {
+		switch ( data.kind ) {
+			case ( bcif_data_kind::INTEGERS ) : {
+				numbers.assign( data.integers.begin(), data.integers.end() );
+				break;
+			}
+			case ( bcif_data_kind::FLOATS   ) : {
+				numbers = std::move( data.floats );
+				break;
+			}
+			default : {
+				numbers.reserve( num_rows );
+				for (size_t row_ctr = 0; row_ctr < num_rows; ++row_ctr) {
+					const string text_string = data.strings[ row_ctr ].to_string();
+					numbers.push_back(
+						( is_null( row_ctr ) || text_string.empty() ) ? 0.0
+						                                             : parse_double_from_substring( text_string, 0, text_string.length() )
+					);
+				}
+				break;
+			}
+		}
+	}
+	else {
+		if ( data.kind == bcif_data_kind::STRINGS ) {
+			texts = std::move( data.strings );
+		}
+		else {
+			// Convert all the numbers to strings before taking any string_refs to them
+			converted_texts.reserve( num_rows );
+			for (size_t row_ctr = 0; row_ctr < num_rows; ++row_ctr) {
+				const double value = ( data.kind == bcif_data_kind::INTEGERS ) ? static_cast<double>( data.integers[ row_ctr ] )
+				                                                              : data.floats[ row_ctr ];
+				converted_texts.push_back(
+					( value == std::floor( value ) ) ? std::to_string( static_cast<int64_t>( value ) )
+					                                 : boost::lexical_cast<string>( value )
+				);
+			}
+			texts.assign( converted_texts.begin(), converted_texts.end() );
+		}
+	}
+}
+
+/// \brief Getter for the number of rows
+const size_t & bcif_column::size() const {
+	return num_rows;
+}
+
+/// \brief Whether the value in the specified row is null ('.' or '?')
+bool bcif_column::is_null(const size_t &prm_index ///< The index of the row
+                          ) const {
+	return ( ! mask.empty() && mask[ prm_index ] != 0 );
+}
+
+/// \brief Get the number in the specified row (which must be a numeric column)
+const double & bcif_column::get_number(const size_t &prm_index ///< The index of the row
+                                       ) const {
+	return numbers[ prm_index ];
+}
+
+/// \brief Get the text in the specified row (which must be a text column)
+const string_ref & bcif_column::get_text(const size_t &prm_index ///< The index of the row
+                                         ) const {
+	return texts[ prm_index ];
+}
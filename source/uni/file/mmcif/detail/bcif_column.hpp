@@ -0,0 +1,122 @@
+/// \file
+/// \brief The bcif_column class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_BCIF_COLUMN_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_BCIF_COLUMN_HPP
+
+#include <boost/utility/string_ref.hpp>
+
+#include "common/type_aliases.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace cath {
+	namespace file {
+		namespace detail {
+			class msgpack_value;
+
+			/// \brief Type alias for a vector of 64-bit integers
+			using int64_vec = std::vector<std::int64_t>;
+
+			/// \brief Type alias for a vector of string_ref values
+			using str_ref_vec = std::vector<boost::string_ref>;
+
+			/// \brief The kinds of data that can be produced whilst decoding a BinaryCIF column
+			enum class bcif_data_kind : char {
+				BYTES,    ///< Raw bytes
+				INTEGERS, ///< Integers
+				FLOATS,   ///< Floating-point numbers
+				STRINGS   ///< Strings
+			};
+
+			/// \brief Data produced whilst decoding a BinaryCIF column
+			///
+			/// The bytes and strings refer to the original BinaryCIF data, which must outlive this.
+			struct bcif_data final {
+				/// \brief The kind of data
+				bcif_data_kind    kind = bcif_data_kind::BYTES;
+
+				/// \brief The raw bytes (for BYTES)
+				boost::string_ref bytes;
+
+				/// \brief The integers (for INTEGERS)
+				int64_vec         integers;
+
+				/// \brief The floating-point numbers (for FLOATS)
+				doub_vec          floats;
+
+				/// \brief The strings (for STRINGS)
+				str_ref_vec       strings;
+			};
+
+			bcif_data decode_bcif_data(const bcif_data &,
+			                           const msgpack_value &);
+
+			bcif_data decode_bcif_data(const msgpack_value &);
+
+			/// \brief A decoded BinaryCIF column, holding either text or numbers (as required by the caller)
+			///
+			/// Whole columns are decoded at once (which is what makes BinaryCIF fast to read);
+			/// the values of a row can then be queried by index.
+			class bcif_column final {
+			private:
+				/// \brief The numbers (if this is a numeric column)
+				doub_vec    numbers;
+
+				/// \brief The text values (if this is a text column)
+				str_ref_vec texts;
+
+				/// \brief Storage for any text values that were converted from numbers
+				///
+				/// (This is why bcif_column can be moved but not copied: texts may refer into this storage)
+				str_vec     converted_texts;
+
+				/// \brief The mask for the values (0 for present, 1 for '.' or 2 for '?') or empty if all are present
+				int64_vec   mask;
+
+				/// \brief The number of rows
+				size_t      num_rows = 0;
+
+			public:
+				bcif_column(const msgpack_value &,
+				            const bool &);
+				bcif_column(const bcif_column &) = delete;
+				bcif_column(bcif_column &&) noexcept = default;
+				bcif_column & operator=(const bcif_column &) = delete;
+				bcif_column & operator=(bcif_column &&) noexcept = default;
+				~bcif_column() noexcept = default;
+
+				const size_t & size() const;
+				bool is_null(const size_t &) const;
+				const double & get_number(const size_t &) const;
+				const boost::string_ref & get_text(const size_t &) const;
+			};
+
+			int64_vec decode_bcif_integer_packing(const int64_vec &,
+			                                      const bool &,
+			                                      const size_t &,
+			                                      const size_t &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
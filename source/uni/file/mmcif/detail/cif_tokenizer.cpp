@@ -0,0 +1,142 @@
+/// \file
+/// \brief The cif_tokenizer class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cif_tokenizer.hpp"
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+
+using namespace cath::common;
+using namespace cath::file::detail;
+
+using boost::algorithm::iequals;
+using boost::algorithm::istarts_with;
+using boost::none;
+using boost::string_ref;
+
+/// \brief Ctor from the CIF text to tokenize (which must outlive the cif_tokenizer)
+cif_tokenizer::cif_tokenizer(const string_ref &prm_text ///< The CIF text to tokenize
+                             ) : text( prm_text ) {
+}
+
+/// \brief Read the next token from the text or return none if there are no more
+///
+/// \throws invalid_argument_exception if a text field isn't terminated
+cif_token_opt cif_tokenizer::read_token() {
+	// Skip whitespace and comments
+	while ( ! text.empty() ) {
+		if ( text.front() == '#' ) {
+			const size_t newline_index = text.find( '\n' );
+			text = ( newline_index == string_ref::npos ) ? text.substr( text.length() ) : text.substr( newline_index );
+		}
+		else if ( is_cif_space( text.front() ) ) {
+			at_line_start = ( text.front() == '\n' );
+			text.remove_prefix( 1 );
+		}
+		else {
+			break;
+		}
+	}
+	if ( text.empty() ) {
+		return none;
+	}
+
+	// Handle a text field, which runs from a semicolon at the start of a line to the next semicolon at the start of a line
+	if ( at_line_start && text.front() == ';' ) {
+		const size_t end_index = text.find( "\n;" );
+		if ( end_index == string_ref::npos ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("Unterminated text field in CIF data"));
+		}
+		const string_ref field_text = text.substr( 1, end_index - 1 );
+		text.remove_prefix( end_index + 2 );
+		at_line_start = false;
+		return cif_token{ field_text, true };
+	}
+	at_line_start = false;
+
+	// Handle a quoted value, which ends at a matching quote that's followed by whitespace (or the end)
+	if ( text.front() == '\'' || text.front() == '"' ) {
+		const char quote = text.front();
+		for (size_t index = 1; index < text.length(); ++index) {
+			if ( text[ index ] == quote && ( index + 1 == text.length() || is_cif_space( text[ index + 1 ] ) ) ) {
+				const string_ref quoted_text = text.substr( 1, index - 1 );
+				text.remove_prefix( index + 1 );
+				return cif_token{ quoted_text, true };
+			}
+		}
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Unterminated quoted value in CIF data"));
+	}
+
+	// Otherwise, this is an unquoted token, which ends at the next whitespace
+	size_t end_index = 0;
+	while ( end_index < text.length() && ! is_cif_space( text[ end_index ] ) ) {
+		++end_index;
+	}
+	const string_ref token_text = text.substr( 0, end_index );
+	text.remove_prefix( end_index );
+	return cif_token{ token_text, false };
+}
+
+/// \brief Get the next token (or none if there are no more)
+cif_token_opt cif_tokenizer::next() {
+	if ( peeked_token ) {
+		cif_token_opt result = peeked_token;
+		peeked_token = none;
+		return result;
+	}
+	return read_token();
+}
+
+/// \brief Get the next token (or none if there are no more) without consuming it
+const cif_token_opt & cif_tokenizer::peek() {
+	if ( ! peeked_token ) {
+		peeked_token = read_token();
+	}
+	return peeked_token;
+}
+
+/// \brief Whether the specified token is a null value (ie an unquoted '.' or '?')
+bool cath::file::detail::is_null_cif_value(const cif_token &prm_token ///< The token to query
+                                           ) {
+	return ( ! prm_token.is_quoted && ( prm_token.text == "." || prm_token.text == "?" ) );
+}
+
+/// \brief Whether the specified token is a tag (ie a data name such as "_atom_site.id")
+bool cath::file::detail::is_cif_tag(const cif_token &prm_token ///< The token to query
+                                    ) {
+	return ( ! prm_token.is_quoted && prm_token.text.starts_with( '_' ) );
+}
+
+/// \brief Whether the specified token is one of CIF's reserved words (eg "loop_" or "data_XXXX")
+bool cath::file::detail::is_cif_reserved_word(const cif_token &prm_token ///< The token to query
+                                              ) {
+	return ! prm_token.is_quoted && (
+		iequals     ( prm_token.text, "loop_"   )
+		||
+		iequals     ( prm_token.text, "stop_"   )
+		||
+		istarts_with( prm_token.text, "data_"   )
+		||
+		istarts_with( prm_token.text, "save_"   )
+		||
+		istarts_with( prm_token.text, "global_" )
+	);
+}
@@ -0,0 +1,80 @@
+/// \file
+/// \brief The cif_tokenizer class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_CIF_TOKENIZER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_CIF_TOKENIZER_HPP
+
+#include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief A token from a CIF file
+			struct cif_token final {
+				/// \brief The text of the token (without any quotes or text-field semicolons)
+				boost::string_ref text;
+
+				/// \brief Whether the token was quoted (or in a text field), in which case it's always a value
+				bool              is_quoted = false;
+			};
+
+			/// \brief Whether the specified character is CIF whitespace
+			inline bool is_cif_space(const char &prm_char ///< The character to query
+			                         ) {
+				return ( prm_char == ' ' || prm_char == '\t' || prm_char == '\n' || prm_char == '\r' );
+			}
+
+			/// \brief Type alias for an optional cif_token
+			using cif_token_opt = boost::optional<cif_token>;
+
+			/// \brief Split CIF text into tokens, without copying
+			///
+			/// This handles comments, single/double-quoted values and semicolon-delimited text fields.
+			class cif_tokenizer final {
+			private:
+				/// \brief The remaining text
+				boost::string_ref text;
+
+				/// \brief Whether the remaining text starts at the start of a line
+				bool              at_line_start = true;
+
+				/// \brief The next token, if it's already been read by peek()
+				cif_token_opt     peeked_token;
+
+				cif_token_opt read_token();
+
+			public:
+				explicit cif_tokenizer(const boost::string_ref &);
+
+				cif_token_opt next();
+				const cif_token_opt & peek();
+			};
+
+			bool is_null_cif_value(const cif_token &);
+			bool is_cif_tag(const cif_token &);
+			bool is_cif_reserved_word(const cif_token &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,304 @@
+/// \file
+/// \brief The msgpack_value class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "msgpack_value.hpp"
+
+#include "common/exception/invalid_argument_exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using namespace cath::common;
+using namespace cath::file::detail;
+
+using boost::string_ref;
+using std::int64_t;
+using std::string;
+using std::uint64_t;
+using std::vector;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief Check that there are at least the specified number of bytes remaining
+			///
+			/// \throws invalid_argument_exception if not
+			inline void check_msgpack_bytes_remain(const char   *prm_itr,      ///< The current position
+			                                       const char   *prm_end,      ///< The end of the data
+			                                       const size_t &prm_num_bytes ///< The number of bytes required
+			                                       ) {
+				if ( static_cast<size_t>( prm_end - prm_itr ) < prm_num_bytes ) {
+					BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack data ended unexpectedly"));
+				}
+			}
+
+			/// \brief Read a big-endian unsigned integer of the specified number of bytes and advance past it
+			inline uint64_t read_msgpack_big_endian(const char   *&prm_itr,      ///< The current position (which is advanced)
+			                                        const char    *prm_end,      ///< The end of the data
+			                                        const size_t  &prm_num_bytes ///< The number of bytes in the integer
+			                                        ) {
+				check_msgpack_bytes_remain( prm_itr, prm_end, prm_num_bytes );
+				uint64_t value = 0;
+				for (size_t byte_ctr = 0; byte_ctr < prm_num_bytes; ++byte_ctr) {
+					value = ( value << 8 ) | static_cast<unsigned char>( *prm_itr );
+					++prm_itr;
+				}
+				return value;
+			}
+
+			/// \brief Read a region of the specified number of bytes and advance past it
+			inline string_ref read_msgpack_bytes(const char   *&prm_itr,      ///< The current position (which is advanced)
+			                                     const char    *prm_end,      ///< The end of the data
+			                                     const size_t  &prm_num_bytes ///< The number of bytes
+			                                     ) {
+				check_msgpack_bytes_remain( prm_itr, prm_end, prm_num_bytes );
+				const string_ref result{ prm_itr, prm_num_bytes };
+				prm_itr += prm_num_bytes;
+				return result;
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Getter for the type of the value
+const msgpack_type & msgpack_value::get_type() const {
+	return type;
+}
+
+/// \brief Whether the value is nil
+bool msgpack_value::is_nil() const {
+	return ( type == msgpack_type::NIL );
+}
+
+/// \brief Get the value of a BOOLEAN
+///
+/// \throws invalid_argument_exception if the value isn't a boolean
+bool msgpack_value::get_boolean() const {
+	if ( type != msgpack_type::BOOLEAN ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not a boolean"));
+	}
+	return ( integer_value != 0 );
+}
+
+/// \brief Get the value of an INTEGER or FLOAT as a double
+///
+/// \throws invalid_argument_exception if the value isn't a number
+double msgpack_value::get_number() const {
+	if ( type == msgpack_type::INTEGER ) {
+		return static_cast<double>( integer_value );
+	}
+	if ( type == msgpack_type::FLOAT ) {
+		return float_value;
+	}
+	BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not a number"));
+}
+
+/// \brief Get the value of an INTEGER
+///
+/// \throws invalid_argument_exception if the value isn't an integer
+int64_t msgpack_value::get_integer() const {
+	if ( type != msgpack_type::INTEGER ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not an integer"));
+	}
+	return integer_value;
+}
+
+/// \brief Get the value of a STRING
+///
+/// \throws invalid_argument_exception if the value isn't a string
+const string_ref & msgpack_value::get_string() const {
+	if ( type != msgpack_type::STRING ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not a string"));
+	}
+	return bytes;
+}
+
+/// \brief Get the value of a BINARY
+///
+/// \throws invalid_argument_exception if the value isn't a byte array
+const string_ref & msgpack_value::get_binary() const {
+	if ( type != msgpack_type::BINARY ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not a byte array"));
+	}
+	return bytes;
+}
+
+/// \brief Get the elements of an ARRAY
+///
+/// \throws invalid_argument_exception if the value isn't an array
+const vector<msgpack_value> & msgpack_value::get_array() const {
+	if ( type != msgpack_type::ARRAY ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not an array"));
+	}
+	return elements;
+}
+
+/// \brief Find the value for the specified key in a MAP
+///
+/// \returns A pointer to the value or nullptr if there's no such key
+///
+/// \throws invalid_argument_exception if the value isn't a map
+const msgpack_value * msgpack_value::find(const string_ref &prm_key ///< The key to find
+                                          ) const {
+	if ( type != msgpack_type::MAP ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack value is not a map"));
+	}
+	for (size_t key_ctr = 0; key_ctr < keys.size(); ++key_ctr) {
+		if ( keys[ key_ctr ] == prm_key ) {
+			return &elements[ key_ctr ];
+		}
+	}
+	return nullptr;
+}
+
+/// \brief Get the value for the specified key in a MAP
+///
+/// \throws invalid_argument_exception if the value isn't a map or doesn't contain the key
+const msgpack_value & msgpack_value::at(const string_ref &prm_key ///< The key to find
+                                        ) const {
+	const msgpack_value * const value_ptr = find( prm_key );
+	if ( value_ptr == nullptr ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack map does not contain key \"" + prm_key.to_string() + "\""));
+	}
+	return *value_ptr;
+}
+
+/// \brief Parse the MessagePack value at the specified position and advance past it
+///
+/// \throws invalid_argument_exception if the data is malformed or uses unsupported features
+msgpack_value cath::file::detail::parse_msgpack_value(const char *&prm_itr, ///< The current position (which is advanced)
+                                                      const char  *prm_end  ///< The end of the data
+                                                      ) {
+	const auto integer_fn = [] (const int64_t &prm_integer) {
+		msgpack_value value;
+		value.type          = msgpack_type::INTEGER;
+		value.integer_value = prm_integer;
+		return value;
+	};
+	const auto bytes_fn = [&] (const msgpack_type &prm_type, const size_t &prm_num_bytes) {
+		msgpack_value value;
+		value.type  = prm_type;
+		value.bytes = read_msgpack_bytes( prm_itr, prm_end, prm_num_bytes );
+		return value;
+	};
+	const auto array_fn = [&] (const size_t &prm_num_elements) {
+		msgpack_value value;
+		value.type = msgpack_type::ARRAY;
+		// Each element takes at least one byte, so don't let malformed data trigger a huge reservation
+		value.elements.reserve( std::min( prm_num_elements, static_cast<size_t>( prm_end - prm_itr ) ) );
+		for (size_t element_ctr = 0; element_ctr < prm_num_elements; ++element_ctr) {
+			value.elements.push_back( parse_msgpack_value( prm_itr, prm_end ) );
+		}
+		return value;
+	};
+	const auto map_fn = [&] (const size_t &prm_num_entries) {
+		msgpack_value value;
+		value.type = msgpack_type::MAP;
+		value.keys.reserve    ( std::min( prm_num_entries, static_cast<size_t>( prm_end - prm_itr ) ) );
+		value.elements.reserve( std::min( prm_num_entries, static_cast<size_t>( prm_end - prm_itr ) ) );
+		for (size_t entry_ctr = 0; entry_ctr < prm_num_entries; ++entry_ctr) {
+			value.keys.push_back    ( parse_msgpack_value( prm_itr, prm_end ).get_string() );
+			value.elements.push_back( parse_msgpack_value( prm_itr, prm_end )              );
+		}
+		return value;
+	};
+	const auto float_fn = [&] (const size_t &prm_num_bytes) {
+		const uint64_t bits = read_msgpack_big_endian( prm_itr, prm_end, prm_num_bytes );
+		msgpack_value value;
+		value.type = msgpack_type::FLOAT;
+		if ( prm_num_bytes == 4 ) {
+			const auto bits_32 = static_cast<std::uint32_t>( bits );
+			float      float_32 = 0.0;
+			std::memcpy( &float_32, &bits_32, sizeof( float_32 ) );
+			value.float_value = static_cast<double>( float_32 );
+		}
+		else {
+			std::memcpy( &value.float_value, &bits, sizeof( value.float_value ) );
+		}
+		return value;
+	};
+	const auto signed_fn = [&] (const size_t &prm_num_bytes) {
+		const uint64_t bits      = read_msgpack_big_endian( prm_itr, prm_end, prm_num_bytes );
+		const size_t   num_bits  = 8 * prm_num_bytes;
+		const uint64_t sign_bit  = ( uint64_t{ 1 } << ( num_bits - 1 ) );
+		const int64_t  magnitude = static_cast<int64_t>( bits & ( sign_bit - 1 ) );
+		return integer_fn( ( ( bits & sign_bit ) != 0 ) ? ( magnitude - static_cast<int64_t>( sign_bit - 1 ) - 1 ) : magnitude );
+	};
+
+	check_msgpack_bytes_remain( prm_itr, prm_end, 1 );
+	const auto lead_byte = static_cast<unsigned char>( *prm_itr );
+	++prm_itr;
+
+	if ( lead_byte <= 0x7f ) { return integer_fn( lead_byte                                    ); } // positive fixint
+	if ( lead_byte >= 0xe0 ) { return integer_fn( static_cast<int64_t>( lead_byte ) - 0x100     ); } // negative fixint
+	if ( lead_byte <= 0x8f ) { return map_fn    ( lead_byte & 0x0fU                             ); } // fixmap
+	if ( lead_byte <= 0x9f ) { return array_fn  ( lead_byte & 0x0fU                             ); } // fixarray
+	if ( lead_byte <= 0xbf ) { return bytes_fn  ( msgpack_type::STRING, lead_byte & 0x1fU       ); } // fixstr
+
+	switch ( lead_byte ) {
+		case ( 0xc0 ) : { return msgpack_value{}; }
+		case ( 0xc2 ) :
+		case ( 0xc3 ) : {
+			msgpack_value value = integer_fn( ( lead_byte == 0xc3 ) ? 1 : 0 );
+			value.type = msgpack_type::BOOLEAN;
+			return value;
+		}
+		case ( 0xc4 ) : { return bytes_fn  ( msgpack_type::BINARY, read_msgpack_big_endian( prm_itr, prm_end, 1 ) ); }
+		case ( 0xc5 ) : { return bytes_fn  ( msgpack_type::BINARY, read_msgpack_big_endian( prm_itr, prm_end, 2 ) ); }
+		case ( 0xc6 ) : { return bytes_fn  ( msgpack_type::BINARY, read_msgpack_big_endian( prm_itr, prm_end, 4 ) ); }
+		case ( 0xca ) : { return float_fn  ( 4 ); }
+		case ( 0xcb ) : { return float_fn  ( 8 ); }
+		case ( 0xcc ) : { return integer_fn( static_cast<int64_t>( read_msgpack_big_endian( prm_itr, prm_end, 1 ) ) ); }
+		case ( 0xcd ) : { return integer_fn( static_cast<int64_t>( read_msgpack_big_endian( prm_itr, prm_end, 2 ) ) ); }
+		case ( 0xce ) : { return integer_fn( static_cast<int64_t>( read_msgpack_big_endian( prm_itr, prm_end, 4 ) ) ); }
+		case ( 0xcf ) : { return integer_fn( static_cast<int64_t>( read_msgpack_big_endian( prm_itr, prm_end, 8 ) ) ); }
+		case ( 0xd0 ) : { return signed_fn ( 1 ); }
+		case ( 0xd1 ) : { return signed_fn ( 2 ); }
+		case ( 0xd2 ) : { return signed_fn ( 4 ); }
+		case ( 0xd3 ) : { return signed_fn ( 8 ); }
+		case ( 0xd9 ) : { return bytes_fn  ( msgpack_type::STRING, read_msgpack_big_endian( prm_itr, prm_end, 1 ) ); }
+		case ( 0xda ) : { return bytes_fn  ( msgpack_type::STRING, read_msgpack_big_endian( prm_itr, prm_end, 2 ) ); }
+		case ( 0xdb ) : { return bytes_fn  ( msgpack_type::STRING, read_msgpack_big_endian( prm_itr, prm_end, 4 ) ); }
+		case ( 0xdc ) : { return array_fn  ( read_msgpack_big_endian( prm_itr, prm_end, 2 ) ); }
+		case ( 0xdd ) : { return array_fn  ( read_msgpack_big_endian( prm_itr, prm_end, 4 ) ); }
+		case ( 0xde ) : { return map_fn    ( read_msgpack_big_endian( prm_itr, prm_end, 2 ) ); }
+		case ( 0xdf ) : { return map_fn    ( read_msgpack_big_endian( prm_itr, prm_end, 4 ) ); }
+	}
+	BOOST_THROW_EXCEPTION(invalid_argument_exception(
+		"Unsupported MessagePack type byte " + std::to_string( static_cast<unsigned int>( lead_byte ) )
+	));
+}
+
+/// \brief Parse the specified MessagePack data, which must contain exactly one value
+///
+/// \throws invalid_argument_exception if the data is malformed or uses unsupported features
+msgpack_value cath::file::detail::parse_msgpack(const string_ref &prm_data ///< The MessagePack data
+                                                ) {
+	const char *itr = prm_data.data();
+	const char *end = prm_data.data() + prm_data.length();
+	msgpack_value value = parse_msgpack_value( itr, end );
+	if ( itr != end ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("MessagePack data has unexpected trailing bytes"));
+	}
+	return value;
+}
@@ -0,0 +1,98 @@
+/// \file
+/// \brief The msgpack_value class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_MSGPACK_VALUE_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_DETAIL_MSGPACK_VALUE_HPP
+
+#include <boost/utility/string_ref.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The types of msgpack_value
+			enum class msgpack_type : char {
+				NIL,     ///< A nil value
+				BOOLEAN, ///< A boolean
+				INTEGER, ///< A (signed or unsigned) integer
+				FLOAT,   ///< A 32-bit or 64-bit float
+				STRING,  ///< A UTF-8 string
+				BINARY,  ///< A byte array
+				ARRAY,   ///< An array of values
+				MAP      ///< A map from string keys to values
+			};
+
+			/// \brief A value decoded from MessagePack data (as used in BinaryCIF files)
+			///
+			/// The strings and byte arrays refer to the original data (which must outlive the msgpack_value)
+			/// so that the (potentially large) encoded columns aren't copied.
+			///
+			/// Only the parts of MessagePack that BinaryCIF uses are supported (so not extension types
+			/// or maps with non-string keys).
+			class msgpack_value final {
+			private:
+				/// \brief The type of the value
+				msgpack_type               type          = msgpack_type::NIL;
+
+				/// \brief The value of a BOOLEAN or INTEGER
+				std::int64_t               integer_value = 0;
+
+				/// \brief The value of a FLOAT
+				double                     float_value   = 0.0;
+
+				/// \brief The bytes of a STRING or BINARY
+				boost::string_ref          bytes;
+
+				/// \brief The elements of an ARRAY or the values of a MAP
+				std::vector<msgpack_value> elements;
+
+				/// \brief The keys of a MAP
+				std::vector<boost::string_ref> keys;
+
+				friend msgpack_value parse_msgpack_value(const char *&,
+				                                         const char *);
+
+			public:
+				const msgpack_type & get_type() const;
+				bool is_nil() const;
+				bool get_boolean() const;
+				double get_number() const;
+				std::int64_t get_integer() const;
+				const boost::string_ref & get_string() const;
+				const boost::string_ref & get_binary() const;
+				const std::vector<msgpack_value> & get_array() const;
+
+				const msgpack_value * find(const boost::string_ref &) const;
+				const msgpack_value & at(const boost::string_ref &) const;
+			};
+
+			msgpack_value parse_msgpack_value(const char *&,
+			                                  const char *);
+
+			msgpack_value parse_msgpack(const boost::string_ref &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
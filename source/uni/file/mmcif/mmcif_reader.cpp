@@ -0,0 +1,293 @@
+/// \file
+/// \brief The mmCIF reader definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "mmcif_reader.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/string/string_parse_tools.hpp"
+#include "file/mmcif/detail/atom_site_field.hpp"
+#include "file/mmcif/detail/atom_site_pdb_builder.hpp"
+#include "file/mmcif/detail/cif_tokenizer.hpp"
+#include "file/pdb/detail/pdb_atom_line_parser.hpp"
+#include "file/pdb/pdb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::algorithm::istarts_with;
+using boost::algorithm::to_lower_copy;
+using boost::filesystem::file_size;
+using boost::filesystem::path;
+using boost::iostreams::mapped_file_source;
+using boost::none;
+using boost::string_ref;
+using std::string;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The prefix of the tags of the _atom_site category
+			static constexpr char ATOM_SITE_TAG_PREFIX[] = "_atom_site.";
+
+			/// \brief The values of the current row of an mmCIF _atom_site category,
+			///        as required by make_atom_site_row()
+			class cif_text_atom_site_row final {
+			private:
+				/// \brief Which of the fields are present in the category
+				atom_site_field_presence                    presence = {};
+
+				/// \brief The tokens for the fields in the current row
+				std::array<cif_token, NUM_ATOM_SITE_FIELDS> values;
+
+				/// \brief Whether each of the fields is null in the current row
+				atom_site_field_presence                    nulls    = {};
+
+			public:
+				/// \brief Set the value of the specified field in the current row
+				void set_value(const atom_site_field &prm_field, ///< The field to set
+				               const cif_token       &prm_token  ///< The token holding the value
+				               ) {
+					const size_t index = index_of_atom_site_field( prm_field );
+					presence[ index ] = true;
+					values  [ index ] = prm_token;
+					nulls   [ index ] = is_null_cif_value( prm_token );
+				}
+
+				/// \brief Getter for which of the fields are present in the category
+				const atom_site_field_presence & get_presence() const {
+					return presence;
+				}
+
+				/// \brief Whether the specified field is present in the category
+				bool has_field(const atom_site_field &prm_field ///< The field to query
+				               ) const {
+					return presence[ index_of_atom_site_field( prm_field ) ];
+				}
+
+				/// \brief Whether the specified field is present and non-null in the current row
+				bool has_value(const atom_site_field &prm_field ///< The field to query
+				               ) const {
+					const size_t index = index_of_atom_site_field( prm_field );
+					return presence[ index ] && ! nulls[ index ];
+				}
+
+				/// \brief Get the text of the specified field in the current row
+				string_ref get_text(const atom_site_field &prm_field ///< The field to query
+				                    ) const {
+					return values[ index_of_atom_site_field( prm_field ) ].text;
+				}
+
+				/// \brief Get the number in the specified field in the current row
+				///
+				/// \throws invalid_argument_exception if the field doesn't contain a number
+				double get_number(const atom_site_field &prm_field ///< The field to query
+				                  ) const {
+					const string_ref &text = get_text( prm_field );
+					double value = 0.0;
+					if ( parse_fixed_width_fixed_point( text, value ) ) {
+						return value;
+					}
+					const string text_string = text.to_string();
+					return parse_double_from_substring( text_string, 0, text_string.length() );
+				}
+			};
+
+			/// \brief Get the atom_site_field of the specified CIF tag or none if it isn't an _atom_site tag that's used
+			inline atom_site_field_opt atom_site_field_of_tag(const string_ref &prm_tag ///< The tag (eg "_atom_site.Cartn_x")
+			                                                  ) {
+				const string_ref prefix{ ATOM_SITE_TAG_PREFIX };
+				if ( prm_tag.length() <= prefix.length() || ! istarts_with( prm_tag, prefix ) ) {
+					return none;
+				}
+				return atom_site_field_of_name( prm_tag.substr( prefix.length() ) );
+			}
+
+			/// \brief Whether the specified token starts something other than a value (ie is a tag or reserved word)
+			inline bool is_non_value(const cif_token &prm_token ///< The token to query
+			                         ) {
+				return is_cif_tag( prm_token ) || is_cif_reserved_word( prm_token );
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Whether the specified filename has an mmCIF extension (".cif" or ".mmcif", case-insensitively)
+bool cath::file::is_mmcif_filename(const path &prm_filename ///< The filename to query
+                                   ) {
+	const string extension = to_lower_copy( prm_filename.extension().string() );
+	return ( extension == ".cif" || extension == ".mmcif" );
+}
+
+/// \brief Read the _atom_site data from the specified mmCIF text into the specified pdb
+///
+/// This streams through the tokens of the first data block, decoding the _atom_site values
+/// as they're reached, without building any intermediate representation of the file.
+/// Other categories are skipped.
+///
+/// The resulting pdb is the same as would be read from the equivalent PDB-format file
+/// (see atom_site_pdb_builder for details)
+///
+/// \throws invalid_argument_exception if the _atom_site data is malformed or can't be represented
+void cath::file::read_mmcif_text(const string_ref &prm_text, ///< The mmCIF text (eg from a memory-mapped file)
+                                 pdb              &prm_pdb   ///< The pdb to populate
+                                 ) {
+	cif_tokenizer           tokenizer{ prm_text };
+	atom_site_pdb_builder   builder;
+	cif_text_atom_site_row  single_row;
+	bool                    seen_data_block = false;
+	bool                    finished        = false;
+
+	while ( ! finished ) {
+		const cif_token_opt token = tokenizer.next();
+		if ( ! token ) {
+			break;
+		}
+
+		// Only read the first data block
+		if ( ! token->is_quoted && istarts_with( token->text, "data_" ) ) {
+			finished        = seen_data_block;
+			seen_data_block = true;
+		}
+		// Handle a loop
+		else if ( ! token->is_quoted && token->text == "loop_" ) {
+			std::vector<atom_site_field_opt> loop_fields;
+			bool                             is_atom_site_loop = false;
+			while ( tokenizer.peek() && is_cif_tag( *tokenizer.peek() ) ) {
+				const string_ref tag = tokenizer.next()->text;
+				is_atom_site_loop = is_atom_site_loop || istarts_with( tag, ATOM_SITE_TAG_PREFIX );
+				loop_fields.push_back( atom_site_field_of_tag( tag ) );
+			}
+
+			// Read the loop's values, adding a row whenever one is complete (or just skip them if this isn't the _atom_site loop)
+			cif_text_atom_site_row row;
+			if ( is_atom_site_loop ) {
+				for (const atom_site_field_opt &field : loop_fields) {
+					if ( field ) {
+						row.set_value( *field, cif_token{} );
+					}
+				}
+				check_required_atom_site_fields_present( row.get_presence() );
+			}
+			size_t value_ctr = 0;
+			while ( ! finished && tokenizer.peek() && ! is_non_value( *tokenizer.peek() ) ) {
+				const cif_token value = *tokenizer.next();
+				if ( ! is_atom_site_loop ) {
+					continue;
+				}
+				const atom_site_field_opt &field = loop_fields[ value_ctr ];
+				if ( field ) {
+					row.set_value( *field, value );
+				}
+				++value_ctr;
+				if ( value_ctr == loop_fields.size() ) {
+					value_ctr = 0;
+					finished = ! builder.add_row( make_atom_site_row( row ) );
+				}
+			}
+			if ( is_atom_site_loop && value_ctr != 0 ) {
+				BOOST_THROW_EXCEPTION(invalid_argument_exception("The mmCIF _atom_site loop has a number of values that isn't a multiple of its number of tags"));
+			}
+		}
+		// Handle a non-looped tag and its value
+		else if ( is_cif_tag( *token ) ) {
+			const cif_token_opt value = tokenizer.next();
+			if ( ! value || is_non_value( *value ) ) {
+				BOOST_THROW_EXCEPTION(invalid_argument_exception("Missing value for CIF tag \"" + token->text.to_string() + "\""));
+			}
+			const atom_site_field_opt field = atom_site_field_of_tag( token->text );
+			if ( field ) {
+				single_row.set_value( *field, *value );
+			}
+		}
+	}
+
+	// If there were non-looped _atom_site values, add them as a single row
+	if ( std::any_of( single_row.get_presence().begin(), single_row.get_presence().end(), [] (const bool &x) { return x; } ) ) {
+		check_required_atom_site_fields_present( single_row.get_presence() );
+		builder.add_row( make_atom_site_row( single_row ) );
+	}
+
+	builder.finish_into( prm_pdb );
+}
+
+/// \brief Read a pdb from the specified string containing mmCIF data
+pdb cath::file::read_mmcif(const string &prm_string ///< The string containing the mmCIF data
+                           ) {
+	pdb new_pdb;
+	read_mmcif_text( prm_string, new_pdb );
+	return new_pdb;
+}
+
+/// \brief Read the specified mmCIF file into the specified pdb
+///
+/// The file is memory-mapped to avoid copying its contents.
+///
+/// \throws runtime_error_exception if the file can't be read
+void cath::file::read_mmcif_file(const path &prm_filename, ///< The mmCIF file to read
+                                 pdb        &prm_pdb       ///< The pdb to populate
+                                 ) {
+	try {
+		if ( file_size( prm_filename ) == 0 ) {
+			read_mmcif_text( string_ref{}, prm_pdb );
+			return;
+		}
+		const mapped_file_source mmcif_file{ prm_filename.string() };
+		read_mmcif_text( string_ref{ mmcif_file.data(), mmcif_file.size() }, prm_pdb );
+	}
+	// Catch and immediately rethrow any boost::exceptions
+	// (so that it won't get caught in the next block if it's a std::exception)
+	catch (const boost::exception &ex) {
+		throw;
+	}
+	// Catch any I/O exceptions
+	catch (const std::exception &ex) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			  "Cannot read mmCIF file \""
+			+ prm_filename.string()
+			+ "\" ["
+			+ ex.what()
+			+ "]"
+		));
+	}
+}
+
+/// \brief Read a pdb from the specified mmCIF file
+///
+/// \throws runtime_error_exception if the file can't be read
+pdb cath::file::read_mmcif_file(const path &prm_filename ///< The mmCIF file to read
+                                ) {
+	pdb new_pdb;
+	read_mmcif_file( prm_filename, new_pdb );
+	return new_pdb;
+}
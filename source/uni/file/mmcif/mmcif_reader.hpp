@@ -0,0 +1,49 @@
+/// \file
+/// \brief The mmCIF reader header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_MMCIF_READER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_MMCIF_MMCIF_READER_HPP
+
+#include <boost/filesystem/path.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <string>
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace file {
+
+		bool is_mmcif_filename(const boost::filesystem::path &);
+
+		void read_mmcif_text(const boost::string_ref &,
+		                     pdb &);
+
+		pdb read_mmcif(const std::string &);
+
+		void read_mmcif_file(const boost::filesystem::path &,
+		                     pdb &);
+
+		pdb read_mmcif_file(const boost::filesystem::path &);
+
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,240 @@
+/// \file
+/// \brief The mmcif_reader test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "biocore/chain_label.hpp"
+#include "chopping/region/region.hpp"
+#include "common/boost_addenda/log/stringstream_log_sink.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "file/mmcif/detail/cif_tokenizer.hpp"
+#include "file/mmcif/mmcif_reader.hpp"
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_atom.hpp"
+#include "file/pdb/pdb_residue.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::filesystem::path;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The mmcif_reader_test_suite_fixture to assist in testing mmcif_reader
+		struct mmcif_reader_test_suite_fixture : protected global_test_constants {
+		protected:
+			~mmcif_reader_test_suite_fixture() noexcept = default;
+
+			/// \brief Check that the two specified pdbs have the same residues and post-TER residues
+			void check_pdbs_match(const pdb &prm_got,     ///< The pdb that was read
+			                      const pdb &prm_expected ///< The expected pdb
+			                      ) {
+				BOOST_CHECK_EQUAL( prm_got.get_num_residues(),              prm_expected.get_num_residues()              );
+				BOOST_CHECK_EQUAL( prm_got.get_post_ter_residues().size(),  prm_expected.get_post_ter_residues().size()  );
+				BOOST_CHECK_EQUAL( to_pdb_file_string( prm_got ),           to_pdb_file_string( prm_expected )           );
+				BOOST_CHECK_EQUAL(
+					to_pdb_file_string( pdb{}.set_residues( prm_got.get_post_ter_residues()      ) ),
+					to_pdb_file_string( pdb{}.set_residues( prm_expected.get_post_ter_residues() ) )
+				);
+			}
+
+			/// \brief The header of an mmCIF _atom_site loop with the commonly-used fields
+			const string ATOM_SITE_LOOP_HEADER = R"(data_test
+loop_
+_atom_site.group_PDB
+_atom_site.id
+_atom_site.type_symbol
+_atom_site.label_atom_id
+_atom_site.label_alt_id
+_atom_site.label_comp_id
+_atom_site.label_asym_id
+_atom_site.label_seq_id
+_atom_site.Cartn_x
+_atom_site.Cartn_y
+_atom_site.Cartn_z
+_atom_site.occupancy
+_atom_site.B_iso_or_equiv
+_atom_site.auth_seq_id
+_atom_site.auth_asym_id
+_atom_site.pdbx_PDB_model_num
+)";
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(mmcif_reader_test_suite, cath::test::mmcif_reader_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(recognises_mmcif_filenames) {
+	BOOST_CHECK(   is_mmcif_filename( "1bdh.cif"       ) );
+	BOOST_CHECK(   is_mmcif_filename( "dir/1BDH.CIF"   ) );
+	BOOST_CHECK(   is_mmcif_filename( "1bdh.mmcif"     ) );
+	BOOST_CHECK( ! is_mmcif_filename( "1bdh.bcif"      ) );
+	BOOST_CHECK( ! is_mmcif_filename( "1bdh.pdb"       ) );
+	BOOST_CHECK( ! is_mmcif_filename( "1bdh"           ) );
+}
+
+BOOST_AUTO_TEST_CASE(reads_file_as_equivalent_pdb_file) {
+	check_pdbs_match(
+		read_mmcif_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.cif" ),
+		read_pdb_file  ( TEST_SOURCE_DATA_DIR() / "supn_content" / "1bdh" )
+	);
+}
+
+BOOST_AUTO_TEST_CASE(pdb_read_file_reads_mmcif_files_by_extension) {
+	check_pdbs_match(
+		read_pdb_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.cif" ),
+		read_pdb_file( TEST_SOURCE_DATA_DIR() / "supn_content" / "1bdh" )
+	);
+}
+
+BOOST_AUTO_TEST_CASE(reads_looped_values_with_comments_quotes_and_text_fields_in_other_categories) {
+	const pdb the_pdb = read_mmcif(
+		"# A comment\n"
+		"data_test\n"
+		"_struct.title\n"
+		";A text field with 'quotes', \"more quotes\" and\n"
+		"loop_ _atom_site.id 1 # that should all be ignored\n"
+		";\n"
+		+ ATOM_SITE_LOOP_HEADER.substr( ATOM_SITE_LOOP_HEADER.find( '\n' ) + 1 ) +
+		"ATOM 1 N N   . SER A 1 -1.5 2.25 3 1 10.5 7 A 1 # comment after a row\n"
+		"ATOM 2 C CA  . SER A 1 4 5 6 0.5 20 7 A 1\n"
+		"ATOM 3 C 'C' . SER A 1 4 5 6 ? . 7 A 1\n"
+		"ATOM 4 N N   . GLY A 2 7 8 9 1 30 8 A 1\n"
+		"#\n"
+	);
+	BOOST_REQUIRE_EQUAL( the_pdb.get_num_residues(), 2 );
+	BOOST_CHECK_EQUAL( the_pdb.get_num_atoms(), 4 );
+	BOOST_CHECK_EQUAL(
+		to_pdb_file_string( the_pdb ),
+		"ATOM      1  N   SER A   7      -1.500   2.250   3.000  1.00 10.50           N  \n"
+		"ATOM      2  CA  SER A   7       4.000   5.000   6.000  0.50 20.00           C  \n"
+		"ATOM      3  C   SER A   7       4.000   5.000   6.000  1.00  0.00           C  \n"
+		"ATOM      4  N   GLY A   8       7.000   8.000   9.000  1.00 30.00           N  \n"
+		"TER       5      GLY A   8                                                      \n"
+		"END   \n"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(reads_non_looped_atom_site_as_a_single_row) {
+	const pdb the_pdb = read_mmcif(
+		"data_test\n"
+		"_atom_site.group_PDB HETATM\n"
+		"_atom_site.id 9\n"
+		"_atom_site.type_symbol ZN\n"
+		"_atom_site.label_atom_id ZN\n"
+		"_atom_site.label_comp_id ZN\n"
+		"_atom_site.auth_seq_id 101\n"
+		"_atom_site.auth_asym_id B\n"
+		"_atom_site.Cartn_x 1.0\n"
+		"_atom_site.Cartn_y 2.0\n"
+		"_atom_site.Cartn_z 3.0\n"
+		"_atom_site.pdbx_formal_charge 2\n"
+	);
+	BOOST_REQUIRE_EQUAL( the_pdb.get_num_residues(), 1 );
+	BOOST_CHECK_EQUAL(
+		to_pdb_file_entry( the_pdb.get_residue_of_index__backbone_unchecked( 0 ).get_residue_id(), *the_pdb.get_residue_of_index__backbone_unchecked( 0 ).begin() ),
+		"HETATM    9 ZN    ZN B 101       1.000   2.000   3.000  1.00  0.00          ZN2+"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(treats_non_polymer_atoms_as_following_ters_of_their_chains) {
+	const pdb the_pdb = read_mmcif(
+		ATOM_SITE_LOOP_HEADER +
+		"ATOM   1 N N  . SER A 1 1 1 1 1 1 7   A 1\n"
+		"HETATM 2 O O  . HOH A . 2 2 2 1 1 201 A 1\n"
+		"ATOM   3 N N  . GLY B 1 3 3 3 1 1 1   B 1\n"
+	);
+	BOOST_CHECK_EQUAL( the_pdb.get_num_residues(),             2 );
+	BOOST_CHECK_EQUAL( the_pdb.get_post_ter_residues().size(), 1 );
+}
+
+BOOST_AUTO_TEST_CASE(only_reads_the_first_model_and_first_data_block) {
+	const pdb the_pdb = read_mmcif(
+		ATOM_SITE_LOOP_HEADER +
+		"ATOM 1 N N . SER A 1 1 1 1 1 1 7 A 1\n"
+		"ATOM 2 N N . GLY A 2 1 1 1 1 1 8 A 2\n"
+		"data_another\n"
+		+ ATOM_SITE_LOOP_HEADER.substr( ATOM_SITE_LOOP_HEADER.find( '\n' ) + 1 ) +
+		"ATOM 3 N N . ALA A 3 1 1 1 1 1 9 A 1\n"
+	);
+	BOOST_CHECK_EQUAL( the_pdb.get_num_residues(), 1 );
+}
+
+BOOST_AUTO_TEST_CASE(warns_about_and_skips_unrepresentable_atoms) {
+	const stringstream_log_sink log_sink;
+	const pdb the_pdb = read_mmcif(
+		ATOM_SITE_LOOP_HEADER +
+		"ATOM 1 N N     . SER A 1 1 1 1 1 1 7 A 1\n"
+		"ATOM 2 C CLONG . SER A 1 1 1 1 1 1 7 A 1\n"
+	);
+	BOOST_CHECK_EQUAL( the_pdb.get_num_atoms(), 1 );
+	BOOST_CHECK( ! log_sink.str_is_empty() );
+}
+
+BOOST_AUTO_TEST_CASE(warns_about_and_skips_chains_with_multi_character_identifiers) {
+	const stringstream_log_sink log_sink;
+	const pdb the_pdb = read_mmcif(
+		ATOM_SITE_LOOP_HEADER +
+		"ATOM 1 N N . SER A  1 1 1 1 1 1 7 A  1\n"
+		"ATOM 2 N N . GLY AA 1 2 2 2 1 1 1 AA 1\n"
+		"ATOM 3 C CA . GLY AA 1 3 3 3 1 1 1 AA 1\n"
+	);
+	BOOST_REQUIRE_EQUAL( the_pdb.get_num_residues(), 1 );
+	BOOST_CHECK_EQUAL  ( the_pdb.get_num_atoms(),    1 );
+	BOOST_CHECK_EQUAL  ( get_chain_label( the_pdb.get_residue_of_index__backbone_unchecked( 0 ) ), chain_label( 'A' ) );
+	BOOST_CHECK        ( ! log_sink.str_is_empty() );
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_invalid_data) {
+	// Missing coordinates
+	BOOST_CHECK_THROW( read_mmcif( "data_test\nloop_\n_atom_site.id\n_atom_site.label_atom_id\n1 N\n" ), invalid_argument_exception );
+
+	// Incomplete row
+	BOOST_CHECK_THROW( read_mmcif( ATOM_SITE_LOOP_HEADER + "ATOM 1 N N . SER A 1 1 1 1 1 1 7 A\n" ), invalid_argument_exception );
+
+	// Missing file
+	BOOST_CHECK_THROW( read_mmcif_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "does_not_exist.cif" ), runtime_error_exception );
+}
+
+BOOST_AUTO_TEST_CASE(tokenizes_cif_text) {
+	cif_tokenizer tokenizer{ "loop_ _a.b 'it''s' \"x y\" ? . # comment\n;line 1\nline 2\n;\nlast" };
+	const auto next_text_fn = [&] () { return tokenizer.next()->text.to_string(); };
+	BOOST_CHECK_EQUAL( next_text_fn(), "loop_"  );
+	BOOST_CHECK_EQUAL( tokenizer.peek()->text.to_string(), "_a.b" );
+	BOOST_CHECK_EQUAL( next_text_fn(), "_a.b"   );
+	BOOST_CHECK_EQUAL( next_text_fn(), "it''s"  );
+	BOOST_CHECK_EQUAL( next_text_fn(), "x y"    );
+	BOOST_CHECK( is_null_cif_value( *tokenizer.next() ) );
+	BOOST_CHECK( is_null_cif_value( *tokenizer.next() ) );
+	const cif_token text_field = *tokenizer.next();
+	BOOST_CHECK( text_field.is_quoted );
+	BOOST_CHECK_EQUAL( text_field.text.to_string(), "line 1\nline 2" );
+	BOOST_CHECK_EQUAL( next_text_fn(), "last"   );
+	BOOST_CHECK( ! tokenizer.next() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+/// \file
+/// \brief The pdb_atom_line_parser class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pdb_atom_line_parser.hpp"
+
+#include "biocore/chain_label.hpp"
+#include "biocore/residue_id.hpp"
+#include "biocore/residue_name.hpp"
+#include "structure/geometry/coord.hpp"
+
+#include <algorithm>
+#include <string>
+
+using namespace cath;
+using namespace cath::file;
+using namespace cath::file::detail;
+using namespace cath::geom;
+
+using boost::none;
+using boost::optional;
+using boost::string_ref;
+using std::string;
+
+/// \brief Get the amino_acid for the specified residue name and record type,
+///        reusing the previous one if they're the same as last time
+///
+/// \returns The amino_acid or none if it isn't recognised (in which case the caller should
+///          fall back on pdb_record_parse_problem() to get the appropriate warning)
+optional<amino_acid> pdb_atom_line_parser::get_amino_acid(const string_ref &prm_amino_acid_chars, ///< The three-letter residue name from the record
+                                                          const pdb_record &prm_record_type       ///< The type of the record
+                                                          ) {
+	if ( ! prev_amino_acid
+		|| prm_record_type != prev_record_type
+		|| ! std::equal( prm_amino_acid_chars.begin(), prm_amino_acid_chars.end(), prev_amino_acid_chars.begin() ) ) {
+		try {
+			prev_amino_acid = get_amino_acid_of_string_and_record(
+				string{ prm_amino_acid_chars.begin(), prm_amino_acid_chars.end() },
+				prm_record_type
+			);
+		}
+		catch (...) {
+			prev_amino_acid = none;
+			return none;
+		}
+		std::copy( prm_amino_acid_chars.begin(), prm_amino_acid_chars.end(), prev_amino_acid_chars.begin() );
+		prev_record_type = prm_record_type;
+	}
+	return prev_amino_acid;
+}
+
+/// \brief Parse the specified ATOM/HETATM record
+///
+/// \returns The parsed residue_id and pdb_atom or none if the record isn't simple and well-formed
+///          (in which case the caller should fall back on pdb_record_parse_problem() and parse_pdb_atom_record())
+res_id_pdb_atom_pair_opt pdb_atom_line_parser::parse_line(const string_ref &prm_line,       ///< The ATOM/HETATM record to parse
+                                                          const pdb_record &prm_record_type ///< The type of the record (as returned by pdb_atom_record_type_of_line())
+                                                          ) {
+	// Leave any of the problems that pdb_record_parse_problem() reports to the fall-back
+	if ( prm_line.length() < pdb_atom::MIN_NUM_PDB_COLS || prm_line.length() > pdb_atom::MAX_NUM_PDB_COLS ) {
+		return none;
+	}
+	if ( prm_line[ 11 ] != ' ' || prm_line[ 20 ] != ' ' || prm_line[ 27 ] != ' ' || prm_line[ 28 ] != ' ' || prm_line[ 29 ] != ' ' ) {
+		return none;
+	}
+	const auto the_amino_acid = get_amino_acid( prm_line.substr( 17, 3 ), prm_record_type );
+	if ( ! the_amino_acid ) {
+		return none;
+	}
+
+	// Leave the error about a space in column 26 to the fall-back
+	if ( prm_line[ 25 ] == ' ' ) {
+		return none;
+	}
+
+	                                                                                                      // Comments with PDB format documentation
+	                                                                                                      // (http://www.wwpdb.org/documentation/format33/sect9.html#ATOM)
+	uint   serial      = 0;                                                                               //  7 - 11        Integer       serial       Atom  serial number.
+	int    res_num     = 0;                                                                               // 23 - 26        Integer       resSeq       Residue sequence number.
+	double coord_x     = 0.0;                                                                             // 31 - 38        Real(8.3)     x            Orthogonal coordinates for X in Angstroms.
+	double coord_y     = 0.0;                                                                             // 39 - 46        Real(8.3)     y            Orthogonal coordinates for Y in Angstroms.
+	double coord_z     = 0.0;                                                                             // 47 - 54        Real(8.3)     z            Orthogonal coordinates for Z in Angstroms.
+	float  occupancy   = 0.0;                                                                             // 55 - 60        Real(6.2)     occupancy    Occupancy.
+	float  temp_factor = 0.0;                                                                             // 61 - 66        Real(6.2)     tempFactor   Temperature  factor.
+	const bool parsed_ok = parse_fixed_width_uint       ( prm_line.substr(  6, 5 ), serial      )
+	                    && parse_fixed_width_int        ( prm_line.substr( 22, 4 ), res_num     )
+	                    && parse_fixed_width_fixed_point( prm_line.substr( 30, 8 ), coord_x     )
+	                    && parse_fixed_width_fixed_point( prm_line.substr( 38, 8 ), coord_y     )
+	                    && parse_fixed_width_fixed_point( prm_line.substr( 46, 8 ), coord_z     )
+	                    && parse_fixed_width_fixed_point( prm_line.substr( 54, 6 ), occupancy   )
+	                    && parse_fixed_width_fixed_point( prm_line.substr( 60, 6 ), temp_factor );
+	if ( ! parsed_ok ) {
+		return none;
+	}
+
+	// Copy the (possibly absent) element symbol and charge, filling with 0s like get_char_arr_of_substring()
+	const auto char_arr_of_line = [&] (const size_t &prm_index) {
+		char_2_arr result = { { 0, 0 } };
+		const string_ref part = prm_line.substr( std::min( prm_index, prm_line.length() ), 2 );
+		std::copy( part.begin(), part.end(), result.begin() );
+		return result;
+	};
+
+	return res_id_pdb_atom_pair{
+		residue_id{
+			chain_label( prm_line[ 21 ] ),                                                                // 22             Character     chainID      Chain identifier.
+			make_residue_name_with_non_insert_char( res_num, prm_line[ 26 ], ' ' )                        // 27             AChar         iCode        Code for insertion of residues.
+		},
+		pdb_atom(
+			prm_record_type,
+			serial,
+			char_4_arr{ { prm_line[ 12 ], prm_line[ 13 ], prm_line[ 14 ], prm_line[ 15 ] } },             // 13 - 16        Atom          name         Atom name.
+			prm_line[ 16 ],                                                                               // 17             Character     altLoc       Alternate location indicator.
+			*the_amino_acid,
+			coord{ coord_x, coord_y, coord_z },
+			occupancy,
+			temp_factor,
+			char_arr_of_line( 76 ),                                                                       // 77 - 78        LString(2)    element      Element symbol, right-justified.
+			char_arr_of_line( 78 )                                                                        // 79 - 80        LString(2)    charge       Charge  on the atom.
+		)
+	};
+}
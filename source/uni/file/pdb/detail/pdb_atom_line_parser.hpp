@@ -0,0 +1,212 @@
+/// \file
+/// \brief The pdb_atom_line_parser class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_ATOM_LINE_PARSER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_ATOM_LINE_PARSER_HPP
+
+#include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include "common/char_arr_type_aliases.hpp"
+#include "file/file_type_aliases.hpp"
+#include "file/pdb/pdb_atom.hpp"
+#include "file/pdb/pdb_record.hpp"
+#include "structure/protein/amino_acid.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The maximum number of digits accepted by the fast fixed-width numeric parsers
+			///
+			/// This keeps the accumulated values well within the range in which they (and the powers of ten
+			/// by which they're divided) are exact, even as floats (the widest numeric field in a PDB ATOM record
+			/// is 8 characters)
+			constexpr size_t MAX_FAST_PARSE_DIGITS = 9;
+
+			/// \brief Get the power of ten of the specified exponent (which must be no more than MAX_FAST_PARSE_DIGITS) as the specified type
+			template <typename T>
+			inline T fast_parse_pow10(const size_t &prm_exponent ///< The exponent (the number of fractional digits)
+			                          ) {
+				static constexpr std::array<T, MAX_FAST_PARSE_DIGITS + 1> pow10s = { {
+					static_cast<T>( 1e0 ), static_cast<T>( 1e1 ), static_cast<T>( 1e2 ), static_cast<T>( 1e3 ), static_cast<T>( 1e4 ),
+					static_cast<T>( 1e5 ), static_cast<T>( 1e6 ), static_cast<T>( 1e7 ), static_cast<T>( 1e8 ), static_cast<T>( 1e9 )
+				} };
+				return pow10s[ prm_exponent ];
+			}
+
+			/// \brief Skip over any spaces at the start of the specified region
+			inline void fast_parse_skip_spaces(const char *&prm_itr, ///< The iterator to advance over any spaces
+			                                   const char  *prm_end  ///< The end of the region
+			                                   ) {
+				while ( prm_itr != prm_end && *prm_itr == ' ' ) {
+					++prm_itr;
+				}
+			}
+
+			/// \brief Accumulate any decimal digits at the start of the specified region into the specified value
+			///        and return the number of digits read
+			inline size_t fast_parse_accumulate_digits(const char    *&prm_itr,  ///< The iterator to advance over any digits
+			                                           const char     *prm_end,  ///< The end of the region
+			                                           std::uint64_t  &prm_value ///< The value into which the digits should be accumulated
+			                                           ) {
+				size_t num_digits = 0;
+				while ( prm_itr != prm_end && *prm_itr >= '0' && *prm_itr <= '9' ) {
+					prm_value = ( prm_value * 10 ) + static_cast<std::uint64_t>( *prm_itr - '0' );
+					++prm_itr;
+					++num_digits;
+				}
+				return num_digits;
+			}
+
+			/// \brief Parse an optionally-signed integer that may be padded with spaces from the specified fixed-width field
+			///
+			/// This only accepts a simple subset of the inputs that common::parse_int_from_substring() accepts but,
+			/// for that subset, it returns exactly the same values (and much more quickly).
+			///
+			/// \returns Whether the field could be parsed (if not, prm_value is left unchanged)
+			inline bool parse_fixed_width_int(const boost::string_ref &prm_field, ///< The field to parse
+			                                  int                     &prm_value  ///< The value to populate
+			                                  ) {
+				const char *itr = prm_field.data();
+				const char *end = prm_field.data() + prm_field.length();
+				fast_parse_skip_spaces( itr, end );
+				const bool is_negative = ( itr != end && *itr == '-' );
+				if ( itr != end && ( *itr == '-' || *itr == '+' ) ) {
+					++itr;
+				}
+				std::uint64_t magnitude  = 0;
+				const size_t  num_digits = fast_parse_accumulate_digits( itr, end, magnitude );
+				fast_parse_skip_spaces( itr, end );
+				if ( num_digits == 0 || num_digits > MAX_FAST_PARSE_DIGITS || itr != end ) {
+					return false;
+				}
+				prm_value = is_negative ? -static_cast<int>( magnitude ) : static_cast<int>( magnitude );
+				return true;
+			}
+
+			/// \brief Parse an unsigned integer that may be padded with spaces from the specified fixed-width field
+			///
+			/// This only accepts a simple subset of the inputs that common::parse_uint_from_substring() accepts but,
+			/// for that subset, it returns exactly the same values (and much more quickly).
+			///
+			/// \returns Whether the field could be parsed (if not, prm_value is left unchanged)
+			inline bool parse_fixed_width_uint(const boost::string_ref &prm_field, ///< The field to parse
+			                                   uint                    &prm_value  ///< The value to populate
+			                                   ) {
+				const char *itr = prm_field.data();
+				const char *end = prm_field.data() + prm_field.length();
+				fast_parse_skip_spaces( itr, end );
+				std::uint64_t value      = 0;
+				const size_t  num_digits = fast_parse_accumulate_digits( itr, end, value );
+				fast_parse_skip_spaces( itr, end );
+				if ( num_digits == 0 || num_digits > MAX_FAST_PARSE_DIGITS || itr != end ) {
+					return false;
+				}
+				prm_value = static_cast<uint>( value );
+				return true;
+			}
+
+			/// \brief Parse a fixed-point number (eg "-12.345") that may be padded with spaces from the specified fixed-width field
+			///
+			/// This only accepts a simple subset of the inputs that common::parse_double_from_substring() and
+			/// common::parse_float_from_substring() accept (no exponents, NaNs, infinities or missing leading digits)
+			/// but, for that subset, it returns exactly the same values (and much more quickly).
+			///
+			/// This relies on the digits being accumulated into an exact integer which is then divided by an exact power of ten,
+			/// which is what Boost Spirit's real parsers do.
+			///
+			/// \returns Whether the field could be parsed (if not, prm_value is left unchanged)
+			template <typename T>
+			inline bool parse_fixed_width_fixed_point(const boost::string_ref &prm_field, ///< The field to parse
+			                                          T                       &prm_value  ///< The value to populate
+			                                          ) {
+				const char *itr = prm_field.data();
+				const char *end = prm_field.data() + prm_field.length();
+				fast_parse_skip_spaces( itr, end );
+				const bool is_negative = ( itr != end && *itr == '-' );
+				if ( itr != end && ( *itr == '-' || *itr == '+' ) ) {
+					++itr;
+				}
+				std::uint64_t mantissa       = 0;
+				const size_t  num_int_digits = fast_parse_accumulate_digits( itr, end, mantissa );
+				size_t        num_frac_digits = 0;
+				if ( itr != end && *itr == '.' ) {
+					++itr;
+					num_frac_digits = fast_parse_accumulate_digits( itr, end, mantissa );
+				}
+				fast_parse_skip_spaces( itr, end );
+				if ( num_int_digits == 0 || num_int_digits + num_frac_digits > MAX_FAST_PARSE_DIGITS || itr != end ) {
+					return false;
+				}
+				const T magnitude = ( num_frac_digits == 0 ) ? static_cast<T>( mantissa )
+				                                             : static_cast<T>( mantissa ) / fast_parse_pow10<T>( num_frac_digits );
+				prm_value = is_negative ? -magnitude : magnitude;
+				return true;
+			}
+
+			/// \brief Get the pdb_record of the specified line if it's an ATOM or HETATM record or none otherwise
+			inline boost::optional<pdb_record> pdb_atom_record_type_of_line(const boost::string_ref &prm_line ///< The line to examine
+			                                                                ) {
+				if ( prm_line.starts_with( "ATOM  " ) ) {
+					return pdb_record::ATOM;
+				}
+				if ( prm_line.starts_with( "HETATM" ) ) {
+					return pdb_record::HETATM;
+				}
+				return boost::none;
+			}
+
+			/// \brief Quickly parse the fixed columns of PDB ATOM/HETATM records without building temporary strings
+			///
+			/// This has been optimised because whole-complex PDB files can contain hundreds of thousands of atom records:
+			///  * reads the fixed columns directly from the line with hand-rolled integer/fixed-point decoding
+			///  * reuses the previous line's amino_acid when the residue name and record type haven't changed
+			///
+			/// This only handles well-formed records; it returns none for anything else so that the caller can
+			/// fall back on pdb_record_parse_problem() and parse_pdb_atom_record(), which then give the usual
+			/// warnings/errors.
+			class pdb_atom_line_parser final {
+			private:
+				/// \brief The residue name of the most recently parsed record
+				char_3_arr                 prev_amino_acid_chars = { { 0, 0, 0 } };
+
+				/// \brief The record type of the most recently parsed record
+				pdb_record                 prev_record_type      = pdb_record::ATOM;
+
+				/// \brief The amino_acid of the most recently parsed record (or none if there hasn't been one)
+				boost::optional<amino_acid> prev_amino_acid;
+
+				boost::optional<amino_acid> get_amino_acid(const boost::string_ref &,
+				                                           const pdb_record &);
+
+			public:
+				res_id_pdb_atom_pair_opt parse_line(const boost::string_ref &,
+				                                    const pdb_record &);
+			};
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,164 @@
+/// \file
+/// \brief The pdb_atom_line_parser test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/file/open_fstream.hpp"
+#include "common/string/string_parse_tools.hpp"
+#include "file/pdb/detail/pdb_atom_line_parser.hpp"
+#include "file/pdb/pdb_atom.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::filesystem::path;
+using boost::string_ref;
+using std::ifstream;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The pdb_atom_line_parser_test_suite_fixture to assist in testing pdb_atom_line_parser
+		struct pdb_atom_line_parser_test_suite_fixture : protected global_test_constants {
+		protected:
+			~pdb_atom_line_parser_test_suite_fixture() noexcept = default;
+
+			/// \brief Check that pdb_atom_line_parser parses each of the ATOM/HETATM records in the specified file
+			///        to exactly the same result as parse_pdb_atom_record() (or leaves it to the fall-back if that would complain)
+			void check_parses_file_as_parse_pdb_atom_record(const path &prm_file ///< The PDB file to check
+			                                                ) {
+				ifstream pdb_istream;
+				open_ifstream( pdb_istream, prm_file );
+				pdb_atom_line_parser the_parser;
+				string line_string;
+				while ( getline( pdb_istream, line_string ) ) {
+					const auto record_type = pdb_atom_record_type_of_line( line_string );
+					if ( ! record_type ) {
+						continue;
+					}
+					const auto fast_parsed = the_parser.parse_line( line_string, *record_type );
+					if ( std::get<0>( pdb_record_parse_problem( line_string ) ) != pdb_atom_parse_status::OK ) {
+						BOOST_CHECK( ! fast_parsed );
+						continue;
+					}
+					BOOST_REQUIRE( fast_parsed );
+					const resid_atom_pair expected = parse_pdb_atom_record( line_string );
+					BOOST_CHECK_EQUAL( fast_parsed->first, expected.first );
+					BOOST_CHECK_EQUAL( to_pdb_file_entry( fast_parsed->first, fast_parsed->second ), to_pdb_file_entry( expected.first, expected.second ) );
+					BOOST_CHECK_EQUAL( fast_parsed->second.get_coord().get_x(),  expected.second.get_coord().get_x()  );
+					BOOST_CHECK_EQUAL( fast_parsed->second.get_coord().get_y(),  expected.second.get_coord().get_y()  );
+					BOOST_CHECK_EQUAL( fast_parsed->second.get_coord().get_z(),  expected.second.get_coord().get_z()  );
+					BOOST_CHECK_EQUAL( fast_parsed->second.get_occupancy(),      expected.second.get_occupancy()      );
+					BOOST_CHECK_EQUAL( fast_parsed->second.get_temp_factor(),    expected.second.get_temp_factor()    );
+				}
+			}
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(pdb_atom_line_parser_test_suite, cath::test::pdb_atom_line_parser_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(parses_fixed_width_ints) {
+	int value = 0;
+	BOOST_CHECK( parse_fixed_width_int( "  12", value ) );
+	BOOST_CHECK_EQUAL( value, 12 );
+	BOOST_CHECK( parse_fixed_width_int( "  -1", value ) );
+	BOOST_CHECK_EQUAL( value, -1 );
+	BOOST_CHECK( parse_fixed_width_int( "+7  ", value ) );
+	BOOST_CHECK_EQUAL( value, 7 );
+
+	BOOST_CHECK( ! parse_fixed_width_int( "    ", value ) );
+	BOOST_CHECK( ! parse_fixed_width_int( " 1 2", value ) );
+	BOOST_CHECK( ! parse_fixed_width_int( "  1A", value ) );
+	BOOST_CHECK( ! parse_fixed_width_int( "\t  1", value ) );
+	BOOST_CHECK_EQUAL( value, 7 );
+}
+
+BOOST_AUTO_TEST_CASE(parses_fixed_width_uints) {
+	uint value = 0;
+	BOOST_CHECK( parse_fixed_width_uint( "  123", value ) );
+	BOOST_CHECK_EQUAL( value, 123 );
+	BOOST_CHECK( ! parse_fixed_width_uint( "   -1", value ) );
+	BOOST_CHECK( ! parse_fixed_width_uint( "     ", value ) );
+	BOOST_CHECK_EQUAL( value, 123 );
+}
+
+BOOST_AUTO_TEST_CASE(parses_fixed_width_fixed_point_numbers) {
+	double value = 0.0;
+	BOOST_CHECK( parse_fixed_width_fixed_point( " -12.345", value ) );
+	BOOST_CHECK_EQUAL( value, -12.345 );
+	BOOST_CHECK( parse_fixed_width_fixed_point( "148.800 ", value ) );
+	BOOST_CHECK_EQUAL( value, 148.8 );
+	BOOST_CHECK( parse_fixed_width_fixed_point( "      5.", value ) );
+	BOOST_CHECK_EQUAL( value, 5.0 );
+
+	// Leave anything less simple to the full parser
+	BOOST_CHECK( ! parse_fixed_width_fixed_point( "  1.5e2 ", value ) );
+	BOOST_CHECK( ! parse_fixed_width_fixed_point( "    -.5 ", value ) );
+	BOOST_CHECK( ! parse_fixed_width_fixed_point( "     nan", value ) );
+	BOOST_CHECK( ! parse_fixed_width_fixed_point( " 1.2.3  ", value ) );
+	BOOST_CHECK( ! parse_fixed_width_fixed_point( "        ", value ) );
+	BOOST_CHECK_EQUAL( value, 5.0 );
+}
+
+BOOST_AUTO_TEST_CASE(fixed_point_numbers_match_the_full_parsers_exactly) {
+	char buffer[ 16 ];
+	for (int thousandths = -999999; thousandths <= 999999; thousandths += 997) {
+		std::snprintf( buffer, sizeof( buffer ), "%8.3f", static_cast<double>( thousandths ) / 1000.0 );
+		const string double_field{ buffer };
+		double double_value = 0.0;
+		BOOST_REQUIRE( parse_fixed_width_fixed_point( double_field, double_value ) );
+		BOOST_CHECK_EQUAL( double_value, parse_double_from_substring( double_field, 0, double_field.length() ) );
+
+		std::snprintf( buffer, sizeof( buffer ), "%6.2f", static_cast<double>( thousandths / 100 ) / 100.0 );
+		const string float_field{ buffer };
+		float float_value = 0.0;
+		BOOST_REQUIRE( parse_fixed_width_fixed_point( float_field, float_value ) );
+		BOOST_CHECK_EQUAL( float_value, parse_float_from_substring( float_field, 0, float_field.length() ) );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(leaves_problem_records_to_the_fall_back) {
+	pdb_atom_line_parser the_parser;
+	BOOST_CHECK(   the_parser.parse_line( "ATOM      1  N   LEU A 999       0.041 148.800  54.967  1.00 35.61           N  ", pdb_record::ATOM ) );
+	BOOST_CHECK( ! the_parser.parse_line( "ATOM      1  N   LEU A 999       0.041 148.800  54.967  1.00 35.6",              pdb_record::ATOM ) );
+	BOOST_CHECK( ! the_parser.parse_line( "ATOM      1  N   FOO A 999       0.041 148.800  54.967  1.00 35.61           N  ", pdb_record::ATOM ) );
+	BOOST_CHECK( ! the_parser.parse_line( "ATOM      1  N   LEU A 99        0.041 148.800  54.967  1.00 35.61           N  ", pdb_record::ATOM ) );
+	BOOST_CHECK( ! the_parser.parse_line( "ATOM      1  N   LEU A 999       0.041 148.800  5.4E+1  1.00 35.61           N  ", pdb_record::ATOM ) );
+}
+
+BOOST_AUTO_TEST_CASE(parses_records_as_parse_pdb_atom_record) {
+	check_parses_file_as_parse_pdb_atom_record( TEST_SOURCE_DATA_DIR()                                   / "1c0pA01"                                     );
+	check_parses_file_as_parse_pdb_atom_record( TEST_EXAMPLE_PDBS_DATA_DIR()                             / "1ufmA00"                                     );
+	check_parses_file_as_parse_pdb_atom_record( TEST_SOURCE_DATA_DIR() / "supn_content"                  / "1bdh"                                        );
+	check_parses_file_as_parse_pdb_atom_record( TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "non_std_amino_acid_hetatm_1"                 );
+	check_parses_file_as_parse_pdb_atom_record( TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "residue_with_diff_aas_in_altlocs"            );
+	check_parses_file_as_parse_pdb_atom_record( TEST_SOURCE_DATA_DIR() / "dssp"                          / "dssp_uses_x_if_unknown_hetatms_1"            );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
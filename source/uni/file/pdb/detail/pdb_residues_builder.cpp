@@ -0,0 +1,159 @@
+/// \file
+/// \brief The pdb_residues_builder class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pdb_residues_builder.hpp"
+
+#include <boost/log/trivial.hpp>
+
+#include "common/algorithm/contains.hpp"
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/string/char_arr_to_string.hpp"
+#include "file/pdb/detail/pdb_text_chunk.hpp"
+#include "file/pdb/pdb.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::none;
+using boost::string_ref;
+
+/// \brief Add the atoms of the residue currently being read as a completed residue and reset ready for the next residue
+void pdb_residues_builder::add_prev_atoms_and_reset() {
+	pdb_residue_vec &write_residues = contains( terminated_chains, prev_res_id.get_chain_label() ) ? post_ter_residues
+	                                                                                              : residues;
+	write_residues.emplace_back(
+		prev_res_id,
+		std::move( prev_atoms )
+	);
+	prev_amino_acid_3_char_code = none;
+	prev_atoms                  = pdb_atom_vec{};
+	prev_warned_conflict        = false;
+}
+
+/// \brief Add the specified atom, which was parsed from the next ATOM/HETATM record
+void pdb_residues_builder::add_atom(const residue_id &prm_res_id, ///< The residue_id parsed from the record
+                                    const pdb_atom   &prm_atom    ///< The atom parsed from the record
+                                    ) {
+	const char_3_arr amino_acid_3_char_code = get_amino_acid_code( prm_atom );
+
+	// Some PDBs (eg 4tsw) may have erroneous consecutive duplicate residues.
+	// Though that's a bit rubbish, it shouldn't break the whole comparison
+	// so if that's detected, just warn and move on.
+	if (
+		prm_atom.get_record_type() == pdb_record::ATOM
+		&&
+		prm_res_id == prev_res_id
+		&&
+		prev_amino_acid_3_char_code
+		&&
+		amino_acid_3_char_code != prev_amino_acid_3_char_code
+		&&
+		prm_atom.get_alt_locn() == ' '
+		) {
+		if ( ! prev_warned_conflict ) {
+			BOOST_LOG_TRIVIAL( warning ) << "Whilst parsing PDB file, found conflicting consecutive entries for residue \""
+			                             << prm_res_id
+			                             << "\" (with amino acids \""
+			                             << char_arr_to_string( *prev_amino_acid_3_char_code )
+			                             << "\" and then \""
+			                             << char_arr_to_string( amino_acid_3_char_code )
+			                             << "\") - won't warn about any further entries.";
+			prev_warned_conflict = true;
+		}
+	}
+
+	// If this is the start of a new residue...
+	const bool new_residue = ( prm_res_id != prev_res_id || amino_acid_3_char_code != prev_amino_acid_3_char_code );
+	if ( new_residue ) {
+		// If there are previously seen atoms then add those atoms' residue and reset prev_atoms
+		if ( ! prev_atoms.empty() ) {
+			add_prev_atoms_and_reset();
+		}
+
+		// Update the records of previously seen atoms
+		prev_amino_acid_3_char_code = amino_acid_3_char_code;
+		prev_res_id = prm_res_id;
+	}
+
+	prev_atoms.push_back( prm_atom );
+}
+
+/// \brief Add a TER record, which completes any residue currently being read and terminates the record's chain
+void pdb_residues_builder::add_ter_record(const string_ref &prm_line ///< The TER record (of which only the first 22 characters are used)
+                                          ) {
+	if ( prm_line.length() >= 22 ) {
+		add_ter_of_chain( chain_label( prm_line[ 21 ] ) );
+	}
+	else if ( ! is_null( prev_res_id ) ) {
+		add_ter_of_chain( prev_res_id.get_chain_label() );
+	}
+}
+
+/// \brief Add a TER of the specified chain, which completes any residue currently being read and terminates the chain
+///
+/// This is for formats (eg mmCIF) that don't have TER records but do identify the non-polymer atoms
+void pdb_residues_builder::add_ter_of_chain(const chain_label &prm_chain_label ///< The label of the chain to terminate
+                                            ) {
+	if ( ! prev_atoms.empty() ) {
+		add_prev_atoms_and_reset();
+	}
+	terminated_chains.insert( prm_chain_label );
+}
+
+/// \brief Add the atoms and events of the specified pdb_text_chunk in order, logging any warnings as they're reached
+///
+/// \throws The chunk's error, if it has one, after adding everything that precedes it
+void pdb_residues_builder::add_chunk(const pdb_text_chunk &prm_chunk ///< The chunk to add
+                                     ) {
+	const res_id_pdb_atom_pair_vec &atoms      = prm_chunk.get_atoms();
+	const pdb_text_chunk_event_vec &events     = prm_chunk.get_events();
+	auto                            event_itr  = events.begin();
+	const auto add_events_up_to_fn = [&] (const size_t &prm_atom_index) {
+		for ( ; event_itr != events.end() && event_itr->atom_index <= prm_atom_index; ++event_itr) {
+			switch ( event_itr->type ) {
+				case ( pdb_text_chunk_event_type::TER            ) : { add_ter_record( event_itr->text );                 break; }
+				case ( pdb_text_chunk_event_type::SKIPPED_RECORD ) : { BOOST_LOG_TRIVIAL( warning ) << event_itr->text; break; }
+			}
+		}
+	};
+	for (const size_t &atom_ctr : indices( atoms.size() ) ) {
+		add_events_up_to_fn( atom_ctr );
+		add_atom( atoms[ atom_ctr ].first, atoms[ atom_ctr ].second );
+	}
+	add_events_up_to_fn( atoms.size() );
+
+	if ( prm_chunk.get_error() ) {
+		std::rethrow_exception( prm_chunk.get_error() );
+	}
+}
+
+/// \brief Complete any residue currently being read and set the residues in the specified pdb
+void pdb_residues_builder::finish_into(pdb &prm_pdb ///< The pdb to populate
+                                       ) {
+	// Add any last remaining atoms
+	if ( ! prev_atoms.empty() ) {
+		add_prev_atoms_and_reset();
+	}
+
+	prm_pdb.set_residues         ( std::move( residues          ) );
+	prm_pdb.set_post_ter_residues( std::move( post_ter_residues ) );
+}
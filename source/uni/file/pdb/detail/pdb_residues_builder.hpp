@@ -0,0 +1,86 @@
+/// \file
+/// \brief The pdb_residues_builder class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_RESIDUES_BUILDER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_RESIDUES_BUILDER_HPP
+
+#include <boost/utility/string_ref.hpp>
+
+#include "biocore/residue_id.hpp"
+#include "common/char_arr_type_aliases.hpp"
+#include "file/pdb/pdb_atom.hpp"
+#include "file/pdb/pdb_residue.hpp"
+#include "structure/structure_type_aliases.hpp"
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace file {
+		namespace detail {
+			class pdb_text_chunk;
+
+			/// \brief Group the atoms parsed from the ATOM/HETATM records of a PDB file into residues
+			///
+			/// This holds the state that's needed between records (the atoms of the residue that's currently being
+			/// read, the chains that have been terminated etc) so that the atoms can be added one at a time
+			/// (or a chunk at a time) in the order in which they appear in the file.
+			///
+			/// It isn't clear that a residue has finished until the first atom of the next residue (or a TER record
+			/// or the end of the file) so the atoms of the current residue are held until then.
+			class pdb_residues_builder final {
+			private:
+				/// \brief The residues that have been completed so far
+				pdb_residue_vec  residues;
+
+				/// \brief The residues that have been completed so far that appeared after a TER record in their respective chains
+				pdb_residue_vec  post_ter_residues;
+
+				/// \brief The chains that have been terminated with a TER record
+				chain_label_set  terminated_chains;
+
+				/// \brief The three-letter code of the amino acid of the residue currently being read, if any
+				char_3_arr_opt   prev_amino_acid_3_char_code;
+
+				/// \brief The atoms of the residue currently being read
+				pdb_atom_vec     prev_atoms;
+
+				/// \brief The residue_id of the residue currently being read
+				residue_id       prev_res_id;
+
+				/// \brief Whether a warning has already been given about conflicting entries for the residue currently being read
+				bool             prev_warned_conflict = false;
+
+				void add_prev_atoms_and_reset();
+
+			public:
+				void add_atom(const residue_id &,
+				              const pdb_atom &);
+				void add_ter_record(const boost::string_ref &);
+				void add_ter_of_chain(const chain_label &);
+				void add_chunk(const pdb_text_chunk &);
+
+				void finish_into(pdb &);
+			};
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,233 @@
+/// \file
+/// \brief The pdb_text_chunk class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pdb_text_chunk.hpp"
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "file/pdb/detail/pdb_residues_builder.hpp"
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_atom.hpp"
+
+#include <algorithm>
+#include <future>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::file::detail;
+
+using boost::string_ref;
+using std::async;
+using std::exception_ptr;
+using std::future;
+using std::get;
+using std::launch;
+using std::string;
+using std::vector;
+
+/// \brief Add the specified ATOM/HETATM record to the chunk
+///
+/// This uses the fast pdb_atom_line_parser where possible and otherwise falls back on
+/// pdb_record_parse_problem() and parse_pdb_atom_record() to give the usual warnings/errors.
+///
+/// \throws invalid_argument_exception if the record is malformed
+void pdb_text_chunk::add_atom_record(const string_ref &prm_line,       ///< The ATOM/HETATM record
+                                     const pdb_record &prm_record_type ///< The type of the record
+                                     ) {
+	auto fast_parsed_atom = line_parser.parse_line( prm_line, prm_record_type );
+	if ( fast_parsed_atom ) {
+		atoms.push_back( std::move( *fast_parsed_atom ) );
+		return;
+	}
+
+	const string line_string{ prm_line.begin(), prm_line.end() };
+	const auto parse_status_str_and_aa = pdb_record_parse_problem( line_string );
+	const auto &parse_status = get<0>( parse_status_str_and_aa );
+	const auto &parse_string = get<1>( parse_status_str_and_aa );
+	const auto &parse_aa     = get<2>( parse_status_str_and_aa );
+	if ( parse_status == pdb_atom_parse_status::ABORT ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception(
+			"ATOM record is malformed : " + parse_string
+			+ "\nRecord was \"" + line_string.substr(0, pdb_atom::MAX_NUM_PDB_COLS)
+			+ "\""
+		));
+	}
+	if ( parse_status == pdb_atom_parse_status::SKIP ) {
+		events.push_back( pdb_text_chunk_event{
+			atoms.size(),
+			pdb_text_chunk_event_type::SKIPPED_RECORD,
+			"Skipping PDB atom record \"" + line_string + "\" with message: " + parse_string
+		} );
+		return;
+	}
+	atoms.push_back( parse_pdb_atom_record( line_string, parse_aa ) );
+}
+
+/// \brief Parse the specified line of a PDB file into the chunk
+///
+/// Any error is stored (see get_error()) rather than thrown.
+///
+/// \returns Whether parsing should continue (ie false after an ENDMDL record or an error)
+bool pdb_text_chunk::add_line(const string_ref &prm_line ///< The line to parse (without any trailing newline)
+                              ) {
+	if ( error || hit_end_of_model ) {
+		return false;
+	}
+	try {
+		const auto record_type = pdb_atom_record_type_of_line( prm_line );
+		if ( record_type ) {
+			add_atom_record( prm_line, *record_type );
+		}
+		else if ( prm_line.starts_with( "ENDMDL" ) ) {
+			hit_end_of_model = true;
+			return false;
+		}
+		else if ( prm_line.starts_with( "TER" ) ) {
+			const string_ref ter_start = prm_line.substr( 0, 22 );
+			events.push_back( pdb_text_chunk_event{
+				atoms.size(),
+				pdb_text_chunk_event_type::TER,
+				string{ ter_start.begin(), ter_start.end() }
+			} );
+		}
+	}
+	catch (...) {
+		error = std::current_exception();
+		return false;
+	}
+	return true;
+}
+
+/// \brief Getter for the atoms parsed from the chunk's ATOM/HETATM records
+const res_id_pdb_atom_pair_vec & pdb_text_chunk::get_atoms() const {
+	return atoms;
+}
+
+/// \brief Getter for the other events in the chunk
+const pdb_text_chunk_event_vec & pdb_text_chunk::get_events() const {
+	return events;
+}
+
+/// \brief Getter for any error that prevented the rest of the chunk from being parsed
+const exception_ptr & pdb_text_chunk::get_error() const {
+	return error;
+}
+
+/// \brief Getter for whether the chunk ended with an ENDMDL record, after which nothing further should be read
+const bool & pdb_text_chunk::get_hit_end_of_model() const {
+	return hit_end_of_model;
+}
+
+/// \brief Parse the lines of the specified stretch of PDB text into a pdb_text_chunk
+///
+/// This splits lines in the same way as std::getline() so that the results are the
+/// same as for parsing the lines from a stream.
+pdb_text_chunk cath::file::detail::parse_pdb_text_chunk(const string_ref &prm_text ///< The stretch of PDB text to parse
+                                                        ) {
+	pdb_text_chunk the_chunk;
+	const char *line_begin = prm_text.data();
+	const char *text_end   = prm_text.data() + prm_text.length();
+	while ( line_begin != text_end ) {
+		const char *line_end = std::find( line_begin, text_end, '\n' );
+		if ( ! the_chunk.add_line( string_ref{ line_begin, static_cast<size_t>( line_end - line_begin ) } ) ) {
+			break;
+		}
+		line_begin = ( line_end == text_end ) ? text_end : ( line_end + 1 );
+	}
+	return the_chunk;
+}
+
+/// \brief Get the part of the specified PDB text that precedes the first ENDMDL record (or all of it if there isn't one)
+///
+/// Nothing after the first ENDMDL is read so this prevents chunks beyond it being parsed needlessly.
+string_ref cath::file::detail::pdb_text_up_to_first_endmdl(const string_ref &prm_text ///< The PDB text
+                                                           ) {
+	if ( prm_text.starts_with( "ENDMDL" ) ) {
+		return prm_text.substr( 0, 0 );
+	}
+	const size_t endmdl_index = prm_text.find( "\nENDMDL" );
+	return ( endmdl_index == string_ref::npos ) ? prm_text
+	                                            : prm_text.substr( 0, endmdl_index + 1 );
+}
+
+/// \brief Split the specified PDB text into up to the specified number of chunks of roughly equal size,
+///        each of which ends at the end of a line
+///
+/// \throws invalid_argument_exception if prm_num_chunks is 0
+string_ref_vec cath::file::detail::split_pdb_text_into_chunks(const string_ref &prm_text,      ///< The PDB text to split
+                                                              const size_t     &prm_num_chunks ///< The maximum number of chunks
+                                                              ) {
+	if ( prm_num_chunks == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot split PDB text into zero chunks"));
+	}
+	string_ref_vec chunks;
+	size_t chunk_begin = 0;
+	for (size_t chunk_ctr = 1; chunk_ctr <= prm_num_chunks && chunk_begin < prm_text.length(); ++chunk_ctr) {
+		const size_t target_end = ( prm_text.length() * chunk_ctr ) / prm_num_chunks;
+		if ( target_end <= chunk_begin ) {
+			continue;
+		}
+		const size_t newline_offset = prm_text.substr( target_end - 1 ).find( '\n' );
+		const size_t chunk_end      = ( newline_offset == string_ref::npos ) ? prm_text.length()
+		                                                                     : ( target_end + newline_offset );
+		chunks.push_back( prm_text.substr( chunk_begin, chunk_end - chunk_begin ) );
+		chunk_begin = chunk_end;
+	}
+	return chunks;
+}
+
+/// \brief Read the specified PDB text into the specified pdb by splitting it into up to the specified number of chunks,
+///        parsing them in parallel and then stitching the atoms back together into residues in order
+///
+/// The residues that straddle the chunk boundaries are reassembled correctly because the grouping into residues is done
+/// in order by a single pdb_residues_builder. Any warnings/errors are issued as they would be for a serial parse.
+void cath::file::detail::read_pdb_text_in_chunks(const string_ref &prm_text,      ///< The PDB text to read
+                                                 pdb              &prm_pdb,       ///< The pdb to populate
+                                                 const size_t     &prm_num_chunks ///< The maximum number of chunks (and hence threads)
+                                                 ) {
+	const string_ref_vec chunk_texts = split_pdb_text_into_chunks( prm_text, prm_num_chunks );
+	pdb_residues_builder the_builder;
+
+	// Do the work on this thread if there's only one chunk
+	if ( chunk_texts.size() <= 1 ) {
+		the_builder.add_chunk( parse_pdb_text_chunk( prm_text ) );
+		the_builder.finish_into( prm_pdb );
+		return;
+	}
+
+	// Otherwise, parse the chunks in parallel and then add them in order
+	vector<future<pdb_text_chunk>> chunk_futures;
+	chunk_futures.reserve( chunk_texts.size() );
+	for (const string_ref &chunk_text : chunk_texts) {
+		chunk_futures.push_back( async(
+			launch::async,
+			[] (const string_ref &x) { return parse_pdb_text_chunk( x ); },
+			chunk_text
+		) );
+	}
+	for (future<pdb_text_chunk> &chunk_future : chunk_futures) {
+		const pdb_text_chunk the_chunk = chunk_future.get();
+		the_builder.add_chunk( the_chunk );
+		if ( the_chunk.get_hit_end_of_model() ) {
+			break;
+		}
+	}
+	the_builder.finish_into( prm_pdb );
+}
@@ -0,0 +1,116 @@
+/// \file
+/// \brief The pdb_text_chunk class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_TEXT_CHUNK_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_PDB_DETAIL_PDB_TEXT_CHUNK_HPP
+
+#include <boost/utility/string_ref.hpp>
+
+#include "file/file_type_aliases.hpp"
+#include "file/pdb/detail/pdb_atom_line_parser.hpp"
+
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The types of pdb_text_chunk_event
+			enum class pdb_text_chunk_event_type : char {
+				TER,           ///< A TER record
+				SKIPPED_RECORD ///< An ATOM/HETATM record that was skipped (with a warning)
+			};
+
+			/// \brief A non-atom event in a pdb_text_chunk that must be handled in order with the chunk's atoms
+			struct pdb_text_chunk_event final {
+				/// \brief The number of the chunk's atoms that precede this event
+				size_t                    atom_index;
+
+				/// \brief The type of the event
+				pdb_text_chunk_event_type type;
+
+				/// \brief The text associated with the event (the start of the record for a TER or the warning for a skipped record)
+				std::string               text;
+			};
+
+			/// \brief Type alias for a vector of pdb_text_chunk_event values
+			using pdb_text_chunk_event_vec = std::vector<pdb_text_chunk_event>;
+
+			/// \brief The results of parsing the lines in a stretch of a PDB file, ready to be grouped into residues
+			///        by a pdb_residues_builder in the order in which the chunks appear in the file
+			///
+			/// This allows the parsing (which is most of the work) to be done on separate chunks in parallel
+			/// whilst the grouping of atoms into residues (which depends on state from previous chunks)
+			/// is done in order afterwards.
+			///
+			/// Warnings and errors are stored rather than being logged/thrown immediately so that they're
+			/// issued in the same order as they would be if the file were parsed in one go.
+			class pdb_text_chunk final {
+			private:
+				/// \brief The parser for the ATOM/HETATM records (which holds a small cache between lines)
+				pdb_atom_line_parser     line_parser;
+
+				/// \brief The atoms parsed from the chunk's ATOM/HETATM records
+				res_id_pdb_atom_pair_vec atoms;
+
+				/// \brief The other events in the chunk
+				pdb_text_chunk_event_vec events;
+
+				/// \brief Any error that prevented the rest of the chunk from being parsed
+				std::exception_ptr       error;
+
+				/// \brief Whether the chunk ended with an ENDMDL record, after which nothing further should be read
+				bool                     hit_end_of_model = false;
+
+				void add_atom_record(const boost::string_ref &,
+				                     const pdb_record &);
+
+			public:
+				bool add_line(const boost::string_ref &);
+
+				const res_id_pdb_atom_pair_vec & get_atoms() const;
+				const pdb_text_chunk_event_vec & get_events() const;
+				const std::exception_ptr & get_error() const;
+				const bool & get_hit_end_of_model() const;
+			};
+
+			/// \brief Type alias for a vector of string_ref values
+			using string_ref_vec = std::vector<boost::string_ref>;
+
+			pdb_text_chunk parse_pdb_text_chunk(const boost::string_ref &);
+
+			boost::string_ref pdb_text_up_to_first_endmdl(const boost::string_ref &);
+
+			string_ref_vec split_pdb_text_into_chunks(const boost::string_ref &,
+			                                          const size_t &);
+
+			void read_pdb_text_in_chunks(const boost::string_ref &,
+			                             pdb &,
+			                             const size_t &);
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+#endif
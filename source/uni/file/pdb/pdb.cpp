@@ -24,6 +24,8 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/range/adaptor/filtered.hpp>
@@ -46,9 +48,14 @@
 #include "common/cpp14/cbegin_cend.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "common/exception/runtime_error_exception.hpp"
+#include "common/file/gzip_file.hpp"
 #include "common/file/open_fstream.hpp"
 #include "common/size_t_literal.hpp"
+#include "file/mmcif/bcif_reader.hpp"
+#include "file/mmcif/mmcif_reader.hpp"
 #include "file/pdb/backbone_complete_indices.hpp"
+#include "file/pdb/detail/pdb_residues_builder.hpp"
+#include "file/pdb/detail/pdb_text_chunk.hpp"
 #include "file/pdb/pdb_atom.hpp"
 #include "file/pdb/pdb_list.hpp"
 #include "file/pdb/pdb_residue.hpp"
@@ -79,16 +86,21 @@ using ::boost::algorithm::is_space;
 using ::boost::algorithm::join;
 using ::boost::algorithm::starts_with;
 using ::boost::filesystem::path;
+using ::boost::iostreams::mapped_file_source;
 using ::boost::none;
 using ::boost::numeric_cast;
 using ::boost::optional;
 using ::boost::range::count_if;
+using ::boost::string_ref;
+using ::boost::system::error_code;
 using ::std::get;
 using ::std::ifstream;
 using ::std::istream;
 using ::std::istringstream;
 using ::std::make_pair;
 using ::std::make_tuple;
+using ::std::max;
+using ::std::min;
 using ::std::ofstream;
 using ::std::ostream;
 using ::std::ostringstream;
@@ -104,18 +116,81 @@ using ::std::vector;
 
 const string pdb::PDB_RECORD_STRING_TER ( "TER   " );
 
-/// \brief TODOCUMENT
-void pdb::read_file(const path &prm_filename ///< TODOCUMENT
+/// \brief Read the specified PDB file into this pdb
+///
+/// Regular files are memory-mapped and parsed with read_pdb_text() (in parallel, if they're large enough);
+/// anything else (eg a pipe) is read as a stream.
+///
+/// Files with mmCIF (".cif"/".mmcif") or BinaryCIF (".bcif") extensions are read from
+/// their _atom_site data instead (see read_mmcif_file() and read_bcif_file()).
+///
+/// Gzipped files (detected from their contents) are decompressed in memory (in parallel, if they're BGZF)
+/// and then read according to their name without any gzip extension (eg "1abc.cif.gz" is read as mmCIF).
+///
+/// This uses a single thread so that callers that read files concurrently don't oversubscribe the CPUs;
+/// use the other overload to give the read a thread budget.
+void pdb::read_file(const path &prm_filename ///< The PDB file to read
                     ) {
+	read_file( prm_filename, 1 );
+}
+
+/// \brief Read the specified PDB file into this pdb, using at most the specified number of threads
+///
+/// Callers that read many files concurrently (eg in a batch) should pass 1 because that's
+/// a better use of the threads than reading each file in parallel.
+///
+/// \pre prm_max_num_threads must be greater than 0
+void pdb::read_file(const path   &prm_filename,       ///< The PDB file to read
+                    const size_t &prm_max_num_threads ///< The maximum number of threads with which to decompress/parse the file
+                    ) {
+	if ( is_gzip_file( prm_filename ) ) {
+		const string decompressed_data     = read_decompressed_file( prm_filename, prm_max_num_threads );
+		const path   uncompressed_filename = strip_gzip_extension( prm_filename );
+		if ( is_mmcif_filename( uncompressed_filename ) ) {
+			read_mmcif_text( decompressed_data, *this );
+		}
+		else if ( is_bcif_filename( uncompressed_filename ) ) {
+			read_bcif_data( decompressed_data, *this );
+		}
+		else {
+			read_pdb_text( decompressed_data, *this, prm_max_num_threads );
+		}
+		return;
+	}
+
+	if ( is_mmcif_filename( prm_filename ) ) {
+		read_mmcif_file( prm_filename, *this );
+		return;
+	}
+	if ( is_bcif_filename( prm_filename ) ) {
+		read_bcif_file( prm_filename, *this );
+		return;
+	}
+
+	error_code error;
+	const bool can_map = is_regular_file( prm_filename, error ) && ( file_size( prm_filename, error ) > 0 ) && ! error;
+
 	ifstream pdb_istream;
-	open_ifstream(pdb_istream, prm_filename);
+	if ( ! can_map ) {
+		open_ifstream(pdb_istream, prm_filename);
+	}
 
 	// Try here to catch any I/O exceptions
 	try {
-		read_pdb_file( pdb_istream, *this );
+		if ( can_map ) {
+			const mapped_file_source pdb_file{ prm_filename.string() };
+			read_pdb_text(
+				string_ref{ pdb_file.data(), pdb_file.size() },
+				*this,
+				prm_max_num_threads
+			);
+		}
+		else {
+			read_pdb_file( pdb_istream, *this );
 
-		// Close the file
-		pdb_istream.close();
+			// Close the file
+			pdb_istream.close();
+		}
 	}
 	// Catch and immediately rethrow any boost::exceptions
 	// (so that it won't get caught in the next block if it's a std::exception)
@@ -483,13 +558,14 @@ residue_id_vec cath::file::get_backbone_complete_residue_ids(const pdb &prm_pdb
 	return results;
 }
 
-/// \brief TODOCUMENT
+/// \brief Read a pdb from the specified file, using at most the specified number of threads
 ///
 /// \relates pdb
-pdb cath::file::read_pdb_file(const path &prm_pdb_filename ///< TODOCUMENT
+pdb cath::file::read_pdb_file(const path   &prm_pdb_filename,   ///< The PDB file to read
+                              const size_t &prm_max_num_threads ///< The maximum number of threads with which to decompress/parse the file
                               ) {
 	pdb new_pdb;
-	new_pdb.read_file( prm_pdb_filename );
+	new_pdb.read_file( prm_pdb_filename, prm_max_num_threads );
 	return new_pdb;
 }
 
@@ -503,149 +579,59 @@ pdb cath::file::read_pdb_file(istream &prm_input_stream ///< TODOCUMENT
 	return new_pdb;
 }
 
-/// \brief TODOCUMENT
+/// \brief Read a pdb from the specified stream into the specified pdb
+///
+/// This reads line by line (stopping after any ENDMDL record) so it leaves the rest of the stream unread.
 ///
 /// \relates pdb
-istream & cath::file::read_pdb_file(istream &input_stream, ///< TODOCUMENT
-                                    pdb     &prm_pdb       ///< TODOCUMENT
+istream & cath::file::read_pdb_file(istream &input_stream, ///< The stream from which to read the PDB data
+                                    pdb     &prm_pdb       ///< The pdb to populate
                                     ) {
-	// Variables to store the details of parsed atoms
-	pdb_residue_vec  residues;
-	pdb_residue_vec  post_ter_residues;
-
-	set<chain_label> terminated_chains;
-	string           line_string;
-
-	char_3_arr_opt   prev_amino_acid_3_char_code;
-	pdb_atom_vec     prev_atoms;
-	residue_id       prev_res_id;
-	bool             prev_warned_conflict = false;
-
-	const auto add_atoms_and_reset_fn = [&] (const chain_label &x) {
-		// if ( ! prev_atoms.empty() ) {
-		// 	prev_atoms.last()
-		// }
-		pdb_residue_vec &write_residues = contains( terminated_chains, x ) ? post_ter_residues
-		                                                                   : residues;
-		write_residues.emplace_back(
-			prev_res_id,
-			std::move( prev_atoms )
-		);
-		prev_amino_acid_3_char_code = none;
-		prev_atoms                  = pdb_atom_vec{};
-		prev_warned_conflict        = false;
-	};
-
-	// Loop over the lines of the file
-	//
-	// This code is made a bit more complicated because the aim is to
-	// add all of the atoms within a residue at the same time but it isn't
-	// clear that the residue has finished until the first line of the next residue
-	// (or the end of the file)
+	// Parse the lines into one chunk (which stops after any ENDMDL record or error)...
+	detail::pdb_text_chunk the_chunk;
+	string                 line_string;
 	while ( getline( input_stream, line_string ) ) {
-		// If this line is an ATOM or HETATM record
-		if ( is_pdb_record_of_type( line_string, pdb_record::ATOM ) || is_pdb_record_of_type( line_string, pdb_record::HETATM ) ) {
-			const bool is_atom                 = is_pdb_record_of_type( line_string, pdb_record::ATOM );
-			const auto parse_status_str_and_aa = pdb_record_parse_problem( line_string );
-			const auto &parse_status = get<0>( parse_status_str_and_aa );
-			const auto &parse_string = get<1>( parse_status_str_and_aa );
-			const auto &parse_aa     = get<2>( parse_status_str_and_aa );
-			if ( parse_status == pdb_atom_parse_status::ABORT ) {
-				BOOST_THROW_EXCEPTION(invalid_argument_exception(
-					"ATOM record is malformed : " + parse_string
-					+ "\nRecord was \"" + line_string.substr(0, pdb_atom::MAX_NUM_PDB_COLS)
-					+ "\""
-				));
-			}
-			else if ( parse_status == pdb_atom_parse_status::SKIP ) {
-				BOOST_LOG_TRIVIAL( warning ) << "Skipping PDB atom record \""
-					<< line_string
-					<< "\" with message: "
-					<< parse_string;
-				continue;
-			}
-
-			// Grab the details from parsing this ATOM record
-			const auto        new_entry              = parse_pdb_atom_record( line_string, parse_aa );
-			const residue_id &res_id                 = new_entry.first;
-			const pdb_atom   &atom                   = new_entry.second;
-			const char_3_arr  amino_acid_3_char_code = get_amino_acid_code( atom );
-
-			// Some PDBs (eg 4tsw) may have erroneous consecutive duplicate residues.
-			// Though that's a bit rubbish, it shouldn't break the whole comparison
-			// so if that's detected, just warn and move on.
-			if (
-				is_atom
-				&&
-				res_id == prev_res_id
-				&&
-				prev_amino_acid_3_char_code
-				&&
-				amino_acid_3_char_code != prev_amino_acid_3_char_code
-				&&
-				atom.get_alt_locn() == ' '
-				) {
-				if ( ! prev_warned_conflict ) {
-					BOOST_LOG_TRIVIAL( warning ) << "Whilst parsing PDB file, found conflicting consecutive entries for residue \""
-					                             << res_id
-					                             << "\" (with amino acids \""
-					                             << char_arr_to_string( *prev_amino_acid_3_char_code )
-					                             << "\" and then \""
-					                             << char_arr_to_string( amino_acid_3_char_code )
-					                             << "\") - won't warn about any further entries.";
-					prev_warned_conflict = true;
-				}
-			}
-
-			// If this is the start of a new residue...
-			const bool new_residue = ( res_id != prev_res_id || amino_acid_3_char_code != prev_amino_acid_3_char_code );
-			if ( new_residue ) {
-				// If there are previously seen atoms then add those atoms' residue and reset prev_atoms
-				if ( ! prev_atoms.empty() ) {
-					add_atoms_and_reset_fn( prev_res_id.get_chain_label() );
-				}
-
-				// Update the records of previously seen atoms
-				prev_amino_acid_3_char_code = amino_acid_3_char_code;
-				prev_res_id = res_id;
-			}
-
-			prev_atoms.push_back( atom );
-		}
-		else if ( boost::algorithm::starts_with( line_string, "ENDMDL" ) ) {
+		if ( ! the_chunk.add_line( line_string ) ) {
 			break;
 		}
-		else if ( boost::algorithm::starts_with( line_string, "TER" ) ) {
-			if ( ! prev_atoms.empty() ) {
-				add_atoms_and_reset_fn( prev_res_id.get_chain_label() );
-			}
-			if ( line_string.length() >= 22 ) {
-				terminated_chains.insert( chain_label( line_string.at( 21 ) ) );
-			}
-			else if ( ! is_null( prev_res_id ) ) {
-				terminated_chains.insert( prev_res_id.get_chain_label() );
-			}
-		}
-	};
-
-	// Add any last remaining atoms
-	if ( ! prev_atoms.empty() ) {
-		add_atoms_and_reset_fn( prev_res_id.get_chain_label() );
 	}
 
-	prm_pdb.set_residues         ( std::move( residues          ) );
-	prm_pdb.set_post_ter_residues( std::move( post_ter_residues ) );
+	// ...and then group the atoms into residues (which issues any warnings/errors in order)
+	detail::pdb_residues_builder the_builder;
+	the_builder.add_chunk( the_chunk );
+	the_builder.finish_into( prm_pdb );
 
 	return input_stream;
 }
 
+/// \brief Read a pdb from the specified PDB text into the specified pdb
+///
+/// This gives the same results as read_pdb_file() on a stream of the same text but it's much faster because:
+///  * it parses the ATOM/HETATM records with fixed-column integer/fixed-point decoding rather than via temporary strings
+///  * if the text is large enough, it splits the text into chunks, parses them in parallel and then stitches
+///    the atoms back together into residues in order
+///
+/// \relates pdb
+void cath::file::read_pdb_text(const string_ref &prm_text,           ///< The PDB text (eg from a memory-mapped file)
+                               pdb              &prm_pdb,            ///< The pdb to populate
+                               const size_t     &prm_max_num_threads ///< The maximum number of threads with which to parse the text
+                               ) {
+	if ( prm_max_num_threads == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot read PDB text with zero threads"));
+	}
+	const string_ref text       = detail::pdb_text_up_to_first_endmdl( prm_text );
+	const size_t     num_chunks = max( 1_z, min( prm_max_num_threads, text.length() / pdb::MIN_BYTES_PER_PARALLEL_READ_CHUNK ) );
+	detail::read_pdb_text_in_chunks( text, prm_pdb, num_chunks );
+}
+
 /// \brief Parse a pdb from the specified string
 ///
 /// \relates pdb
 pdb cath::file::read_pdb(const string &prm_string ///< The string containing the PDB data
                          ) {
-	istringstream in_ss{ prm_string };
-	return read_pdb_file( in_ss );
+	pdb new_pdb;
+	read_pdb_text( prm_string, new_pdb );
+	return new_pdb;
 }
 
 /// \brief TODOCUMENT
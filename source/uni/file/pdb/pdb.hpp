@@ -23,6 +23,7 @@
 
 #include <boost/operators.hpp>
 #include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include "chopping/region/regions_limiter.hpp"
 #include "common/boost_addenda/range/indices.hpp"
@@ -59,6 +60,8 @@ namespace cath {
 
 		public:
 			void read_file(const boost::filesystem::path &);
+			void read_file(const boost::filesystem::path &,
+			               const size_t &);
 			void append_to_file(const boost::filesystem::path &) const;
 			pdb & set_chain_label(const chain_label &);
 			residue_id_vec get_residue_ids_of_first_chain__backbone_unchecked() const;
@@ -84,6 +87,11 @@ namespace cath {
 			const_iterator end() const;
 
 			static const std::string PDB_RECORD_STRING_TER;
+
+			/// \brief The minimum number of bytes of PDB text per chunk when parsing PDB text in parallel
+			///
+			/// (ie files smaller than twice this are always parsed on one thread)
+			static constexpr size_t MIN_BYTES_PER_PARALLEL_READ_CHUNK = 1024 * 1024;
 		};
 
 		backbone_complete_indices get_backbone_complete_indices(const pdb &);
@@ -126,11 +134,15 @@ namespace cath {
 		                                                                const bool & = true);
 		residue_id_vec get_backbone_complete_residue_ids(const pdb &);
 
-		pdb read_pdb_file(const boost::filesystem::path &);
+		pdb read_pdb_file(const boost::filesystem::path &,
+		                  const size_t & = 1);
 
 		pdb read_pdb_file(std::istream &);
 		std::istream & read_pdb_file(std::istream &,
 		                             pdb &);
+		void read_pdb_text(const boost::string_ref &,
+		                   pdb &,
+		                   const size_t & = 1);
 		pdb read_pdb(const std::string &);
 		pdb_list read_end_separated_pdb_files(std::istream &);
 
@@ -0,0 +1,332 @@
+/// \file
+/// \brief The pdb_batch definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pdb_batch.hpp"
+
+#include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/range/algorithm/adjacent_find.hpp>
+#include <boost/range/algorithm/sort.hpp>
+
+#include "chopping/region/region.hpp"
+#include "common/cpp14/cbegin_cend.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/file/gzip_file.hpp"
+#include "common/file/open_fstream.hpp"
+#include "file/mmcif/bcif_reader.hpp"
+#include "file/mmcif/mmcif_reader.hpp"
+#include "file/pdb/pdb.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+
+using boost::algorithm::replace_all_copy;
+using boost::algorithm::trim_copy;
+using boost::filesystem::directory_iterator;
+using boost::filesystem::is_directory;
+using boost::filesystem::is_regular_file;
+using boost::filesystem::path;
+using boost::range::adjacent_find;
+using boost::range::sort;
+using std::deque;
+using std::future;
+using std::ifstream;
+using std::istream;
+using std::min;
+using std::next;
+using std::ofstream;
+using std::ostream;
+using std::pair;
+using std::string;
+using std::vector;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The type of a list of statuses of files processed in a batch
+			using pdb_batch_file_status_vec = vector<pdb_batch_file_status>;
+
+			/// \brief Process the specified file with the specified processor, catching any exception
+			///        and recording it in the returned status
+			inline pdb_batch_file_status process_pdb_batch_file(const path                     &prm_file,      ///< The file to process
+			                                                    const pdb_batch_file_processor &prm_processor, ///< The function with which to process the file
+			                                                    pdb                            &prm_pdb        ///< The pdb that the processor may reuse for reading the file
+			                                                    ) {
+				try {
+					return prm_processor( prm_file, prm_pdb );
+				}
+				catch (const std::exception &ex) {
+					return { prm_file, false, 0, ex.what() };
+				}
+			}
+
+			/// \brief Process the files in the specified range of the specified list with the specified processor,
+			///        reusing the same pdb for each of them
+			inline pdb_batch_file_status_vec process_pdb_batch_files(const path_vec                 &prm_files,     ///< The list of files
+			                                                         const size_t                   &prm_begin,     ///< The index of the first file to process
+			                                                         const size_t                   &prm_end,       ///< The index of one-past the last file to process
+			                                                         const pdb_batch_file_processor &prm_processor  ///< The function with which to process each file
+			                                                         ) {
+				pdb the_pdb;
+				pdb_batch_file_status_vec statuses;
+				statuses.reserve( prm_end - prm_begin );
+				for (size_t file_ctr = prm_begin; file_ctr < prm_end; ++file_ctr) {
+					statuses.push_back( process_pdb_batch_file( prm_files[ file_ctr ], prm_processor, the_pdb ) );
+				}
+				return statuses;
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Read a manifest of files to process in a batch from the specified istream
+///
+/// The manifest should contain one file per line. Leading/trailing whitespace is ignored,
+/// as are empty lines and lines beginning with '#'.
+path_vec cath::file::read_pdb_batch_manifest(istream &prm_istream ///< The istream from which to read the manifest
+                                             ) {
+	path_vec files;
+	string line_string;
+	while ( getline( prm_istream, line_string ) ) {
+		const string file_string = trim_copy( line_string );
+		if ( ! file_string.empty() && file_string.front() != '#' ) {
+			files.emplace_back( file_string );
+		}
+	}
+	return files;
+}
+
+/// \brief Read a manifest of files to process in a batch from the specified file
+///
+/// \copydetails read_pdb_batch_manifest(istream &)
+path_vec cath::file::read_pdb_batch_manifest(const path &prm_manifest_file ///< The manifest file to read
+                                             ) {
+	ifstream manifest_ifstream;
+	open_ifstream( manifest_ifstream, prm_manifest_file );
+	const path_vec files = read_pdb_batch_manifest( manifest_ifstream );
+	manifest_ifstream.close();
+	return files;
+}
+
+/// \brief Get the regular files in the specified directory (not recursively), sorted by name
+///
+/// \throws invalid_argument_exception if the directory isn't a directory
+path_vec cath::file::pdb_batch_files_of_directory(const path &prm_directory ///< The directory to scan
+                                                  ) {
+	if ( ! is_directory( prm_directory ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception(
+			"Unable to find PDB files in \"" + prm_directory.string() + "\" because it isn't a directory"
+		));
+	}
+	path_vec files;
+	for (const auto &entry : directory_iterator( prm_directory ) ) {
+		if ( is_regular_file( entry.path() ) ) {
+			files.push_back( entry.path() );
+		}
+	}
+	sort( files );
+	return files;
+}
+
+/// \brief Get the files of a batch from the specified manifest file or directory (exactly one of which should be specified)
+///
+/// \throws invalid_argument_exception if neither or both of the manifest file and directory are specified
+path_vec cath::file::pdb_batch_files(const path_opt &prm_manifest_file, ///< An optional manifest file listing the files (see read_pdb_batch_manifest())
+                                     const path_opt &prm_directory      ///< An optional directory containing the files (see pdb_batch_files_of_directory())
+                                     ) {
+	if ( static_cast<bool>( prm_manifest_file ) == static_cast<bool>( prm_directory ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Must specify exactly one of a manifest file and a directory for a batch of PDB files"));
+	}
+	return prm_manifest_file ? read_pdb_batch_manifest     ( *prm_manifest_file )
+	                         : pdb_batch_files_of_directory( *prm_directory     );
+}
+
+/// \brief Process the specified files with the specified processor, streaming each file's status to the specified report
+///        and return the number of files that failed
+///
+/// A failure to process one file doesn't stop the others being processed.
+///
+/// If there are multiple threads, the files are processed in tasks of up to PDB_BATCH_FILES_PER_TASK files,
+/// with up to prm_num_threads tasks in flight at once. The oldest task's statuses are always written first
+/// so the report's order always matches the order of the files.
+size_t cath::file::process_pdb_batch(const path_vec                 &prm_files,      ///< The files to process
+                                     const pdb_batch_file_processor &prm_processor,  ///< The function with which to process each file
+                                     ostream                        &prm_report,     ///< The ostream to which the status of each file should be written
+                                     const size_t                   &prm_num_threads ///< The maximum number of threads with which to process the files
+                                     ) {
+	size_t num_failed = 0;
+	const auto write_statuses = [&] (const detail::pdb_batch_file_status_vec &prm_statuses) {
+		for (const pdb_batch_file_status &status : prm_statuses) {
+			prm_report << status << "\n";
+			if ( ! status.succeeded ) {
+				++num_failed;
+			}
+		}
+		prm_report.flush();
+	};
+
+	const size_t num_files = prm_files.size();
+	if ( prm_num_threads <= 1 ) {
+		pdb the_pdb;
+		for (const path &file : prm_files) {
+			write_statuses( { detail::process_pdb_batch_file( file, prm_processor, the_pdb ) } );
+		}
+		return num_failed;
+	}
+
+	deque<future<detail::pdb_batch_file_status_vec>> status_futures;
+	for (size_t begin = 0; begin < num_files; begin += PDB_BATCH_FILES_PER_TASK) {
+		if ( status_futures.size() >= prm_num_threads ) {
+			write_statuses( status_futures.front().get() );
+			status_futures.pop_front();
+		}
+		const size_t end = min( num_files, begin + PDB_BATCH_FILES_PER_TASK );
+		status_futures.push_back( std::async(
+			std::launch::async,
+			[&, begin, end] {
+				return detail::process_pdb_batch_files( prm_files, begin, end, prm_processor );
+			}
+		) );
+	}
+	while ( ! status_futures.empty() ) {
+		write_statuses( status_futures.front().get() );
+		status_futures.pop_front();
+	}
+	return num_failed;
+}
+
+/// \brief Check the specified PDB file for a batch of check-pdb, reading it into the specified pdb
+///
+/// Each file is read with a single thread because the batch's threads are better spent reading different files
+///
+/// \throws invalid_argument_exception if the file has no ATOM records and that isn't permitted
+pdb_batch_file_status cath::file::check_pdb_batch_file(const path &prm_file,           ///< The file to check
+                                                       pdb        &prm_pdb,            ///< The pdb to reuse for reading the file
+                                                       const bool &prm_permit_no_atoms ///< Whether to permit a file with no ATOM records
+                                                       ) {
+	prm_pdb.read_file( prm_file, 1 );
+	const size_t num_atoms = prm_pdb.get_num_atoms();
+	if ( ! prm_permit_no_atoms && num_atoms == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("PDB file \"" + prm_file.string() + "\" did not contain any valid ATOM records"));
+	}
+	return { prm_file, true, num_atoms, "parsed successfully" };
+}
+
+/// \brief Get the file to which the specified input file should be extracted in the specified output directory
+///
+/// This uses the input file's name, without any gzip extension and with any mmCIF/BinaryCIF extension
+/// replaced with ".pdb" (because the extracted file is always in PDB format)
+path cath::file::extracted_pdb_batch_filename(const path &prm_file,      ///< The input file
+                                              const path &prm_output_dir ///< The directory to which the file is extracted
+                                              ) {
+	path filename = strip_gzip_extension( prm_file.filename() );
+	if ( is_mmcif_filename( filename ) || is_bcif_filename( filename ) ) {
+		filename.replace_extension( ".pdb" );
+	}
+	return prm_output_dir / filename;
+}
+
+/// \brief Check that no two of the specified input files would be extracted to the same file
+///        in the specified output directory (see extracted_pdb_batch_filename())
+///
+/// Without this, one of the extracted files would silently overwrite the other
+/// (eg for 1bdh.cif.gz and 1bdh.bcif, which would both be extracted to 1bdh.pdb)
+///
+/// \throws invalid_argument_exception if two of the files would be extracted to the same file
+void cath::file::check_extracted_pdb_batch_filenames_are_distinct(const path_vec &prm_files,     ///< The input files
+                                                                  const path     &prm_output_dir ///< The directory to which the files are extracted
+                                                                  ) {
+	using output_and_input = pair<path, path>;
+	vector<output_and_input> output_and_inputs;
+	output_and_inputs.reserve( prm_files.size() );
+	for (const path &file : prm_files) {
+		output_and_inputs.emplace_back( extracted_pdb_batch_filename( file, prm_output_dir ), file );
+	}
+	sort( output_and_inputs );
+	const auto clash_itr = adjacent_find(
+		output_and_inputs,
+		[] (const output_and_input &x, const output_and_input &y) { return x.first == y.first; }
+	);
+	if ( clash_itr != common::cend( output_and_inputs ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception(
+			"Cannot extract both PDB files \""
+			+ clash_itr->second.string()
+			+ "\" and \""
+			+ next( clash_itr )->second.string()
+			+ "\" because they would both be extracted to \""
+			+ clash_itr->first.string()
+			+ "\""
+		));
+	}
+}
+
+/// \brief Extract the specified file for a batch of extract-pdb, reading it into the specified pdb
+///        and writing it to the specified output directory (see extracted_pdb_batch_filename())
+///
+/// As with the single-file extract-pdb, the written file excludes any post-TER residues.
+///
+/// \throws runtime_error_exception if the output file can't be written
+pdb_batch_file_status cath::file::extract_pdb_batch_file(const path &prm_file,      ///< The file to extract
+                                                         pdb        &prm_pdb,       ///< The pdb to reuse for reading the file
+                                                         const path &prm_output_dir ///< The directory to which the file should be extracted
+                                                         ) {
+	prm_pdb.read_file( prm_file, 1 );
+	prm_pdb.set_post_ter_residues( {} );
+
+	const path output_file = extracted_pdb_batch_filename( prm_file, prm_output_dir );
+	ofstream output_ofstream;
+	open_ofstream( output_ofstream, output_file );
+	write_pdb_file( output_ofstream, prm_pdb );
+	output_ofstream.close();
+	if ( ! output_ofstream ) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception("Unable to finish writing extracted PDB file " + output_file.string()));
+	}
+	return { prm_file, true, prm_pdb.get_num_atoms(), output_file.string() };
+}
+
+/// \brief Insert a description of the specified pdb_batch_file_status into the specified ostream
+///
+/// This is a tab-separated line (without the trailing newline) of: file, OK/ERROR, number of atoms and message.
+/// Any newlines/tabs in the message are replaced with spaces to keep one line per file.
+///
+/// \relates pdb_batch_file_status
+ostream & cath::file::operator<<(ostream                     &prm_os,    ///< The ostream to which the pdb_batch_file_status should be output
+                                 const pdb_batch_file_status &prm_status ///< The pdb_batch_file_status to output
+                                 ) {
+	prm_os << prm_status.file.string()
+		<< "\t" << ( prm_status.succeeded ? "OK" : "ERROR" )
+		<< "\t" << prm_status.num_atoms
+		<< "\t" << replace_all_copy( replace_all_copy( prm_status.message, "\n", " " ), "\t", " " );
+	return prm_os;
+}
@@ -0,0 +1,98 @@
+/// \file
+/// \brief The pdb_batch header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_PDB_PDB_BATCH_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_PDB_PDB_BATCH_HPP
+
+#include <boost/filesystem/path.hpp>
+
+#include "common/path_type_aliases.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace file {
+
+		/// \brief The status of processing one of the files in a batch of PDB files
+		struct pdb_batch_file_status final {
+			/// \brief The file that was processed
+			boost::filesystem::path file;
+
+			/// \brief Whether the file was processed successfully
+			bool                    succeeded = false;
+
+			/// \brief The number of atoms that were read from the file
+			size_t                  num_atoms = 0;
+
+			/// \brief A description of the error (on failure) or of the result (on success, eg the file written)
+			std::string             message;
+		};
+
+		/// \brief The type of function that processes one file of a batch
+		///
+		/// The function is given the file and a pdb that it may reuse for reading it.
+		/// It should throw on failure (the exception's message is recorded in the file's status).
+		///
+		/// The function may be called concurrently from multiple threads (each with a different pdb)
+		using pdb_batch_file_processor = std::function<pdb_batch_file_status(const boost::filesystem::path &, pdb &)>;
+
+		/// \brief The number of files that each task processes in a batch that's processed with multiple threads
+		///
+		/// This amortises the cost of launching the task (and lets it reuse its pdb across more files)
+		/// whilst still keeping the in-flight results small enough to stream the report
+		constexpr size_t PDB_BATCH_FILES_PER_TASK = 16;
+
+		path_vec read_pdb_batch_manifest(std::istream &);
+		path_vec read_pdb_batch_manifest(const boost::filesystem::path &);
+		path_vec pdb_batch_files_of_directory(const boost::filesystem::path &);
+		path_vec pdb_batch_files(const path_opt &,
+		                         const path_opt &);
+
+		size_t process_pdb_batch(const path_vec &,
+		                         const pdb_batch_file_processor &,
+		                         std::ostream &,
+		                         const size_t & = 1);
+
+		pdb_batch_file_status check_pdb_batch_file(const boost::filesystem::path &,
+		                                           pdb &,
+		                                           const bool &);
+
+		boost::filesystem::path extracted_pdb_batch_filename(const boost::filesystem::path &,
+		                                                     const boost::filesystem::path &);
+
+		void check_extracted_pdb_batch_filenames_are_distinct(const path_vec &,
+		                                                      const boost::filesystem::path &);
+
+		pdb_batch_file_status extract_pdb_batch_file(const boost::filesystem::path &,
+		                                             pdb &,
+		                                             const boost::filesystem::path &);
+
+		std::ostream & operator<<(std::ostream &,
+		                          const pdb_batch_file_status &);
+
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -0,0 +1,178 @@
+/// \file
+/// \brief The pdb_batch test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/auto_unit_test.hpp>
+
+#include "chopping/region/region.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/file/temp_file.hpp"
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_batch.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <fstream>
+#include <sstream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+
+using boost::algorithm::starts_with;
+using boost::filesystem::copy_file;
+using boost::filesystem::exists;
+using boost::filesystem::path;
+using boost::filesystem::temp_directory_path;
+using std::istringstream;
+using std::ofstream;
+using std::ostringstream;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The pdb_batch_test_suite_fixture to assist in testing pdb_batch
+		struct pdb_batch_test_suite_fixture : protected global_test_constants {
+		protected:
+			~pdb_batch_test_suite_fixture() noexcept = default;
+
+			/// \brief A processor that checks each file, permitting no ATOM records
+			const pdb_batch_file_processor check_processor = [] (const path &x, pdb &y) {
+				return check_pdb_batch_file( x, y, false );
+			};
+
+			/// \brief A batch of a good file, a missing file and another good file
+			const path_vec good_bad_good_files = {
+				EXAMPLE_A_PDB_FILENAME(),
+				TEST_SOURCE_DATA_DIR() / "this_file_does_not_exist",
+				TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.gz",
+			};
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(pdb_batch_test_suite, cath::test::pdb_batch_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(reads_manifest_ignoring_blank_lines_comments_and_whitespace) {
+	istringstream manifest_ss{ "# A comment\n1abc.pdb\n\n   2def.cif.gz  \n\t# Another comment\n/a/b/3ghi\n" };
+	BOOST_CHECK_EQUAL_RANGES(
+		read_pdb_batch_manifest( manifest_ss ),
+		path_vec{ { "1abc.pdb", "2def.cif.gz", "/a/b/3ghi" } }
+	);
+}
+
+BOOST_AUTO_TEST_CASE(lists_files_of_directory_in_sorted_order) {
+	const path dir = TEST_SOURCE_DATA_DIR() / "compressed";
+	BOOST_CHECK_EQUAL_RANGES(
+		pdb_batch_files_of_directory( dir ),
+		path_vec{ {
+			dir / "1bdh.cif.gz",
+			dir / "1c0pA01.bgz",
+			dir / "1c0pA01.dssp.gz",
+			dir / "1c0pA01.gz",
+			dir / "1c0pA01.sec.gz",
+		} }
+	);
+	BOOST_CHECK_EQUAL_RANGES(
+		pdb_batch_files( path_opt{}, dir ),
+		pdb_batch_files_of_directory( dir )
+	);
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_invalid_batch_source) {
+	BOOST_CHECK_THROW( pdb_batch_files_of_directory( EXAMPLE_A_PDB_FILENAME() ), invalid_argument_exception );
+	BOOST_CHECK_THROW( pdb_batch_files( path_opt{}, path_opt{} ), invalid_argument_exception );
+	BOOST_CHECK_THROW( pdb_batch_files( path_opt{ "a" }, path_opt{ "b" } ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(continues_past_errors_and_reports_each_file_in_order) {
+	ostringstream report_ss;
+	BOOST_CHECK_EQUAL( process_pdb_batch( good_bad_good_files, check_processor, report_ss ), 1 );
+
+	istringstream report_lines_ss{ report_ss.str() };
+	string line;
+	BOOST_REQUIRE( getline( report_lines_ss, line ) );
+	BOOST_CHECK( starts_with( line, good_bad_good_files[ 0 ].string() + "\tOK\t" ) );
+	BOOST_REQUIRE( getline( report_lines_ss, line ) );
+	BOOST_CHECK( starts_with( line, good_bad_good_files[ 1 ].string() + "\tERROR\t0\t" ) );
+	BOOST_REQUIRE( getline( report_lines_ss, line ) );
+	BOOST_CHECK( starts_with( line, good_bad_good_files[ 2 ].string() + "\tOK\t" ) );
+	BOOST_CHECK( ! getline( report_lines_ss, line ) );
+}
+
+BOOST_AUTO_TEST_CASE(multithreaded_batch_gives_same_report_as_single_threaded) {
+	path_vec files;
+	for (size_t rep_ctr = 0; rep_ctr < 3 * PDB_BATCH_FILES_PER_TASK; ++rep_ctr) {
+		files.insert( files.end(), good_bad_good_files.begin(), good_bad_good_files.end() );
+	}
+
+	ostringstream single_threaded_report_ss;
+	ostringstream multi_threaded_report_ss;
+	BOOST_CHECK_EQUAL( process_pdb_batch( files, check_processor, single_threaded_report_ss, 1 ), 3 * PDB_BATCH_FILES_PER_TASK );
+	BOOST_CHECK_EQUAL( process_pdb_batch( files, check_processor, multi_threaded_report_ss,  4 ), 3 * PDB_BATCH_FILES_PER_TASK );
+	BOOST_CHECK_EQUAL( multi_threaded_report_ss.str(), single_threaded_report_ss.str() );
+}
+
+BOOST_AUTO_TEST_CASE(check_rejects_file_without_atoms_unless_permitted) {
+	const temp_file temp_file{ "cath_tools_test_temp_file.pdb_batch.%%%%" };
+	ofstream{ get_filename( temp_file ).string() } << "REMARK   1 NO ATOMS HERE\n";
+
+	pdb the_pdb;
+	BOOST_CHECK_THROW( check_pdb_batch_file( get_filename( temp_file ), the_pdb, false ), invalid_argument_exception );
+	BOOST_CHECK_EQUAL( check_pdb_batch_file( get_filename( temp_file ), the_pdb, true ).num_atoms, 0 );
+}
+
+BOOST_AUTO_TEST_CASE(extracted_filename_strips_gzip_and_replaces_cif_extensions) {
+	BOOST_CHECK_EQUAL( extracted_pdb_batch_filename( "/a/1c0pA01",     "out" ), path( "out/1c0pA01"  ) );
+	BOOST_CHECK_EQUAL( extracted_pdb_batch_filename( "/a/1c0pA01.gz",  "out" ), path( "out/1c0pA01"  ) );
+	BOOST_CHECK_EQUAL( extracted_pdb_batch_filename( "/a/1bdh.cif.gz", "out" ), path( "out/1bdh.pdb" ) );
+	BOOST_CHECK_EQUAL( extracted_pdb_batch_filename( "/a/1bdh.bcif",   "out" ), path( "out/1bdh.pdb" ) );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_batch_with_files_extracted_to_the_same_file) {
+	BOOST_CHECK_NO_THROW( check_extracted_pdb_batch_filenames_are_distinct( { "/a/1c0pA01", "/b/1c0pB01.gz", "/a/1bdh.cif" }, "out" ) );
+	BOOST_CHECK_THROW   ( check_extracted_pdb_batch_filenames_are_distinct( { "/a/1bdh.cif.gz", "/a/1c0pA01", "/a/1bdh.bcif" }, "out" ), invalid_argument_exception );
+	BOOST_CHECK_THROW   ( check_extracted_pdb_batch_filenames_are_distinct( { "/a/1c0pA01",     "/b/1c0pA01.gz"               }, "out" ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(extracts_mmcif_file_to_pdb_file_in_output_dir) {
+	const temp_file input_file{ "cath_tools_test_temp_file.pdb_batch.%%%%.cif" };
+	copy_file( TEST_SOURCE_DATA_DIR() / "mmcif" / "1bdh.cif", get_filename( input_file ) );
+	const temp_file output_file{ extracted_pdb_batch_filename( get_filename( input_file ), temp_directory_path() ).filename().string() };
+
+	pdb the_pdb;
+	const pdb_batch_file_status status = extract_pdb_batch_file( get_filename( input_file ), the_pdb, temp_directory_path() );
+	BOOST_CHECK( status.succeeded );
+	BOOST_CHECK_EQUAL( status.message, get_filename( output_file ).string() );
+	BOOST_REQUIRE( exists( get_filename( output_file ) ) );
+	BOOST_CHECK_EQUAL( read_pdb_file( get_filename( output_file ) ).get_num_atoms(), status.num_atoms );
+	BOOST_CHECK_GT( status.num_atoms, 0 );
+}
+
+BOOST_AUTO_TEST_CASE(writes_status_on_one_tab_separated_line) {
+	ostringstream status_ss;
+	status_ss << pdb_batch_file_status{ "1abc", false, 0, "Bad\tthings\nhappened" };
+	BOOST_CHECK_EQUAL( status_ss.str(), "1abc\tERROR\t0\tBad things happened" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
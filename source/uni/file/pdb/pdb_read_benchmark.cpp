@@ -0,0 +1,155 @@
+/// \file
+/// \brief The pdb_read_benchmark definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pdb_read_benchmark.hpp"
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/filesystem.hpp>
+
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/chrono/duration_to_seconds_string.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "file/pdb/pdb.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+
+using boost::filesystem::file_size;
+using boost::filesystem::path;
+using boost::ignore_unused;
+using std::chrono::duration;
+using std::chrono::high_resolution_clock;
+using std::min;
+using std::ostream;
+
+namespace cath {
+	namespace file {
+		namespace detail {
+
+			/// \brief The number of megabytes of text that are read per second when reading the specified number of
+			///        bytes in the specified duration
+			inline double megabytes_per_second(const size_t       &prm_num_bytes, ///< The number of bytes read
+			                                   const hrc_duration &prm_durn       ///< The time taken to read them
+			                                   ) {
+				const double num_seconds = duration<double>( prm_durn ).count();
+				return ( num_seconds > 0.0 ) ? ( static_cast<double>( prm_num_bytes ) / ( 1024.0 * 1024.0 ) / num_seconds )
+				                             : 0.0;
+			}
+
+		} // namespace detail
+	} // namespace file
+} // namespace cath
+
+/// \brief Time reading the same structure from the specified uncompressed file and from the specified compressed file
+///
+/// Each repeat reads each file once with read_pdb_file(). The durations are the fastest over the repeats
+/// (to reduce the noise from other activity on the machine).
+///
+/// \throws invalid_argument_exception if there are zero repeats or if the two files give different numbers of atoms
+///
+/// \relates pdb_read_benchmark_result
+pdb_read_benchmark_result cath::file::benchmark_pdb_reading(const path   &prm_uncompressed_file, ///< The uncompressed file to read
+                                                            const path   &prm_compressed_file,   ///< The compressed equivalent of the uncompressed file
+                                                            const size_t &prm_num_repeats        ///< The number of times to repeat the benchmark
+                                                            ) {
+	if ( prm_num_repeats == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot benchmark PDB reading with zero repeats"));
+	}
+
+	pdb_read_benchmark_result result{
+		file_size( prm_uncompressed_file ),
+		file_size( prm_compressed_file   ),
+		0,
+		hrc_duration::max(),
+		hrc_duration::max()
+	};
+
+	for (const size_t &repeat_ctr : indices( prm_num_repeats ) ) {
+		ignore_unused( repeat_ctr );
+
+		const auto uncompressed_start = high_resolution_clock::now();
+		const pdb  uncompressed_pdb   = read_pdb_file( prm_uncompressed_file );
+		const auto compressed_start   = high_resolution_clock::now();
+		const pdb  compressed_pdb     = read_pdb_file( prm_compressed_file );
+		const auto compressed_stop    = high_resolution_clock::now();
+
+		if ( compressed_pdb.get_num_atoms() != uncompressed_pdb.get_num_atoms() ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception(
+				"Cannot benchmark PDB reading from compressed file \""
+				+ prm_compressed_file.string()
+				+ "\" because it doesn't contain the same atoms as \""
+				+ prm_uncompressed_file.string()
+				+ "\""
+			));
+		}
+
+		result.num_atoms         = uncompressed_pdb.get_num_atoms();
+		result.uncompressed_durn = min( result.uncompressed_durn, hrc_duration{ compressed_start - uncompressed_start } );
+		result.compressed_durn   = min( result.compressed_durn,   hrc_duration{ compressed_stop  - compressed_start   } );
+	}
+	return result;
+}
+
+/// \brief The throughput of reading the uncompressed file, in megabytes of PDB text per second
+///
+/// \relates pdb_read_benchmark_result
+double cath::file::uncompressed_megabytes_per_second(const pdb_read_benchmark_result &prm_result ///< The pdb_read_benchmark_result to query
+                                                     ) {
+	return detail::megabytes_per_second( prm_result.num_uncompressed_bytes, prm_result.uncompressed_durn );
+}
+
+/// \brief The throughput of reading the compressed file, in megabytes of (decompressed) PDB text per second
+///
+/// This uses the uncompressed size so that it's directly comparable with uncompressed_megabytes_per_second()
+///
+/// \relates pdb_read_benchmark_result
+double cath::file::compressed_megabytes_per_second(const pdb_read_benchmark_result &prm_result ///< The pdb_read_benchmark_result to query
+                                                   ) {
+	return detail::megabytes_per_second( prm_result.num_uncompressed_bytes, prm_result.compressed_durn );
+}
+
+/// \brief Insert a description of the specified pdb_read_benchmark_result into the specified ostream
+///
+/// \relates pdb_read_benchmark_result
+ostream & cath::file::operator<<(ostream                         &prm_os,    ///< The ostream into which the description should be inserted
+                                 const pdb_read_benchmark_result &prm_result ///< The pdb_read_benchmark_result to describe
+                                 ) {
+	prm_os << "pdb_read_benchmark_result["
+	       << prm_result.num_atoms
+	       << " atoms; uncompressed: "
+	       << prm_result.num_uncompressed_bytes
+	       << " bytes in "
+	       << durn_to_seconds_string( prm_result.uncompressed_durn )
+	       << " ("
+	       << uncompressed_megabytes_per_second( prm_result )
+	       << " MB/s); compressed: "
+	       << prm_result.num_compressed_bytes
+	       << " bytes in "
+	       << durn_to_seconds_string( prm_result.compressed_durn   )
+	       << " ("
+	       << compressed_megabytes_per_second( prm_result )
+	       << " MB/s)]";
+	return prm_os;
+}
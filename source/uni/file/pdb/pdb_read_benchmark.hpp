@@ -0,0 +1,67 @@
+/// \file
+/// \brief The pdb_read_benchmark header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_PDB_PDB_READ_BENCHMARK_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_PDB_PDB_READ_BENCHMARK_HPP
+
+#include <boost/filesystem/path.hpp>
+
+#include "common/chrono/chrono_type_aliases.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace cath {
+	namespace file {
+
+		/// \brief The timings of reading the same structure from an uncompressed file and from a compressed file
+		///
+		/// The durations are the fastest over the repeats
+		struct pdb_read_benchmark_result final {
+			/// \brief The number of bytes in the uncompressed file
+			size_t       num_uncompressed_bytes;
+
+			/// \brief The number of bytes in the compressed file
+			size_t       num_compressed_bytes;
+
+			/// \brief The number of atoms read (which is the same from both files)
+			size_t       num_atoms;
+
+			/// \brief The time taken to read the uncompressed file
+			hrc_duration uncompressed_durn;
+
+			/// \brief The time taken to read (and decompress) the compressed file
+			hrc_duration compressed_durn;
+		};
+
+		pdb_read_benchmark_result benchmark_pdb_reading(const boost::filesystem::path &,
+		                                                const boost::filesystem::path &,
+		                                                const size_t & = 1);
+
+		double uncompressed_megabytes_per_second(const pdb_read_benchmark_result &);
+		double compressed_megabytes_per_second(const pdb_read_benchmark_result &);
+
+		std::ostream & operator<<(std::ostream &,
+		                          const pdb_read_benchmark_result &);
+
+	} // namespace file
+} // namespace cath
+
+#endif
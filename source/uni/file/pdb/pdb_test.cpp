@@ -26,11 +26,14 @@
 #include "common/boost_addenda/log/stringstream_log_sink.hpp"
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
+#include "common/file/slurp.hpp"
 #include "common/file/temp_file.hpp"
 #include "common/size_t_literal.hpp"
+#include "file/pdb/detail/pdb_text_chunk.hpp"
 #include "file/pdb/pdb.hpp"
 #include "file/pdb/pdb_atom.hpp"
 #include "file/pdb/pdb_list.hpp"
+#include "file/pdb/pdb_read_benchmark.hpp"
 #include "file/pdb/pdb_residue.hpp"
 #include "test/boost_addenda/boost_check_equal_ranges.hpp"
 #include "test/boost_addenda/boost_check_no_throw_diag.hpp"
@@ -66,6 +69,35 @@ namespace cath {
 			/// \brief Check that the number of atoms in a vector of PDBs matches the expected numbers
 			void check_nums_of_atoms(const pdb_list &,
 			                         const size_vec &) const;
+
+			/// \brief Check that reading the specified PDB text in the specified numbers of chunks
+			///        gives the same residues and warnings as reading it from a stream
+			void check_chunked_read_matches_stream_read(const string &prm_pdb_text ///< The PDB text to read
+			                                            ) const {
+				pdb    stream_pdb;
+				string stream_log;
+				{
+					const stringstream_log_sink log_sink;
+					istringstream input_ss{ prm_pdb_text };
+					read_pdb_file( input_ss, stream_pdb );
+					stream_log = log_sink.str();
+				}
+				for (const size_t &num_chunks : { 1_z, 2_z, 3_z, 5_z, 8_z, 1000_z } ) {
+					BOOST_TEST_CONTEXT( "Reading in " << num_chunks << " chunk(s)" ) {
+						pdb    chunked_pdb;
+						string chunked_log;
+						{
+							const stringstream_log_sink log_sink;
+							file::detail::read_pdb_text_in_chunks( file::detail::pdb_text_up_to_first_endmdl( prm_pdb_text ), chunked_pdb, num_chunks );
+							chunked_log = log_sink.str();
+						}
+						BOOST_CHECK_EQUAL( chunked_pdb.get_num_residues(),                 stream_pdb.get_num_residues()                 );
+						BOOST_CHECK_EQUAL( chunked_pdb.get_post_ter_residues().size(),     stream_pdb.get_post_ter_residues().size()     );
+						BOOST_CHECK_EQUAL( to_pdb_file_string( chunked_pdb ),               to_pdb_file_string( stream_pdb )               );
+						BOOST_CHECK_EQUAL( chunked_log,                                    stream_log                                    );
+					}
+				}
+			}
 		};
 
 	}  // namespace test
@@ -396,4 +428,96 @@ BOOST_AUTO_TEST_CASE(writes_partial_pdb_correctly) {
 	BOOST_CHECK_FILES_EQUAL( temp_test_file, expected );
 }
 
+BOOST_AUTO_TEST_CASE(splits_text_into_chunks_at_line_ends) {
+	const string pdb_text = "AAAA\nBB\nCCCCCC\nD";
+	for (const size_t &num_chunks : { 1_z, 2_z, 3_z, 4_z, 100_z } ) {
+		const auto chunks = file::detail::split_pdb_text_into_chunks( pdb_text, num_chunks );
+		BOOST_CHECK_LE( chunks.size(), num_chunks );
+		string rejoined;
+		for (const auto &chunk : chunks) {
+			BOOST_CHECK( chunk.empty() || chunk.back() == '\n' || &chunk == &chunks.back() );
+			rejoined += chunk.to_string();
+		}
+		BOOST_CHECK_EQUAL( rejoined, pdb_text );
+	}
+	BOOST_CHECK_THROW( file::detail::split_pdb_text_into_chunks( pdb_text, 0 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(chunked_reads_match_stream_reads) {
+	for (const path &pdb_file : {
+			TEST_SOURCE_DATA_DIR()                                   / "1c0pA01",
+			TEST_SOURCE_DATA_DIR()                                   / "1hdoA00",
+			TEST_EXAMPLE_PDBS_DATA_DIR()                             / "1a04A02",
+			TEST_EXAMPLE_PDBS_DATA_DIR()                             / "1cf7B00",
+			TEST_SOURCE_DATA_DIR() / "supn_content"                  / "1bdh",
+			TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "chain_break_1",
+			TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "hetatms_in_altloc_a_then_proline_atoms_in_b",
+			TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "interspersed_chains",
+			TEST_SOURCE_DATA_DIR() / "dssp" / "hbond"                / "residue_with_diff_aas_in_altlocs",
+		} ) {
+		BOOST_TEST_CONTEXT( "Checking " << pdb_file ) {
+			check_chunked_read_matches_stream_read( slurp( pdb_file ) );
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(chunked_reads_handle_ters_skipped_records_and_endmdl_across_chunks) {
+	check_chunked_read_matches_stream_read( R"(ATOM      1  N   ALA A   1      11.104   6.134  -6.504  1.00  0.00           N  
+ATOM      2  CA  ALA A   1      11.639   6.071  -5.147  1.00  0.00           C  
+ATOM      3  N   FOO A   2      12.000   6.000  -5.000  1.00  0.00           N  
+TER       4      ALA A   1
+HETATM    5  O   HOH A 101       1.000   2.000   3.000  1.00  0.00           O  
+ATOM      6  N   GLY B   1       1.000   2.000   3.000  1.00  0.00           N  
+ATOM      7  CA  GLY B   1       2.000   2.000   3.000  1.00  0.00           C  
+TER
+ATOM      8  N   SER C   1       1.000   2.000   3.000  1.00  0.00           N  
+ENDMDL
+ATOM      9  N   SER D   1       1.000   2.000   3.000  1.00  0.00           N  
+)" );
+}
+
+BOOST_AUTO_TEST_CASE(chunked_reads_throw_on_malformed_record_in_later_chunk) {
+	const string good_line = "ATOM      1  N   ALA A   1      11.104   6.134  -6.504  1.00  0.00           N  \n";
+	string pdb_text;
+	for (size_t line_ctr = 0; line_ctr < 50; ++line_ctr) {
+		pdb_text += good_line;
+	}
+	pdb_text += "ATOM      1  N   ALA A   1      11.104   6.134  -6.50X  1.00  0.00           N  \n";
+	pdb the_pdb;
+	BOOST_CHECK_THROW( file::detail::read_pdb_text_in_chunks( pdb_text, the_pdb, 4 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(memory_mapped_file_read_matches_stream_read) {
+	const path    pdb_file = EXAMPLE_A_PDB_FILENAME();
+	istringstream input_ss{ slurp( pdb_file ) };
+	BOOST_CHECK_EQUAL( to_pdb_file_string( read_pdb_file( pdb_file ) ), to_pdb_file_string( read_pdb_file( input_ss ) ) );
+}
+
+BOOST_AUTO_TEST_CASE(reads_gzipped_files_as_uncompressed) {
+	const string expected_1c0p = to_pdb_file_string( read_pdb_file( TEST_SOURCE_DATA_DIR() / "1c0pA01" ) );
+	BOOST_CHECK_EQUAL( to_pdb_file_string( read_pdb_file( TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.gz"  ) ), expected_1c0p );
+	BOOST_CHECK_EQUAL( to_pdb_file_string( read_pdb_file( TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.bgz" ) ), expected_1c0p );
+
+	// The format of a gzipped file is determined by its name without the gzip extension
+	const pdb bdh_pdb   = read_pdb_file( TEST_SOURCE_DATA_DIR() / "supn_content" / "1bdh"        );
+	const pdb bdh_mmcif = read_pdb_file( TEST_SOURCE_DATA_DIR() / "compressed"   / "1bdh.cif.gz" );
+	BOOST_CHECK_EQUAL( to_pdb_file_string( bdh_mmcif ),           to_pdb_file_string( bdh_pdb ) );
+	BOOST_CHECK_EQUAL( bdh_mmcif.get_post_ter_residues().size(), bdh_pdb.get_post_ter_residues().size() );
+}
+
+BOOST_AUTO_TEST_CASE(benchmarks_reading_compressed_against_uncompressed) {
+	const pdb_read_benchmark_result result = benchmark_pdb_reading(
+		TEST_SOURCE_DATA_DIR() / "1c0pA01",
+		TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.bgz",
+		2
+	);
+	BOOST_CHECK_EQUAL( result.num_atoms, read_pdb_file( TEST_SOURCE_DATA_DIR() / "1c0pA01" ).get_num_atoms() );
+	BOOST_CHECK_GT   ( result.num_uncompressed_bytes, result.num_compressed_bytes );
+	BOOST_CHECK_GE   ( uncompressed_megabytes_per_second( result ), 0.0 );
+	BOOST_CHECK_GE   ( compressed_megabytes_per_second  ( result ), 0.0 );
+
+	BOOST_CHECK_THROW( benchmark_pdb_reading( TEST_SOURCE_DATA_DIR() / "1c0pA01", TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.gz", 0 ), invalid_argument_exception );
+	BOOST_CHECK_THROW( benchmark_pdb_reading( TEST_SOURCE_DATA_DIR() / "1c0pA01", TEST_SOURCE_DATA_DIR() / "1hdoA00",                   1 ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
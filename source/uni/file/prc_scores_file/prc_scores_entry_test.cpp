@@ -21,6 +21,7 @@
 #include <boost/test/auto_unit_test.hpp>
 
 #include "file/prc_scores_file/prc_scores_entry.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
 #include "test/test_tools.hpp"
 
 #include <vector>
@@ -30,6 +31,8 @@ using namespace cath::common::test;
 using namespace cath::file;
 using namespace std;
 
+using cath::common::invalid_argument_exception;
+
 namespace cath {
 	namespace test {
 
@@ -79,6 +82,12 @@ BOOST_AUTO_TEST_CASE(parses_from_line) {
 	);
 }
 
+BOOST_AUTO_TEST_CASE(rejects_line_with_trailing_junk_in_numeric_field) {
+	// std::stoul()/std::stod() used to accept (and ignore) trailing junk such as this but the fields must now be wholly numeric
+	BOOST_CHECK_THROW( prc_scores_entry_from_line( "1i4dA00 4       199x    201     1       3cazA00 15      209     219       25.3    16.3   1.6e-11" ), invalid_argument_exception );
+	BOOST_CHECK_THROW( prc_scores_entry_from_line( "1i4dA00 4       199     201     1       3cazA00 15      209     219       25.3    16.3   1.6e-11e" ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_CASE(getters) {
 	BOOST_CHECK_EQUAL( eg_entry.get_name_1(),   "1i4dA00" );
 	BOOST_CHECK_EQUAL( eg_entry.get_start_1(),    4       );
@@ -28,7 +28,7 @@
 #include "common/boost_addenda/string_algorithm/split_build.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "common/exception/runtime_error_exception.hpp"
-#include "common/file/open_fstream.hpp"
+#include "common/file/gzip_file.hpp"
 #include "common/lexical_cast_line.hpp"
 #include "common/type_aliases.hpp"
 #include "file/sec/sec_file.hpp"
@@ -50,18 +50,17 @@ using boost::algorithm::is_any_of;
 using boost::algorithm::token_compress_on;
 using boost::algorithm::trim_copy;
 using boost::filesystem::path;
+using boost::iostreams::filtering_istream;
 using boost::lexical_cast;
 
-/// \brief Read a sec file into a sec_file object
+/// \brief Read a sec file (which may be gzipped) into a sec_file object
 ///
 /// \relates sec_file
 sec_file cath::file::read_sec(const path &prm_sec_filename ///< The file from which to parse the sec data
                               ) {
-	ifstream my_sec_istream;
-	open_ifstream(my_sec_istream, prm_sec_filename);
-	const sec_file the_sec_file = read_sec( my_sec_istream );
-	my_sec_istream.close();
-	return the_sec_file;
+	filtering_istream my_sec_istream;
+	open_decompressing_istream( my_sec_istream, prm_sec_filename );
+	return read_sec( my_sec_istream );
 }
 
 /// \brief Read a sec file from an istream into a sec_file object
@@ -20,11 +20,22 @@
 
 #include <boost/test/auto_unit_test.hpp>
 
+#include "file/sec/sec_file.hpp"
+#include "file/sec/sec_file_io.hpp"
+#include "file/sec/sec_file_record.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <algorithm>
+
+using namespace cath::file;
+
 namespace cath {
 	namespace test {
 
 		/// \brief The sec_file_test_suite_fixture to assist in testing sec_file
-		struct sec_file_test_suite_fixture {
+		struct sec_file_test_suite_fixture : protected global_test_constants {
 		protected:
 			~sec_file_test_suite_fixture() noexcept = default;
 		};
@@ -39,5 +50,12 @@ BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_CHECK( true );
 }
 
+BOOST_AUTO_TEST_CASE(reads_gzipped_file_as_uncompressed) {
+	const sec_file uncompressed_sec = read_sec( TEST_SOURCE_DATA_DIR() / "1c0pA01.sec"                   );
+	const sec_file gzipped_sec      = read_sec( TEST_SOURCE_DATA_DIR() / "compressed" / "1c0pA01.sec.gz" );
+	BOOST_REQUIRE_EQUAL( gzipped_sec.size(), uncompressed_sec.size() );
+	BOOST_CHECK( std::equal( gzipped_sec.begin(), gzipped_sec.end(), uncompressed_sec.begin() ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,77 @@
+/// \file
+/// \brief The ssap_scores_line_parser class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_FILE_SSAP_SCORES_FILE_DETAIL_SSAP_SCORES_LINE_PARSER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_FILE_SSAP_SCORES_FILE_DETAIL_SSAP_SCORES_LINE_PARSER_HPP
+
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/string/string_parse_tools.hpp"
+#include "common/type_aliases.hpp"
+#include "file/ssap_scores_file/ssap_scores_entry.hpp"
+
+#include <string>
+
+namespace cath {
+	namespace file {
+
+		/// \brief Helper for parsing SSAP scores lines that, when reused over multiple lines,
+		///        reuses a vector of field iterators and hence avoids wasting time on needless reallocations
+		class ssap_scores_line_parser final {
+		private:
+			/// \brief Reused vector of iterators wrapping the fields parsed from lines
+			str_citr_str_citr_pair_vec field_itrs;
+
+		public:
+			ssap_scores_entry parse_line(const std::string &);
+		};
+
+		/// \brief Parse the specified string into a ssap_scores_entry
+		///
+		/// This avoids splitting the line into strings (as split_build() does) and instead
+		/// parses the numbers directly from the fields of the line.
+		///
+		/// An example line:
+		///
+		///     1cukA03  1hjpA03   48   44  94.92   44   91   97   0.71
+		inline ssap_scores_entry ssap_scores_line_parser::parse_line(const std::string &prm_ssap_line ///< The SSAP scores file line to be parsed
+		                                                             ) {
+			common::split_into_field_itrs( prm_ssap_line, field_itrs );
+			if ( field_itrs.size() != 9 ) {
+				BOOST_THROW_EXCEPTION(common::runtime_error_exception("Unable to parse ssap_scores_entry from line that doesn't contain 9 parts"));
+			}
+
+			/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
+			return ssap_scores_entry{
+				std::string{ field_itrs[ 0 ].first, field_itrs[ 0 ].second },
+				std::string{ field_itrs[ 1 ].first, field_itrs[ 1 ].second },
+				common::strtoul_field( prm_ssap_line, field_itrs[ 2 ] ),
+				common::strtoul_field( prm_ssap_line, field_itrs[ 3 ] ),
+				common::strtod_field ( prm_ssap_line, field_itrs[ 4 ] ),
+				common::strtoul_field( prm_ssap_line, field_itrs[ 5 ] ),
+				common::strtod_field ( prm_ssap_line, field_itrs[ 6 ] ),
+				common::strtod_field ( prm_ssap_line, field_itrs[ 7 ] ),
+				common::strtod_field ( prm_ssap_line, field_itrs[ 8 ] )
+			};
+		}
+
+	} // namespace file
+} // namespace cath
+
+#endif
@@ -20,12 +20,8 @@
 
 #include "ssap_scores_entry.hpp"
 
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/finder.hpp>
-
-#include "common/boost_addenda/string_algorithm/split_build.hpp"
-#include "common/exception/runtime_error_exception.hpp"
 #include "common/type_aliases.hpp"
+#include "file/ssap_scores_file/detail/ssap_scores_line_parser.hpp"
 
 #include <string>
 
@@ -33,9 +29,6 @@ using namespace cath::common;
 using namespace cath::file;
 using namespace std;
 
-using boost::algorithm::is_space;
-using boost::token_compress_on;
-
 /// \brief Ctor from all of the required pieces of information
 ssap_scores_entry::ssap_scores_entry(string        prm_prot1,      ///< Name of protein 1
                                      string        prm_prot2,      ///< Name of protein 2
@@ -138,23 +131,7 @@ bool cath::file::operator==(const ssap_scores_entry &prm_entry_a, ///< The first
 /// \relates ssap_scores_entry
 ssap_scores_entry cath::file::ssap_scores_entry_from_line(const string &prm_ssap_line_entry ///< The line from which to parse the data
                                                           ) {
-	const auto line_parts = split_build<str_vec>( prm_ssap_line_entry, is_space(), token_compress_on );
-	if ( line_parts.size() != 9 ) {
-		BOOST_THROW_EXCEPTION(runtime_error_exception("Unable to parse ssap_scores_entry from line that doesn't contain 9 parts"));
-	}
-
-	/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
-	return ssap_scores_entry{
-		       line_parts[ 0 ],
-		       line_parts[ 1 ],
-		stoul( line_parts[ 2 ] ),
-		stoul( line_parts[ 3 ] ),
-		stod ( line_parts[ 4 ] ),
-		stoul( line_parts[ 5 ] ),
-		stod ( line_parts[ 6 ] ),
-		stod ( line_parts[ 7 ] ),
-		stod ( line_parts[ 8 ] )
-	};
+	return ssap_scores_line_parser{}.parse_line( prm_ssap_line_entry );
 }
 
 /// \brief Simple to_string() overload for ssap_scores_entry
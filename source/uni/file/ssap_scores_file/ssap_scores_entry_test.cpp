@@ -21,6 +21,7 @@
 #include <boost/test/auto_unit_test.hpp>
 
 #include "file/ssap_scores_file/ssap_scores_entry.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
 #include "test/test_tools.hpp"
 
 #include <vector>
@@ -73,6 +74,12 @@ BOOST_AUTO_TEST_CASE(parses_from_line) {
 	BOOST_CHECK_EQUAL( ssap_scores_entry_from_line( "1cukA03  1hjpA03   48   44  94.92   44   91   97   0.71" ), eg_entry );
 }
 
+BOOST_AUTO_TEST_CASE(rejects_line_with_trailing_junk_in_numeric_field) {
+	// std::stoul()/std::stod() used to accept (and ignore) trailing junk such as this but the fields must now be wholly numeric
+	BOOST_CHECK_THROW( ssap_scores_entry_from_line( "1cukA03  1hjpA03   48x  44  94.92   44   91   97   0.71" ), invalid_argument_exception );
+	BOOST_CHECK_THROW( ssap_scores_entry_from_line( "1cukA03  1hjpA03   48   44  94.92%  44   91   97   0.71" ), invalid_argument_exception );
+}
+
 BOOST_AUTO_TEST_CASE(getters) {
 	BOOST_CHECK_EQUAL( eg_entry.get_name_1(),     "1cukA03" );
 	BOOST_CHECK_EQUAL( eg_entry.get_name_2(),     "1hjpA03" );
@@ -32,6 +32,7 @@
 #include "common/boost_addenda/string_algorithm/split_build.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "common/file/open_fstream.hpp"
+#include "file/ssap_scores_file/detail/ssap_scores_line_parser.hpp"
 #include "file/ssap_scores_file/ssap_scores_entry.hpp"
 
 #include <fstream>
@@ -48,14 +49,15 @@ using boost::filesystem::path;
 /// \brief Parse a vector of ssap_scores_entry objects from the specified istream
 ssap_scores_entry_vec ssap_scores_file::parse_ssap_scores_file_simple(istream &prm_ssap_scores_is ///< The istream of SSAP scores data from which to parse the ssap_scores_entry objects
                                                                       ) {
-	string                line_string;
-	ssap_scores_entry_vec results;
+	string                  line_string;
+	ssap_scores_entry_vec   results;
+	ssap_scores_line_parser parser;
 	while ( getline( prm_ssap_scores_is, line_string ) ) {
 
 		// If this line is neither empty nor a comment line (a comment line is a line with a '#' character as the first non-whitespace character)
 		trim_left( line_string );
 		if ( ! line_string.empty() && line_string.front() != '#' ) {
-			results.push_back( ssap_scores_entry_from_line( line_string ) );
+			results.push_back( parser.parse_line( line_string ) );
 		}
 	}
 	return results;
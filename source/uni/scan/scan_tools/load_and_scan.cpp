@@ -36,9 +36,15 @@ void load_and_scan::perform_load() {
 	stringstream stderr_ostream;
 	const auto query_load_result = query_protein_loader.load_proteins( stderr_ostream );
 	const auto match_load_result = match_protein_loader.load_proteins( stderr_ostream );
-	query_proteins = query_load_result.first;
-	match_proteins = match_load_result.first;
-	load_files_duration = query_load_result.second + match_load_result.second;
+	query_proteins = query_load_result.proteins;
+	match_proteins = match_load_result.proteins;
+	load_files_duration = query_load_result.load_durn + match_load_result.load_durn;
+	protein_load_durations = query_load_result.protein_load_durns;
+	protein_load_durations.insert(
+		protein_load_durations.end(),
+		match_load_result.protein_load_durns.begin(),
+		match_load_result.protein_load_durns.end()
+	);
 }
 
 /// \brief TODOCUMENT
@@ -72,6 +78,7 @@ const protein_list & load_and_scan::get_match_proteins() const {
 load_and_scan_metrics load_and_scan::get_load_and_scan_metrics() const {
 	return {
 		*load_files_duration,
+		protein_load_durations,
 		*the_scan_metrics
 	};
 }
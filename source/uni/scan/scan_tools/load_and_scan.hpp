@@ -55,6 +55,9 @@ namespace cath {
 			/// \brief TODOCUMENT
 			hrc_duration_opt load_files_duration;
 
+			/// \brief The time taken to load each of the query proteins and then each of the match proteins
+			hrc_duration_vec protein_load_durations;
+
 			/// \brief TODOCUMENT
 			boost::optional<scan_metrics> the_scan_metrics;
 
@@ -38,15 +38,18 @@ using namespace cath::scan;
 using namespace cath::scan::detail;
 
 using boost::filesystem::path;
+using boost::range::max_element;
 using std::ofstream;
 using std::string;
 using std::to_string;
 
 /// \brief TODOCUMENT
-load_and_scan_metrics::load_and_scan_metrics(const hrc_duration &prm_load_files_durn, ///< TODOCUMENT
-                                             scan_metrics        prm_scan_metrics     ///< TODOCUMENT
-                                             ) : load_files_durn  { prm_load_files_durn           },
-                                                 the_scan_metrics { std::move( prm_scan_metrics ) } {
+load_and_scan_metrics::load_and_scan_metrics(const hrc_duration &prm_load_files_durn,    ///< TODOCUMENT
+                                             hrc_duration_vec    prm_protein_load_durns, ///< The time taken to load each of the proteins
+                                             scan_metrics        prm_scan_metrics        ///< TODOCUMENT
+                                             ) : load_files_durn    { prm_load_files_durn                 },
+                                                 protein_load_durns { std::move( prm_protein_load_durns ) },
+                                                 the_scan_metrics   { std::move( prm_scan_metrics       ) } {
 }
 
 /// \brief TODOCUMENT
@@ -54,11 +57,28 @@ const hrc_duration & load_and_scan_metrics::get_load_files_durn() const {
 	return load_files_durn;
 }
 
+/// \brief Getter for the time taken to load each of the proteins (query proteins, then match proteins)
+const hrc_duration_vec & load_and_scan_metrics::get_protein_load_durns() const {
+	return protein_load_durns;
+}
+
 /// \brief TODOCUMENT
 const scan_metrics & load_and_scan_metrics::get_scan_metrics() const {
 	return the_scan_metrics;
 }
 
+/// \brief Get the longest time taken to load any one protein (or zero if there were no proteins)
+///
+/// This is useful for spotting a single slow protein that holds up a multi-threaded load
+///
+/// \relates load_and_scan_metrics
+hrc_duration cath::scan::get_slowest_protein_load_durn(const load_and_scan_metrics &prm_load_and_scan_metrics ///< The load_and_scan_metrics to query
+                                                       ) {
+	const auto &durns = prm_load_and_scan_metrics.get_protein_load_durns();
+	return durns.empty() ? hrc_duration::zero()
+	                     : *max_element( durns );
+}
+
 /// \brief TODOCUMENT
 ///
 /// \relates load_and_scan_metrics
@@ -110,6 +130,7 @@ string cath::scan::to_markdown_string(const load_and_scan_metrics &prm_load_and_
 	const auto &index_index_metrics  = get_index_index_metrics ( prm_load_and_scan_metrics );
 
 	const auto &load_files_durn      = prm_load_and_scan_metrics.get_load_files_durn();
+	const auto  slowest_load_durn    = get_slowest_protein_load_durn( prm_load_and_scan_metrics );
 	const auto &query_strucs_durn    = query_strucs_metrics.first;
 	const auto &query_index_durn     = query_index_metrics.first;
 	const auto &index_strucs_durn    = index_strucs_metrics.first;
@@ -134,6 +155,7 @@ string cath::scan::to_markdown_string(const load_and_scan_metrics &prm_load_and_
 	const auto property_fields = str_str_str_str_tpl_vec{ {
 		str_str_str_str_tpl{ "Task",                       "Duration",                                  "Rate",                                              "Memory Required"                            },
 		str_str_str_str_tpl{ "Load files",                 durn_to_seconds_string( load_files_durn   ), durn_to_rate_per_second_string( load_files_durn   ), ""                                           },
+		str_str_str_str_tpl{ "Load slowest protein",       durn_to_seconds_string( slowest_load_durn ), durn_to_rate_per_second_string( slowest_load_durn ), ""                                           },
 		str_str_str_str_tpl{ "Build query structure data", durn_to_seconds_string( query_strucs_durn ), durn_to_rate_per_second_string( query_strucs_durn ), to_string( query_strucs_size.value() ) + "b" },
 		str_str_str_str_tpl{ "Build query index store",    durn_to_seconds_string( query_index_durn  ), durn_to_rate_per_second_string( query_index_durn  ), to_string( query_index_size.value()  ) + "b" },
 		str_str_str_str_tpl{ "Build match structure data", durn_to_seconds_string( index_strucs_durn ), durn_to_rate_per_second_string( index_strucs_durn ), to_string( index_strucs_size.value() ) + "b" },
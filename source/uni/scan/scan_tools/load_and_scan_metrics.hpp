@@ -122,19 +122,26 @@ namespace cath {
 		class load_and_scan_metrics final {
 		private:
 			/// \brief TODOCUMENT
-			hrc_duration load_files_durn;
+			hrc_duration     load_files_durn;
+
+			/// \brief The time taken to load each of the proteins (query proteins, then match proteins)
+			hrc_duration_vec protein_load_durns;
 
 			/// \brief TODOCUMENT
-			scan_metrics the_scan_metrics;
+			scan_metrics     the_scan_metrics;
 
 		public:
 			load_and_scan_metrics(const hrc_duration &,
+			                      hrc_duration_vec,
 			                      scan_metrics);
 
 			const hrc_duration & get_load_files_durn() const;
+			const hrc_duration_vec & get_protein_load_durns() const;
 			const scan_metrics & get_scan_metrics() const;
 		};
 
+		hrc_duration get_slowest_protein_load_durn(const load_and_scan_metrics &);
+
 		const durn_mem_pair & get_query_strucs_metrics(const load_and_scan_metrics &);
 		const durn_mem_pair & get_query_index_metrics(const load_and_scan_metrics &);
 		const durn_mem_pair & get_index_strucs_metrics(const load_and_scan_metrics &);
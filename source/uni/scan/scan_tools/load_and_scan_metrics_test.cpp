@@ -20,13 +20,22 @@
 
 #include <boost/test/auto_unit_test.hpp>
 
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/units/quantity.hpp>
+
 #include "scan/scan_tools/load_and_scan_metrics.hpp"
 
+#include <chrono>
+
 //#include "test/global_test_constants.hpp"
 
+using namespace cath;
 using namespace cath::scan;
 //using namespace std;
 
+using boost::algorithm::contains;
+using std::chrono::milliseconds;
+
 namespace cath {
 	namespace test {
 
@@ -47,4 +56,21 @@ BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_CHECK( true );
 }
 
+BOOST_AUTO_TEST_CASE(reports_slowest_protein_load) {
+	const durn_mem_pair empty_metrics{ hrc_duration::zero(), info_quantity::from_value( 0 ) };
+	const scan_metrics  the_scan_metrics{ empty_metrics, empty_metrics, empty_metrics, empty_metrics, hrc_duration::zero() };
+
+	const load_and_scan_metrics metrics{
+		milliseconds{ 10 },
+		hrc_duration_vec{ milliseconds{ 3 }, milliseconds{ 7 }, milliseconds{ 5 } },
+		the_scan_metrics
+	};
+	BOOST_CHECK_EQUAL( metrics.get_protein_load_durns().size(), 3 );
+	BOOST_CHECK( get_slowest_protein_load_durn( metrics ) == milliseconds{ 7 } );
+	BOOST_CHECK( contains( to_markdown_string( metrics ), "Load slowest protein" ) );
+
+	const load_and_scan_metrics no_proteins_metrics{ hrc_duration::zero(), hrc_duration_vec{}, the_scan_metrics };
+	BOOST_CHECK( get_slowest_protein_load_durn( no_proteins_metrics ) == hrc_duration::zero() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
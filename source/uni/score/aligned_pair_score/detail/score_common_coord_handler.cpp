@@ -27,6 +27,7 @@
 #include "common/boost_addenda/range/indices.hpp"
 #include "common/exception/out_of_range_exception.hpp"
 #include "common/less_than_helper.hpp"
+#include "score/aligned_pair_score/detail/score_common_coords_cache.hpp"
 #include "structure/geometry/coord.hpp"
 #include "structure/geometry/coord_list.hpp"
 
@@ -112,10 +113,31 @@ str_bool_pair_vec score_common_coord_handler::short_name_suffixes() const {
 ///       else out_of_range_exception will be thrown
 ///
 /// Note that this may contain more than one coordinate pair per residue, depending on the common atom policy
+///
+/// If a score_common_coords_cache for this alignment and these proteins is active on the current thread,
+/// the common coordinates are only extracted the first time and then reused
 coord_list_coord_list_pair score_common_coord_handler::get_common_coords(const alignment &prm_alignment, ///< The pair alignment to be scored
                                                                          const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
                                                                          const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
                                                                          ) const {
+	score_common_coords_cache * const cache_ptr = score_common_coords_cache::get_active_cache_for( prm_alignment, prm_protein_a, prm_protein_b );
+	if ( cache_ptr != nullptr ) {
+		const auto * const cached_common_coords_ptr = cache_ptr->find_common_coords( *this );
+		return ( cached_common_coords_ptr != nullptr )
+			? *cached_common_coords_ptr
+			: cache_ptr->store_common_coords( *this, calc_common_coords( prm_alignment, prm_protein_a, prm_protein_b ) );
+	}
+	return calc_common_coords( prm_alignment, prm_protein_a, prm_protein_b );
+}
+
+/// \brief Extract the common coordinates between residues, as specified by the common_residue_selection_policy
+///        (without using any active score_common_coords_cache)
+///
+/// \copydetails get_common_coords()
+coord_list_coord_list_pair score_common_coord_handler::calc_common_coords(const alignment &prm_alignment, ///< The pair alignment to be scored
+                                                                          const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
+                                                                          const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
+                                                                          ) const {
 	// Extract the common coordinates to be chosen
 	const pair<coord_list, coord_list> common_coords = alignment_coord_extractor::get_common_coords(
 		prm_alignment,
@@ -140,10 +162,31 @@ coord_list_coord_list_pair score_common_coord_handler::get_common_coords(const a
 ///       else out_of_range_exception will be thrown
 ///
 /// Note that this may contain more than one coordinate pair per residue, depending on the common atom policy
+///
+/// If a score_common_coords_cache for this alignment and these proteins is active on the current thread,
+/// the common coordinates are only extracted the first time and then reused
 pair<coord_list_vec, coord_list_vec> score_common_coord_handler::get_common_coords_by_residue(const alignment &prm_alignment, ///< The pair alignment to be scored
                                                                                               const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
                                                                                               const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
                                                                                               ) const {
+	score_common_coords_cache * const cache_ptr = score_common_coords_cache::get_active_cache_for( prm_alignment, prm_protein_a, prm_protein_b );
+	if ( cache_ptr != nullptr ) {
+		const auto * const cached_common_coords_ptr = cache_ptr->find_common_coords_by_residue( *this );
+		return ( cached_common_coords_ptr != nullptr )
+			? *cached_common_coords_ptr
+			: cache_ptr->store_common_coords_by_residue( *this, calc_common_coords_by_residue( prm_alignment, prm_protein_a, prm_protein_b ) );
+	}
+	return calc_common_coords_by_residue( prm_alignment, prm_protein_a, prm_protein_b );
+}
+
+/// \brief Extract the common coordinates between residues, grouped by residue, as specified by the
+///        common_residue_selection_policy (without using any active score_common_coords_cache)
+///
+/// \copydetails get_common_coords_by_residue()
+pair<coord_list_vec, coord_list_vec> score_common_coord_handler::calc_common_coords_by_residue(const alignment &prm_alignment, ///< The pair alignment to be scored
+                                                                                               const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
+                                                                                               const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
+                                                                                               ) const {
 	// Extract the common coordinates to be chosen
 	const pair<coord_list_vec, coord_list_vec> common_coords = alignment_coord_extractor::get_common_coords_by_residue(
 		prm_alignment,
@@ -102,6 +102,14 @@ namespace cath {
 				const align::common_atom_selection_policy    & get_comm_atom_seln_pol() const;
 
 				str_str_pair get_policy_description_strings() const;
+
+				geom::coord_list_coord_list_pair calc_common_coords(const align::alignment &,
+				                                                    const protein &,
+				                                                    const protein &) const;
+
+				std::pair<cath::geom::coord_list_vec, cath::geom::coord_list_vec> calc_common_coords_by_residue(const align::alignment &,
+				                                                                                                const protein &,
+				                                                                                                const protein &) const;
 				
 			public:
 				score_common_coord_handler() = default;
@@ -0,0 +1,119 @@
+/// \file
+/// \brief The score_common_coords_cache class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "score_common_coords_cache.hpp"
+
+#include <boost/range/algorithm/find.hpp>
+
+#include "common/cpp14/cbegin_cend.hpp"
+#include "structure/geometry/coord.hpp"
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::geom;
+using namespace cath::score::detail;
+
+using boost::range::find;
+using std::move;
+
+/// \brief The cache that is active on the current thread (or nullptr)
+thread_local score_common_coords_cache * score_common_coords_cache::active_cache_ptr = nullptr;
+
+/// \brief Ctor from the alignment and proteins whose common coordinates should be cached, which activates
+///        the new cache on the current thread
+score_common_coords_cache::score_common_coords_cache(const alignment &prm_alignment, ///< The pair alignment whose common coordinates should be cached
+                                                     const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
+                                                     const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
+                                                     ) : the_alignment        { prm_alignment    },
+                                                         protein_a            { prm_protein_a    },
+                                                         protein_b            { prm_protein_b    },
+                                                         prev_active_cache_ptr{ active_cache_ptr } {
+	active_cache_ptr = this;
+}
+
+/// \brief Dtor, which re-activates whichever cache was active on this thread when this one was constructed
+score_common_coords_cache::~score_common_coords_cache() noexcept {
+	active_cache_ptr = prev_active_cache_ptr;
+}
+
+/// \brief Whether this cache is for the specified alignment and proteins (as identified by their addresses)
+bool score_common_coords_cache::is_for(const alignment &prm_alignment, ///< The pair alignment to check
+                                       const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
+                                       const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
+                                       ) const {
+	return (
+		&prm_alignment == &the_alignment
+		&&
+		&prm_protein_a == &protein_a
+		&&
+		&prm_protein_b == &protein_b
+	);
+}
+
+/// \brief Find the cached common coordinates for the specified handler, or nullptr if there aren't any
+const coord_list_coord_list_pair * score_common_coords_cache::find_common_coords(const score_common_coord_handler &prm_handler ///< The handler whose common coordinates should be found
+                                                                                 ) const {
+	const auto handler_itr = find( common_coords_handlers, prm_handler );
+	return ( handler_itr == common::cend( common_coords_handlers ) )
+		? nullptr
+		: &common_coords[ static_cast<size_t>( handler_itr - common::cbegin( common_coords_handlers ) ) ];
+}
+
+/// \brief Find the cached common coordinates by residue for the specified handler, or nullptr if there aren't any
+auto score_common_coords_cache::find_common_coords_by_residue(const score_common_coord_handler &prm_handler ///< The handler whose common coordinates by residue should be found
+                                                              ) const -> const coord_list_vec_pair * {
+	const auto handler_itr = find( common_coords_by_residue_handlers, prm_handler );
+	return ( handler_itr == common::cend( common_coords_by_residue_handlers ) )
+		? nullptr
+		: &common_coords_by_residue[ static_cast<size_t>( handler_itr - common::cbegin( common_coords_by_residue_handlers ) ) ];
+}
+
+/// \brief Store the specified common coordinates for the specified handler and return a reference to the stored copy
+///
+/// The reference remains valid until the next call to store_common_coords()
+const coord_list_coord_list_pair & score_common_coords_cache::store_common_coords(const score_common_coord_handler &prm_handler,      ///< The handler that extracted the common coordinates
+                                                                                  coord_list_coord_list_pair        prm_common_coords ///< The common coordinates to store
+                                                                                  ) {
+	common_coords_handlers.push_back( prm_handler                   );
+	common_coords.push_back         ( move( prm_common_coords )     );
+	return common_coords.back();
+}
+
+/// \brief Store the specified common coordinates by residue for the specified handler and return a reference to the stored copy
+///
+/// The reference remains valid until the next call to store_common_coords_by_residue()
+auto score_common_coords_cache::store_common_coords_by_residue(const score_common_coord_handler &prm_handler,      ///< The handler that extracted the common coordinates by residue
+                                                               coord_list_vec_pair               prm_common_coords ///< The common coordinates by residue to store
+                                                               ) -> const coord_list_vec_pair & {
+	common_coords_by_residue_handlers.push_back( prm_handler               );
+	common_coords_by_residue.push_back         ( move( prm_common_coords ) );
+	return common_coords_by_residue.back();
+}
+
+/// \brief Get the cache that's active on the current thread if it's for the specified alignment and proteins,
+///        or nullptr otherwise
+score_common_coords_cache * score_common_coords_cache::get_active_cache_for(const alignment &prm_alignment, ///< The pair alignment being scored
+                                                                            const protein   &prm_protein_a, ///< The protein associated with the first  half of the alignment
+                                                                            const protein   &prm_protein_b  ///< The protein associated with the second half of the alignment
+                                                                            ) {
+	return ( active_cache_ptr != nullptr && active_cache_ptr->is_for( prm_alignment, prm_protein_a, prm_protein_b ) )
+		? active_cache_ptr
+		: nullptr;
+}
@@ -0,0 +1,117 @@
+/// \file
+/// \brief The score_common_coords_cache class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_SCORE_ALIGNED_PAIR_SCORE_DETAIL_SCORE_COMMON_COORDS_CACHE_HPP
+#define _CATH_TOOLS_SOURCE_UNI_SCORE_ALIGNED_PAIR_SCORE_DETAIL_SCORE_COMMON_COORDS_CACHE_HPP
+
+#include "score/aligned_pair_score/detail/score_common_coord_handler.hpp"
+#include "score/score_type_aliases.hpp"
+#include "structure/geometry/coord_list.hpp"
+#include "structure/structure_type_aliases.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace cath { namespace align { class alignment; } }
+namespace cath { class protein; }
+
+namespace cath {
+	namespace score {
+		namespace detail {
+
+			/// \brief Cache the common coordinates that score_common_coord_handler extracts from one alignment
+			///        and its pair of proteins so that the many scores of an aligned_pair_score_list
+			///        that use the same selection policies don't each re-extract them
+			///
+			/// Constructing a score_common_coords_cache activates it on the current thread until it's destroyed
+			/// (at which point any previously active cache is re-activated). Whilst it's active,
+			/// score_common_coord_handler::get_common_coords() and score_common_coord_handler::get_common_coords_by_residue()
+			/// use it for calls on the cache's alignment and proteins (identified by address).
+			///
+			/// \pre The alignment and proteins must outlive the score_common_coords_cache and mustn't be modified
+			///      whilst it's active
+			///
+			/// Each thread has its own active cache so concurrent scoring on separate threads is unaffected.
+			class score_common_coords_cache final {
+			public:
+				/// \brief The type of common coordinates by residue, as returned by score_common_coord_handler::get_common_coords_by_residue()
+				using coord_list_vec_pair = std::pair<geom::coord_list_vec, geom::coord_list_vec>;
+
+			private:
+				/// \brief The alignment whose common coordinates are cached
+				const align::alignment &the_alignment;
+
+				/// \brief The protein associated with the first  half of the alignment
+				const protein          &protein_a;
+
+				/// \brief The protein associated with the second half of the alignment
+				const protein          &protein_b;
+
+				/// \brief The handlers whose common coordinates have been cached in common_coords
+				///
+				/// Score lists only use a handful of distinct handlers so these are just searched linearly
+				score_common_coord_handler_vec                 common_coords_handlers;
+
+				/// \brief The common coordinates of each of the handlers in common_coords_handlers
+				std::vector<geom::coord_list_coord_list_pair>  common_coords;
+
+				/// \brief The handlers whose common coordinates by residue have been cached in common_coords_by_residue
+				score_common_coord_handler_vec                 common_coords_by_residue_handlers;
+
+				/// \brief The common coordinates by residue of each of the handlers in common_coords_by_residue_handlers
+				std::vector<coord_list_vec_pair>               common_coords_by_residue;
+
+				/// \brief The cache that was active on this thread when this one was constructed (or nullptr)
+				score_common_coords_cache                     *prev_active_cache_ptr;
+
+				/// \brief The cache that is active on the current thread (or nullptr)
+				static thread_local score_common_coords_cache *active_cache_ptr;
+
+			public:
+				score_common_coords_cache(const align::alignment &,
+				                          const protein &,
+				                          const protein &);
+				~score_common_coords_cache() noexcept;
+
+				score_common_coords_cache(const score_common_coords_cache &) = delete;
+				score_common_coords_cache & operator=(const score_common_coords_cache &) = delete;
+
+				bool is_for(const align::alignment &,
+				            const protein &,
+				            const protein &) const;
+
+				const geom::coord_list_coord_list_pair * find_common_coords(const score_common_coord_handler &) const;
+				const coord_list_vec_pair * find_common_coords_by_residue(const score_common_coord_handler &) const;
+
+				const geom::coord_list_coord_list_pair & store_common_coords(const score_common_coord_handler &,
+				                                                             geom::coord_list_coord_list_pair);
+				const coord_list_vec_pair & store_common_coords_by_residue(const score_common_coord_handler &,
+				                                                           coord_list_vec_pair);
+
+				static score_common_coords_cache * get_active_cache_for(const align::alignment &,
+				                                                        const protein &,
+				                                                        const protein &);
+			};
+
+		} // namespace detail
+	} // namespace score
+} // namespace cath
+
+#endif
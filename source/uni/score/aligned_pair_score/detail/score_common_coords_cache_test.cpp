@@ -0,0 +1,142 @@
+/// \file
+/// \brief The score_common_coords_cache test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "score_common_coords_cache.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include "alignment/alignment.hpp"
+#include "alignment/common_atom_selection_policy/common_atom_select_ca_policy.hpp"
+#include "alignment/common_residue_selection_policy/common_residue_select_best_score_percent_policy.hpp"
+#include "alignment/common_residue_selection_policy/common_residue_select_min_score_policy.hpp"
+#include "alignment/residue_score/residue_scorer.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/protein_list.hpp"
+#include "structure/protein/protein_source_file_set/protein_from_pdb.hpp"
+#include "structure/protein/residue.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <sstream>
+#include <utility>
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::common;
+using namespace cath::geom;
+using namespace cath::score::detail;
+
+using boost::filesystem::path;
+using std::make_pair;
+using std::ostringstream;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The score_common_coords_cache_test_suite_fixture to assist in testing score_common_coords_cache
+		struct score_common_coords_cache_test_suite_fixture : protected global_test_constants {
+		protected:
+			~score_common_coords_cache_test_suite_fixture() noexcept = default;
+
+			/// \brief The directory containing the example proteins and alignment
+			const path data_dir = TEST_SOURCE_DATA_DIR() / "aligned_pair_score";
+
+			/// \brief A pair of example proteins
+			const protein_list proteins = make_protein_list( {
+				read_protein_from_files( protein_from_pdb(), data_dir, "1c55A" ),
+				read_protein_from_files( protein_from_pdb(), data_dir, "1c56A" )
+			} );
+
+			/// \brief An example alignment between the pair of proteins
+			const alignment the_alignment = [&] {
+				ostringstream warnings_ss;
+				return read_and_rescore_fasta_alignment( data_dir / "1c55A_1c56A.aln.fa", proteins, residue_scorer(), warnings_ss );
+			} ();
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(score_common_coords_cache_test_suite, cath::test::score_common_coords_cache_test_suite_fixture)
+
+/// \brief Check that a cache is only active within its scope (and only for its own alignment and proteins)
+///        and that a nested cache re-activates the outer one when it's destroyed
+BOOST_AUTO_TEST_CASE(is_only_active_within_scope_and_nests) {
+	BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 0 ], proteins[ 1 ] ) == nullptr );
+	{
+		score_common_coords_cache outer_cache{ the_alignment, proteins[ 0 ], proteins[ 1 ] };
+		BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 0 ], proteins[ 1 ] ) == &outer_cache );
+		BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 1 ], proteins[ 0 ] ) == nullptr      );
+		{
+			score_common_coords_cache inner_cache{ the_alignment, proteins[ 0 ], proteins[ 1 ] };
+			BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 0 ], proteins[ 1 ] ) == &inner_cache );
+		}
+		BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 0 ], proteins[ 1 ] ) == &outer_cache );
+	}
+	BOOST_CHECK( score_common_coords_cache::get_active_cache_for( the_alignment, proteins[ 0 ], proteins[ 1 ] ) == nullptr );
+}
+
+/// \brief Check that, for every handler, the common coordinates from an active cache match those extracted without one
+///        and that the cache stores them on first use
+BOOST_AUTO_TEST_CASE(cached_common_coords_match_uncached) {
+	for (const score_common_coord_handler &handler : get_all_score_common_coord_handlers() ) {
+		const auto uncached_coords        = handler.get_common_coords           ( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+		const auto uncached_coords_by_res = handler.get_common_coords_by_residue( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+
+		const score_common_coords_cache the_cache{ the_alignment, proteins[ 0 ], proteins[ 1 ] };
+		BOOST_CHECK( the_cache.find_common_coords           ( handler ) == nullptr );
+		BOOST_CHECK( the_cache.find_common_coords_by_residue( handler ) == nullptr );
+		for (size_t call_ctr = 0; call_ctr < 2; ++call_ctr) {
+			const auto cached_coords        = handler.get_common_coords           ( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+			const auto cached_coords_by_res = handler.get_common_coords_by_residue( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+			BOOST_CHECK_EQUAL_RANGES( cached_coords.first,  uncached_coords.first  );
+			BOOST_CHECK_EQUAL_RANGES( cached_coords.second, uncached_coords.second );
+			BOOST_CHECK_EQUAL_RANGES( flatten_coord_lists( cached_coords_by_res.first  ), flatten_coord_lists( uncached_coords_by_res.first  ) );
+			BOOST_CHECK_EQUAL_RANGES( flatten_coord_lists( cached_coords_by_res.second ), flatten_coord_lists( uncached_coords_by_res.second ) );
+		}
+		BOOST_CHECK( the_cache.find_common_coords           ( handler ) != nullptr );
+		BOOST_CHECK( the_cache.find_common_coords_by_residue( handler ) != nullptr );
+	}
+}
+
+/// \brief Check that handlers that only differ in their residue selection policy's parameter get their own cache entries
+BOOST_AUTO_TEST_CASE(caches_handlers_with_different_cutoffs_separately) {
+	for (const auto &handler_pair : { make_pair( score_common_coord_handler{ common_residue_select_min_score_policy        {  0.0 }, common_atom_select_ca_policy{} },
+	                                             score_common_coord_handler{ common_residue_select_min_score_policy        { 90.0 }, common_atom_select_ca_policy{} } ),
+	                                  make_pair( score_common_coord_handler{ common_residue_select_best_score_percent_policy{ 30.0 }, common_atom_select_ca_policy{} },
+	                                             score_common_coord_handler{ common_residue_select_best_score_percent_policy{ 90.0 }, common_atom_select_ca_policy{} } ) } ) {
+		const score_common_coord_handler &handler_a = handler_pair.first;
+		const score_common_coord_handler &handler_b = handler_pair.second;
+		const auto uncached_coords_a = handler_a.get_common_coords( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+		const auto uncached_coords_b = handler_b.get_common_coords( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+		BOOST_REQUIRE_NE( uncached_coords_a.first.size(), uncached_coords_b.first.size() );
+
+		const score_common_coords_cache the_cache{ the_alignment, proteins[ 0 ], proteins[ 1 ] };
+		const auto cached_coords_a = handler_a.get_common_coords( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+		BOOST_CHECK( the_cache.find_common_coords( handler_b ) == nullptr );
+		const auto cached_coords_b = handler_b.get_common_coords( the_alignment, proteins[ 0 ], proteins[ 1 ] );
+		BOOST_CHECK_EQUAL_RANGES( cached_coords_a.first, uncached_coords_a.first );
+		BOOST_CHECK_EQUAL_RANGES( cached_coords_b.first, uncached_coords_b.first );
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
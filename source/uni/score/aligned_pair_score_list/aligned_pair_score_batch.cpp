@@ -0,0 +1,399 @@
+/// \file
+/// \brief The aligned_pair_score_batch definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "aligned_pair_score_batch.hpp"
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/range/algorithm/lower_bound.hpp>
+#include <boost/range/irange.hpp>
+
+#include "alignment/alignment.hpp"
+#include "alignment/residue_score/residue_scorer.hpp"
+#include "common/algorithm/sort_uniq_copy.hpp"
+#include "common/algorithm/transform_build.hpp"
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/cpp14/cbegin_cend.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/file/open_fstream.hpp"
+#include "common/size_t_literal.hpp"
+#include "file/name_set/name_set.hpp"
+#include "file/pdb/pdb.hpp"
+#include "score/aligned_pair_score/aligned_pair_score.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_list.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_value_list.hpp"
+#include "structure/protein/residue.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <sstream>
+#include <string>
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::score;
+
+using boost::algorithm::is_space;
+using boost::algorithm::replace_all_copy;
+using boost::algorithm::split;
+using boost::algorithm::token_compress_on;
+using boost::algorithm::trim_copy;
+using boost::filesystem::path;
+using boost::irange;
+using boost::lexical_cast;
+using boost::range::lower_bound;
+using std::cref;
+using std::deque;
+using std::future;
+using std::ifstream;
+using std::istream;
+using std::min;
+using std::ostream;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+namespace cath {
+	namespace score {
+		namespace detail {
+
+			/// \brief The result of loading one of the structure files of a batch
+			struct aligned_pair_score_batch_load_result final {
+				/// \brief The protein that was loaded (or a default protein if loading failed)
+				protein the_protein;
+
+				/// \brief The error message from loading the file (or an empty string if loading succeeded)
+				string  error_message;
+
+				/// \brief Any warnings that arose from building the protein
+				string  warnings;
+			};
+
+			/// \brief The result of scoring one of the entries of a batch
+			struct aligned_pair_score_batch_result final {
+				/// \brief Whether the entry was scored successfully
+				bool     succeeded = false;
+
+				/// \brief The value of each of the scores (or empty if scoring failed)
+				doub_vec values;
+
+				/// \brief A description of the error (on failure) or of the result (on success)
+				string   message;
+			};
+
+			/// \brief Type alias for a vector of aligned_pair_score_batch_load_result objects
+			using aligned_pair_score_batch_load_result_vec = vector<aligned_pair_score_batch_load_result>;
+
+			/// \brief Type alias for a vector of aligned_pair_score_batch_result objects
+			using aligned_pair_score_batch_result_vec = vector<aligned_pair_score_batch_result>;
+
+			/// \brief Perform the specified task on consecutive ranges of up to prm_items_per_task of the items
+			///        and pass each range's results to the specified processor in order
+			///
+			/// If there are multiple threads, up to prm_num_threads tasks are in flight at once. The oldest
+			/// task's results are always processed first so the processing order matches the order of the items
+			/// (and is the same as with a single thread).
+			template <typename TASK, typename PROC>
+			void process_in_ordered_tasks(const size_t &prm_num_items,      ///< The number of items
+			                              const size_t &prm_items_per_task, ///< The maximum number of items to process in each task
+			                              const size_t &prm_num_threads,    ///< The maximum number of threads with which to perform the tasks
+			                              TASK          prm_task,           ///< The task, which should take the begin and end indices of the items and return a vector of results
+			                              PROC          prm_processor       ///< The processor, which is called with each of the task's results in order
+			                              ) {
+				using result_vec_type = decltype( prm_task( 0_z, 0_z ) );
+				deque<future<result_vec_type>> result_futures;
+				for (size_t begin = 0; begin < prm_num_items; begin += prm_items_per_task) {
+					const size_t end = min( prm_num_items, begin + prm_items_per_task );
+					if ( prm_num_threads <= 1 ) {
+						prm_processor( prm_task( begin, end ) );
+						continue;
+					}
+					if ( result_futures.size() >= prm_num_threads ) {
+						prm_processor( result_futures.front().get() );
+						result_futures.pop_front();
+					}
+					result_futures.push_back( std::async(
+						std::launch::async,
+						[&, begin, end] { return prm_task( begin, end ); }
+					) );
+				}
+				while ( ! result_futures.empty() ) {
+					prm_processor( result_futures.front().get() );
+					result_futures.pop_front();
+				}
+			}
+
+			/// \brief Load the specified structure file for a batch, catching any exception and recording it in the result
+			///
+			/// Each file is read with a single thread because the batch's threads are better spent reading different files
+			inline aligned_pair_score_batch_load_result load_aligned_pair_score_batch_file(const path &prm_file ///< The structure file to load
+			                                                                               ) {
+				aligned_pair_score_batch_load_result result;
+				try {
+					pdb the_pdb;
+					the_pdb.read_file( prm_file, 1 );
+					ostringstream warnings_ss;
+					result.the_protein = build_protein_of_pdb_and_name( the_pdb, name_set{ prm_file }, ostream_ref{ warnings_ss } );
+					result.warnings    = warnings_ss.str();
+				}
+				catch (const std::exception &ex) {
+					result.error_message = "Unable to load structure file \"" + prm_file.string() + "\" : " + ex.what();
+				}
+				return result;
+			}
+
+			/// \brief Score the specified entry of a batch with the specified scores, catching any exception
+			///        and recording it in the result
+			///
+			/// As in cath-score-align's handling of a single FASTA alignment, the alignment is
+			/// read by order (not by name) and then scored with the residue_scorer.
+			///
+			/// The proteins are used directly from the cache (without being copied) and any warnings
+			/// from reading the alignment are appended to the result's message
+			inline aligned_pair_score_batch_result score_aligned_pair_batch_entry(const aligned_pair_score_batch_entry         &prm_entry,         ///< The entry to score
+			                                                                      const aligned_pair_score_batch_protein_cache &prm_protein_cache, ///< The cache of the batch's proteins
+			                                                                      const aligned_pair_score_list                &prm_scores         ///< The scores to calculate
+			                                                                      ) {
+				ostringstream warnings_ss;
+				try {
+					const protein_cref_vec proteins{
+						cref( prm_protein_cache.get_protein( prm_entry.pdb_file_a ) ),
+						cref( prm_protein_cache.get_protein( prm_entry.pdb_file_b ) )
+					};
+
+					const alignment the_alignment = read_and_rescore_fasta_alignment(
+						prm_entry.alignment_file,
+						proteins,
+						residue_scorer(),
+						warnings_ss
+					);
+					const aligned_pair_score_value_list score_values = make_aligned_pair_score_value_list(
+						prm_scores,
+						the_alignment,
+						proteins[ 0 ].get(),
+						proteins[ 1 ].get()
+					);
+					return {
+						true,
+						transform_build<doub_vec>(
+							indices( score_values.size() ),
+							[&] (const size_t &x) { return score_values.get_value_of_index( x ); }
+						),
+						warnings_ss.str().empty() ? "scored successfully"
+						                          : "scored successfully with warnings : " + warnings_ss.str()
+					};
+				}
+				catch (const std::exception &ex) {
+					return {
+						false,
+						{},
+						warnings_ss.str().empty() ? string{ ex.what() }
+						                          : ex.what() + string{ " (after warnings : " } + warnings_ss.str() + ")"
+					};
+				}
+			}
+
+		} // namespace detail
+	} // namespace score
+} // namespace cath
+
+/// \brief Ctor that loads each of the distinct structure files of the specified batch
+///
+/// Any warnings from building the proteins are written to the specified ostream in the order of the (sorted) files
+aligned_pair_score_batch_protein_cache::aligned_pair_score_batch_protein_cache(const aligned_pair_score_batch_entry_vec &prm_entries,    ///< The entries of the batch whose structure files should be loaded
+                                                                               ostream                                  &prm_stderr,     ///< The ostream to which any warnings should be written
+                                                                               const size_t                             &prm_num_threads ///< The maximum number of threads with which to load the files
+                                                                               ) {
+	files.reserve( 2 * prm_entries.size() );
+	for (const aligned_pair_score_batch_entry &entry : prm_entries) {
+		files.push_back( entry.pdb_file_a );
+		files.push_back( entry.pdb_file_b );
+	}
+	sort_uniq( files );
+
+	const size_t num_files = files.size();
+	proteins.reserve      ( num_files );
+	error_messages.reserve( num_files );
+	detail::process_in_ordered_tasks(
+		num_files,
+		ALIGNED_PAIR_SCORE_BATCH_ENTRIES_PER_TASK,
+		prm_num_threads,
+		[&] (const size_t &prm_begin, const size_t &prm_end) {
+			return transform_build<detail::aligned_pair_score_batch_load_result_vec>(
+				irange( prm_begin, prm_end ),
+				[&] (const size_t &x) { return detail::load_aligned_pair_score_batch_file( files[ x ] ); }
+			);
+		},
+		[&] (detail::aligned_pair_score_batch_load_result_vec &&prm_results) {
+			for (detail::aligned_pair_score_batch_load_result &result : prm_results) {
+				prm_stderr << result.warnings;
+				proteins.push_back      ( std::move( result.the_protein   ) );
+				error_messages.push_back( std::move( result.error_message ) );
+			}
+		}
+	);
+}
+
+/// \brief Get the number of distinct structure files in the cache
+size_t aligned_pair_score_batch_protein_cache::size() const {
+	return files.size();
+}
+
+/// \brief Get the protein loaded from the specified structure file
+///
+/// \throws invalid_argument_exception if the file isn't one of the cache's files
+///         or runtime_error_exception if the file failed to load
+const protein & aligned_pair_score_batch_protein_cache::get_protein(const path &prm_file ///< The structure file whose protein should be returned
+                                                                    ) const {
+	const auto file_itr = lower_bound( files, prm_file );
+	if ( file_itr == common::cend( files ) || *file_itr != prm_file ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception(
+			"Structure file \"" + prm_file.string() + "\" isn't in the batch's cache of proteins"
+		));
+	}
+	const auto index = static_cast<size_t>( file_itr - common::cbegin( files ) );
+	if ( ! error_messages[ index ].empty() ) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception( error_messages[ index ] ));
+	}
+	return proteins[ index ];
+}
+
+/// \brief Read a manifest of alignments to score in a batch from the specified istream
+///
+/// Each line should contain three whitespace-separated fields: the first structure file, the second
+/// structure file and the FASTA alignment file between them. Leading/trailing whitespace is ignored,
+/// as are empty lines and lines beginning with '#'.
+///
+/// \throws runtime_error_exception if any other line doesn't contain exactly three fields
+aligned_pair_score_batch_entry_vec cath::score::read_aligned_pair_score_batch_manifest(istream &prm_istream ///< The istream from which to read the manifest
+                                                                                       ) {
+	aligned_pair_score_batch_entry_vec entries;
+	string line_string;
+	str_vec fields;
+	size_t line_ctr = 0;
+	while ( getline( prm_istream, line_string ) ) {
+		++line_ctr;
+		const string trimmed_line_string = trim_copy( line_string );
+		if ( trimmed_line_string.empty() || trimmed_line_string.front() == '#' ) {
+			continue;
+		}
+		split( fields, trimmed_line_string, is_space(), token_compress_on );
+		if ( fields.size() != 3 ) {
+			BOOST_THROW_EXCEPTION(runtime_error_exception(
+				"Line "
+				+ lexical_cast<string>( line_ctr )
+				+ " of the alignment batch manifest contains "
+				+ lexical_cast<string>( fields.size() )
+				+ " fields but should contain 3 (structure file, structure file, FASTA alignment file)"
+			));
+		}
+		entries.push_back( { fields[ 0 ], fields[ 1 ], fields[ 2 ] } );
+	}
+	return entries;
+}
+
+/// \brief Read a manifest of alignments to score in a batch from the specified file
+///
+/// \copydetails read_aligned_pair_score_batch_manifest(istream &)
+aligned_pair_score_batch_entry_vec cath::score::read_aligned_pair_score_batch_manifest(const path &prm_manifest_file ///< The manifest file to read
+                                                                                       ) {
+	ifstream manifest_ifstream;
+	open_ifstream( manifest_ifstream, prm_manifest_file );
+	const aligned_pair_score_batch_entry_vec entries = read_aligned_pair_score_batch_manifest( manifest_ifstream );
+	manifest_ifstream.close();
+	return entries;
+}
+
+/// \brief Score each of the specified entries with the specified scores, streaming a report to the specified ostream
+///        and return the number of entries that failed
+///
+/// Each distinct structure file is loaded once (see aligned_pair_score_batch_protein_cache) and then shared by all
+/// the entries that use it. A failure to score one entry doesn't stop the others being scored.
+///
+/// The report is tab-separated: a header line (starting with '#') of the column names and then one line per entry of:
+/// the three files, OK/ERROR, the value of each score (empty on ERROR) and a message.
+///
+/// If there are multiple threads, the entries are scored in tasks of up to ALIGNED_PAIR_SCORE_BATCH_ENTRIES_PER_TASK
+/// entries, with up to prm_num_threads tasks in flight at once. The oldest task's results are always written first
+/// so the report's order always matches the order of the entries.
+size_t cath::score::score_aligned_pair_batch(const aligned_pair_score_batch_entry_vec &prm_entries,    ///< The entries to score
+                                             const aligned_pair_score_list            &prm_scores,     ///< The scores to calculate for each entry
+                                             ostream                                  &prm_report,     ///< The ostream to which the report should be written
+                                             ostream                                  &prm_stderr,     ///< The ostream to which any warnings should be written
+                                             const size_t                             &prm_num_threads ///< The maximum number of threads with which to score the entries
+                                             ) {
+	const aligned_pair_score_batch_protein_cache protein_cache{ prm_entries, prm_stderr, prm_num_threads };
+
+	const auto clean_field = [] (const string &x) {
+		return replace_all_copy( replace_all_copy( x, "\n", " " ), "\t", " " );
+	};
+
+	const size_t num_scores = prm_scores.size();
+	prm_report << "#pdb_file_a\tpdb_file_b\talignment_file\tstatus";
+	for (const size_t &score_ctr : indices( num_scores ) ) {
+		prm_report << "\t" << clean_field( prm_scores[ score_ctr ].human_friendly_short_name() );
+	}
+	prm_report << "\tmessage\n";
+
+	size_t num_failed = 0;
+	detail::process_in_ordered_tasks(
+		prm_entries.size(),
+		ALIGNED_PAIR_SCORE_BATCH_ENTRIES_PER_TASK,
+		prm_num_threads,
+		[&] (const size_t &prm_begin, const size_t &prm_end) {
+			return transform_build<detail::aligned_pair_score_batch_result_vec>(
+				irange( prm_begin, prm_end ),
+				[&] (const size_t &x) { return detail::score_aligned_pair_batch_entry( prm_entries[ x ], protein_cache, prm_scores ); }
+			);
+		},
+		[&, entry_ctr = 0_z] (const detail::aligned_pair_score_batch_result_vec &prm_results) mutable {
+			for (const detail::aligned_pair_score_batch_result &result : prm_results) {
+				const aligned_pair_score_batch_entry &entry = prm_entries[ entry_ctr++ ];
+				prm_report << clean_field( entry.pdb_file_a.string()     )
+				   << "\t" << clean_field( entry.pdb_file_b.string()     )
+				   << "\t" << clean_field( entry.alignment_file.string() )
+				   << "\t" << ( result.succeeded ? "OK" : "ERROR" );
+				for (const size_t &score_ctr : indices( num_scores ) ) {
+					prm_report << "\t";
+					if ( result.succeeded ) {
+						prm_report << result.values[ score_ctr ];
+					}
+				}
+				prm_report << "\t" << clean_field( result.message ) << "\n";
+				if ( ! result.succeeded ) {
+					++num_failed;
+				}
+			}
+			prm_report.flush();
+		}
+	);
+	return num_failed;
+}
@@ -0,0 +1,100 @@
+/// \file
+/// \brief The aligned_pair_score_batch header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_SCORE_ALIGNED_PAIR_SCORE_LIST_ALIGNED_PAIR_SCORE_BATCH_HPP
+#define _CATH_TOOLS_SOURCE_UNI_SCORE_ALIGNED_PAIR_SCORE_LIST_ALIGNED_PAIR_SCORE_BATCH_HPP
+
+#include <boost/filesystem/path.hpp>
+
+#include "common/path_type_aliases.hpp"
+#include "common/type_aliases.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/structure_type_aliases.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace cath { namespace score { class aligned_pair_score_list; } }
+
+namespace cath {
+	namespace score {
+
+		/// \brief One entry of a batch of alignments to score: a pair of structure files and a FASTA alignment between them
+		struct aligned_pair_score_batch_entry final {
+			/// \brief The structure file of the first  entry of the alignment
+			boost::filesystem::path pdb_file_a;
+
+			/// \brief The structure file of the second entry of the alignment
+			boost::filesystem::path pdb_file_b;
+
+			/// \brief The FASTA alignment file
+			boost::filesystem::path alignment_file;
+		};
+
+		/// \brief Type alias for a vector of aligned_pair_score_batch_entry objects
+		using aligned_pair_score_batch_entry_vec = std::vector<aligned_pair_score_batch_entry>;
+
+		/// \brief The number of entries that each task scores in a batch that's scored with multiple threads
+		///
+		/// As with PDB_BATCH_FILES_PER_TASK, this amortises the cost of launching each task whilst
+		/// keeping the in-flight results small enough to stream the report
+		constexpr size_t ALIGNED_PAIR_SCORE_BATCH_ENTRIES_PER_TASK = 16;
+
+		/// \brief Load each of the distinct structure files of a batch once so that all the batch's entries can share them
+		///
+		/// A file that fails to load doesn't prevent the others from loading; the error is recorded and
+		/// rethrown by get_protein() so that only the entries that use that file fail.
+		///
+		/// Once constructed, this is only read so it can be shared between threads
+		class aligned_pair_score_batch_protein_cache final {
+		private:
+			/// \brief The distinct structure files, sorted
+			path_vec    files;
+
+			/// \brief The protein loaded from each of the files (or a default protein if loading failed)
+			protein_vec proteins;
+
+			/// \brief The error message from loading each of the files (or an empty string if loading succeeded)
+			str_vec     error_messages;
+
+		public:
+			aligned_pair_score_batch_protein_cache(const aligned_pair_score_batch_entry_vec &,
+			                                       std::ostream &,
+			                                       const size_t & = 1);
+
+			size_t size() const;
+
+			const protein & get_protein(const boost::filesystem::path &) const;
+		};
+
+		aligned_pair_score_batch_entry_vec read_aligned_pair_score_batch_manifest(std::istream &);
+		aligned_pair_score_batch_entry_vec read_aligned_pair_score_batch_manifest(const boost::filesystem::path &);
+
+		size_t score_aligned_pair_batch(const aligned_pair_score_batch_entry_vec &,
+		                                const aligned_pair_score_list &,
+		                                std::ostream &,
+		                                std::ostream &,
+		                                const size_t & = 1);
+
+	} // namespace score
+} // namespace cath
+
+#endif
@@ -0,0 +1,202 @@
+/// \file
+/// \brief The aligned_pair_score_batch test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/test/auto_unit_test.hpp>
+
+#include "alignment/alignment.hpp"
+#include "alignment/residue_score/residue_scorer.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/exception/runtime_error_exception.hpp"
+#include "common/size_t_literal.hpp"
+#include "file/name_set/name_set.hpp"
+#include "file/pdb/pdb.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_batch.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_list.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_list_factory.hpp"
+#include "score/aligned_pair_score_list/aligned_pair_score_value_list.hpp"
+#include "structure/protein/protein_list.hpp"
+#include "structure/protein/residue.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <sstream>
+
+using namespace cath;
+using namespace cath::align;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::score;
+
+using boost::algorithm::is_any_of;
+using boost::algorithm::split;
+using boost::filesystem::path;
+using std::istringstream;
+using std::ostringstream;
+using std::string;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The aligned_pair_score_batch_test_suite_fixture to assist in testing aligned_pair_score_batch
+		struct aligned_pair_score_batch_test_suite_fixture : protected global_test_constants {
+		protected:
+			~aligned_pair_score_batch_test_suite_fixture() noexcept = default;
+
+			/// \brief The directory containing the example proteins and alignments
+			const path data_dir = TEST_SOURCE_DATA_DIR() / "aligned_pair_score";
+
+			/// \brief Make an entry for the alignment between the two specified example proteins
+			aligned_pair_score_batch_entry make_entry(const string &prm_id_a, ///< The ID of the first  example protein
+			                                          const string &prm_id_b  ///< The ID of the second example protein
+			                                          ) const {
+				return { data_dir / prm_id_a, data_dir / prm_id_b, data_dir / ( prm_id_a + "_" + prm_id_b + ".aln.fa" ) };
+			}
+
+			/// \brief Score the alignment between the two specified example proteins directly (without a batch)
+			///        and return the values formatted as they are in a batch's report
+			str_vec directly_scored_values(const string &prm_id_a, ///< The ID of the first  example protein
+			                               const string &prm_id_b  ///< The ID of the second example protein
+			                               ) const {
+				const aligned_pair_score_batch_entry entry = make_entry( prm_id_a, prm_id_b );
+				const protein_list proteins = make_protein_list( {
+					build_protein_of_pdb_and_name( read_pdb_file( entry.pdb_file_a ), name_set{ entry.pdb_file_a } ),
+					build_protein_of_pdb_and_name( read_pdb_file( entry.pdb_file_b ), name_set{ entry.pdb_file_b } )
+				} );
+				ostringstream warnings_ss;
+				const alignment the_alignment = read_and_rescore_fasta_alignment( entry.alignment_file, proteins, residue_scorer(), warnings_ss );
+				const aligned_pair_score_value_list score_values = make_aligned_pair_score_value_list(
+					make_default_aligned_pair_score_list(),
+					the_alignment,
+					proteins[ 0 ],
+					proteins[ 1 ]
+				);
+				str_vec values;
+				for (size_t score_ctr = 0; score_ctr < score_values.size(); ++score_ctr) {
+					ostringstream value_ss;
+					value_ss << score_values.get_value_of_index( score_ctr );
+					values.push_back( value_ss.str() );
+				}
+				return values;
+			}
+
+			/// \brief Split the specified report into its lines, each split into its tab-separated fields
+			static str_vec_vec report_fields(const string &prm_report ///< The report to split
+			                                 ) {
+				str_vec lines;
+				split( lines, prm_report, is_any_of( "\n" ) );
+				str_vec_vec fields;
+				for (const string &line : lines) {
+					if ( ! line.empty() ) {
+						fields.emplace_back();
+						split( fields.back(), line, is_any_of( "\t" ) );
+					}
+				}
+				return fields;
+			}
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(aligned_pair_score_batch_test_suite, cath::test::aligned_pair_score_batch_test_suite_fixture)
+
+/// \brief Check that a manifest is read correctly, ignoring blank lines, comments and surrounding whitespace
+BOOST_AUTO_TEST_CASE(reads_manifest) {
+	istringstream manifest_ss{ "# a comment\n\n  a.pdb \t b.pdb   a_b.fa  \nc d e\n" };
+	const aligned_pair_score_batch_entry_vec entries = read_aligned_pair_score_batch_manifest( manifest_ss );
+	BOOST_REQUIRE_EQUAL( entries.size(), 2_z );
+	BOOST_CHECK_EQUAL( entries[ 0 ].pdb_file_a,     path( "a.pdb"  ) );
+	BOOST_CHECK_EQUAL( entries[ 0 ].pdb_file_b,     path( "b.pdb"  ) );
+	BOOST_CHECK_EQUAL( entries[ 0 ].alignment_file, path( "a_b.fa" ) );
+	BOOST_CHECK_EQUAL( entries[ 1 ].alignment_file, path( "e"      ) );
+}
+
+/// \brief Check that a manifest line without exactly three fields is rejected
+BOOST_AUTO_TEST_CASE(rejects_manifest_line_with_wrong_num_fields) {
+	istringstream too_few_ss { "a.pdb b.pdb\n"           };
+	istringstream too_many_ss{ "a.pdb b.pdb a_b.fa x\n"  };
+	BOOST_CHECK_THROW( read_aligned_pair_score_batch_manifest( too_few_ss  ), runtime_error_exception );
+	BOOST_CHECK_THROW( read_aligned_pair_score_batch_manifest( too_many_ss ), runtime_error_exception );
+}
+
+/// \brief Check that the protein cache loads each distinct file once and records failures against only that file
+BOOST_AUTO_TEST_CASE(protein_cache_loads_each_distinct_file_once) {
+	aligned_pair_score_batch_entry_vec entries{ make_entry( "1c55A", "1c56A" ), make_entry( "1c55A", "1hykA" ) };
+	entries.push_back( { data_dir / "1c55A", NONEXISTENT_FILE(), data_dir / "1c55A_1c56A.aln.fa" } );
+
+	ostringstream warnings_ss;
+	const aligned_pair_score_batch_protein_cache the_cache{ entries, warnings_ss, 2 };
+	BOOST_CHECK_EQUAL( the_cache.size(), 4_z );
+	BOOST_CHECK_GT   ( the_cache.get_protein( data_dir / "1c56A" ).get_length(), 0_z );
+	BOOST_CHECK_THROW( the_cache.get_protein( NONEXISTENT_FILE()  ), runtime_error_exception );
+	BOOST_CHECK_THROW( the_cache.get_protein( data_dir / "1wmtA"  ), invalid_argument_exception );
+}
+
+/// \brief Check that a batch's scores match those calculated directly and that failing entries are reported
+///        without stopping the others
+BOOST_AUTO_TEST_CASE(scores_match_direct_scoring_and_failures_are_reported) {
+	const aligned_pair_score_batch_entry_vec entries{
+		make_entry( "1c55A", "1c56A" ),
+		{ data_dir / "1c55A", data_dir / "1c56A", NONEXISTENT_FILE() },
+		make_entry( "1c55A", "1hykA" ),
+		{ data_dir / "1c55A", NONEXISTENT_FILE(), data_dir / "1c55A_1c56A.aln.fa" },
+	};
+	ostringstream report_ss;
+	ostringstream warnings_ss;
+	const size_t num_failed = score_aligned_pair_batch( entries, make_default_aligned_pair_score_list(), report_ss, warnings_ss );
+	BOOST_CHECK_EQUAL( num_failed, 2_z );
+
+	const str_vec_vec fields     = report_fields( report_ss.str() );
+	const size_t      num_scores = make_default_aligned_pair_score_list().size();
+	BOOST_REQUIRE_EQUAL( fields.size(), 5_z );
+	for (const str_vec &line_fields : fields) {
+		BOOST_CHECK_EQUAL( line_fields.size(), num_scores + 5 );
+	}
+	BOOST_CHECK_EQUAL( fields[ 1 ][ 3 ], "OK"    );
+	BOOST_CHECK_EQUAL( fields[ 2 ][ 3 ], "ERROR" );
+	BOOST_CHECK_EQUAL( fields[ 3 ][ 3 ], "OK"    );
+	BOOST_CHECK_EQUAL( fields[ 4 ][ 3 ], "ERROR" );
+
+	const str_vec values_1c55A_1c56A = directly_scored_values( "1c55A", "1c56A" );
+	const str_vec values_1c55A_1hykA = directly_scored_values( "1c55A", "1hykA" );
+	BOOST_CHECK_EQUAL_COLLECTIONS( fields[ 1 ].begin() + 4, fields[ 1 ].end() - 1, values_1c55A_1c56A.begin(), values_1c55A_1c56A.end() );
+	BOOST_CHECK_EQUAL_COLLECTIONS( fields[ 3 ].begin() + 4, fields[ 3 ].end() - 1, values_1c55A_1hykA.begin(), values_1c55A_1hykA.end() );
+}
+
+/// \brief Check that scoring a batch with multiple threads gives the same report, in the same order, as with one thread
+BOOST_AUTO_TEST_CASE(multiple_threads_give_same_report) {
+	aligned_pair_score_batch_entry_vec entries;
+	for (size_t repeat_ctr = 0; repeat_ctr < 2 * ALIGNED_PAIR_SCORE_BATCH_ENTRIES_PER_TASK; ++repeat_ctr) {
+		for (const string &id_b : str_vec{ "1c56A", "1hykA", "1wmtA", "1wt7A" } ) {
+			entries.push_back( make_entry( "1c55A", id_b ) );
+		}
+	}
+	ostringstream warnings_ss;
+	ostringstream serial_report_ss;
+	ostringstream parallel_report_ss;
+	score_aligned_pair_batch( entries, make_default_aligned_pair_score_list(), serial_report_ss,   warnings_ss, 1 );
+	score_aligned_pair_batch( entries, make_default_aligned_pair_score_list(), parallel_report_ss, warnings_ss, 3 );
+	BOOST_CHECK_EQUAL( parallel_report_ss.str(), serial_report_ss.str() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -34,6 +34,7 @@
 #include "common/boost_addenda/tribool/tribool.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "score/aligned_pair_score/aligned_pair_score.hpp"
+#include "score/aligned_pair_score/detail/score_common_coords_cache.hpp"
 
 #include <iostream> // ***** TEMPORARY *****
 
@@ -164,6 +165,9 @@ aligned_pair_score_value_list cath::score::make_aligned_pair_score_value_list(co
 	// Create a new aligned_pair_score_value_list
 	aligned_pair_score_value_list new_aligned_pair_score_value_list;
 
+	// Share the common coordinates between all the scores that select them with the same policies
+	const detail::score_common_coords_cache common_coords_cache{ prm_alignment, prm_protein_a, prm_protein_b };
+
 	// Loop over the scores
 	const size_t num_scores = prm_scores.size();
 	for (const size_t &score_ctr : indices( num_scores ) ) {
@@ -62,6 +62,12 @@ void ssap_and_prc::calculate_svm_score(const rbf_model &prm_svm ///< The SVM RBF
 	svm_score = get_score( prm_svm, *this );
 }
 
+/// \brief Store the specified SVM score (eg as calculated for many ssap_and_prc objects at once with rbf_model::get_scores())
+void ssap_and_prc::set_svm_score(const double &prm_svm_score ///< The SVM score to store
+                                 ) {
+	svm_score = prm_svm_score;
+}
+
 /// \brief Getter for the query_id (name_1) shared by the SSAP and PRC results
 const string & ssap_and_prc::get_query_id() const {
 	return the_ssap.get_name_1();
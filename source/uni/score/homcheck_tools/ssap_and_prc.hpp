@@ -55,6 +55,7 @@ namespace cath {
 			             file::prc_scores_entry);
 
 			void calculate_svm_score(const score::rbf_model &);
+			void set_svm_score(const double &);
 
 			const std::string & get_query_id() const;
 			const std::string & get_match_id() const;
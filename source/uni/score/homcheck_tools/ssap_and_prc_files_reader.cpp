@@ -0,0 +1,121 @@
+/// \file
+/// \brief The ssap_and_prc_files_reader definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ssap_and_prc_files_reader.hpp"
+
+#include "file/prc_scores_file/prc_scores_file.hpp"
+#include "file/ssap_scores_file/ssap_scores_file.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+
+using namespace cath;
+using namespace cath::file;
+using namespace cath::homcheck;
+
+using boost::filesystem::path;
+using std::deque;
+using std::future;
+using std::min;
+using std::vector;
+
+namespace cath {
+	namespace homcheck {
+		namespace detail {
+
+			/// \brief Type alias for a vector of ssap_and_prc_files_results
+			using ssap_and_prc_files_results_vec = vector<ssap_and_prc_files_results>;
+
+			/// \brief Read the pairs of files of the specified (half-open) range of indices
+			ssap_and_prc_files_results_vec read_ssap_and_prc_files_range(const path_path_pair_vec &prm_files, ///< The pairs of SSAP and PRC files
+			                                                             const size_t             &prm_begin, ///< The index of the first pair of files to read
+			                                                             const size_t             &prm_end    ///< The index one past the last pair of files to read
+			                                                             ) {
+				ssap_and_prc_files_results_vec results;
+				results.reserve( prm_end - prm_begin );
+				for (size_t file_ctr = prm_begin; file_ctr < prm_end; ++file_ctr) {
+					results.push_back( read_ssap_and_prc_files( prm_files[ file_ctr ].first, prm_files[ file_ctr ].second ) );
+				}
+				return results;
+			}
+
+		} // namespace detail
+	} // namespace homcheck
+} // namespace cath
+
+/// \brief Read the SSAP and PRC results from the specified SSAP and PRC scores files
+///
+/// The PRC results have duplicates removed, as by prc_scores_file::parse_prc_scores_file_fancy()
+ssap_and_prc_files_results cath::homcheck::read_ssap_and_prc_files(const path &prm_ssap_file, ///< The SSAP scores file to read
+                                                                   const path &prm_prc_file   ///< The PRC scores file to read
+                                                                   ) {
+	return {
+		prm_ssap_file,
+		prm_prc_file,
+		ssap_scores_file::parse_ssap_scores_file_simple( prm_ssap_file ),
+		prc_scores_file::parse_prc_scores_file_fancy   ( prm_prc_file  )
+	};
+}
+
+/// \brief Read each of the specified pairs of SSAP and PRC scores files and pass the results to the specified consumer
+///
+/// If there are multiple threads, the files are read in tasks of up to SSAP_AND_PRC_FILES_PER_TASK pairs,
+/// with up to prm_num_threads tasks in flight at once. The oldest task's results are always consumed first
+/// (in the calling thread) so the consumer always receives the results in the order of the files.
+///
+/// If reading any of the files throws, the exception is rethrown when that file's results are due to be consumed.
+void cath::homcheck::read_ssap_and_prc_files(const path_path_pair_vec                  &prm_files,      ///< The pairs of SSAP and PRC scores files to read
+                                             const ssap_and_prc_files_results_consumer &prm_consumer,   ///< The function to which the results of each pair of files should be passed
+                                             const size_t                              &prm_num_threads ///< The maximum number of threads with which to read the files
+                                             ) {
+	if ( prm_num_threads <= 1 ) {
+		for (const path_path_pair &ssap_and_prc_file : prm_files) {
+			prm_consumer( read_ssap_and_prc_files( ssap_and_prc_file.first, ssap_and_prc_file.second ) );
+		}
+		return;
+	}
+
+	const auto consume_all = [&] (const detail::ssap_and_prc_files_results_vec &prm_results) {
+		for (const ssap_and_prc_files_results &results : prm_results) {
+			prm_consumer( results );
+		}
+	};
+
+	const size_t num_files = prm_files.size();
+	deque<future<detail::ssap_and_prc_files_results_vec>> results_futures;
+	for (size_t begin = 0; begin < num_files; begin += SSAP_AND_PRC_FILES_PER_TASK) {
+		if ( results_futures.size() >= prm_num_threads ) {
+			consume_all( results_futures.front().get() );
+			results_futures.pop_front();
+		}
+		const size_t end = min( num_files, begin + SSAP_AND_PRC_FILES_PER_TASK );
+		results_futures.push_back( std::async(
+			std::launch::async,
+			[&, begin, end] {
+				return detail::read_ssap_and_prc_files_range( prm_files, begin, end );
+			}
+		) );
+	}
+	while ( ! results_futures.empty() ) {
+		consume_all( results_futures.front().get() );
+		results_futures.pop_front();
+	}
+}
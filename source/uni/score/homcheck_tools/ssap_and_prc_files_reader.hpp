@@ -0,0 +1,75 @@
+/// \file
+/// \brief The ssap_and_prc_files_reader header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_SCORE_HOMCHECK_TOOLS_SSAP_AND_PRC_FILES_READER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_SCORE_HOMCHECK_TOOLS_SSAP_AND_PRC_FILES_READER_HPP
+
+#include <boost/filesystem/path.hpp>
+
+#include "common/path_type_aliases.hpp"
+#include "file/file_type_aliases.hpp"
+#include "file/prc_scores_file/prc_scores_entry.hpp"
+#include "file/ssap_scores_file/ssap_scores_entry.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace cath {
+	namespace homcheck {
+
+		/// \brief The SSAP and PRC results read from one pair of SSAP and PRC scores files
+		struct ssap_and_prc_files_results final {
+			/// \brief The SSAP scores file from which the SSAP results were read
+			boost::filesystem::path     ssap_file;
+
+			/// \brief The PRC scores file from which the PRC results were read
+			boost::filesystem::path     prc_file;
+
+			/// \brief The SSAP results
+			file::ssap_scores_entry_vec ssaps;
+
+			/// \brief The PRC results (with duplicates removed, as by prc_scores_file::parse_prc_scores_file_fancy())
+			file::prc_scores_entry_vec  prcs;
+		};
+
+		/// \brief The type of function that consumes the results of one pair of files
+		///
+		/// In read_ssap_and_prc_files(), this is only ever called from the calling thread
+		/// and it's called on the pairs of files in the order in which they were specified
+		using ssap_and_prc_files_results_consumer = std::function<void(const ssap_and_prc_files_results &)>;
+
+		/// \brief The number of pairs of files that each task reads when reading with multiple threads
+		///
+		/// The files are typically small so this amortises the cost of launching each task
+		/// whilst keeping the number of in-flight results small
+		constexpr size_t SSAP_AND_PRC_FILES_PER_TASK = 32;
+
+		ssap_and_prc_files_results read_ssap_and_prc_files(const boost::filesystem::path &,
+		                                                   const boost::filesystem::path &);
+
+		void read_ssap_and_prc_files(const path_path_pair_vec &,
+		                             const ssap_and_prc_files_results_consumer &,
+		                             const size_t & = 1);
+
+	} // namespace homcheck
+} // namespace cath
+
+#endif
@@ -0,0 +1,126 @@
+/// \file
+/// \brief The ssap_and_prc_files_reader test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/file/simple_file_read_write.hpp"
+#include "common/file/temp_file.hpp"
+#include "common/path_type_aliases.hpp"
+#include "common/size_t_literal.hpp"
+#include "score/homcheck_tools/ssap_and_prc_files_reader.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::homcheck;
+using namespace std;
+
+using boost::filesystem::path;
+using cath::path_path_pair;
+using cath::path_path_pair_vec;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The ssap_and_prc_files_reader_test_suite_fixture to assist in testing ssap_and_prc_files_reader
+		struct ssap_and_prc_files_reader_test_suite_fixture {
+		protected:
+			~ssap_and_prc_files_reader_test_suite_fixture() noexcept = default;
+
+			/// \brief Write the specified contents to the specified temp file and return its filename
+			static path write_temp_file(const temp_file &prm_temp_file, ///< The temp file to which the contents should be written
+			                            const string    &prm_contents   ///< The contents to write
+			                            ) {
+				const path filename = get_filename( prm_temp_file );
+				write_file( filename, prm_contents );
+				return filename;
+			}
+
+			/// \brief Read the specified files with the specified number of threads and return the results in the order they were consumed
+			static vector<ssap_and_prc_files_results> read_all(const path_path_pair_vec &prm_files,      ///< The pairs of SSAP and PRC files to read
+			                                                   const size_t             &prm_num_threads ///< The number of threads with which to read the files
+			                                                   ) {
+				vector<ssap_and_prc_files_results> results;
+				read_ssap_and_prc_files(
+					prm_files,
+					[&] (const ssap_and_prc_files_results &x) { results.push_back( x ); },
+					prm_num_threads
+				);
+				return results;
+			}
+
+			/// \brief Temp files for two queries' SSAP and PRC results
+			const temp_file ssap_temp_file_a{ "cath_tools_test_temp_file.ssap_and_prc_files_reader.ssaps.%%%%" };
+			const temp_file ssap_temp_file_b{ "cath_tools_test_temp_file.ssap_and_prc_files_reader.ssaps.%%%%" };
+			const temp_file prc_temp_file_a { "cath_tools_test_temp_file.ssap_and_prc_files_reader.prc.%%%%"   };
+			const temp_file prc_temp_file_b { "cath_tools_test_temp_file.ssap_and_prc_files_reader.prc.%%%%"   };
+
+			/// \brief The SSAP and PRC files for the first query
+			const path_path_pair files_a{
+				write_temp_file( ssap_temp_file_a, "1fkmA02  1pauB00  121   91  67.58   52   42    5   6.33\n1fkmA02  1qtnB00  121   90  67.14   56   46    4   7.95\n" ),
+				write_temp_file( prc_temp_file_a,  "1fkmA02 79      102     141     1       1pauB00 43      66      102        5.0     0.6   3.0e+03\n" )
+			};
+
+			/// \brief The SSAP and PRC files for the second query
+			const path_path_pair files_b{
+				write_temp_file( ssap_temp_file_b, "1x3zA01  1w09A00   26   92  55.10   20   76    3   2.01\n" ),
+				write_temp_file( prc_temp_file_b,  "1x3zA01 4       20      26      1       1w09A00 71      87      92         7.5     3.8      0.83\n1x3zA01 2       25      26      1       1zx2B00 3       26      147        6.0     3.5       2.0\n" )
+			};
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(ssap_and_prc_files_reader_test_suite, cath::test::ssap_and_prc_files_reader_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(reads_one_pair_of_files) {
+	const auto results = read_ssap_and_prc_files( files_a.first, files_a.second );
+	BOOST_CHECK_EQUAL( results.ssap_file,    files_a.first  );
+	BOOST_CHECK_EQUAL( results.prc_file,     files_a.second );
+	BOOST_CHECK_EQUAL( results.ssaps.size(), 2 );
+	BOOST_CHECK_EQUAL( results.prcs.size(),  1 );
+	BOOST_CHECK_EQUAL( results.ssaps.front().get_name_2(), "1pauB00" );
+	BOOST_CHECK_EQUAL( results.prcs.front().get_name_2(),  "1pauB00" );
+}
+
+BOOST_AUTO_TEST_CASE(multithreaded_reading_consumes_results_in_order) {
+	// Use enough pairs of files to require several tasks per thread
+	path_path_pair_vec files;
+	for (size_t file_ctr = 0; file_ctr < 5 * SSAP_AND_PRC_FILES_PER_TASK + 3; ++file_ctr) {
+		files.push_back( ( file_ctr % 3 == 1 ) ? files_b : files_a );
+	}
+
+	const auto serial_results = read_all( files, 1 );
+	BOOST_REQUIRE_EQUAL( serial_results.size(), files.size() );
+	for (const size_t &num_threads : { 2_z, 3_z, 8_z } ) {
+		const auto parallel_results = read_all( files, num_threads );
+		BOOST_REQUIRE_EQUAL( parallel_results.size(), serial_results.size() );
+		for (size_t result_ctr = 0; result_ctr < serial_results.size(); ++result_ctr) {
+			BOOST_CHECK_EQUAL( parallel_results[ result_ctr ].ssap_file, files[ result_ctr ].first  );
+			BOOST_CHECK_EQUAL( parallel_results[ result_ctr ].prc_file,  files[ result_ctr ].second );
+			BOOST_CHECK( parallel_results[ result_ctr ].ssaps == serial_results[ result_ctr ].ssaps );
+			BOOST_CHECK( parallel_results[ result_ctr ].prcs  == serial_results[ result_ctr ].prcs  );
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
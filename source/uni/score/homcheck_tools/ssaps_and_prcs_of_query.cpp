@@ -22,7 +22,6 @@
 
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/log/trivial.hpp>
-#include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/algorithm/max_element.hpp>
 
 #include "common/algorithm/transform_build.hpp"
@@ -49,7 +48,6 @@ using namespace cath::score;
 using namespace std;
 
 using boost::algorithm::all_of;
-using boost::range::for_each;
 
 /// \brief Check that the class invariants hold
 ///
@@ -80,12 +78,21 @@ ssaps_and_prcs_of_query::ssaps_and_prcs_of_query(ssap_and_prc_vec prm_ssap_and_p
 }
 
 /// \brief Calculate the SVM scores for all the results using the specified SVM RBF model
-void ssaps_and_prcs_of_query::calculate_all_svm_scores(const rbf_model &prm_svm /// \brief The SVM RBF model with which to calculate the scores
+///
+/// This scores all the results in one batch with rbf_model::get_scores()
+void ssaps_and_prcs_of_query::calculate_all_svm_scores(const rbf_model &prm_svm,        ///< The SVM RBF model with which to calculate the scores
+                                                       const size_t    &prm_num_threads ///< The maximum number of threads with which to calculate the scores
                                                        ) {
-	for_each(
-		ssap_and_prc_entries,
-		[&] (ssap_and_prc &x) { x.calculate_svm_score( prm_svm ); }
+	const doub_vec svm_scores = prm_svm.get_scores(
+		transform_build<double_octuple_vec>(
+			ssap_and_prc_entries,
+			[] (const ssap_and_prc &x) { return rbf_model::make_standard_scores( x ); }
+		),
+		prm_num_threads
 	);
+	for (const size_t &entry_ctr : indices( ssap_and_prc_entries.size() ) ) {
+		ssap_and_prc_entries[ entry_ctr ].set_svm_score( svm_scores[ entry_ctr ] );
+	}
 }
 
 /// \brief Get the whether this ssaps_and_prcs_of_query is empty (ie has no ssap_and_prc objects)
@@ -116,9 +123,10 @@ auto ssaps_and_prcs_of_query::end() const -> const_iterator{
 
 /// \brief Calculate the SVM scores for all the results in a copy of the specified ssaps_and_prcs_of_query and return that copy
 ssaps_and_prcs_of_query cath::homcheck::calculate_all_svm_scores_copy(ssaps_and_prcs_of_query  prm_ssaps_and_prcs, ///< The ssaps_and_prcs_of_query from which a copy should be taken, updated and returned
-                                                                      const rbf_model         &prm_svm             ///< The SVM RBF model with which to calculate the scores
+                                                                      const rbf_model         &prm_svm,            ///< The SVM RBF model with which to calculate the scores
+                                                                      const size_t            &prm_num_threads     ///< The maximum number of threads with which to calculate the scores
                                                                       ) {
-	prm_ssaps_and_prcs.calculate_all_svm_scores( prm_svm );
+	prm_ssaps_and_prcs.calculate_all_svm_scores( prm_svm, prm_num_threads );
 	return prm_ssaps_and_prcs;
 }
 
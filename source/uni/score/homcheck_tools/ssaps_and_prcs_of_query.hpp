@@ -63,7 +63,8 @@ namespace cath {
 			ssaps_and_prcs_of_query() = default;
 			explicit ssaps_and_prcs_of_query(ssap_and_prc_vec);
 
-			void calculate_all_svm_scores(const score::rbf_model &);
+			void calculate_all_svm_scores(const score::rbf_model &,
+			                              const size_t & = 1);
 
 			bool empty() const;
 			size_t size() const;
@@ -75,7 +76,8 @@ namespace cath {
 		};
 
 		ssaps_and_prcs_of_query calculate_all_svm_scores_copy(ssaps_and_prcs_of_query,
-		                                                      const score::rbf_model &);
+		                                                      const score::rbf_model &,
+		                                                      const size_t & = 1);
 
 		const std::string & get_query_id(const ssaps_and_prcs_of_query &);
 
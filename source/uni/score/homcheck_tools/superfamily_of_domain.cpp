@@ -20,30 +20,31 @@
 
 #include "superfamily_of_domain.hpp"
 
-#include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
-#include "common/boost_addenda/string_algorithm/split_build.hpp"
 #include "common/cpp14/cbegin_cend.hpp"
 #include "common/exception/invalid_argument_exception.hpp"
 #include "common/file/open_fstream.hpp"
+#include "common/size_t_literal.hpp"
+#include "common/string/string_parse_tools.hpp"
 #include "common/type_aliases.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
+#include <numeric>
 #include <regex>
-#include <unordered_set>
 
 using namespace cath::common;
 using namespace cath::homcheck;
 using namespace cath::homcheck::detail;
 using namespace std;
 
-using boost::algorithm::any_of;
 using boost::algorithm::contains;
-using boost::algorithm::is_space;
 using boost::filesystem::path;
-using boost::token_compress_on;
+using boost::none;
+using cath::size_opt;
 
 /// \brief The regular expression used to determine whether a string is a valid CATH superfamily ID
 const regex is_valid_superfamily_id::SUPERFAMILY_ID_REGEX{ R"(^\d+\.\d+\.\d+\.\d+$)" };
@@ -62,6 +63,16 @@ string cath::homcheck::detail::fold_of_superfamily_id(const string &prm_superfam
 	return regex_replace( prm_superfamily_id, regex{ R"(\.[^\.]+$)" }, "" );
 }
 
+/// \brief Get the index of the specified superfamily ID in superfamily_ids, adding it if it isn't already present
+size_t superfamily_of_domain::index_of_superfamily_id(const string &prm_superfamily_id ///< The superfamily ID to find or add
+                                                      ) {
+	const auto emplace_result = superfamily_index_of_id.emplace( prm_superfamily_id, superfamily_ids.size() );
+	if ( emplace_result.second ) {
+		superfamily_ids.push_back( prm_superfamily_id );
+	}
+	return emplace_result.first->second;
+}
+
 /// \brief Return whether the specified superfamily is a new superfamily created in this run (rather than a real, original superfamily)
 bool superfamily_of_domain::is_created_sf(const string &prm_superfamily ///< The superfamily to query
                                           ) {
@@ -69,25 +80,80 @@ bool superfamily_of_domain::is_created_sf(const string &prm_superfamily ///< The
 }
 
 /// \brief Ctor from a vector<pair<string, string>> where each pair contains domain ID and the corresponding superfamily ID
+///
+/// This is quicker if the data is already sorted by domain ID because it then needn't sort it.
+///
+/// \throws invalid_argument_exception if a domain ID is duplicated or a superfamily ID is invalid
 superfamily_of_domain::superfamily_of_domain(const str_str_pair_vec &prm_sf_of_dom ///< The domain ID -> superfamily ID data from which this superfamily_of_domain should be constructed
-                                             ) : sf_of_dom( common::cbegin( prm_sf_of_dom ), common::cend( prm_sf_of_dom ) ) {
+                                             ) {
+	const size_t num_domains    = prm_sf_of_dom.size();
+	const auto   domain_id_less = [&] (const size_t &x, const size_t &y) {
+		return ( prm_sf_of_dom[ x ].first < prm_sf_of_dom[ y ].first );
+	};
+
+	// Sort the indices of the entries by domain ID (rather than copying and sorting the entries themselves)
+	size_vec sorted_indices( num_domains );
+	iota( begin( sorted_indices ), end( sorted_indices ), 0_z );
+	if ( ! is_sorted( common::cbegin( sorted_indices ), common::cend( sorted_indices ), domain_id_less ) ) {
+		sort( begin( sorted_indices ), end( sorted_indices ), domain_id_less );
+	}
+
 	const is_valid_superfamily_id is_valid_sf_pred{};
-	for (const auto &x: sf_of_dom) {
-		if ( ! is_valid_sf_pred( x.second ) ) {
-			BOOST_THROW_EXCEPTION(invalid_argument_exception("Unable to construct superfamily_of_domain with invalid superfamily ID "+ x.second));
+	domain_ids.reserve                 ( num_domains );
+	superfamily_index_of_domain.reserve( num_domains );
+	for (const size_t &index : sorted_indices) {
+		const string &domain_id      = prm_sf_of_dom[ index ].first;
+		const string &superfamily_id = prm_sf_of_dom[ index ].second;
+		if ( ! domain_ids.empty() && domain_ids.back() == domain_id ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("Unable to construct superfamily_of_domain with duplicated domain ID " + domain_id));
+		}
+
+		// There are many more domains than superfamilies so only check each superfamily ID the first time it's seen
+		const size_t prev_num_superfamilies = superfamily_ids.size();
+		const size_t superfamily_index      = index_of_superfamily_id( superfamily_id );
+		if ( superfamily_ids.size() > prev_num_superfamilies && ! is_valid_sf_pred( superfamily_id ) ) {
+			BOOST_THROW_EXCEPTION(invalid_argument_exception("Unable to construct superfamily_of_domain with invalid superfamily ID "+ superfamily_id));
 		}
+
+		domain_ids.push_back                 ( domain_id         );
+		superfamily_index_of_domain.push_back( superfamily_index );
 	}
+	num_sorted_domains = num_domains;
 }
 
 /// \brief Getter for the size (ie number of domains for which superfamily information is stored)
 size_t superfamily_of_domain::size() const {
-	return sf_of_dom.size();
+	return domain_ids.size();
+}
+
+/// \brief Getter for the number of distinct superfamilies (including any new superfamilies that have been created)
+size_t superfamily_of_domain::get_num_superfamilies() const {
+	return superfamily_ids.size();
+}
+
+/// \brief Find the index in domain_ids of the specified domain ID or return none if this has no superfamily information for it
+///
+/// The domains from construction are found by binary search and any domains added since are found in added_domain_index_of_id
+size_opt superfamily_of_domain::find_domain_index(const string &prm_domain_id ///< The domain ID to query
+                                                  ) const {
+	const auto sorted_begin = common::cbegin( domain_ids );
+	const auto sorted_end   = next( sorted_begin, static_cast<ptrdiff_t>( num_sorted_domains ) );
+	const auto find_itr     = lower_bound( sorted_begin, sorted_end, prm_domain_id );
+	if ( find_itr != sorted_end && *find_itr == prm_domain_id ) {
+		return static_cast<size_t>( distance( sorted_begin, find_itr ) );
+	}
+
+	const auto added_find_itr = added_domain_index_of_id.find( prm_domain_id );
+	if ( added_find_itr != common::cend( added_domain_index_of_id ) ) {
+		return added_find_itr->second;
+	}
+	return none;
 }
 
 /// \brief Return whether this superfamily_of_domain has superfamily information for the specified domain ID
 bool superfamily_of_domain::has_superfamily_of_domain(const string &prm_domain_id ///< The domain ID to query
                                                       ) const {
-	return sf_of_dom.count( prm_domain_id ) > 0;
+	return static_cast<bool>( find_domain_index( prm_domain_id ) );
 }
 
 /// \brief Return whether this superfamily_of_domain has superfamily information for the specified domain ID
@@ -95,15 +161,15 @@ bool superfamily_of_domain::has_superfamily_of_domain(const string &prm_domain_i
 /// \pre `this->has_superfamily_of_domain( prm_domain_id )`, else and invalid_argument_exception will be thrown
 const string & superfamily_of_domain::get_superfamily_of_domain(const string &prm_domain_id ///< The domain ID to query
                                                                 ) const {
-	const auto find_itr = sf_of_dom.find( prm_domain_id );
-	if ( find_itr == common::cend( sf_of_dom ) ) {
+	const size_opt domain_index = find_domain_index( prm_domain_id );
+	if ( ! domain_index ) {
 		BOOST_THROW_EXCEPTION(
 			invalid_argument_exception("Unable to find any entry in superfamily_of_domain for domain ID \""
 			+ prm_domain_id
 			+ "\""
 		));
 	}
-	return find_itr->second;
+	return superfamily_ids[ superfamily_index_of_domain[ *domain_index ] ];
 }
 
 /// \brief Return whether the specified domain is in a new superfamily created in this run (rather than a real, original superfamily)
@@ -131,7 +197,10 @@ void superfamily_of_domain::add_domain_in_new_sf_in_fold_of_domain(const string
 			+ "\" into superfamily_of_domain because there it already has an entry"
 		));
 	}
-	sf_of_dom.emplace( prm_new_domain_id, fold_id + NEW_SF_CORE_STRING + prm_match_domain_id );
+	const size_t superfamily_index = index_of_superfamily_id( fold_id + NEW_SF_CORE_STRING + prm_match_domain_id );
+	added_domain_index_of_id.emplace( prm_new_domain_id, domain_ids.size() );
+	domain_ids.push_back                 ( prm_new_domain_id );
+	superfamily_index_of_domain.push_back( superfamily_index );
 }
 
 /// \brief Parse the superfamily_of_domain information from the specified istream
@@ -139,45 +208,37 @@ void superfamily_of_domain::add_domain_in_new_sf_in_fold_of_domain(const string
 /// \relates superfamily_of_domain
 superfamily_of_domain cath::homcheck::parse_superfamily_of_domain(istream &prm_sf_of_dom_istream ///< The istream from which the superfamily_of_domain information should be parsed
                                                                   ) {
-	const is_valid_superfamily_id is_valid_sf_pred{};
-	unordered_set<string> prev_seen_domain_ids;
 	str_str_pair_vec line_string_pairs;
+	str_citr_str_citr_pair_vec field_itrs;
 	string line_string;
 	while ( getline( prm_sf_of_dom_istream, line_string ) ) {
-		const auto line_parts = split_build<str_vec>( line_string, is_space(), token_compress_on );
-		if ( ! line_parts.empty() ) {
-			if ( line_parts.size() != 2 ) {
+		split_into_field_itrs( line_string, field_itrs );
+		if ( ! field_itrs.empty() ) {
+			if ( field_itrs.size() != 2 ) {
 				BOOST_THROW_EXCEPTION(runtime_error_exception(
 					"Cannot parse superfamily_of_domain data because line \""
 					+ line_string
 					+ "\" does not contain two parts."
 				));
 			}
-			const string &domain_id      = line_parts[ 0 ];
-			const string &superfamily_id = line_parts[ 1 ];
-
-			if ( ! is_valid_sf_pred( superfamily_id ) ) {
-				BOOST_THROW_EXCEPTION(runtime_error_exception(
-					"Second entry in parsed line from superfamily_of_domain data is \""
-					+ superfamily_id
-					+ "\", which isn't a valid superfamily ID"
-				));
-			}
-			if ( prev_seen_domain_ids.count( domain_id ) > 0 ) {
-				BOOST_THROW_EXCEPTION(runtime_error_exception(
-					"Duplicated domain_id \""
-					+ domain_id
-					+ "\" in superfamily_of_domain data"
-				));
-			}
-			prev_seen_domain_ids.insert( domain_id );
-
-			line_string_pairs.emplace_back( domain_id, superfamily_id );
+			line_string_pairs.emplace_back(
+				string{ field_itrs[ 0 ].first, field_itrs[ 0 ].second },
+				string{ field_itrs[ 1 ].first, field_itrs[ 1 ].second }
+			);
 		}
 	}
 
-	/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
-	return superfamily_of_domain{ line_string_pairs };
+	// The ctor checks for invalid superfamily IDs and duplicated domain IDs
+	try {
+		/// \todo Come C++17, if Herb Sutter has gotten his way (n4029), just use braced list here
+		return superfamily_of_domain{ line_string_pairs };
+	}
+	catch (const invalid_argument_exception &ex) {
+		BOOST_THROW_EXCEPTION(runtime_error_exception(
+			"Cannot parse superfamily_of_domain data : "
+			+ string{ ex.what() }
+		));
+	}
 }
 
 /// \brief Parse the superfamily_of_domain information from the specified file
@@ -22,6 +22,7 @@
 #define _CATH_TOOLS_SOURCE_UNI_SCORE_HOMCHECK_TOOLS_SUPERFAMILY_OF_DOMAIN_HPP
 
 #include <boost/filesystem/path.hpp>
+#include <boost/optional.hpp>
 
 #include "common/type_aliases.hpp"
 
@@ -61,13 +62,40 @@ namespace cath {
 
 		/// \brief A lookup from domain_id to the superfamily in which that domain is currently classified
 		///        (or will be classified after actions suggested by this code)
+		///
+		/// This is stored compactly because it typically holds every CATH domain:
+		///  * the domain IDs from construction are stored once, sorted, and found by binary search
+		///    (the few domains added later are indexed by a small side map)
+		///  * each distinct superfamily ID is only stored once (there are many more domains than
+		///    superfamilies) and each domain just stores the index of its superfamily
 		class superfamily_of_domain final {
 		private:
-			/// \brief Hash from domain_id to superfamily ID
+			/// \brief The distinct superfamily IDs
 			///
 			/// Pre-existing superfamily_ids satisfy meet is_valid_superfamily_id()
 			/// New superfamily IDs are built from pre-existing ones and look like: 2.60.40.new_sf_in_fold_of_1cukA01
-			std::unordered_map<std::string, std::string> sf_of_dom;
+			///
+			/// This is a deque so that references returned by get_superfamily_of_domain() remain valid
+			/// when new superfamilies are added
+			str_deq superfamily_ids;
+
+			/// \brief The index in superfamily_ids of each of the superfamily IDs
+			std::unordered_map<std::string, size_t> superfamily_index_of_id;
+
+			/// \brief The domain IDs: the first num_sorted_domains (from construction) sorted and then any added since
+			str_vec domain_ids;
+
+			/// \brief The index in superfamily_ids of the superfamily of each of the domains in domain_ids
+			size_vec superfamily_index_of_domain;
+
+			/// \brief The number of domains at the start of domain_ids that are sorted
+			size_t num_sorted_domains = 0;
+
+			/// \brief The index in domain_ids of each of the domains added since construction
+			std::unordered_map<std::string, size_t> added_domain_index_of_id;
+
+			size_t index_of_superfamily_id(const std::string &);
+			size_opt find_domain_index(const std::string &) const;
 
 			static bool is_created_sf(const std::string &);
 
@@ -78,6 +106,7 @@ namespace cath {
 			explicit superfamily_of_domain(const str_str_pair_vec &);
 
 			size_t size() const;
+			size_t get_num_superfamilies() const;
 
 			bool is_in_new_superfamily(const std::string &) const;
 			bool has_superfamily_of_domain(const std::string &) const;
@@ -30,6 +30,8 @@ using namespace cath::homcheck;
 using namespace cath::homcheck::detail;
 using namespace std;
 
+using cath::str_str_pair_vec;
+
 namespace cath {
 	namespace test {
 
@@ -102,6 +104,43 @@ BOOST_AUTO_TEST_CASE(parses_correctly) {
 }
 
 
+BOOST_AUTO_TEST_CASE(finds_unsorted_and_added_domains) {
+	superfamily_of_domain sf_of_dom{ {
+		{ "6cscA01", "1.10.580.10" },
+		{ "1qinA00", "3.10.180.10" },
+		{ "2x2jC01", "2.60.40.10"  },
+	} };
+	sf_of_dom.add_domain_in_new_sf_in_fold_of_domain( "1cukA01", "2x2jC01" );
+
+	BOOST_CHECK( ! sf_of_dom.has_superfamily_of_domain( "1cg2A01" ) );
+	BOOST_CHECK( ! sf_of_dom.has_superfamily_of_domain( "9zzzZ99" ) );
+	BOOST_CHECK_EQUAL( sf_of_dom.size(), 4 );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "1qinA00" ), "3.10.180.10"                       );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "2x2jC01" ), "2.60.40.10"                        );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "6cscA01" ), "1.10.580.10"                       );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "1cukA01" ), "2.60.40.new_sf_in_fold_of_2x2jC01" );
+}
+
+
+BOOST_AUTO_TEST_CASE(stores_each_superfamily_once) {
+	const superfamily_of_domain sf_of_dom{ {
+		{ "2x2jC01", "2.60.40.10"   },
+		{ "1qinA00", "3.10.180.10"  },
+		{ "2nx5G00", "2.60.40.10"   },
+		{ "1vkeD00", "3.10.180.10"  },
+	} };
+	BOOST_CHECK_EQUAL( sf_of_dom.size(),                                 4              );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_num_superfamilies(),                2              );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "1vkeD00" ), "3.10.180.10" );
+	BOOST_CHECK_EQUAL( sf_of_dom.get_superfamily_of_domain( "2x2jC01" ), "2.60.40.10"  );
+}
+
+
+BOOST_AUTO_TEST_CASE(ctor_rejects_repeated_domain_ids) {
+	BOOST_CHECK_THROW( superfamily_of_domain( str_str_pair_vec{ { "1qinA00", "3.10.180.10" }, { "1vkeD00", "1.20.1290.10" }, { "1qinA00", "1.20.1290.10" } } ), invalid_argument_exception );
+}
+
+
 BOOST_AUTO_TEST_CASE(parses_single_line) {
 	BOOST_CHECK_EQUAL( parse_superfamily_of_domain( string{ "1qinA00 3.10.180.10" } ).size(), 1 );
 }
@@ -25,7 +25,6 @@
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/optional.hpp>
 #include <boost/range/irange.hpp>
-#include <boost/range/numeric.hpp>
 
 #include "common/algorithm/transform_build.hpp"
 #include "common/boost_addenda/string_algorithm/split_build.hpp"
@@ -38,8 +37,11 @@
 #include "score/homcheck_tools/ssap_and_prc.hpp"
 #include "score/score_classification/value_list_scaling.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <deque>
 #include <fstream>
+#include <future>
 
 using namespace cath;
 using namespace cath::common;
@@ -48,7 +50,6 @@ using namespace cath::homcheck;
 using namespace cath::score;
 using namespace std;
 
-using boost::accumulate;
 using boost::algorithm::is_any_of;
 using boost::algorithm::is_space;
 using boost::algorithm::token_compress_on;
@@ -59,6 +60,9 @@ using boost::irange;
 using boost::numeric_cast;
 using boost::optional;
 
+constexpr size_t             rbf_model::NUM_COMPONENTS;
+constexpr size_t             rbf_model::SUPPORT_VECTOR_BLOCK_SIZE;
+constexpr size_t             rbf_model::QUERIES_PER_TASK;
 constexpr value_list_scaling rbf_model::PRC_EVALUE_SCALING;
 constexpr value_list_scaling rbf_model::PRC_REVERSE_SCALING;
 constexpr value_list_scaling rbf_model::PRC_SIMPLE_SCALING;
@@ -68,6 +72,29 @@ constexpr value_list_scaling rbf_model::SSAP_RMSD_SCALING;
 constexpr value_list_scaling rbf_model::SSAP_SEQ_ID_PC_SCALING;
 constexpr value_list_scaling rbf_model::SSAP_SCORE_SCALING;
 
+namespace cath {
+	namespace score {
+		namespace detail {
+
+			/// \brief Get the components of the specified double_octuple as an array
+			inline array<double, rbf_model::NUM_COMPONENTS> array_of_double_octuple(const double_octuple &prm_octuple ///< The double_octuple to convert
+			                                                                        ) {
+				return { {
+					get<0>( prm_octuple ),
+					get<1>( prm_octuple ),
+					get<2>( prm_octuple ),
+					get<3>( prm_octuple ),
+					get<4>( prm_octuple ),
+					get<5>( prm_octuple ),
+					get<6>( prm_octuple ),
+					get<7>( prm_octuple )
+				} };
+			}
+
+		} // namespace detail
+	} // namespace score
+} // namespace cath
+
 // Temporarily suppress a false-positive GCC compiler warning
 //
 // It seems GCC has a problem that's currently making it
@@ -95,9 +122,19 @@ constexpr value_list_scaling rbf_model::SSAP_SCORE_SCALING;
 rbf_model::rbf_model(const double                          &prm_gamma,       ///< The SVM RBF gamma parameter
                      const double                          &prm_b,           ///< The SVM RBF b parameter
                      vector<pair<double, double_octuple> >  prm_model_values ///< The SVM RBF support vectors
-                     ) : gamma           { prm_gamma                     },
-                         b               { prm_b                         },
-                         support_vectors { std::move( prm_model_values ) } {
+                     ) : gamma { prm_gamma },
+                         b     { prm_b     } {
+	support_vector_weights.reserve( prm_model_values.size() );
+	for (sv_row &component_row : support_vector_components) {
+		component_row.reserve( prm_model_values.size() );
+	}
+	for (const pair<double, double_octuple> &support_vector : prm_model_values) {
+		support_vector_weights.push_back( support_vector.first );
+		const auto components = detail::array_of_double_octuple( support_vector.second );
+		for (size_t comp_ctr = 0; comp_ctr < NUM_COMPONENTS; ++comp_ctr) {
+			support_vector_components[ comp_ctr ].push_back( components[ comp_ctr ] );
+		}
+	}
 }
 
 // Stop suppressing the GCC warning again
@@ -138,30 +175,90 @@ double_octuple rbf_model::make_standard_scores(const prc_scores_entry  &prm_prc,
 	);
 }
 
+/// \brief Get the number of support vectors in this RBF model
+size_t rbf_model::get_num_support_vectors() const {
+	return support_vector_weights.size();
+}
+
 /// \brief Get the SVM the this RBF model assigns to the input vector
+///
+/// The support vectors are processed in blocks of SUPPORT_VECTOR_BLOCK_SIZE: the squared distances to the block's
+/// support vectors are accumulated one component at a time over contiguous rows, then the exponentials are
+/// calculated in a separate loop and then the weighted exponentials are summed in the order of the support
+/// vectors. The operations are performed in the same order as a direct per-support-vector calculation,
+/// so the scores are identical to that.
 double rbf_model::get_score(const double_octuple &prm_to_be_scored ///< The vector to be scored
                             ) const {
-	return accumulate(
-		support_vectors,
-		0.0,
-		[&] (const double &x, const tuple<double, double_octuple> &support_vector_entry) {
-			const double_octuple &sup_vec = get<1>( support_vector_entry );
-			return x + (
-					get<0>( support_vector_entry ) * ::std::exp(
-					0.0 - gamma * (
-						   ( ( get<0>( prm_to_be_scored ) - get<0>( sup_vec ) ) * ( get<0>( prm_to_be_scored ) - get<0>( sup_vec ) ) )
-						 + ( ( get<1>( prm_to_be_scored ) - get<1>( sup_vec ) ) * ( get<1>( prm_to_be_scored ) - get<1>( sup_vec ) ) )
-						 + ( ( get<2>( prm_to_be_scored ) - get<2>( sup_vec ) ) * ( get<2>( prm_to_be_scored ) - get<2>( sup_vec ) ) )
-						 + ( ( get<3>( prm_to_be_scored ) - get<3>( sup_vec ) ) * ( get<3>( prm_to_be_scored ) - get<3>( sup_vec ) ) )
-						 + ( ( get<4>( prm_to_be_scored ) - get<4>( sup_vec ) ) * ( get<4>( prm_to_be_scored ) - get<4>( sup_vec ) ) )
-						 + ( ( get<5>( prm_to_be_scored ) - get<5>( sup_vec ) ) * ( get<5>( prm_to_be_scored ) - get<5>( sup_vec ) ) )
-						 + ( ( get<6>( prm_to_be_scored ) - get<6>( sup_vec ) ) * ( get<6>( prm_to_be_scored ) - get<6>( sup_vec ) ) )
-						 + ( ( get<7>( prm_to_be_scored ) - get<7>( sup_vec ) ) * ( get<7>( prm_to_be_scored ) - get<7>( sup_vec ) ) )
-					)
-				)
-			);
+	const auto   query            = detail::array_of_double_octuple( prm_to_be_scored );
+	const size_t num_support_vecs = get_num_support_vectors();
+
+	alignas( 64 ) array<double, SUPPORT_VECTOR_BLOCK_SIZE> block_values;
+	double score = 0.0;
+	for (size_t block_begin = 0; block_begin < num_support_vecs; block_begin += SUPPORT_VECTOR_BLOCK_SIZE) {
+		const size_t block_size = min( SUPPORT_VECTOR_BLOCK_SIZE, num_support_vecs - block_begin );
+
+		// Accumulate the squared distances to this block's support vectors
+		block_values.fill( 0.0 );
+		for (size_t comp_ctr = 0; comp_ctr < NUM_COMPONENTS; ++comp_ctr) {
+			const double  query_comp = query[ comp_ctr ];
+			const double *sv_comps   = support_vector_components[ comp_ctr ].data() + block_begin;
+			for (size_t sv_ctr = 0; sv_ctr < block_size; ++sv_ctr) {
+				const double diff = query_comp - sv_comps[ sv_ctr ];
+				block_values[ sv_ctr ] += diff * diff;
+			}
+		}
+
+		// Convert them to the RBF kernel values
+		for (size_t sv_ctr = 0; sv_ctr < block_size; ++sv_ctr) {
+			block_values[ sv_ctr ] = ::std::exp( 0.0 - gamma * block_values[ sv_ctr ] );
 		}
-	) - b;
+
+		// Add the weighted kernel values to the score
+		const double *weights = support_vector_weights.data() + block_begin;
+		for (size_t sv_ctr = 0; sv_ctr < block_size; ++sv_ctr) {
+			score += weights[ sv_ctr ] * block_values[ sv_ctr ];
+		}
+	}
+	return score - b;
+}
+
+/// \brief Get the SVM scores that this RBF model assigns to each of the specified input vectors
+///
+/// If there are multiple threads, the vectors are scored in tasks of up to QUERIES_PER_TASK vectors,
+/// with up to prm_num_threads tasks in flight at once. Each score is identical to that from get_score().
+doub_vec rbf_model::get_scores(const double_octuple_vec &prm_to_be_scored, ///< The vectors to be scored
+                               const size_t             &prm_num_threads   ///< The maximum number of threads with which to score the vectors
+                               ) const {
+	const size_t num_queries = prm_to_be_scored.size();
+	doub_vec scores( num_queries, 0.0 );
+	const auto score_queries = [&] (const size_t &prm_begin, const size_t &prm_end) {
+		for (size_t query_ctr = prm_begin; query_ctr < prm_end; ++query_ctr) {
+			scores[ query_ctr ] = get_score( prm_to_be_scored[ query_ctr ] );
+		}
+	};
+
+	if ( prm_num_threads <= 1 || num_queries <= QUERIES_PER_TASK ) {
+		score_queries( 0, num_queries );
+		return scores;
+	}
+
+	deque<future<void>> task_futures;
+	for (size_t begin = 0; begin < num_queries; begin += QUERIES_PER_TASK) {
+		if ( task_futures.size() >= prm_num_threads ) {
+			task_futures.front().get();
+			task_futures.pop_front();
+		}
+		const size_t end = min( num_queries, begin + QUERIES_PER_TASK );
+		task_futures.push_back( async(
+			launch::async,
+			[&, begin, end] { score_queries( begin, end ); }
+		) );
+	}
+	while ( ! task_futures.empty() ) {
+		task_futures.front().get();
+		task_futures.pop_front();
+	}
+	return scores;
 }
 
 /// \brief Parse an rbf_model from an SVM-light RBF model file
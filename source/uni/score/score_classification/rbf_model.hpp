@@ -21,11 +21,15 @@
 #ifndef _CATH_TOOLS_SOURCE_UNI_SCORE_SCORE_CLASSIFICATION_RBF_MODEL_HPP
 #define _CATH_TOOLS_SOURCE_UNI_SCORE_SCORE_CLASSIFICATION_RBF_MODEL_HPP
 
+#include <boost/align/aligned_allocator.hpp>
 #include <boost/filesystem/path.hpp>
 
 #include "common/type_aliases.hpp"
 #include "score/score_classification/value_list_scaling.hpp"
 
+#include <array>
+#include <vector>
+
 namespace cath { namespace file { class prc_scores_entry; } }
 namespace cath { namespace file { class ssap_scores_entry; } }
 namespace cath { namespace homcheck { class ssap_and_prc; } }
@@ -38,6 +42,9 @@ namespace cath {
 		/// \brief A convenience type-alias for a tuple of eight doubles
 		using double_octuple = std::tuple<double, double, double, double, double, double, double, double>;
 
+		/// \brief Type alias for a vector of double_octuple
+		using double_octuple_vec = std::vector<double_octuple>;
+
 		/// \brief Represent a SVM RBF model for a specific combination of SSAP and PRC scores
 		///
 		/// SVM: Support Vector Machine
@@ -46,17 +53,38 @@ namespace cath {
 		/// This is currently only used with SVM-light but there is nothing that in principle
 		/// ties it to that implementation
 		///
+		/// The support vectors are stored as a matrix of eight rows (one per component) and a column per
+		/// support vector (plus a row of the support vectors' weights) so that the kernel can calculate the
+		/// squared distances from a query to a block of support vectors with contiguous, branch-free loops that
+		/// the compiler can vectorise.
+		///
 		/// \todo Separate out scaling code into a different class
 		class rbf_model final {
+		public:
+			/// \brief The number of components in each of the vectors
+			static constexpr size_t NUM_COMPONENTS = std::tuple_size<double_octuple>::value;
+
+			/// \brief The number of support vectors that are processed together by the kernel
+			static constexpr size_t SUPPORT_VECTOR_BLOCK_SIZE = 64;
+
+			/// \brief The number of queries that get_scores() scores in each task
+			static constexpr size_t QUERIES_PER_TASK = 1024;
+
 		private:
+			/// \brief The type of array used to store each of the rows of the support vectors matrix
+			using sv_row = std::vector<double, boost::alignment::aligned_allocator<double, 64>>;
+
 			/// \brief The gamma parameter of the SVM RBF model
 			double gamma;
 
 			/// \brief The b parameter of the SVM RBF model
 			double b;
 
-			/// \brief The support vectors of the SVM RBF model
-			std::vector<std::pair<double, double_octuple> > support_vectors;
+			/// \brief The weights of the support vectors of the SVM RBF model
+			sv_row support_vector_weights;
+
+			/// \brief The components of the support vectors of the SVM RBF model (one row per component)
+			std::array<sv_row, NUM_COMPONENTS> support_vector_components;
 
 			/// \brief The scaling to be applied to the log10 of the PRC e-value before it's used in the SVM
 			static constexpr value_list_scaling PRC_EVALUE_SCALING     { -0.00440636400685107468,  0.0160543787343339489 };
@@ -84,7 +112,12 @@ namespace cath {
 			static double_octuple make_standard_scores(const file::prc_scores_entry &,
 			                                           const file::ssap_scores_entry &);
 
+			size_t get_num_support_vectors() const;
+
 			double get_score(const double_octuple &) const;
+
+			doub_vec get_scores(const double_octuple_vec &,
+			                    const size_t & = 1) const;
 		};
 
 		rbf_model parse_rbf_model(std::istream &);
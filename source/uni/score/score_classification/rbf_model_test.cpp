@@ -25,6 +25,7 @@
 #include "common/algorithm/contains.hpp"
 #include "common/algorithm/transform_build.hpp"
 #include "common/file/open_fstream.hpp"
+#include "common/size_t_literal.hpp"
 #include "file/prc_scores_file/prc_scores_entry.hpp"
 #include "file/prc_scores_file/prc_scores_file.hpp"
 #include "file/ssap_scores_file/ssap_scores_entry.hpp"
@@ -62,4 +63,38 @@ BOOST_AUTO_TEST_CASE(parsed_model_calculates_correct_score) {
 	BOOST_CHECK_CLOSE( get_score( the_model, the_prc_scores_entry, the_ssap_scores_entry ), 8.3668143327915736, ACCURACY_PERCENTAGE() );
 }
 
+BOOST_AUTO_TEST_CASE(batch_scores_match_individual_scores) {
+	const auto the_model = parse_rbf_model( TEST_SVM_DIR() / "cath_svm.rbf_gamma_1_c_5.model" );
+	BOOST_REQUIRE_GT( the_model.get_num_support_vectors(), rbf_model::SUPPORT_VECTOR_BLOCK_SIZE );
+
+	// Make enough queries to require several tasks
+	const auto standard_scores = rbf_model::make_standard_scores(
+		prc_scores_entry_from_line ( "1by5A02     2       554     554     1       1xkhA02 7       543     543      223.8   215.5  3.1e-185" ),
+		ssap_scores_entry_from_line( "1by5A02 1xkhA02 554 535 79.16 511 92 17 3.11" )
+	);
+	// Perturb each query differently, except for leaving the one at index QUERIES_PER_TASK equal to the standard scores
+	double_octuple_vec queries;
+	for (size_t query_ctr = 0; query_ctr < 2 * rbf_model::QUERIES_PER_TASK + 1; ++query_ctr) {
+		const double factor = static_cast<double>( query_ctr ) / static_cast<double>( rbf_model::QUERIES_PER_TASK );
+		auto query = standard_scores;
+		get<0>( query ) *= factor;
+		get<5>( query ) += factor * ( 1.0 - factor );
+		queries.push_back( query );
+	}
+
+	const auto scores_single = the_model.get_scores( queries, 1 );
+	const auto scores_multi  = the_model.get_scores( queries, 3 );
+	BOOST_REQUIRE_EQUAL( scores_single.size(), queries.size() );
+	BOOST_CHECK_EQUAL_COLLECTIONS( begin( scores_multi ), end( scores_multi ), begin( scores_single ), end( scores_single ) );
+	for (const size_t &query_ctr : { 0_z, 1_z, rbf_model::QUERIES_PER_TASK, 2 * rbf_model::QUERIES_PER_TASK } ) {
+		BOOST_CHECK_EQUAL( scores_single[ query_ctr ], the_model.get_score( queries[ query_ctr ] ) );
+	}
+	BOOST_CHECK_CLOSE( scores_single[ rbf_model::QUERIES_PER_TASK ], 8.3668143327915736, ACCURACY_PERCENTAGE() );
+}
+
+BOOST_AUTO_TEST_CASE(batch_scores_of_no_queries_are_empty) {
+	const auto the_model = parse_rbf_model( TEST_SVM_DIR() / "cath_svm.rbf_gamma_1_c_5.model" );
+	BOOST_CHECK( the_model.get_scores( {}, 4 ).empty() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
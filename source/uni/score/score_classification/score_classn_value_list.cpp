@@ -33,6 +33,7 @@
 #include <boost/range/algorithm.hpp>
 
 #include "common/algorithm/copy_build.hpp"
+#include "common/algorithm/parallel_sort.hpp"
 #include "common/algorithm/sort_uniq_copy.hpp"
 #include "common/algorithm/transform_build.hpp"
 #include "common/boost_addenda/range/adaptor/equal_grouped.hpp"
@@ -43,6 +44,9 @@
 #include "common/cpp14/cbegin_cend.hpp"
 #include "common/type_aliases.hpp"
 #include "score/score_classification/value_list_scaling.hpp"
+#include "score/true_pos_false_neg/classn_rate_stat.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series_builder.hpp"
 #include "score/true_pos_false_neg/named_true_false_pos_neg_list.hpp"
 #include "score/true_pos_false_neg/true_false_pos_neg.hpp"
 #include "score/true_pos_false_neg/true_false_pos_neg_list.hpp"
@@ -66,8 +70,11 @@ using boost::range::find_if;
 using boost::range::sort;
 
 /// \brief Private function to sort all the values in descending order of goodness
-void score_classn_value_list::sort_values() {
-	sort( score_classn_values, better_than );
+///
+/// Large lists are sorted in parallel over the specified number of threads (see parallel_sort())
+void score_classn_value_list::sort_values(const size_t &prm_num_threads ///< The maximum number of threads to use for the sort
+                                          ) {
+	parallel_sort( score_classn_values, better_than, prm_num_threads );
 }
 
 /// \brief Ctor for score_classn_value_list
@@ -75,11 +82,12 @@ void score_classn_value_list::sort_values() {
 /// For now, this is kept private to ensure clients use the factory function make_score_classn_value_list()
 score_classn_value_list::score_classn_value_list(score_classn_value_vec  prm_score_classn_values, ///< TODOCUMENT
                                                  const bool             &prm_higher_is_better,    ///< TODOCUMENT
-                                                 string                  prm_name                 ///< TODOCUMENT
+                                                 string                  prm_name,                ///< TODOCUMENT
+                                                 const size_t           &prm_num_threads          ///< The maximum number of threads to use to sort the values
                                                  ) : score_classn_values{ std::move( prm_score_classn_values ) },
                                                      better_than        { prm_higher_is_better                 },
                                                      name               { std::move( prm_name                ) } {
-	sort_values();
+	sort_values( prm_num_threads );
 }
 
 /// \brief TODOCUMENT
@@ -124,6 +132,31 @@ void score_classn_value_list::add_score_classn_value(const score_classn_value &p
 	sorted_insert( score_classn_values, prm_score_classn_value, better_than );
 }
 
+/// \brief Add many score_classn_values at once
+///
+/// This sorts the new values, appends them and then merges them with the existing values,
+/// which is O(n log n) overall, rather than the O(n^2) of calling add_score_classn_value() for each
+///
+/// As with the ctor, the order of values with equal scores is unspecified
+void score_classn_value_list::add_score_classn_values(score_classn_value_vec  prm_score_classn_values, ///< The score_classn_values to add
+                                                      const size_t           &prm_num_threads          ///< The maximum number of threads to use to sort the new values
+                                                      ) {
+	parallel_sort( prm_score_classn_values, better_than, prm_num_threads );
+
+	const auto orig_size = static_cast<ptrdiff_t>( score_classn_values.size() );
+	score_classn_values.insert(
+		std::end( score_classn_values ),
+		make_move_iterator( std::begin( prm_score_classn_values ) ),
+		make_move_iterator( std::end  ( prm_score_classn_values ) )
+	);
+	inplace_merge(
+		std::begin( score_classn_values ),
+		std::next ( std::begin( score_classn_values ), orig_size ),
+		std::end  ( score_classn_values ),
+		better_than
+	);
+}
+
 /// \brief Get the best score for a score_classn_value_list
 ///
 /// \relates score_classn_value_list
@@ -362,9 +395,10 @@ double cath::score::worst_possible_score(const score_classn_value_list &prm_scor
 /// \relates score_classn_value_list
 score_classn_value_list cath::score::make_score_classn_value_list(const score_classn_value_vec &prm_score_classn_values, ///< TODOCUMENT
                                                                   const bool                   &prm_higher_is_better,    ///< TODOCUMENT
-                                                                  const string                 &prm_name                 ///< TODOCUMENT
+                                                                  const string                 &prm_name,                ///< TODOCUMENT
+                                                                  const size_t                 &prm_num_threads          ///< The maximum number of threads to use to sort the values
                                                                   ) {
-	return score_classn_value_list( prm_score_classn_values, prm_higher_is_better, prm_name );
+	return score_classn_value_list( prm_score_classn_values, prm_higher_is_better, prm_name, prm_num_threads );
 }
 
 /// \brief TODOCUMENT
@@ -469,6 +503,33 @@ named_true_false_pos_neg_list cath::score::make_named_true_false_pos_neg_list(co
 	return { tfpns, prm_score_classn_value_list.get_name() };
 }
 
+/// \brief Make the classn_stat_pair_series (eg ROC or precision-recall curve) for the specified score_classn_value_list
+///        in one streaming pass over its (already sorted) values
+///
+/// This gives the same result as going via make_named_true_false_pos_neg_list() but without
+/// building the intermediate list of true_false_pos_neg counts
+///
+/// \relates score_classn_value_list
+classn_stat_pair_series cath::score::make_classn_stat_pair_series(const score_classn_value_list &prm_score_classn_value_list, ///< The score_classn_value_list from which the series should be made
+                                                                  const classn_stat             &prm_classn_stat_a,           ///< The classn_stat to use for the first value of each pair
+                                                                  const classn_stat             &prm_classn_stat_b            ///< The classn_stat to use for the second value of each pair
+                                                                  ) {
+	const auto reps_positive_instance = [] (const score_classn_value &x) { return x.get_instance_is_positive(); };
+	const auto better_than            = prm_score_classn_value_list.get_better_than();
+
+	const size_t total_num           = prm_score_classn_value_list.size();
+	const size_t total_num_positives = numeric_cast<size_t>( count_if( prm_score_classn_value_list, reps_positive_instance ) );
+	const size_t total_num_negatives = total_num - total_num_positives;
+
+	classn_stat_pair_series_builder the_builder{ total_num_positives, total_num_negatives, prm_classn_stat_a, prm_classn_stat_b };
+	for (const auto &equivalent_score_classn_values : prm_score_classn_value_list | equal_grouped( better_than ) ) {
+		const size_t num_in_group  = equivalent_score_classn_values.size();
+		const size_t num_positives = numeric_cast<size_t>( count_if( equivalent_score_classn_values, reps_positive_instance ) );
+		the_builder.add_predicted_positives( num_positives, num_in_group - num_positives );
+	}
+	return std::move( the_builder ).build( prm_score_classn_value_list.get_name() );
+}
+
 /// \brief TODOCUMENT
 ///
 /// \relates score_classn_value_list
@@ -477,9 +538,7 @@ double cath::score::area_under_curve(const score_classn_value_list &prm_tfpns,
                                      const classn_stat             &prm_classn_stat_y  ///< TODOCUMENT
                                      ) {
 	return area_under_curve(
-		make_named_true_false_pos_neg_list( prm_tfpns ),
-		prm_classn_stat_x,
-		prm_classn_stat_y
+		make_classn_stat_pair_series( prm_tfpns, prm_classn_stat_x, prm_classn_stat_y )
 	);
 }
 
@@ -488,7 +547,7 @@ double cath::score::area_under_curve(const score_classn_value_list &prm_tfpns,
 /// \relates score_classn_value_list
 double cath::score::area_under_roc_curve(const score_classn_value_list &prm_tfpns ///< TODOCUMENT
                                          ) {
-	return area_under_roc_curve( make_named_true_false_pos_neg_list( prm_tfpns ) );
+	return area_under_curve( prm_tfpns, roc_rates::first_type(), roc_rates::second_type() );
 }
 
 
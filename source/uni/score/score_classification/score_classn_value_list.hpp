@@ -35,6 +35,7 @@
 #include <fstream>
 
 namespace cath { namespace score { class classn_stat; } }
+namespace cath { namespace score { class classn_stat_pair_series; } }
 namespace cath { namespace score { class score_classn_value_list; } }
 namespace cath { namespace score { class named_true_false_pos_neg_list; } }
 
@@ -42,7 +43,8 @@ namespace cath {
 	namespace score {
 		score_classn_value_list make_score_classn_value_list(const score_classn_value_vec &,
 		                                                     const bool &,
-		                                                     const std::string &);
+		                                                     const std::string &,
+		                                                     const size_t & = 1);
 
 		/// \brief TODOCUMENT
 		///
@@ -52,7 +54,8 @@ namespace cath {
 		private:
 			friend score_classn_value_list cath::score::make_score_classn_value_list(const score_classn_value_vec &,
 			                                                                         const bool &,
-			                                                                         const std::string &);
+			                                                                         const std::string &,
+			                                                                         const size_t &);
 
 			/// \brief A vector of score_classn_value objects
 			///
@@ -67,11 +70,12 @@ namespace cath {
 			/// This will often be the algorithm or scoring-scheme that generated the scores
 			std::string name;
 
-			void sort_values();
+			void sort_values(const size_t &);
 
 			score_classn_value_list(score_classn_value_vec,
 			                        const bool &,
-			                        std::string);
+			                        std::string,
+			                        const size_t &);
 
 		public:
 			using const_iterator = score_classn_value_vec_citr;
@@ -90,6 +94,8 @@ namespace cath {
 			const score_classn_value_better_value & get_better_than() const;
 
 			void add_score_classn_value(const score_classn_value &);
+			void add_score_classn_values(score_classn_value_vec,
+			                             const size_t & = 1);
 		};
 
 //		void fill_missing_instance_labels_with_score(score_classn_value_list &);
@@ -123,7 +129,8 @@ namespace cath {
 
 		score_classn_value_list make_score_classn_value_list(const score_classn_value_vec &,
 		                                                     const bool &,
-		                                                     const std::string &);
+		                                                     const std::string &,
+		                                                     const size_t &);
 
 		doub_doub_pair_vec correlated_data(const score_classn_value_list &,
 		                                   const score_classn_value_list &);
@@ -175,6 +182,10 @@ namespace cath {
 
 		named_true_false_pos_neg_list make_named_true_false_pos_neg_list(const score_classn_value_list &);
 
+		classn_stat_pair_series make_classn_stat_pair_series(const score_classn_value_list &,
+		                                                     const classn_stat &,
+		                                                     const classn_stat &);
+
 		double area_under_curve(const score_classn_value_list &,
 		                        const classn_stat &,
 		                        const classn_stat &);
@@ -22,8 +22,13 @@
 
 #include "score_classn_value_list.hpp"
 
+#include "score/true_pos_false_neg/classn_rate_stat.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series.hpp"
+#include "score/true_pos_false_neg/named_true_false_pos_neg_list.hpp"
 //#include "test/global_test_constants.hpp"
 
+#include <random>
+
 using namespace cath::score;
 //using namespace std;
 
@@ -34,6 +39,34 @@ namespace cath {
 		struct score_classn_value_list_test_suite_fixture {
 		protected:
 			~score_classn_value_list_test_suite_fixture() noexcept = default;
+
+			/// \brief Make the specified number of score_classn_values with pseudo-random scores (with plenty of ties) and labels
+			static score_classn_value_vec make_random_values(const size_t &prm_num_values, ///< The number of score_classn_values to make
+			                                                 const size_t &prm_seed        ///< The seed for the random number generator
+			                                                 ) {
+				std::mt19937 rng{ static_cast<std::mt19937::result_type>( prm_seed ) };
+				std::uniform_int_distribution<int> score_dist{ 0, 50 };
+				std::bernoulli_distribution        positive_dist{ 0.3 };
+				score_classn_value_vec values;
+				for (size_t value_ctr = 0; value_ctr < prm_num_values; ++value_ctr) {
+					values.emplace_back(
+						static_cast<double>( score_dist( rng ) ) / 10.0,
+						positive_dist( rng ),
+						std::to_string( prm_seed ) + "_" + std::to_string( value_ctr )
+					);
+				}
+				return values;
+			}
+
+			/// \brief Get the scores of the specified score_classn_value_list in order
+			static doub_vec get_scores(const score_classn_value_list &prm_list ///< The score_classn_value_list to query
+			                           ) {
+				doub_vec scores;
+				for (const score_classn_value &the_value : prm_list) {
+					scores.push_back( the_value.get_score_value() );
+				}
+				return scores;
+			}
 		};
 
 	}
@@ -47,5 +80,41 @@ BOOST_AUTO_TEST_CASE(basic) {
 	BOOST_CHECK( true );
 }
 
+/// \brief Check that adding values in bulk gives the same ordering of scores as adding them one at a time
+BOOST_AUTO_TEST_CASE(bulk_add_matches_individual_adds) {
+	for (const bool &higher_is_better : { true, false } ) {
+		const auto initial_values = make_random_values( 200, 1 );
+		const auto extra_values   = make_random_values( 300, 2 );
+
+		auto individual_list = make_score_classn_value_list( initial_values, higher_is_better, "individual" );
+		for (const score_classn_value &extra_value : extra_values) {
+			individual_list.add_score_classn_value( extra_value );
+		}
+		auto bulk_list = make_score_classn_value_list( initial_values, higher_is_better, "bulk", 3 );
+		bulk_list.add_score_classn_values( extra_values, 3 );
+
+		BOOST_REQUIRE_EQUAL( bulk_list.size(), individual_list.size() );
+		const auto bulk_scores       = get_scores( bulk_list       );
+		const auto individual_scores = get_scores( individual_list );
+		BOOST_CHECK_EQUAL_COLLECTIONS( bulk_scores.begin(), bulk_scores.end(), individual_scores.begin(), individual_scores.end() );
+	}
+}
+
+/// \brief Check that the streamed classn_stat_pair_series matches that made via a named_true_false_pos_neg_list
+BOOST_AUTO_TEST_CASE(streamed_series_matches_series_via_true_false_pos_neg_list) {
+	const auto the_list = make_score_classn_value_list( make_random_values( 500, 3 ), true, "streamed" );
+
+	const auto streamed_series = make_classn_stat_pair_series( the_list, roc_rates::first_type(), roc_rates::second_type() );
+	const auto tfpn_series     = get_roc_series( make_named_true_false_pos_neg_list( the_list ) );
+
+	BOOST_CHECK_EQUAL  ( streamed_series.get_name(), tfpn_series.get_name() );
+	BOOST_REQUIRE_EQUAL( streamed_series.size(),     tfpn_series.size()     );
+	for (size_t pair_ctr = 0; pair_ctr < streamed_series.size(); ++pair_ctr) {
+		BOOST_CHECK_EQUAL( streamed_series[ pair_ctr ].first,  tfpn_series[ pair_ctr ].first  );
+		BOOST_CHECK_EQUAL( streamed_series[ pair_ctr ].second, tfpn_series[ pair_ctr ].second );
+	}
+	BOOST_CHECK_EQUAL( area_under_roc_curve( the_list ), area_under_curve( tfpn_series ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -55,6 +55,8 @@
 #include "score/true_pos_false_neg/named_true_false_pos_neg_list_list.hpp"
 #include "score/true_pos_false_neg/true_false_pos_neg.hpp"
 
+#include <tuple>
+
 using namespace cath;
 using namespace cath::common;
 using namespace cath::score;
@@ -176,17 +178,12 @@ void score_classn_value_results_set::add_score_classn_value_list(const score_cla
 	score_classn_value_lists.insert( insert_location_itr, prm_score_classn_value_list );
 }
 
-/// \brief TODOCUMENT
-///
-/// \todo Could this be generalised (perhaps with a non-member function
-///       to make it convenient for the particulars of aligned_pair_score_value_list) ?
-void score_classn_value_results_set::add_aligned_pair_score_value_list(const aligned_pair_score_value_list &prm_aligned_pair_score_value_list, ///< TODOCUMENT
-                                                                       const bool                          &prm_condition_is_positive,         ///< TODOCUMENT
-                                                                       const string                        &prm_instance_label                 ///< TODOCUMENT
-                                                                       ) {
-	const size_t num_score_values = prm_aligned_pair_score_value_list.size();
+/// \brief Initialise the (empty) score_classn_value_lists from the names in the specified aligned_pair_score_value_list
+///        or, if there are already score_classn_value_lists, check the names match and throw if not
+void score_classn_value_results_set::init_or_check_names(const aligned_pair_score_value_list &prm_aligned_pair_score_value_list ///< The aligned_pair_score_value_list whose names should be used/checked
+                                                         ) {
 	if ( empty() ) {
-		for (const size_t &score_value_ctr : indices( num_score_values ) ) {
+		for (const size_t &score_value_ctr : indices( prm_aligned_pair_score_value_list.size() ) ) {
 			const auto   &score            = prm_aligned_pair_score_value_list.get_aligned_pair_score_of_index( score_value_ctr );
 			const string &name             = score.human_friendly_short_name();
 			const bool   &higher_is_better = is_true( score.higher_is_better() );
@@ -209,25 +206,80 @@ void score_classn_value_results_set::add_aligned_pair_score_value_list(const ali
 			BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot add aligned_pair_score_value_list because the series names don't match the existing ones"));
 		}
 	}
+}
 
-	for (const size_t &score_value_ctr : indices( num_score_values ) ) {
+/// \brief TODOCUMENT
+///
+/// \todo Could this be generalised (perhaps with a non-member function
+///       to make it convenient for the particulars of aligned_pair_score_value_list) ?
+void score_classn_value_results_set::add_aligned_pair_score_value_list(const aligned_pair_score_value_list &prm_aligned_pair_score_value_list, ///< TODOCUMENT
+                                                                       const bool                          &prm_condition_is_positive,         ///< TODOCUMENT
+                                                                       const string                        &prm_instance_label                 ///< TODOCUMENT
+                                                                       ) {
+	add_aligned_pair_score_value_lists( { make_tuple(
+		prm_aligned_pair_score_value_list,
+		prm_condition_is_positive,
+		prm_instance_label
+	) } );
+}
+
+/// \brief Add many aligned_pair_score_value_lists (each with whether its instance is positive and its label) at once
+///
+/// This gathers all the new values for each score_classn_value_list and then adds them to it in one
+/// bulk add_score_classn_values() call, which is much faster than adding them one at a time
+/// when there are many aligned_pair_score_value_lists.
+void score_classn_value_results_set::add_aligned_pair_score_value_lists(const aligned_pair_score_value_list_bool_str_tpl_vec &prm_entries,    ///< The aligned_pair_score_value_lists to add, each with whether its instance is positive and its label
+                                                                        const size_t                                         &prm_num_threads ///< The maximum number of threads to use to sort each score_classn_value_list's new values
+                                                                        ) {
+	score_classn_value_vec_vec new_values;
+	for (const auto &the_entry : prm_entries) {
+		append_new_values( new_values, get<0>( the_entry ), get<1>( the_entry ), get<2>( the_entry ) );
+	}
+	add_new_values( std::move( new_values ), prm_num_threads );
+}
+
+/// \brief Append the values of the specified aligned_pair_score_value_list to the specified new values
+///        (one vector per score_classn_value_list, in the same order) so they can later be added with add_new_values()
+///
+/// This initialises the (empty) score_classn_value_lists from the aligned_pair_score_value_list's names
+/// or, if there are already score_classn_value_lists, checks that the names match.
+///
+/// This allows many aligned_pair_score_value_lists to be converted one at a time (eg as each is read from a file)
+/// so that only their values, rather than the whole aligned_pair_score_value_lists, need to be held until they're added.
+void score_classn_value_results_set::append_new_values(score_classn_value_vec_vec          &prm_new_values,                    ///< The new values to which the values should be appended
+                                                       const aligned_pair_score_value_list &prm_aligned_pair_score_value_list, ///< The aligned_pair_score_value_list whose values should be appended
+                                                       const bool                          &prm_condition_is_positive,         ///< Whether the instance is positive
+                                                       const string                        &prm_instance_label                 ///< The label of the instance
+                                                       ) {
+	init_or_check_names( prm_aligned_pair_score_value_list );
+	prm_new_values.resize( size() );
+
+	for (const size_t &score_value_ctr : indices( prm_aligned_pair_score_value_list.size() ) ) {
 		const auto   &value            = prm_aligned_pair_score_value_list.get_value_of_index             ( score_value_ctr );
 		const auto   &score            = prm_aligned_pair_score_value_list.get_aligned_pair_score_of_index( score_value_ctr );
 		const string &name             = score.human_friendly_short_name();
 		const bool   &higher_is_better = is_true( score.higher_is_better() );
 
-		score_classn_value_list &the_list = get_score_classn_value_list_of_name( name );
-		if ( get_higher_is_better( the_list ) != higher_is_better ) {
+		const auto    list_itr         = lower_bound( score_classn_value_lists, name, score_classn_value_list_name_less{} );
+		const size_t  list_index       = static_cast<size_t>( distance( score_classn_value_lists.begin(), list_itr ) );
+		if ( get_higher_is_better( score_classn_value_lists[ list_index ] ) != higher_is_better ) {
 			BOOST_THROW_EXCEPTION(invalid_argument_exception( "Cannot add aligned_pair_score_value_list to score_classn_value_results_set because they conflict regarding the higher_is_better value for score " + name ));
 		}
 
-		the_list.add_score_classn_value(
-			score_classn_value(
-				value,
-				prm_condition_is_positive,
-				prm_instance_label
-			)
-		);
+		prm_new_values[ list_index ].emplace_back( value, prm_condition_is_positive, prm_instance_label );
+	}
+}
+
+/// \brief Add the specified new values (one vector per score_classn_value_list, in the same order,
+///        as built by append_new_values()) to the score_classn_value_lists in bulk
+void score_classn_value_results_set::add_new_values(score_classn_value_vec_vec  prm_new_values, ///< The new values to add
+                                                    const size_t               &prm_num_threads ///< The maximum number of threads to use to sort each score_classn_value_list's new values
+                                                    ) {
+	if ( prm_new_values.size() > size() ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot add new values for more score_classn_value_lists than the score_classn_value_results_set contains"));
+	}
+	for (const size_t &list_ctr : indices( prm_new_values.size() ) ) {
+		score_classn_value_lists[ list_ctr ].add_score_classn_values( std::move( prm_new_values[ list_ctr ] ), prm_num_threads );
 	}
 }
 
@@ -435,16 +487,20 @@ void cath::score::add_score_classn_value_list_and_add_missing(score_classn_value
 		}
 
 		// For each entry in the results_set that's in the missing list, add an equivalent to the value_list
+		// (gathering them all up first so they can be added in one bulk operation)
+		score_classn_value_vec missing_values;
+		missing_values.reserve( missing_instance_labels.size() );
 		for (const score_classn_value &the_value : front( prm_results_set ) ) {
 			const auto &instance_label = the_value.get_instance_label();
 			if ( contains( missing_instance_labels, instance_label ) ) {
-				prm_score_classn_value_list.add_score_classn_value( score_classn_value(
+				missing_values.emplace_back(
 					prm_score_for_missing,
 					the_value.get_instance_is_positive(),
 					instance_label
-				) );
+				);
 			}
 		}
+		prm_score_classn_value_list.add_score_classn_values( std::move( missing_values ) );
 	}
 
 	// Use the standard results_set method to add the now complete value_list
@@ -578,13 +634,14 @@ classn_stat_pair_series_list cath::score::make_classn_stat_pair_series_list(cons
                                                                             const classn_stat                    &prm_classn_stat_a,                  ///< TODOCUMENT
                                                                             const classn_stat                    &prm_classn_stat_b                   ///< TODOCUMENT
                                                                             ) {
-	return make_classn_stat_pair_series_list(
-		make_named_true_false_pos_neg_list_list(
-			prm_score_classn_value_results_set
-		),
-		prm_classn_stat_a,
-		prm_classn_stat_b
-	);
+	return classn_stat_pair_series_list{
+		transform_build<classn_stat_pair_series_vec>(
+			prm_score_classn_value_results_set,
+			[&] (const score_classn_value_list &x) {
+				return make_classn_stat_pair_series( x, prm_classn_stat_a, prm_classn_stat_b );
+			}
+		)
+	};
 }
 
 /// \brief TODOCUMENT
@@ -594,13 +651,14 @@ classn_stat_pair_series_list cath::score::make_classn_stat_pair_series_list(cons
                                                                             const classn_stat                 &prm_classn_stat_a,            ///< TODOCUMENT
                                                                             const classn_stat                 &prm_classn_stat_b             ///< TODOCUMENT
                                                                             ) {
-	return make_classn_stat_pair_series_list(
-		make_named_true_false_pos_neg_list_list(
-			prm_score_classn_value_lists
-		),
-		prm_classn_stat_a,
-		prm_classn_stat_b
-	);
+	return classn_stat_pair_series_list{
+		transform_build<classn_stat_pair_series_vec>(
+			prm_score_classn_value_lists,
+			[&] (const score_classn_value_list &x) {
+				return make_classn_stat_pair_series( x, prm_classn_stat_a, prm_classn_stat_b );
+			}
+		)
+	};
 }
 
 /// \brief TODOCUMENT
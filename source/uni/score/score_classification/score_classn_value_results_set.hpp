@@ -34,8 +34,10 @@
 #include "score/score_type_aliases.hpp"
 #include "score/true_pos_false_neg/classn_stat_pair_series_list.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <thread>
 
 namespace cath { namespace score { class aligned_pair_score_value_list; } }
 namespace cath { namespace score { class classn_stat; } }
@@ -82,6 +84,7 @@ namespace cath {
 			bool is_sorted_uniqued() const;
 			void check_is_sorted_uniqued() const;
 			void sort_score_classn_value_lists();
+			void init_or_check_names(const aligned_pair_score_value_list &);
 
 			/// \brief const-agnostic implementation of get_score_classn_value_list_of_name()
 			///
@@ -122,6 +125,14 @@ namespace cath {
 			void add_aligned_pair_score_value_list(const aligned_pair_score_value_list &,
 			                                       const bool &,
 			                                       const std::string &);
+			void add_aligned_pair_score_value_lists(const aligned_pair_score_value_list_bool_str_tpl_vec &,
+			                                        const size_t & = 1);
+			void append_new_values(score_classn_value_vec_vec &,
+			                       const aligned_pair_score_value_list &,
+			                       const bool &,
+			                       const std::string &);
+			void add_new_values(score_classn_value_vec_vec,
+			                    const size_t & = 1);
 		};
 
 		score_classn_value_results_set make_score_classn_value_results_set(const score_classn_value_list_vec &);
@@ -201,9 +212,14 @@ namespace cath {
 		///
 		/// FN should take a single boost::filesystem::path and return optional<pair<bool, string>>,
 		/// representing files that should be processed with a bool indicating whether it's a positive instance and a label
+		///
+		/// Each file's values are converted as soon as it's read (so only the values, not the files' whole
+		/// aligned_pair_score_value_lists, are held) and then all the values are added in one go, so that
+		/// each score_classn_value_list is sorted once (using up to prm_num_threads threads) rather than per added value
 		template <typename FN>
-		score_classn_value_results_set read_from_dir(const boost::filesystem::path &prm_directory,                     ///< TODOCUMENT
-		                                             const FN                       prm_positive_and_label_of_filename ///< TODOCUMENT
+		score_classn_value_results_set read_from_dir(const boost::filesystem::path &prm_directory,                      ///< TODOCUMENT
+		                                             const FN                       prm_positive_and_label_of_filename, ///< TODOCUMENT
+		                                             const size_t                  &prm_num_threads = std::max<size_t>( 1, std::thread::hardware_concurrency() ) ///< The maximum number of threads with which to sort each score_classn_value_list's values
 		                                             ) {
 			if ( ! boost::filesystem::is_directory( prm_directory ) ) {
 				BOOST_THROW_EXCEPTION(cath::common::invalid_argument_exception("Cannot read_from_dir() for non-directory path"));
@@ -215,6 +231,7 @@ namespace cath {
 			);
 
 			score_classn_value_results_set the_results;
+			score_classn_value_vec_vec     new_values;
 			size_t read_file_ctr = 0;
 			size_t file_ctr      = 0;
 			for (const auto &dir_entry : the_dir_range) {
@@ -222,9 +239,9 @@ namespace cath {
 				const auto  positive_and_label = prm_positive_and_label_of_filename( the_filename );
 				if ( positive_and_label ) {
 					std::cerr << "About to attempt to read file " << std::right << std::setw(6) << read_file_ctr << " / " << file_ctr << " : " << the_filename << std::endl;
-					const auto the_scores = score_value_reader::read( the_filename );
-					the_results.add_aligned_pair_score_value_list(
-						the_scores,
+					the_results.append_new_values(
+						new_values,
+						score_value_reader::read( the_filename ),
 						positive_and_label->first,
 						positive_and_label->second
 					);
@@ -238,6 +255,8 @@ namespace cath {
 //					break;
 //				}
 			}
+
+			the_results.add_new_values( std::move( new_values ), prm_num_threads );
 			return the_results;
 		}
 
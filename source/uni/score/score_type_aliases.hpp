@@ -26,10 +26,13 @@
 #include <boost/ptr_container/ptr_map.hpp>
 
 #include <cstddef>
+#include <string>
+#include <tuple>
 #include <vector>
 
 namespace cath { namespace homcheck { class ssap_and_prc; } }
 namespace cath { namespace score { class aligned_pair_score; } }
+namespace cath { namespace score { class aligned_pair_score_value_list; } }
 namespace cath { namespace score { class classn_stat_pair_series; } }
 namespace cath { namespace score { class named_true_false_pos_neg_list; } }
 namespace cath { namespace score { class score_classn_value; } }
@@ -57,6 +60,13 @@ namespace cath {
 		using str_aligned_pair_score_pmap = boost::ptr_map<std::string, aligned_pair_score>;
 
 
+		/// \brief Type alias for an aligned_pair_score_value_list for an instance, with whether that instance is positive and its label
+		using aligned_pair_score_value_list_bool_str_tpl     = std::tuple<aligned_pair_score_value_list, bool, std::string>;
+
+		/// \brief Type alias for a vector of aligned_pair_score_value_list_bool_str_tpl objects
+		using aligned_pair_score_value_list_bool_str_tpl_vec = std::vector<aligned_pair_score_value_list_bool_str_tpl>;
+
+
 		/// \brief TODOCUMENT
 		using classn_stat_pair_series_vec      = std::vector<classn_stat_pair_series>;
 
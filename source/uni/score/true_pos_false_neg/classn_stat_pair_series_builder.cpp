@@ -0,0 +1,73 @@
+/// \file
+/// \brief The classn_stat_pair_series_builder class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "classn_stat_pair_series_builder.hpp"
+
+#include "score/true_pos_false_neg/classn_stat.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series.hpp"
+
+#include <utility>
+
+using namespace cath;
+using namespace cath::score;
+using namespace std;
+
+/// \brief Add the pair of statistics for the current running_tfpn to the back of the data
+void classn_stat_pair_series_builder::add_current_pair() {
+	data.emplace_back(
+		calculate_and_convert( classn_stat_a.get(), running_tfpn ),
+		calculate_and_convert( classn_stat_b.get(), running_tfpn )
+	);
+}
+
+/// \brief Ctor from the total numbers of positive and negative instances and the two statistics to calculate
+///
+/// This adds the first pair, for which all instances are predicted negative
+classn_stat_pair_series_builder::classn_stat_pair_series_builder(const size_t      &prm_num_positives, ///< The total number of positive instances
+                                                                 const size_t      &prm_num_negatives, ///< The total number of negative instances
+                                                                 const classn_stat &prm_classn_stat_a, ///< The classn_stat to use for the first value of each pair
+                                                                 const classn_stat &prm_classn_stat_b  ///< The classn_stat to use for the second value of each pair
+                                                                 ) : classn_stat_a { prm_classn_stat_a                                  },
+                                                                     classn_stat_b { prm_classn_stat_b                                  },
+                                                                     running_tfpn  { 0, prm_num_negatives, 0, prm_num_positives } {
+	add_current_pair();
+}
+
+/// \brief Move the next group of (equivalently-scored) instances from being predicted negative
+///        to being predicted positive and add the resulting pair of statistics
+void classn_stat_pair_series_builder::add_predicted_positives(const size_t &prm_num_positives, ///< The number of positive instances in the group
+                                                              const size_t &prm_num_negatives  ///< The number of negative instances in the group
+                                                              ) {
+	update_with_predicted_positives( running_tfpn, prm_num_positives, prm_num_negatives );
+	add_current_pair();
+}
+
+/// \brief Getter for the running counts of true/false positives/negatives
+const true_false_pos_neg & classn_stat_pair_series_builder::get_running_tfpn() const {
+	return running_tfpn;
+}
+
+/// \brief Build the classn_stat_pair_series from the pairs of statistics, with the specified name
+///
+/// This moves the data out of the (rvalue) builder
+classn_stat_pair_series classn_stat_pair_series_builder::build(string prm_name ///< The name for the series
+                                                               ) && {
+	return classn_stat_pair_series{ std::move( data ), std::move( prm_name ) };
+}
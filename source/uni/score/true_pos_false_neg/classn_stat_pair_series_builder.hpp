@@ -0,0 +1,74 @@
+/// \file
+/// \brief The classn_stat_pair_series_builder class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_SCORE_TRUE_POS_FALSE_NEG_CLASSN_STAT_PAIR_SERIES_BUILDER_HPP
+#define _CATH_TOOLS_SOURCE_UNI_SCORE_TRUE_POS_FALSE_NEG_CLASSN_STAT_PAIR_SERIES_BUILDER_HPP
+
+#include "common/type_aliases.hpp"
+#include "score/true_pos_false_neg/true_false_pos_neg.hpp"
+
+#include <functional>
+#include <string>
+
+namespace cath { namespace score { class classn_stat; } }
+namespace cath { namespace score { class classn_stat_pair_series; } }
+
+namespace cath {
+	namespace score {
+
+		/// \brief Build a classn_stat_pair_series (eg a ROC or precision-recall curve) in a single streaming pass
+		///        over the groups of equivalently-scored instances, from best to worst
+		///
+		/// This only stores the running true_false_pos_neg counts and the resulting pairs of statistics,
+		/// rather than a true_false_pos_neg for each group (as in true_false_pos_neg_list)
+		class classn_stat_pair_series_builder final {
+		private:
+			/// \brief The classn_stat to use for the first value of each pair
+			std::reference_wrapper<const classn_stat> classn_stat_a;
+
+			/// \brief The classn_stat to use for the second value of each pair
+			std::reference_wrapper<const classn_stat> classn_stat_b;
+
+			/// \brief The running counts of true/false positives/negatives
+			true_false_pos_neg running_tfpn;
+
+			/// \brief The pairs of statistics calculated so far
+			doub_doub_pair_vec data;
+
+			void add_current_pair();
+
+		public:
+			classn_stat_pair_series_builder(const size_t &,
+			                                const size_t &,
+			                                const classn_stat &,
+			                                const classn_stat &);
+
+			void add_predicted_positives(const size_t &,
+			                             const size_t &);
+
+			const true_false_pos_neg & get_running_tfpn() const;
+
+			classn_stat_pair_series build(std::string) &&;
+		};
+
+	} // namespace score
+} // namespace cath
+
+#endif
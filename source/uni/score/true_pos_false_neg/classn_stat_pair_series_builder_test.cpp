@@ -0,0 +1,98 @@
+/// \file
+/// \brief The classn_stat_pair_series_builder test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/type_aliases.hpp"
+#include "score/true_pos_false_neg/classn_rate_stat.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series.hpp"
+#include "score/true_pos_false_neg/classn_stat_pair_series_builder.hpp"
+#include "score/true_pos_false_neg/true_false_pos_neg_list.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
+using namespace cath::score;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The classn_stat_pair_series_builder_test_suite_fixture to assist in testing classn_stat_pair_series_builder
+		struct classn_stat_pair_series_builder_test_suite_fixture: protected global_test_constants {
+		protected:
+			~classn_stat_pair_series_builder_test_suite_fixture() noexcept = default;
+
+			/// \brief Check that the two specified classn_stat_pair_series match
+			static void check_series_match(const classn_stat_pair_series &prm_got,     ///< The classn_stat_pair_series that was built
+			                               const classn_stat_pair_series &prm_expected ///< The expected classn_stat_pair_series
+			                               ) {
+				BOOST_CHECK_EQUAL( prm_got.get_name(), prm_expected.get_name() );
+				BOOST_REQUIRE_EQUAL( prm_got.size(), prm_expected.size() );
+				for (size_t pair_ctr = 0; pair_ctr < prm_got.size(); ++pair_ctr) {
+					BOOST_CHECK_EQUAL( prm_got[ pair_ctr ].first,  prm_expected[ pair_ctr ].first  );
+					BOOST_CHECK_EQUAL( prm_got[ pair_ctr ].second, prm_expected[ pair_ctr ].second );
+				}
+			}
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+/// \brief Test the classn_stat_pair_series_builder
+BOOST_FIXTURE_TEST_SUITE(classn_stat_pair_series_builder_test_suite, cath::test::classn_stat_pair_series_builder_test_suite_fixture)
+
+/// \brief Check that a builder with no groups gives just the point for which everything is predicted negative
+BOOST_AUTO_TEST_CASE(builds_single_point_with_no_groups) {
+	const auto got_series = classn_stat_pair_series_builder{ 2, 3, roc_rates::first_type(), roc_rates::second_type() }.build( "empty" );
+	BOOST_REQUIRE_EQUAL( got_series.size(), 1 );
+	BOOST_CHECK_EQUAL( got_series[ 0 ].first,  0.0 );
+	BOOST_CHECK_EQUAL( got_series[ 0 ].second, 0.0 );
+}
+
+/// \brief Check that the builder's ROC and precision-recall series match those from a full true_false_pos_neg_list
+BOOST_AUTO_TEST_CASE(matches_series_from_true_false_pos_neg_list) {
+	const size_t num_positives = 4;
+	const size_t num_negatives = 5;
+	const size_size_pair_vec groups = { { 1, 0 }, { 1, 1 }, { 0, 2 }, { 2, 1 }, { 0, 1 } };
+
+	true_false_pos_neg running_tfpn{ 0, num_negatives, 0, num_positives };
+	true_false_pos_neg_vec tfpns = { running_tfpn };
+	classn_stat_pair_series_builder roc_builder{ num_positives, num_negatives, roc_rates::first_type(),              roc_rates::second_type()              };
+	classn_stat_pair_series_builder pr_builder { num_positives, num_negatives, precision_recall_rates::first_type(), precision_recall_rates::second_type() };
+	for (const size_size_pair &group : groups) {
+		update_with_predicted_positives( running_tfpn, group.first, group.second );
+		tfpns.push_back( running_tfpn );
+		roc_builder.add_predicted_positives( group.first, group.second );
+		pr_builder.add_predicted_positives ( group.first, group.second );
+	}
+	BOOST_CHECK_EQUAL( get_num_true_positives ( roc_builder.get_running_tfpn() ), get_num_true_positives ( running_tfpn ) );
+	BOOST_CHECK_EQUAL( get_num_false_positives( roc_builder.get_running_tfpn() ), get_num_false_positives( running_tfpn ) );
+
+	const true_false_pos_neg_list tfpn_list{ tfpns };
+	check_series_match(
+		std::move( roc_builder ).build( "roc" ),
+		get_roc_series( tfpn_list, "roc" )
+	);
+	check_series_match(
+		std::move( pr_builder ).build( "pr" ),
+		get_classn_stat_pair_series( tfpn_list, "pr", precision_recall_rates::first_type(), precision_recall_rates::second_type() )
+	);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
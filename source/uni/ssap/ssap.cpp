@@ -142,6 +142,7 @@
 #include "common/exception/out_of_range_exception.hpp"
 #include "common/file/open_fstream.hpp"
 #include "common/logger.hpp"
+#include "common/optional/make_optional_if.hpp"
 #include "common/size_t_literal.hpp"
 #include "common/string/booled_to_string.hpp"
 #include "common/temp_check_offset_1.hpp"
@@ -162,6 +163,7 @@
 #include "structure/protein/residue.hpp"
 #include "structure/protein/sec_struc.hpp"
 #include "structure/protein/sec_struc_planar_angles.hpp"
+#include "structure/view_cache/view_cache.hpp"
 #include "superposition/io/superposition_io.hpp"
 #include "superposition/superposition.hpp"
 
@@ -169,6 +171,7 @@
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 using namespace cath;
@@ -188,6 +191,8 @@ using boost::irange;
 using boost::lexical_cast;
 using boost::none;
 using boost::numeric_cast;
+using boost::optional;
+using cath::index::view_cache;
 using boost::range::stable_sort;
 using std::abs;
 using std::boolalpha;
@@ -199,6 +204,7 @@ using std::max;
 using std::min;
 using std::ofstream;
 using std::ostream;
+using std::ostringstream;
 using std::pair;
 using std::setprecision;
 using std::string;
@@ -224,6 +230,12 @@ constexpr size_t     SEC_STRUC_PLANAR_A_ANGLE =  60;
 constexpr size_t     SEC_STRUC_PLANAR_B_ANGLE =   6;
 constexpr size_t     SEC_STRUC_PLANAR_C_ANGLE =  10;
 
+/// \brief The maximum protein length for which align_proteins() will pre-compute a view_cache of all the
+///        residue-to-residue views (which are otherwise recalculated on every residue comparison)
+///
+/// A view_cache holds length^2 coords (24 bytes each) so this keeps each one under 100MB
+constexpr size_t     MAX_LENGTH_TO_CACHE_VIEWS = 2000;
+
 // \todo Put these matrices in classes. This will help with:
 //        - decent memory management
 //        - passing the matrices to subroutines rather than using them globally
@@ -231,44 +243,51 @@ constexpr size_t     SEC_STRUC_PLANAR_C_ANGLE =  10;
 //       Also, I suspect that quite a bit of complication throughout the file is just indexing these matrices,
 //       which should be encapsulated.
 
+// These are thread_local so that independent SSAPs can run concurrently on separate threads
+// (eg under do_the_ssaps_alignment_acquirer). Each SSAP must still start with a call to
+// reset_ssap_global_variables() on the thread on which it runs.
+
 /// \brief Matrix of upper scores
-score_vec_of_vec global_upper_score_matrix;
+thread_local score_vec_of_vec global_upper_score_matrix;
 
 /// \brief Matrix to mask out comparisons that should be skipped whilst performing upper-matrix residue comparisons
-bool_vec_of_vec  global_upper_res_mask_matrix;
+thread_local bool_vec_of_vec  global_upper_res_mask_matrix;
 
 /// \brief Matrix to mask out comparisons that should be skipped whilst performing upper-matrix, secondary-structure comparisons
-bool_vec_of_vec  global_upper_ss_mask_matrix;
+thread_local bool_vec_of_vec  global_upper_ss_mask_matrix;
 
 /// \brief Matrix to mask out comparisons that should be skipped whilst performing lower-matrix (residue or secondary structure) comparisons
-bool_vec_of_vec  global_lower_mask_matrix;
+thread_local bool_vec_of_vec  global_lower_mask_matrix;
 
-size_size_pair_vec global_selections;              ///< Selected region within matrix
+thread_local size_size_pair_vec global_selections;              ///< Selected region within matrix
 
-size_t             global_num_selections  =     0; ///< The number of selected top-scoring residue pairs
-size_t             global_window          =     0; ///< The size of the window to
-size_t             global_window_add      =    70; ///< The amount that should be added to the difference in lengths to calculate window size
-size_t             global_res_sim_cutoff  =   150; ///<
+thread_local size_t             global_num_selections  =     0; ///< The number of selected top-scoring residue pairs
+thread_local size_t             global_window          =     0; ///< The size of the window to
+thread_local size_t             global_window_add      =    70; ///< The amount that should be added to the difference in lengths to calculate window size
+thread_local size_t             global_res_sim_cutoff  =   150; ///<
 
-ptrdiff_t          global_run_counter     =     0; ///<
+thread_local ptrdiff_t          global_run_counter     =     0; ///<
 
-score_type         global_gap_penalty     =    50; ///< The gap penalty to be used in dynamic programming
+thread_local score_type         global_gap_penalty     =    50; ///< The gap penalty to be used in dynamic programming
 
-bool               global_debug           = false; ///< Whether to output debug messages
-bool               global_align_pass      = false; ///< Whether the pass is a later, refining alignment pass
-bool               global_supaln          =  true; ///<
-bool               global_doing_fast_ssap =  true; ///< Whether currently performing a fast SSAP
-bool               global_res_score       = false; ///<
+thread_local bool               global_debug           = false; ///< Whether to output debug messages
+thread_local bool               global_align_pass      = false; ///< Whether the pass is a later, refining alignment pass
+thread_local bool               global_supaln          =  true; ///<
+thread_local bool               global_doing_fast_ssap =  true; ///< Whether currently performing a fast SSAP
+thread_local bool               global_res_score       = false; ///<
 
-double             global_frac_selected   =   0.0; ///<
+thread_local double             global_frac_selected   =   0.0; ///<
 
-double             global_score_run1      =   0.0; ///<
-double             global_score_run2      =   0.0; ///<
-double             global_ssap_score1     =   0.0; ///<
-double             global_ssap_score2     =   0.0; ///<
+thread_local double             global_score_run1      =   0.0; ///<
+thread_local double             global_score_run2      =   0.0; ///<
+thread_local double             global_ssap_score1     =   0.0; ///<
+thread_local double             global_ssap_score2     =   0.0; ///<
 
-char               global_ssap_line1[SSAP_LINE_LENGTH]; ///<
-char               global_ssap_line2[SSAP_LINE_LENGTH]; ///<
+thread_local char               global_ssap_line1[SSAP_LINE_LENGTH]; ///<
+thread_local char               global_ssap_line2[SSAP_LINE_LENGTH]; ///<
+
+thread_local bool               global_capture_alignment = false; ///< Whether to capture the alignment in global_captured_alignment rather than writing it to a file
+thread_local str_opt            global_captured_alignment;        ///< The legacy-SSAP-format alignment captured whilst global_capture_alignment is set
 
 /// \brief Reset all the global variable that are used by SSAP
 ///
@@ -303,6 +322,8 @@ void cath::reset_ssap_global_variables() {
 	global_ssap_score2     =   0.0;
 	fill_n(global_ssap_line1, SSAP_LINE_LENGTH, 0);
 	fill_n(global_ssap_line2, SSAP_LINE_LENGTH, 0);
+	global_capture_alignment  = false;
+	global_captured_alignment = none;
 }
 
 /// \brief Temporary setter for global_run_counter to allow tests to check their fixtures are
@@ -508,6 +529,73 @@ void cath::run_ssap(const cath_ssap_options &prm_cath_ssap_options, ///< The cat
 }
 
 
+/// \brief SSAP a pair of structures as directed by a cath_ssap_options object, keeping the results in memory
+///
+/// This writes no scores or alignment files: it returns the scores output that run_ssap() would write
+/// and the legacy-SSAP-format alignment (if any) that run_ssap() would write to the alignment directory.
+///
+/// This only uses SSAP's (thread_local) global variables on the calling thread so independent pairs
+/// can be SSAPed concurrently on separate threads.
+///
+/// \returns A pair of the scores output and the optional legacy-SSAP-format alignment
+pair<string, str_opt> cath::run_ssap_in_memory(const cath_ssap_options &prm_cath_ssap_options, ///< The cath_ssap options
+                                               ostream                 &prm_stderr             ///< The ostream to which any stderr-like output should be written
+                                               ) {
+	const prot_prot_pair proteins = read_protein_pair( prm_cath_ssap_options, prm_stderr );
+	return run_ssap_in_memory( proteins.first, proteins.second, prm_cath_ssap_options );
+}
+
+/// \brief SSAP the specified pair of (already-read) proteins as directed by a cath_ssap_options object,
+///        keeping the results in memory
+///
+/// This allows callers that SSAP many pairs to read each protein once and share it between
+/// all the pairs in which it appears. The proteins are only read, so they may be shared
+/// between concurrent calls on separate threads.
+///
+/// \returns A pair of the scores output and the optional legacy-SSAP-format alignment
+pair<string, str_opt> cath::run_ssap_in_memory(const protein           &prm_protein_a,         ///< The first protein
+                                               const protein           &prm_protein_b,         ///< The second protein
+                                               const cath_ssap_options &prm_cath_ssap_options  ///< The cath_ssap options
+                                               ) {
+	// Start by resetting the SSAP global variables
+	reset_ssap_global_variables();
+
+	// If the options are invalid or specify to do_nothing, then throw
+	const auto &error_or_help_string = prm_cath_ssap_options.get_error_or_help_string();
+	if ( error_or_help_string ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception(
+			"Unable to run in-memory SSAP with invalid options: " + *error_or_help_string
+		));
+	}
+
+	global_debug             = prm_cath_ssap_options.get_old_ssap_options().get_debug();
+	global_capture_alignment = true;
+	global_run_counter       = 0;
+
+	const old_ssap_options_block &the_ssap_options = prm_cath_ssap_options.get_old_ssap_options();
+	const data_dirs_spec         &the_data_dirs    = prm_cath_ssap_options.get_data_dirs_spec();
+
+	ostringstream scores_ss;
+	if ( prm_protein_a.get_length() == 0 || prm_protein_b.get_length() == 0 ) {
+		save_zero_scores( prm_protein_a, prm_protein_b, 2 );
+		scores_ss << global_ssap_line2 << "\n";
+	}
+	else {
+		align_proteins( prm_protein_a, prm_protein_b, the_ssap_options, the_data_dirs );
+		print_ssap_scores(
+			scores_ss,
+			global_ssap_score1,
+			global_ssap_score2,
+			global_ssap_line1,
+			global_ssap_line2,
+			global_run_counter,
+			the_ssap_options.get_write_all_scores()
+		);
+	}
+
+	return { scores_ss.str(), global_captured_alignment };
+}
+
 /// \brief Align structures
 ///
 /// JEB v1.12 12.09.2002
@@ -520,6 +608,14 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
                           ) {
 	BOOST_LOG_TRIVIAL( debug ) << "Function: alnseq";
 
+	// Compute the views between all residue pairs in each protein once, up front, so that the
+	// residue comparisons (in fast SSAP and slow SSAP) can look them up rather than recalculating them
+	const bool                 cache_views  = ( max( prm_protein_a.get_length(), prm_protein_b.get_length() ) <= MAX_LENGTH_TO_CACHE_VIEWS );
+	const optional<view_cache> view_cache_a = make_optional_if_fn( cache_views, [&] { return view_cache{ prm_protein_a }; } );
+	const optional<view_cache> view_cache_b = make_optional_if_fn( cache_views, [&] { return view_cache{ prm_protein_b }; } );
+	const residue_querier      the_residue_querier = cache_views
+		? residue_querier{ prm_protein_a, *view_cache_a, prm_protein_b, *view_cache_b }
+		: residue_querier{};
 	// Set alignment options
 	global_res_score   = false;
 	global_align_pass  = false;
@@ -533,7 +629,7 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
 	if ( !prm_ssap_options.get_slow_ssap_only() ) {
 		// Check for minimum number of secondary structures
 		if (prm_protein_a.get_num_sec_strucs() > 1 && prm_protein_b.get_num_sec_strucs() > 1) {
-			fast_ssap_scores         = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs);
+			fast_ssap_scores         = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs, the_residue_querier);
 			const double first_score = fast_ssap_scores.get_ssap_score_over_larger();
 
 //			if (DEBUG) {
@@ -557,7 +653,7 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
 				global_window_add     =  1000;
 				global_window         = max( prm_protein_a.get_num_sec_strucs(), prm_protein_b.get_num_sec_strucs() );
 
-				fast_ssap_scores          = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs);
+				fast_ssap_scores          = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs, the_residue_querier);
 				const double second_score = fast_ssap_scores.get_ssap_score_over_larger();
 
 				// Re-run original alignment if it doesn't give a better score
@@ -576,7 +672,7 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
 					global_window_add     =    70;
 					global_window         = max( prm_protein_a.get_num_sec_strucs(), prm_protein_b.get_num_sec_strucs() );
 
-					fast_ssap_scores = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs);
+					fast_ssap_scores = fast_ssap(prm_protein_a, prm_protein_b, prm_ssap_options, prm_data_dirs, the_residue_querier);
 				}
 			}
 		}
@@ -619,7 +715,7 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
 
 			global_align_pass = ( pass_ctr > 1 );
 			if (pass_ctr == 1 || (pass_ctr == 2 && global_res_score))  {
-				compare( prm_protein_a, prm_protein_b, pass_ctr, residue_querier(), prm_ssap_options, prm_data_dirs, none );
+				compare( prm_protein_a, prm_protein_b, pass_ctr, the_residue_querier, prm_ssap_options, prm_data_dirs, none );
 			}
 		}
 	}
@@ -630,10 +726,11 @@ void cath::align_proteins(const protein                 &prm_protein_a,    ///<
 
 
 /// \brief Function to run fast SSAP
-ssap_scores cath::fast_ssap(const protein                 &prm_protein_a,    ///< The first protein
-                            const protein                 &prm_protein_b,    ///< The second protein
-                            const old_ssap_options_block  &prm_ssap_options, ///< The old_ssap_options_block to specify how things should be done
-                            const data_dirs_spec          &prm_data_dirs     ///< The data directories from which data should be read
+ssap_scores cath::fast_ssap(const protein                 &prm_protein_a,       ///< The first protein
+                            const protein                 &prm_protein_b,       ///< The second protein
+                            const old_ssap_options_block  &prm_ssap_options,    ///< The old_ssap_options_block to specify how things should be done
+                            const data_dirs_spec          &prm_data_dirs,       ///< The data directories from which data should be read
+                            const residue_querier         &prm_residue_querier  ///< The residue_querier to use for the residue comparisons (possibly with cached views)
                             ) {
 	ssap_scores new_ssap_scores;
 
@@ -664,7 +761,7 @@ ssap_scores cath::fast_ssap(const protein                 &prm_protein_a,    ///
 		BOOST_LOG_TRIVIAL( debug ) << "Function: fast_ssap:  pass=" << pass_ctr;
 		global_align_pass = ( pass_ctr > 1 );
 		if ( pass_ctr == 1 || ( pass_ctr == 2 && global_res_score ) ) {
-			const pair<ssap_scores, alignment> tmp_scores_and_aln = compare( prm_protein_a, prm_protein_b, pass_ctr, residue_querier(), prm_ssap_options, prm_data_dirs, sec_struc_alignment );
+			const pair<ssap_scores, alignment> tmp_scores_and_aln = compare( prm_protein_a, prm_protein_b, pass_ctr, prm_residue_querier, prm_ssap_options, prm_data_dirs, sec_struc_alignment );
 			new_ssap_scores = tmp_scores_and_aln.first;
 		}
 	}
@@ -2110,17 +2207,26 @@ ssap_scores cath::plot_aln(const protein                 &prm_protein_a,     ///
 					<< " "
 					<< to_string( prm_protein_b.get_name_set() )
 					;
-				const path alignment_out_file = prm_ssap_options.get_alignment_dir() / (
-					  get_domain_or_specified_or_name_from_acq( prm_protein_a )
-					+ get_domain_or_specified_or_name_from_acq( prm_protein_b )
-					+ ".list"
-				);
-				write_alignment_as_cath_ssap_legacy_format(
-					alignment_out_file,
-					prm_alignment,
-					prm_protein_a,
-					prm_protein_b
-				);
+				if ( global_capture_alignment ) {
+					global_captured_alignment = to_cath_ssap_legacy_format_alignment_string(
+						prm_alignment,
+						prm_protein_a,
+						prm_protein_b
+					);
+				}
+				else {
+					const path alignment_out_file = prm_ssap_options.get_alignment_dir() / (
+						  get_domain_or_specified_or_name_from_acq( prm_protein_a )
+						+ get_domain_or_specified_or_name_from_acq( prm_protein_b )
+						+ ".list"
+					);
+					write_alignment_as_cath_ssap_legacy_format(
+						alignment_out_file,
+						prm_alignment,
+						prm_protein_a,
+						prm_protein_b
+					);
+				}
 			}
 		}
 	}
@@ -38,6 +38,7 @@ namespace cath { class entry_querier;           }
 namespace cath { class protein;                 }
 namespace cath { class protein_source_file_set; }
 namespace cath { class residue;                 }
+namespace cath { class residue_querier;         }
 namespace cath { class sec_struc;               }
 namespace cath { class selected_pair;           }
 namespace cath { class ssap_scores;             }
@@ -70,6 +71,13 @@ namespace cath {
 	              std::ostream & = std::cerr,
 	              const ostream_ref_opt & = boost::none);
 
+	std::pair<std::string, str_opt> run_ssap_in_memory(const opts::cath_ssap_options &,
+	                                                   std::ostream & = std::cerr);
+
+	std::pair<std::string, str_opt> run_ssap_in_memory(const protein &,
+	                                                   const protein &,
+	                                                   const opts::cath_ssap_options &);
+
 	void align_proteins(const protein &,
 	                    const protein &,
 	                    const opts::old_ssap_options_block &,
@@ -78,7 +86,8 @@ namespace cath {
 	ssap_scores fast_ssap(const protein &,
 	                      const protein &,
 	                      const opts::old_ssap_options_block &,
-	                      const opts::data_dirs_spec &);
+	                      const opts::data_dirs_spec &,
+	                      const residue_querier &);
 
 	std::pair<ssap_scores, align::alignment> compare(const protein &,
 	                                                 const protein &,
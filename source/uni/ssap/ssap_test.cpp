@@ -26,10 +26,14 @@
 #include "chopping/region/region.hpp"
 #include "common/boost_addenda/log/stringstream_log_sink.hpp"
 #include "common/boost_addenda/range/indices.hpp"
+#include "common/file/read_string_from_file.hpp"
 #include "common/file/simple_file_read_write.hpp"
+#include "common/file/temp_file.hpp"
 #include "common/size_t_literal.hpp"
 #include "common/type_aliases.hpp"
 #include "file/options/data_dirs_options_block.hpp"
+#include "ssap/options/cath_ssap_options.hpp"
+#include "ssap/options/old_ssap_options_block.hpp"
 #include "ssap/ssap.hpp"
 #include "structure/protein/protein.hpp"
 #include "structure/protein/protein_source_file_set/protein_from_wolf_and_sec.hpp"
@@ -44,6 +48,10 @@ using namespace cath::common;
 using namespace cath::opts;
 using namespace std;
 
+using boost::filesystem::create_directory;
+using boost::filesystem::exists;
+using boost::filesystem::path;
+using boost::filesystem::remove;
 using boost::none;
 
 namespace cath {
@@ -242,5 +250,48 @@ BOOST_FIXTURE_TEST_CASE(residues_have_similar_area_angle_props_1a04A02_1fseB00,
 	check_residues_have_similar_area_angle_props();
 }
 
+BOOST_AUTO_TEST_CASE(in_memory_ssap_matches_ssap_with_output_files) {
+	// Make a temporary directory to which run_ssap() can write the alignment file
+	const temp_file alignment_dir_file{ ".ssap_test_aln_dir.%%%%-%%%%-%%%%-%%%%" };
+	const path      alignment_dir = get_filename( alignment_dir_file );
+	create_directory( alignment_dir );
+	const path      alignment_file = alignment_dir / ( id_1a04A02 + id_1fseB00 + ".list" );
+
+	const auto the_cath_ssap_options = make_and_parse_options<cath_ssap_options>(
+		str_vec{
+			cath_ssap_options::PROGRAM_NAME,
+			id_1a04A02,
+			id_1fseB00,
+			"--pdb-path",                                TEST_SSAP_REGRESSION_DATA_DIR().string(),
+			"--" + old_ssap_options_block::PO_ALIGN_DIR, alignment_dir.string()
+		},
+		parse_sources::CMND_LINE_ONLY
+	);
+
+	// Run SSAP, writing the scores to a stream and the alignment to a file
+	ostringstream file_scores_ss;
+	ostringstream stdout_ss;
+	ostringstream stderr_ss;
+	run_ssap( the_cath_ssap_options, stdout_ss, stderr_ss, ostream_ref{ file_scores_ss } );
+	BOOST_REQUIRE( exists( alignment_file ) );
+	const string file_alignment = read_string_from_file( alignment_file );
+	remove( alignment_file );
+
+	// Check that running SSAP in memory gives the same results, both when reading the proteins
+	// and when using proteins that have already been read
+	const auto in_memory_results = run_ssap_in_memory( the_cath_ssap_options, stderr_ss );
+	BOOST_CHECK_EQUAL( in_memory_results.first, file_scores_ss.str() );
+	BOOST_REQUIRE    ( in_memory_results.second );
+	BOOST_CHECK_EQUAL( *in_memory_results.second, file_alignment );
+
+	const prot_prot_pair proteins = read_protein_pair( the_cath_ssap_options, stderr_ss );
+	const auto preread_results = run_ssap_in_memory( proteins.first, proteins.second, the_cath_ssap_options );
+	BOOST_CHECK_EQUAL( preread_results.first, file_scores_ss.str() );
+	BOOST_REQUIRE    ( preread_results.second );
+	BOOST_CHECK_EQUAL( *preread_results.second, file_alignment );
+
+	BOOST_CHECK_EQUAL( stdout_ss.str(), "" );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
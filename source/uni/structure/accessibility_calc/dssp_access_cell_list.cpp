@@ -0,0 +1,255 @@
+/// \file
+/// \brief The dssp_access_cell_list class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dssp_access_cell_list.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include "common/debug_numeric_cast.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "file/pdb/pdb.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::geom;
+using namespace cath::sec;
+
+using boost::math::constants::pi;
+using std::floor;
+using std::max;
+using std::min;
+
+constexpr double dssp_access_cell_list::DEFAULT_CELL_SIZE;
+
+/// \brief Get the index of the cell in one dimension that contains the specified value
+size_t dssp_access_cell_list::cell_of_value(const double &prm_value,    ///< The value (eg an atom's x coordinate)
+                                            const double &prm_min_value, ///< The minimum value of the grid in this dimension
+                                            const size_t &prm_num_cells  ///< The number of cells in this dimension
+                                            ) const {
+	const double cell = floor( ( prm_value - prm_min_value ) / cell_size );
+	return min(
+		debug_numeric_cast<size_t>( max( cell, 0.0 ) ),
+		prm_num_cells - 1
+	);
+}
+
+/// \brief Get the index of the cell with the specified x, y and z cell indices
+size_t dssp_access_cell_list::cell_index(const size_t &prm_cell_x, ///< The index of the cell in the x dimension
+                                         const size_t &prm_cell_y, ///< The index of the cell in the y dimension
+                                         const size_t &prm_cell_z  ///< The index of the cell in the z dimension
+                                         ) const {
+	return ( ( prm_cell_x * num_cells_y ) + prm_cell_y ) * num_cells_z + prm_cell_z;
+}
+
+/// \brief Ctor from the PDB whose atoms should be stored
+///
+/// This sorts the atoms into cells with a counting sort so the build is linear in the number of atoms
+dssp_access_cell_list::dssp_access_cell_list(const pdb    &prm_pdb,      ///< The PDB whose atoms should be stored
+                                             const double &prm_cell_size ///< The width of the cubic cells (which should be at least MAX_ATOM_DIST)
+                                             ) : cell_size( prm_cell_size ) {
+	if ( ! ( cell_size >= detail::dssp_ball_constants::MAX_ATOM_DIST ) ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("The cell size of a dssp_access_cell_list must be at least the maximum atom distance"));
+	}
+
+	atom_coords.reserve( prm_pdb.get_num_atoms() );
+	atom_radii.reserve ( prm_pdb.get_num_atoms() );
+	residue_atom_begins.reserve( prm_pdb.get_num_residues() + 1 );
+	for (const pdb_residue &the_residue : prm_pdb) {
+		residue_atom_begins.push_back( atom_coords.size() );
+		for (const pdb_atom &the_atom : the_residue) {
+			atom_coords.push_back( the_atom.get_coord()                        );
+			atom_radii.push_back ( get_dssp_access_radius_with_water( the_atom ) );
+		}
+	}
+	residue_atom_begins.push_back( atom_coords.size() );
+
+	if ( atom_coords.empty() ) {
+		return;
+	}
+
+	coord max_corner = atom_coords.front();
+	min_corner       = atom_coords.front();
+	for (const coord &atom_coord : atom_coords) {
+		min_corner = coord{ min( min_corner.get_x(), atom_coord.get_x() ), min( min_corner.get_y(), atom_coord.get_y() ), min( min_corner.get_z(), atom_coord.get_z() ) };
+		max_corner = coord{ max( max_corner.get_x(), atom_coord.get_x() ), max( max_corner.get_y(), atom_coord.get_y() ), max( max_corner.get_z(), atom_coord.get_z() ) };
+	}
+	const auto num_cells_of_extent = [&] (const double &x) {
+		return debug_numeric_cast<size_t>( floor( x / cell_size ) ) + 1;
+	};
+	num_cells_x = num_cells_of_extent( max_corner.get_x() - min_corner.get_x() );
+	num_cells_y = num_cells_of_extent( max_corner.get_y() - min_corner.get_y() );
+	num_cells_z = num_cells_of_extent( max_corner.get_z() - min_corner.get_z() );
+
+	size_vec atom_cells;
+	atom_cells.reserve( atom_coords.size() );
+	for (const coord &atom_coord : atom_coords) {
+		atom_cells.push_back( cell_index(
+			cell_of_value( atom_coord.get_x(), min_corner.get_x(), num_cells_x ),
+			cell_of_value( atom_coord.get_y(), min_corner.get_y(), num_cells_y ),
+			cell_of_value( atom_coord.get_z(), min_corner.get_z(), num_cells_z )
+		) );
+	}
+
+	cell_atom_begins.assign( num_cells_x * num_cells_y * num_cells_z + 1, 0 );
+	for (const size_t &atom_cell : atom_cells) {
+		++cell_atom_begins[ atom_cell + 1 ];
+	}
+	std::partial_sum( cell_atom_begins.begin(), cell_atom_begins.end(), cell_atom_begins.begin() );
+
+	size_vec next_free_slots( cell_atom_begins.begin(), std::prev( cell_atom_begins.end() ) );
+	cell_atom_indices.resize( atom_coords.size() );
+	for (size_t atom_ctr = 0; atom_ctr < atom_cells.size(); ++atom_ctr) {
+		cell_atom_indices[ next_free_slots[ atom_cells[ atom_ctr ] ]++ ] = atom_ctr;
+	}
+}
+
+/// \brief Get the number of atoms
+size_t dssp_access_cell_list::get_num_atoms() const {
+	return atom_coords.size();
+}
+
+/// \brief Get the number of residues
+size_t dssp_access_cell_list::get_num_residues() const {
+	return residue_atom_begins.size() - 1;
+}
+
+/// \brief Get the coordinates of the atom of the specified index
+const coord & dssp_access_cell_list::get_atom_coord(const size_t &prm_atom_index ///< The index of the atom to query
+                                                    ) const {
+	return atom_coords[ prm_atom_index ];
+}
+
+/// \brief Get the DSSP accessibility radius (including the water radius) of the atom of the specified index
+const double & dssp_access_cell_list::get_atom_radius_with_water(const size_t &prm_atom_index ///< The index of the atom to query
+                                                                 ) const {
+	return atom_radii[ prm_atom_index ];
+}
+
+/// \brief Get the index of the first atom of the residue of the specified index
+const size_t & dssp_access_cell_list::get_residue_atoms_begin(const size_t &prm_residue_index ///< The index of the residue to query
+                                                              ) const {
+	return residue_atom_begins[ prm_residue_index ];
+}
+
+/// \brief Get the index of one-past the last atom of the residue of the specified index
+const size_t & dssp_access_cell_list::get_residue_atoms_end(const size_t &prm_residue_index ///< The index of the residue to query
+                                                            ) const {
+	return residue_atom_begins[ prm_residue_index + 1 ];
+}
+
+/// \brief Get the indices of the atoms that might overlap with the accessibility sphere of the atom of the specified index
+///
+/// These are the atoms whose spheres are within reach of the atom's sphere, excluding any atoms
+/// at the same position (including the atom itself)
+size_vec dssp_access_cell_list::get_overlap_candidates(const size_t &prm_atom_index ///< The index of the atom to query
+                                                       ) const {
+	const coord  &the_coord  = atom_coords[ prm_atom_index ];
+	const double &the_radius = atom_radii [ prm_atom_index ];
+	const size_t  cell_x     = cell_of_value( the_coord.get_x(), min_corner.get_x(), num_cells_x );
+	const size_t  cell_y     = cell_of_value( the_coord.get_y(), min_corner.get_y(), num_cells_y );
+	const size_t  cell_z     = cell_of_value( the_coord.get_z(), min_corner.get_z(), num_cells_z );
+
+	// A little slack is allowed for the ball points not being exactly of unit length
+	constexpr double SLACK = DEFAULT_CELL_SIZE - detail::dssp_ball_constants::MAX_ATOM_DIST;
+
+	size_vec candidates;
+	for (size_t x = ( cell_x > 0 ? cell_x - 1 : 0 ); x <= min( cell_x + 1, num_cells_x - 1 ); ++x) {
+		for (size_t y = ( cell_y > 0 ? cell_y - 1 : 0 ); y <= min( cell_y + 1, num_cells_y - 1 ); ++y) {
+			for (size_t z = ( cell_z > 0 ? cell_z - 1 : 0 ); z <= min( cell_z + 1, num_cells_z - 1 ); ++z) {
+				const size_t the_cell = cell_index( x, y, z );
+				for (size_t entry_ctr = cell_atom_begins[ the_cell ]; entry_ctr < cell_atom_begins[ the_cell + 1 ]; ++entry_ctr) {
+					const size_t &other_index = cell_atom_indices[ entry_ctr ];
+					const coord  &other_coord = atom_coords[ other_index ];
+					const double  reach       = the_radius + atom_radii[ other_index ] + SLACK;
+					if ( other_coord != the_coord && squared_distance_between_points( the_coord, other_coord ) <= reach * reach ) {
+						candidates.push_back( other_index );
+					}
+				}
+			}
+		}
+	}
+	std::sort( candidates.begin(), candidates.end() );
+	return candidates;
+}
+
+/// \brief Get the accessibility count for the atom of the specified index in the specified dssp_access_cell_list
+///
+/// This gives the same result as get_accessibility_count(const pdb_atom &, const pdb &, const size_t &) but
+/// only checks each ball point against the atoms that might overlap it and stops on the first overlap,
+/// starting with whichever atom last overlapped (because neighbouring ball points are often covered by the same atom)
+size_t cath::sec::get_accessibility_count(const dssp_access_cell_list &prm_cell_list,  ///< The dssp_access_cell_list containing the atom
+                                          const size_t                &prm_atom_index, ///< The index of the atom for which the accessibility should be calculated
+                                          const coord_vec             &prm_ball_points ///< The unit ball points (as made by make_dssp_ball_points())
+                                          ) {
+	const size_vec  candidates     = prm_cell_list.get_overlap_candidates( prm_atom_index );
+	const size_t    num_candidates = candidates.size();
+	const coord    &the_coord      = prm_cell_list.get_atom_coord( prm_atom_index );
+	const double   &radius         = prm_cell_list.get_atom_radius_with_water( prm_atom_index );
+
+	size_t count        = 0;
+	size_t last_overlap = 0;
+	for (const coord &orig_ball_point : prm_ball_points) {
+		const coord point         = the_coord + ( radius * orig_ball_point );
+		bool        found_overlap = false;
+		for (size_t cand_ctr = 0; cand_ctr < num_candidates && ! found_overlap; ++cand_ctr) {
+			const size_t  cand_offset  = ( last_overlap + cand_ctr ) % num_candidates;
+			const size_t &other_index  = candidates[ cand_offset ];
+			const double &other_radius = prm_cell_list.get_atom_radius_with_water( other_index );
+			if ( squared_distance_between_points( point, prm_cell_list.get_atom_coord( other_index ) ) <= ( other_radius * other_radius ) ) {
+				found_overlap = true;
+				last_overlap  = cand_offset;
+			}
+		}
+		if ( ! found_overlap ) {
+			++count;
+		}
+	}
+	return count;
+}
+
+/// \brief Calculate the accessibility surface-area for the atom of the specified index in the specified dssp_access_cell_list
+double cath::sec::get_accessibility_surface_area(const dssp_access_cell_list &prm_cell_list,  ///< The dssp_access_cell_list containing the atom
+                                                 const size_t                &prm_atom_index, ///< The index of the atom for which the accessibility should be calculated
+                                                 const coord_vec             &prm_ball_points ///< The unit ball points (as made by make_dssp_ball_points())
+                                                 ) {
+	const double &radius              = prm_cell_list.get_atom_radius_with_water( prm_atom_index );
+	const double  sphere_surface_area = 4.0 * pi<double>() * radius * radius;
+	const double  fraction            = debug_numeric_cast<double>( get_accessibility_count( prm_cell_list, prm_atom_index, prm_ball_points ) )
+	                                  / debug_numeric_cast<double>( prm_ball_points.size() );
+	return fraction * sphere_surface_area;
+}
+
+/// \brief Calculate the accessibility surface-area for the residue of the specified index in the specified dssp_access_cell_list
+double cath::sec::get_residue_accessibility_surface_area(const dssp_access_cell_list &prm_cell_list,     ///< The dssp_access_cell_list containing the residue
+                                                         const size_t                &prm_residue_index, ///< The index of the residue for which the accessibility should be calculated
+                                                         const coord_vec             &prm_ball_points    ///< The unit ball points (as made by make_dssp_ball_points())
+                                                         ) {
+	double surface_area = 0.0;
+	for (size_t atom_ctr = prm_cell_list.get_residue_atoms_begin( prm_residue_index ); atom_ctr < prm_cell_list.get_residue_atoms_end( prm_residue_index ); ++atom_ctr) {
+		surface_area += get_accessibility_surface_area( prm_cell_list, atom_ctr, prm_ball_points );
+	}
+	return surface_area;
+}
@@ -0,0 +1,113 @@
+/// \file
+/// \brief The dssp_access_cell_list class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_ACCESSIBILITY_CALC_DSSP_ACCESS_CELL_LIST_HPP
+#define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_ACCESSIBILITY_CALC_DSSP_ACCESS_CELL_LIST_HPP
+
+#include "common/type_aliases.hpp"
+#include "structure/accessibility_calc/dssp_accessibility.hpp"
+#include "structure/geometry/coord.hpp"
+#include "structure/structure_type_aliases.hpp"
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace sec {
+
+		/// \brief Store the atoms of a PDB in a cell list (a grid of cubes, each at least as wide as the
+		///        furthest that two atoms' accessibility spheres can reach) so that the atoms that
+		///        might overlap one atom's accessibility sphere can be found by just checking the
+		///        27 cells around it rather than every atom in the PDB
+		///
+		/// The atoms are indexed in the order of the PDB's residues (and of the atoms within each residue)
+		class dssp_access_cell_list final {
+		private:
+			/// \brief The coordinates of the atoms
+			geom::coord_vec atom_coords;
+
+			/// \brief The DSSP accessibility radius (including the water radius) of each of the atoms
+			doub_vec atom_radii;
+
+			/// \brief The index of the first atom of each residue, followed by the total number of atoms
+			size_vec residue_atom_begins;
+
+			/// \brief The corner of the grid with the minimum x, y and z values
+			geom::coord min_corner = geom::coord::ORIGIN_COORD;
+
+			/// \brief The width of each of the cubic cells
+			double cell_size;
+
+			/// \brief The number of cells in the x dimension
+			size_t num_cells_x = 0;
+
+			/// \brief The number of cells in the y dimension
+			size_t num_cells_y = 0;
+
+			/// \brief The number of cells in the z dimension
+			size_t num_cells_z = 0;
+
+			/// \brief The offset into cell_atom_indices of the first atom of each cell, followed by the total number of atoms
+			size_vec cell_atom_begins;
+
+			/// \brief The indices of the atoms, grouped by cell
+			size_vec cell_atom_indices;
+
+			size_t cell_of_value(const double &,
+			                     const double &,
+			                     const size_t &) const;
+
+			size_t cell_index(const size_t &,
+			                  const size_t &,
+			                  const size_t &) const;
+
+		public:
+			/// \brief The default cell size, a little larger than the furthest that two atoms'
+			///        accessibility spheres can reach, to leave room for rounding errors
+			static constexpr double DEFAULT_CELL_SIZE = detail::dssp_ball_constants::MAX_ATOM_DIST + 0.01;
+
+			explicit dssp_access_cell_list(const file::pdb &,
+			                               const double & = DEFAULT_CELL_SIZE);
+
+			size_t get_num_atoms() const;
+			size_t get_num_residues() const;
+			const geom::coord & get_atom_coord(const size_t &) const;
+			const double & get_atom_radius_with_water(const size_t &) const;
+			const size_t & get_residue_atoms_begin(const size_t &) const;
+			const size_t & get_residue_atoms_end(const size_t &) const;
+
+			size_vec get_overlap_candidates(const size_t &) const;
+		};
+
+		size_t get_accessibility_count(const dssp_access_cell_list &,
+		                               const size_t &,
+		                               const geom::coord_vec &);
+
+		double get_accessibility_surface_area(const dssp_access_cell_list &,
+		                                      const size_t &,
+		                                      const geom::coord_vec &);
+
+		double get_residue_accessibility_surface_area(const dssp_access_cell_list &,
+		                                              const size_t &,
+		                                              const geom::coord_vec &);
+
+	} // namespace sec
+} // namespace cath
+
+#endif
@@ -0,0 +1,81 @@
+/// \file
+/// \brief The dssp_access_cell_list test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dssp_access_cell_list.hpp"
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/size_t_literal.hpp"
+#include "file/pdb/pdb.hpp"
+#include "test/boost_addenda/boost_check_equal_ranges.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::geom;
+using namespace cath::sec;
+
+BOOST_AUTO_TEST_SUITE(dssp_access_cell_list_test_suite)
+
+BOOST_AUTO_TEST_CASE(indexes_atoms_by_residue) {
+	const auto                  parsed_pdb = read_pdb_file( global_test_constants::EXAMPLE_A_PDB_FILENAME() );
+	const dssp_access_cell_list cell_list{ parsed_pdb };
+	BOOST_REQUIRE_EQUAL( cell_list.get_num_residues(), parsed_pdb.get_num_residues() );
+	BOOST_CHECK_EQUAL  ( cell_list.get_num_atoms(),    parsed_pdb.get_num_atoms()    );
+
+	const pdb_residue &the_res = parsed_pdb.get_residue_of_index__backbone_unchecked( 3 );
+	BOOST_REQUIRE_EQUAL( cell_list.get_residue_atoms_end( 3 ) - cell_list.get_residue_atoms_begin( 3 ), the_res.get_num_atoms() );
+	BOOST_CHECK_EQUAL  ( cell_list.get_atom_coord( cell_list.get_residue_atoms_begin( 3 ) ), the_res.get_atom_cref_of_index( 0 ).get_coord() );
+}
+
+BOOST_AUTO_TEST_CASE(overlap_candidates_match_all_atoms_within_reach) {
+	const auto                  parsed_pdb = read_pdb_file( global_test_constants::EXAMPLE_A_PDB_FILENAME() );
+	const dssp_access_cell_list cell_list{ parsed_pdb };
+	for (const size_t &atom_ctr : { 0_z, 27_z, 500_z, cell_list.get_num_atoms() - 1 }) {
+		const coord  &the_coord  = cell_list.get_atom_coord( atom_ctr );
+		size_vec      expected;
+		for (size_t other_ctr = 0; other_ctr < cell_list.get_num_atoms(); ++other_ctr) {
+			const coord  &other_coord = cell_list.get_atom_coord( other_ctr );
+			const double  reach       = cell_list.get_atom_radius_with_water( atom_ctr )
+			                          + cell_list.get_atom_radius_with_water( other_ctr )
+			                          + dssp_access_cell_list::DEFAULT_CELL_SIZE
+			                          - sec::detail::dssp_ball_constants::MAX_ATOM_DIST;
+			if ( other_coord != the_coord && squared_distance_between_points( the_coord, other_coord ) <= reach * reach ) {
+				expected.push_back( other_ctr );
+			}
+		}
+		BOOST_CHECK( ! expected.empty() );
+		BOOST_CHECK_EQUAL_RANGES( cell_list.get_overlap_candidates( atom_ctr ), expected );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(handles_empty_pdb) {
+	const dssp_access_cell_list cell_list{ pdb{} };
+	BOOST_CHECK_EQUAL( cell_list.get_num_atoms(),    0_z );
+	BOOST_CHECK_EQUAL( cell_list.get_num_residues(), 0_z );
+}
+
+BOOST_AUTO_TEST_CASE(rejects_cell_size_smaller_than_max_atom_dist) {
+	BOOST_CHECK_THROW( dssp_access_cell_list( pdb{}, 1.0 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -32,9 +32,13 @@
 #include "file/pdb/pdb.hpp"
 #include "scan/detail/scan_index_store/scan_index_store_helper.hpp"
 #include "scan/spatial_index/spatial_index.hpp"
+#include "structure/accessibility_calc/dssp_access_cell_list.hpp"
 #include "structure/geometry/coord.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <deque>
+#include <future>
 
 using namespace cath;
 using namespace cath::common;
@@ -50,6 +54,9 @@ using boost::math::constants::pi;
 using boost::none;
 using boost::numeric_cast;
 using boost::range::count;
+using std::deque;
+using std::future;
+using std::min;
 using std::plus;
 using std::sqrt;
 using std::vector;
@@ -62,6 +69,28 @@ constexpr double dssp_ball_constants::RADIUS_O;
 constexpr double dssp_ball_constants::RADIUS_SIDE_ATOM;
 constexpr double dssp_ball_constants::RADIUS_WATER;
 constexpr double dssp_ball_constants::MAX_ATOM_DIST;
+constexpr size_t dssp_ball_constants::RESIDUES_PER_TASK;
+
+namespace cath {
+	namespace sec {
+		namespace detail {
+
+			/// \brief Get the ball points for the specified number, reusing a cached copy for the default number
+			///        and otherwise making them into the specified storage
+			inline const coord_vec & dssp_ball_points_of_number(const size_t &prm_number, ///< The number to use to specify the sphere of points
+			                                                    coord_vec    &prm_storage ///< Storage for the ball points if they aren't of the default number
+			                                                    ) {
+				static const coord_vec default_ball_points = make_dssp_ball_points( dssp_ball_constants::NUMBER );
+				if ( prm_number == dssp_ball_constants::NUMBER ) {
+					return default_ball_points;
+				}
+				prm_storage = make_dssp_ball_points( prm_number );
+				return prm_storage;
+			}
+
+		} // namespace detail
+	} // namespace sec
+} // namespace cath
 
 /// \brief Make a load of points on teh surface of a unit sphere for accessibility calculations
 coord_vec cath::sec::make_dssp_ball_points(const size_t &prm_number ///< The input number (just copying DSSP code here; the actual number of points is 2 * this + 1)
@@ -142,21 +171,24 @@ size_t cath::sec::get_accessibility_count(const pdb_atom &prm_pdb_atom, ///< The
                                           const pdb      &prm_pdb,      ///< The PDB in which the accesibility should be calculated 
                                           const size_t   &prm_number    ///< The number to use to specify the sphere of points (tip: you should probably just use the default value)
                                           ) {
-	const coord_vec ball_points = make_dssp_ball_points( prm_number );
-	const double    radius      = get_dssp_access_radius_with_water( prm_pdb_atom );
+	coord_vec        ball_points_storage;
+	const coord_vec &ball_points = dssp_ball_points_of_number( prm_number, ball_points_storage );
+	const double     radius      = get_dssp_access_radius_with_water( prm_pdb_atom );
 
-	size_t count = 0;
-	for (const coord &orig_ball_point : ball_points) {
-		const coord ball_point = radius * orig_ball_point;
-		bool found_overlap = false;
+	const auto overlaps_any_atom = [&] (const coord &prm_ball_point) {
 		for (const pdb_residue &the_res : prm_pdb) {
 			for (const pdb_atom &the_atom : the_res) {
-				if ( prm_pdb_atom .get_coord() != the_atom.get_coord() ) {
-					found_overlap = found_overlap || access_overlap( prm_pdb_atom, ball_point, the_atom );
+				if ( prm_pdb_atom.get_coord() != the_atom.get_coord() && access_overlap( prm_pdb_atom, prm_ball_point, the_atom ) ) {
+					return true;
 				}
 			}
 		}
-		if ( ! found_overlap ) {
+		return false;
+	};
+
+	size_t count = 0;
+	for (const coord &orig_ball_point : ball_points) {
+		if ( ! overlaps_any_atom( radius * orig_ball_point ) ) {
 			++count;
 		}
 	}
@@ -170,10 +202,8 @@ double cath::sec::get_accessibility_fraction(const pdb_atom &prm_pdb_atom, ///<
                                              const pdb      &prm_pdb,      ///< The PDB in which the accesibility should be calculated
                                              const size_t   &prm_number    ///< The number to use to specify the sphere of points (tip: you should probably just use the default value)
                                              ) {
-	const coord_vec ball_points = make_dssp_ball_points( prm_number );
-
 	return debug_numeric_cast<double>( get_accessibility_count( prm_pdb_atom, prm_pdb, prm_number ) )
-	     / debug_numeric_cast<double>( make_dssp_ball_points( prm_number ).size() );
+	     / debug_numeric_cast<double>( 2_z * prm_number + 1_z );
 }
 
 /// \brief Calculate the accessibility surface-area for the specified atom in the specified PDB
@@ -201,13 +231,50 @@ double cath::sec::get_accessibility_surface_area(const pdb_residue &prm_pdb_resi
 }
 
 /// \brief Calculate the per-residue surface-area accessibilities for the specified PDBs
-doub_vec cath::sec::calc_accessibilities(const pdb    &prm_pdb,   ///< The PDB in which the accesibility should be calculated
-                                         const size_t &prm_number ///< The number to use to specify the sphere of points (tip: you should probably just use the default value)
+///
+/// This gives the same results as calling get_accessibility_surface_area() on each residue but builds
+/// a dssp_access_cell_list of the PDB's atoms once so that each ball point is only checked against nearby atoms.
+///
+/// If there are multiple threads, the residues are processed in tasks of up to RESIDUES_PER_TASK residues,
+/// with up to prm_num_threads tasks in flight at once.
+doub_vec cath::sec::calc_accessibilities(const pdb    &prm_pdb,        ///< The PDB in which the accesibility should be calculated
+                                         const size_t &prm_number,     ///< The number to use to specify the sphere of points (tip: you should probably just use the default value)
+                                         const size_t &prm_num_threads ///< The maximum number of threads with which to calculate the accessibilities
                                          ) {
-	return transform_build<doub_vec>(
-		prm_pdb,
-		[&] (const pdb_residue &x) { return get_accessibility_surface_area( x, prm_pdb, prm_number ); }
-	);
+	coord_vec                   ball_points_storage;
+	const coord_vec            &ball_points = dssp_ball_points_of_number( prm_number, ball_points_storage );
+	const dssp_access_cell_list cell_list{ prm_pdb };
+	const size_t                num_residues = cell_list.get_num_residues();
+
+	doub_vec accessibilities( num_residues, 0.0 );
+	const auto calc_residues = [&] (const size_t &prm_begin, const size_t &prm_end) {
+		for (size_t residue_ctr = prm_begin; residue_ctr < prm_end; ++residue_ctr) {
+			accessibilities[ residue_ctr ] = get_residue_accessibility_surface_area( cell_list, residue_ctr, ball_points );
+		}
+	};
+
+	if ( prm_num_threads <= 1 ) {
+		calc_residues( 0, num_residues );
+		return accessibilities;
+	}
+
+	deque<future<void>> task_futures;
+	for (size_t begin = 0; begin < num_residues; begin += dssp_ball_constants::RESIDUES_PER_TASK) {
+		if ( task_futures.size() >= prm_num_threads ) {
+			task_futures.front().get();
+			task_futures.pop_front();
+		}
+		const size_t end = min( num_residues, begin + dssp_ball_constants::RESIDUES_PER_TASK );
+		task_futures.push_back( std::async(
+			std::launch::async,
+			[&, begin, end] { calc_residues( begin, end ); }
+		) );
+	}
+	while ( ! task_futures.empty() ) {
+		task_futures.front().get();
+		task_futures.pop_front();
+	}
+	return accessibilities;
 }
 
 // /// \brief TODOCUMENT
@@ -60,6 +60,9 @@ namespace cath {
 
 				/// \brief The maximum distance between two atoms that could possible affect each other's accessibilities
 				static constexpr double MAX_ATOM_DIST    = RADIUS_CA + RADIUS_CA + RADIUS_WATER + RADIUS_WATER;
+
+				/// \brief The number of residues per task when calculating accessibilities with multiple threads
+				static constexpr size_t RESIDUES_PER_TASK = 64;
 			};
 
 		} // namespace detail
@@ -95,7 +98,8 @@ namespace cath {
 		                                      const size_t & = detail::dssp_ball_constants::NUMBER);
 
 		doub_vec calc_accessibilities(const file::pdb &,
-		                              const size_t & = detail::dssp_ball_constants::NUMBER);
+		                              const size_t & = detail::dssp_ball_constants::NUMBER,
+		                              const size_t & = 1);
 
 		doub_vec calc_accessibilities_with_scanning(const file::pdb &);
 
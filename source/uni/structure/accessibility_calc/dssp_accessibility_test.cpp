@@ -20,6 +20,7 @@
 
 #include "dssp_accessibility.hpp"
 
+#include <boost/filesystem/path.hpp>
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/math/constants/constants.hpp>
 
@@ -39,6 +40,7 @@ using namespace cath::file;
 using namespace cath::geom;
 using namespace cath::sec;
 
+using boost::filesystem::path;
 using boost::numeric_cast;
 
 BOOST_AUTO_TEST_SUITE(dssp_accessibility_test_suite)
@@ -89,6 +91,47 @@ BOOST_AUTO_TEST_CASE(gets_eg_res_accessibility_surface_area_correct) {
 	BOOST_CHECK_EQUAL  ( round( get_accessibility_surface_area( the_res, parsed_pdb ) ), 138 );
 }
 
+BOOST_AUTO_TEST_CASE(calc_accessibilities_matches_per_residue_calculation) {
+	const auto parsed_pdb      = read_pdb_file( global_test_constants::EXAMPLE_A_PDB_FILENAME() );
+	const auto accessibilities = calc_accessibilities( parsed_pdb );
+	BOOST_REQUIRE_EQUAL( accessibilities.size(), parsed_pdb.get_num_residues() );
+	for (const size_t &residue_ctr : { 0_z, 3_z, 8_z, 26_z, 51_z }) {
+		BOOST_CHECK_EQUAL(
+			accessibilities[ residue_ctr ],
+			get_accessibility_surface_area( parsed_pdb.get_residue_of_index__backbone_unchecked( residue_ctr ), parsed_pdb )
+		);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(calc_accessibilities_gives_same_results_with_multiple_threads) {
+	const auto parsed_pdb = read_pdb_file( global_test_constants::EXAMPLE_A_PDB_FILENAME() );
+	BOOST_CHECK_EQUAL_RANGES( calc_accessibilities( parsed_pdb, 200, 3 ), calc_accessibilities( parsed_pdb ) );
+}
+
+BOOST_AUTO_TEST_CASE(calc_accessibilities_rounds_to_same_values_as_with_scanning) {
+	// Proteins' accessibilities are stored as rounded integers, so this is what matters for switching from one to the other
+	const auto rounded = [] (const doub_vec &x) {
+		return transform_build<size_vec>( x, [] (const double &y) { return numeric_cast<size_t>( round( y ) ); } );
+	};
+	for (const path &pdb_file : { global_test_constants::EXAMPLE_A_PDB_FILENAME(),
+	                              global_test_constants::EXAMPLE_B_PDB_FILENAME(),
+	                              global_test_constants::TEST_SSAP_REGRESSION_DATA_DIR() / "1a04A02",
+	                              global_test_constants::TEST_SSAP_REGRESSION_DATA_DIR() / "1fseB00" } ) {
+		BOOST_TEST_CONTEXT( "For PDB file " << pdb_file ) {
+			const auto parsed_pdb = read_pdb_file( pdb_file );
+			BOOST_CHECK_EQUAL_RANGES(
+				rounded( calc_accessibilities              ( parsed_pdb ) ),
+				rounded( calc_accessibilities_with_scanning( parsed_pdb ) )
+			);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(calc_accessibilities_does_not_throw_or_error_on_empty_pdb) {
+	BOOST_CHECK_NO_THROW_DIAG( calc_accessibilities( pdb{}         ) );
+	BOOST_CHECK_NO_THROW_DIAG( calc_accessibilities( pdb{}, 200, 2 ) );
+}
+
 BOOST_AUTO_TEST_CASE(calc_accessibilities_with_scanning_does_not_throw_or_error_on_empty_pdb) {
 	BOOST_CHECK_NO_THROW_DIAG( calc_accessibilities_with_scanning( pdb{} ) );
 }
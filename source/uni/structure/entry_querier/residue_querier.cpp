@@ -26,8 +26,10 @@
 #include "ssap/context_res.hpp"
 #include "ssap/ssap.hpp"
 #include "structure/protein/protein.hpp"
+#include "structure/view_cache/view_cache.hpp"
 
 using namespace cath;
+using namespace cath::index;
 using namespace std;
 
 constexpr float_score_type residue_querier::RESIDUE_A_VALUE;
@@ -35,6 +37,21 @@ constexpr float_score_type residue_querier::RESIDUE_B_VALUE;
 constexpr float_score_type residue_querier::RESIDUE_MIN_SCORE_CUTOFF;
 constexpr float_score_type residue_querier::RESIDUE_MAX_DIST_SQ_CUTOFF;
 
+/// \brief Ctor from view_caches of the two proteins that will be compared
+///
+/// The view_caches are then used in place of calculating views in distance_score__offset_1() whenever that's
+/// called with these same two proteins (in this order). This stores references so the proteins and the
+/// view_caches must outlive the residue_querier.
+residue_querier::residue_querier(const protein    &prm_protein_a,    ///< The first protein
+                                 const view_cache &prm_view_cache_a, ///< A view_cache built from the first protein
+                                 const protein    &prm_protein_b,    ///< The second protein
+                                 const view_cache &prm_view_cache_b  ///< A view_cache built from the second protein
+                                 ) : view_caches{ make_pair(
+                                     	protein_view_cache_cref_pair{ cref( prm_protein_a ), cref( prm_view_cache_a ) },
+                                     	protein_view_cache_cref_pair{ cref( prm_protein_b ), cref( prm_view_cache_b ) }
+                                     ) } {
+}
+
 /// \brief TODOCUMENT
 size_t residue_querier::do_get_length(const protein &prm_protein ///< TODOCUMENT
                                       ) const {
@@ -71,6 +88,22 @@ score_type residue_querier::do_distance_score__offset_1(const protein &prm_prote
                                                         const size_t  &prm_a_dest_to_index__offset_1,   ///< TODOCUMENT
                                                         const size_t  &prm_b_dest_to_index__offset_1    ///< TODOCUMENT
                                                         ) const {
+	// If there are view_caches for these proteins, use their views rather than recalculating them
+	if ( view_caches
+	     && &view_caches->first.first.get()  == &prm_protein_a
+	     && &view_caches->second.first.get() == &prm_protein_b ) {
+		check_offset_1( prm_a_view_from_index__offset_1 );
+		check_offset_1( prm_b_view_from_index__offset_1 );
+		check_offset_1( prm_a_dest_to_index__offset_1   );
+		check_offset_1( prm_b_dest_to_index__offset_1   );
+		return debug_numeric_cast<score_type>(
+			context_res_vec<true>(
+				view_caches->first.second.get().get_view ( prm_a_view_from_index__offset_1 - 1, prm_a_dest_to_index__offset_1 - 1 ),
+				view_caches->second.second.get().get_view( prm_b_view_from_index__offset_1 - 1, prm_b_dest_to_index__offset_1 - 1 )
+			)
+		);
+	}
+
 	const residue &residue_a_view_from = get_residue_ref_of_index__offset_1( prm_protein_a, prm_a_view_from_index__offset_1 );
 	const residue &residue_b_view_from = get_residue_ref_of_index__offset_1( prm_protein_b, prm_b_view_from_index__offset_1 );
 	const residue &residue_a_dest_to   = get_residue_ref_of_index__offset_1( prm_protein_a, prm_a_dest_to_index__offset_1   );
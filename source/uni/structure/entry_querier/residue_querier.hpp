@@ -21,13 +21,27 @@
 #ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_ENTRY_QUERIER_RESIDUE_QUERIER_HPP
 #define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_ENTRY_QUERIER_RESIDUE_QUERIER_HPP
 
+#include <boost/optional.hpp>
+
 #include "structure/entry_querier/entry_querier.hpp"
 
+#include <functional>
+#include <utility>
+
+namespace cath { namespace index { class view_cache; } }
+
 namespace cath {
 
 	/// \brief TODOCUMENT
 	class residue_querier final : public entry_querier {
 	private:
+		/// \brief Type alias for a pair of a protein and a view_cache that was built from it
+		using protein_view_cache_cref_pair = std::pair<std::reference_wrapper<const protein>, std::reference_wrapper<const index::view_cache>>;
+
+		/// \brief Optional view_caches for the first and second proteins, which are used in place of calculating
+		///        the views when distance_score__offset_1() is called with the proteins from which they were built
+		boost::optional<std::pair<protein_view_cache_cref_pair, protein_view_cache_cref_pair>> view_caches;
+
 		size_t           do_get_length(const cath::protein &) const final;
 		double           do_get_gap_penalty_ratio() const final;
 		size_t           do_num_excluded_on_either_size() const final;
@@ -56,6 +70,12 @@ namespace cath {
 		bool         do_temp_hacky_is_residue() const final;
 
 	public:
+		residue_querier() = default;
+		residue_querier(const protein &,
+		                const index::view_cache &,
+		                const protein &,
+		                const index::view_cache &);
+
 		/// As in the SSAP paper(s), the a and b values are used to convert the distance into a score
 		/// for dynamic programming. The inherited code (this is being written in August 2013), which
 		/// appears to use the square of the distance between residues rather than the distance as indicated
@@ -43,6 +43,12 @@ void protein_list::push_back(const protein &prm_pdb ///< TODOCUMENT
 	proteins.push_back(prm_pdb);
 }
 
+/// \brief Move the specified protein onto the back of the list
+void protein_list::push_back(protein &&prm_pdb ///< The protein to move onto the back of the list
+                             ) {
+	proteins.push_back( std::move( prm_pdb ) );
+}
+
 /// \brief TODOCUMENT
 void protein_list::reserve(const size_t &prm_size ///< TODOCUMENT
                            ) {
@@ -37,6 +37,7 @@ namespace cath {
 
 	public:
 		void push_back(const protein &);
+		void push_back(protein &&);
 		void reserve(const size_t &);
 
 		size_t size() const noexcept;
@@ -37,25 +37,31 @@ using boost::filesystem::path;
 /// \brief TODOCUMENT
 protein_list_loader::protein_list_loader(const protein_source_file_set &prm_source_file_set, ///< TODOCUMENT
                                          const path                    &prm_data_dir,        ///< TODOCUMENT
-                                         str_vec                        prm_protein_names    ///< TODOCUMENT
+                                         str_vec                        prm_protein_names,   ///< TODOCUMENT
+                                         const size_t                  &prm_num_threads      ///< The maximum number of proteins to load concurrently
                                          ) : source_file_set_ptr ( prm_source_file_set.clone()    ),
                                              data_dir            ( prm_data_dir                   ),
-                                             protein_names       ( std::move( prm_protein_names ) ) {
+                                             protein_names       ( std::move( prm_protein_names ) ),
+                                             num_threads         ( prm_num_threads                ) {
 }
 
-/// \brief TODOCUMENT
-pair<protein_list, hrc_duration> protein_list_loader::load_proteins(ostream &prm_stderr ///< TODOCUMENT
-                                                                    ) const {
+/// \brief Load the proteins, with up to num_threads being loaded concurrently
+///
+/// The proteins and any warnings/errors (which are written to prm_stderr) are in the order of the names,
+/// however many threads are used
+protein_list_load_result protein_list_loader::load_proteins(ostream &prm_stderr ///< The ostream to which any warnings/errors should be written
+                                                            ) const {
 	const auto scan_starttime = std::chrono::high_resolution_clock::now();
-	const auto the_proteins   = read_proteins_from_files(
+	auto proteins_and_durns   = read_proteins_from_files_with_durations(
 		*source_file_set_ptr,
 		data_dir,
 		protein_names,
-		ref( prm_stderr )
-	);
-	return make_pair(
-		the_proteins,
-		std::chrono::high_resolution_clock::now() - scan_starttime
+		ref( prm_stderr ),
+		num_threads
 	);
+	return {
+		std::move( proteins_and_durns.first  ),
+		std::chrono::high_resolution_clock::now() - scan_starttime,
+		std::move( proteins_and_durns.second )
+	};
 }
-
@@ -29,12 +29,25 @@
 #include "common/type_aliases.hpp"
 #include "common/chrono/chrono_type_aliases.hpp"
 #include "common/clone/clone_ptr.hpp"
+#include "structure/protein/protein_list.hpp"
 #include "structure/protein/protein_source_file_set/protein_source_file_set.hpp"
 
-namespace cath { class protein_list; }
-
 namespace cath {
 
+	/// \brief The result of a protein_list_loader loading its proteins
+	struct protein_list_load_result final {
+		/// \brief The proteins that were loaded (in the order of the loader's names)
+		protein_list     proteins;
+
+		/// \brief The (wall-clock) time taken to load all the proteins
+		hrc_duration     load_durn;
+
+		/// \brief The time taken to load each of the proteins (in the order of the loader's names)
+		///
+		/// When loading with multiple threads, these can sum to more than load_durn
+		hrc_duration_vec protein_load_durns;
+	};
+
 	/// \brief Represent the details required to load a protein_list
 	///	
 	/// In the future, this can be changed to an ABC with concrete implementations
@@ -50,12 +63,16 @@ namespace cath {
 		/// \brief The name of the proteins that are to be read from files
 		const str_vec protein_names;
 
+		/// \brief The maximum number of proteins to load concurrently
+		const size_t num_threads;
+
 	public:
 		protein_list_loader(const protein_source_file_set &,
 		                    const boost::filesystem::path &,
-		                    str_vec);
+		                    str_vec,
+		                    const size_t & = 1);
 
-		std::pair<protein_list, hrc_duration> load_proteins(std::ostream &) const;
+		protein_list_load_result load_proteins(std::ostream &) const;
 	};
 } // namespace cath
 
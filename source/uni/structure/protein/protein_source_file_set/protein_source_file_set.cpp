@@ -41,7 +41,12 @@
 #include "structure/protein/sec_struc.hpp"
 #include "structure/protein/sec_struc_planar_angles.hpp"
 
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <future>
 #include <map>
+#include <sstream>
 
 using namespace cath;
 using namespace cath::chop;
@@ -56,12 +61,59 @@ using boost::lexical_cast;
 using boost::none;
 using boost::range::transform;
 using std::back_inserter;
+using std::chrono::high_resolution_clock;
+using std::deque;
+using std::future;
 using std::make_pair;
 using std::ostream;
 using std::ostringstream;
+using std::pair;
 using std::string;
 using std::unique_ptr;
 
+namespace cath {
+	namespace detail {
+
+		/// \brief The outcome of reading a single protein from files, buffered so that it can be
+		///        generated on a worker thread and then consumed in the original order
+		struct protein_read_outcome final {
+			/// \brief The protein that was read
+			protein            the_protein;
+
+			/// \brief The time taken to read the protein
+			hrc_duration       durn;
+
+			/// \brief Any warnings/errors written whilst reading the protein
+			string             stderr_text;
+
+			/// \brief Any exception thrown whilst reading the protein (in which case the_protein is empty)
+			std::exception_ptr error;
+		};
+
+		/// \brief Read the named protein from files, timing it and buffering any warnings/errors
+		///
+		/// This doesn't touch any shared state so multiple proteins can safely be read concurrently.
+		///
+		/// Any exception is captured in the outcome (rather than thrown) so that the warnings/errors
+		/// written before it aren't lost.
+		inline protein_read_outcome timed_read_protein_from_files(const protein_source_file_set &prm_source_file_set, ///< The protein_source_file_set specifying which set of files should be used to build the protein
+		                                                          const path                    &prm_data_dir,        ///< The directory from which the files should be read
+		                                                          const string                  &prm_protein_name     ///< The name of the protein that is to be read from files
+		                                                          ) {
+			ostringstream stderr_ss;
+			const auto start_time = high_resolution_clock::now();
+			try {
+				protein the_protein = read_protein_from_files( prm_source_file_set, prm_data_dir, prm_protein_name, ostream_ref{ stderr_ss } );
+				return { std::move( the_protein ), high_resolution_clock::now() - start_time, stderr_ss.str(), nullptr };
+			}
+			catch (...) {
+				return { protein{}, high_resolution_clock::now() - start_time, stderr_ss.str(), std::current_exception() };
+			}
+		}
+
+	} // namespace detail
+} // namespace cath
+
 /// \brief Read a PDB and restrict it by the specified regions
 protein protein_source_file_set::do_read_and_restrict_files(const data_file_path_map &prm_filename_of_data_file, ///< The pre-loaded map of file types to filenames
                                                             const string             &prm_protein_name,          ///< The name of the protein that is to be read from files
@@ -174,22 +226,88 @@ protein cath::read_protein_from_files(const protein_source_file_set &prm_source_
 protein_list cath::read_proteins_from_files(const protein_source_file_set &prm_source_file_set, /// The protein_source_file_set specifying which set of files should be used to build the protein
                                             const path                    &prm_data_dir,        ///< The directory from which the files should be read
                                             const str_vec                 &prm_protein_names,   ///< The name of the protein that is to be read from files
-                                            const ostream_ref_opt         &prm_ostream          ///< An optional reference to an ostream to which any warnings/errors should be written
+                                            const ostream_ref_opt         &prm_ostream,         ///< An optional reference to an ostream to which any warnings/errors should be written
+                                            const size_t                  &prm_num_threads      ///< The maximum number of proteins to read concurrently
                                             ) {
-	protein_list the_proteins;
-	transform(
+	if ( prm_num_threads <= 1 ) {
+		protein_list the_proteins;
+		transform(
+			prm_protein_names,
+			back_inserter( the_proteins ),
+			[&] (const string &x) {
+				return read_protein_from_files(
+					prm_source_file_set,
+					prm_data_dir,
+					x,
+					prm_ostream
+				);
+			}
+		);
+		return the_proteins;
+	}
+	return read_proteins_from_files_with_durations(
+		prm_source_file_set,
+		prm_data_dir,
 		prm_protein_names,
-		back_inserter( the_proteins ),
-		[&] (const string &x) {
-			return read_protein_from_files(
-				prm_source_file_set,
-				prm_data_dir,
-				x,
-				prm_ostream
-			);
+		prm_ostream,
+		prm_num_threads
+	).first;
+}
+
+/// \brief Read the named proteins from files, with up to the specified number being read concurrently,
+///        and return them along with the time taken to read each one
+///
+/// The proteins (and their durations) are in the order of the names and any warnings/errors are written
+/// to the ostream in that order too, so the results don't depend on the number of threads.
+///
+/// If reading any of the proteins throws, the exception from the first of those proteins is rethrown
+/// (after the warnings/errors of all proteins before it, and of that protein itself, have been written).
+///
+/// \relates protein_source_file_set
+pair<protein_list, hrc_duration_vec> cath::read_proteins_from_files_with_durations(const protein_source_file_set &prm_source_file_set, ///< The protein_source_file_set specifying which set of files should be used to build the protein
+                                                                                   const path                    &prm_data_dir,        ///< The directory from which the files should be read
+                                                                                   const str_vec                 &prm_protein_names,   ///< The name of the protein that is to be read from files
+                                                                                   const ostream_ref_opt         &prm_ostream,         ///< An optional reference to an ostream to which any warnings/errors should be written
+                                                                                   const size_t                  &prm_num_threads      ///< The maximum number of proteins to read concurrently
+                                                                                   ) {
+	pair<protein_list, hrc_duration_vec> result;
+	result.first.reserve ( prm_protein_names.size() );
+	result.second.reserve( prm_protein_names.size() );
+
+	// Consume an outcome (only ever called from this thread, in the original order)
+	const auto consume_outcome = [&] (detail::protein_read_outcome prm_outcome) {
+		if ( prm_ostream ) {
+			prm_ostream->get() << prm_outcome.stderr_text;
 		}
-	);
-	return the_proteins;
+		if ( prm_outcome.error ) {
+			std::rethrow_exception( prm_outcome.error );
+		}
+		result.first.push_back ( std::move( prm_outcome.the_protein ) );
+		result.second.push_back( prm_outcome.durn                     );
+	};
+
+	// Read the proteins, with up to num_threads in flight at once, always
+	// consuming the oldest protein's outcome first so the order is preserved
+	deque<future<detail::protein_read_outcome>> outcome_futures;
+	for (const string &protein_name : prm_protein_names) {
+		if ( prm_num_threads <= 1 ) {
+			consume_outcome( detail::timed_read_protein_from_files( prm_source_file_set, prm_data_dir, protein_name ) );
+			continue;
+		}
+		if ( outcome_futures.size() >= prm_num_threads ) {
+			consume_outcome( outcome_futures.front().get() );
+			outcome_futures.pop_front();
+		}
+		outcome_futures.push_back( std::async(
+			std::launch::async,
+			[&] { return detail::timed_read_protein_from_files( prm_source_file_set, prm_data_dir, protein_name ); }
+		) );
+	}
+	while ( ! outcome_futures.empty() ) {
+		consume_outcome( outcome_futures.front().get() );
+		outcome_futures.pop_front();
+	}
+	return result;
 }
 
 
@@ -25,10 +25,13 @@
 #include <boost/ptr_container/ptr_vector.hpp>
 
 #include "chopping/chopping_type_aliases.hpp"
+#include "common/chrono/chrono_type_aliases.hpp"
 #include "file/file_type_aliases.hpp"
 #include "structure/protein/protein_list.hpp"
 #include "structure/protein/protein_source_file_set/protein_file_combn.hpp"
 
+#include <utility>
+
 namespace cath { namespace opts { class data_dirs_spec; } }
 
 namespace cath {
@@ -109,7 +112,14 @@ namespace cath {
 	protein_list read_proteins_from_files(const protein_source_file_set &,
 	                                      const boost::filesystem::path &,
 	                                      const str_vec &,
-	                                      const ostream_ref_opt & = boost::none);
+	                                      const ostream_ref_opt & = boost::none,
+	                                      const size_t & = 1);
+
+	std::pair<protein_list, hrc_duration_vec> read_proteins_from_files_with_durations(const protein_source_file_set &,
+	                                                                                  const boost::filesystem::path &,
+	                                                                                  const str_vec &,
+	                                                                                  const ostream_ref_opt & = boost::none,
+	                                                                                  const size_t & = 1);
 
 	file::data_file_path_map get_filename_of_data_file(const protein_source_file_set &,
 	                                                   const opts::data_dirs_spec &,
@@ -18,27 +18,62 @@
 /// You should have received a copy of the GNU General Public License
 /// along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/test/auto_unit_test.hpp>
 
 #include "common/file/simple_file_read_write.hpp"
+#include "common/size_t_literal.hpp"
+#include "file/name_set/name_set.hpp"
 #include "file/options/data_dirs_spec.hpp"
 #include "structure/protein/protein.hpp"
+#include "structure/protein/protein_source_file_set/protein_from_pdb.hpp"
 #include "structure/protein/protein_source_file_set/protein_from_pdb_dssp_and_sec.hpp"
 #include "structure/protein/residue.hpp"
 #include "structure/protein/sec_struc.hpp"
 #include "structure/protein/sec_struc_planar_angles.hpp"
+#include "test/global_test_constants.hpp"
 
 #include <iostream>
 #include <random>
+#include <sstream>
 
 using namespace cath::common;
+using namespace cath::file;
 using namespace cath::opts;
 using namespace cath;
 
+using boost::algorithm::starts_with;
+using std::ostringstream;
 using std::string;
 
-BOOST_AUTO_TEST_SUITE(protein_source_file_set_test_suite)
+namespace cath {
+	namespace test {
+
+		/// \brief The protein_source_file_set_test_suite_fixture to assist in testing protein_source_file_set
+		struct protein_source_file_set_test_suite_fixture : protected global_test_constants {
+		protected:
+			~protein_source_file_set_test_suite_fixture() noexcept = default;
+
+			/// \brief Get the lengths and names of the proteins in the specified protein_list
+			static str_vec lengths_and_names(const protein_list &prm_proteins ///< The protein_list to query
+			                                 ) {
+				str_vec results;
+				for (const protein &the_protein : prm_proteins) {
+					results.push_back(
+						std::to_string( the_protein.get_length() )
+						+ " "
+						+ get_domain_or_specified_or_name_from_acq( the_protein.get_name_set() )
+					);
+				}
+				return results;
+			}
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(protein_source_file_set_test_suite, cath::test::protein_source_file_set_test_suite_fixture)
 
 BOOST_AUTO_TEST_CASE(file_set_contains_primary_file) {
 	const auto all_source_file_sets = get_all_protein_source_file_sets();
@@ -67,4 +102,60 @@ BOOST_AUTO_TEST_CASE(basic) {
 //	}
 }
 
+BOOST_AUTO_TEST_CASE(reading_proteins_concurrently_preserves_order_and_warnings) {
+	const str_vec names = { "1c0pA01", "1hdoA00", "1c0pA01", "1hdoA00", "1hdoA00", "1c0pA01", "1c0pA01" };
+
+	ostringstream serial_ss;
+	ostringstream concurrent_ss;
+	const auto serial     = read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, ostream_ref{ serial_ss     }, 1 );
+	const auto concurrent = read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, ostream_ref{ concurrent_ss }, 3 );
+
+	BOOST_CHECK_EQUAL( serial.second.size(),     names.size() );
+	BOOST_CHECK_EQUAL( concurrent.second.size(), names.size() );
+	const auto serial_lengths_and_names     = lengths_and_names( serial.first     );
+	const auto concurrent_lengths_and_names = lengths_and_names( concurrent.first );
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		serial_lengths_and_names.begin(),     serial_lengths_and_names.end(),
+		concurrent_lengths_and_names.begin(), concurrent_lengths_and_names.end()
+	);
+	BOOST_CHECK_EQUAL( serial_ss.str(), concurrent_ss.str() );
+	BOOST_CHECK_EQUAL(
+		read_proteins_from_files( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, boost::none, 4 ).size(),
+		names.size()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(reading_proteins_concurrently_throws_on_missing_protein) {
+	const str_vec names = { "1c0pA01", "this_protein_does_not_exist", "1hdoA00" };
+	BOOST_CHECK_THROW(
+		read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, boost::none, 2 ),
+		std::exception
+	);
+}
+
+BOOST_AUTO_TEST_CASE(reading_proteins_concurrently_writes_warnings_before_rethrowing) {
+	const str_vec names_before_missing = { "1c0pA01", "1hdoA00", "1c0pA01" };
+	str_vec       names                = names_before_missing;
+	names.push_back( "this_protein_does_not_exist" );
+	names.push_back( "1hdoA00" );
+
+	ostringstream before_missing_ss;
+	ostringstream serial_ss;
+	read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names_before_missing, ostream_ref{ before_missing_ss }, 1 );
+	BOOST_CHECK_THROW(
+		read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, ostream_ref{ serial_ss }, 1 ),
+		std::exception
+	);
+	BOOST_CHECK( starts_with( serial_ss.str(), before_missing_ss.str() ) );
+
+	for (const size_t &num_threads : { 2_z, 4_z } ) {
+		ostringstream concurrent_ss;
+		BOOST_CHECK_THROW(
+			read_proteins_from_files_with_durations( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), names, ostream_ref{ concurrent_ss }, num_threads ),
+			std::exception
+		);
+		BOOST_CHECK_EQUAL( concurrent_ss.str(), serial_ss.str() );
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
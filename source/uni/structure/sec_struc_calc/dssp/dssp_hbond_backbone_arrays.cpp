@@ -0,0 +1,203 @@
+/// \file
+/// \brief The dssp_hbond_backbone_arrays class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dssp_hbond_backbone_arrays.hpp"
+
+#include "file/pdb/pdb.hpp"
+#include "file/pdb/pdb_residue.hpp"
+#include "structure/geometry/coord.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace cath;
+using namespace cath::file;
+using namespace cath::geom;
+using namespace cath::sec;
+
+using std::array;
+using std::min;
+using std::sqrt;
+using std::vector;
+
+constexpr size_t dssp_hbond_backbone_arrays::BLOCK_SIZE;
+
+/// \brief Ctor from the (backbone-complete) PDB whose residues should be stored
+///
+/// The donor/acceptor flags and pseudo-hydrogen positions follow dssp_hbond_calc::has_hbond_energy()
+/// and dssp_hbond_calc::get_hbond_energy() respectively
+dssp_hbond_backbone_arrays::dssp_hbond_backbone_arrays(const pdb &prm_pdb ///< The PDB whose residues should be stored
+                                                       ) {
+	const size_t num_residues = prm_pdb.get_num_residues();
+	for (coord_array *array_ptr : { &n_x, &n_y, &n_z, &h_x, &h_y, &h_z, &c_x, &c_y, &c_z, &o_x, &o_y, &o_z, &ca_x, &ca_y, &ca_z } ) {
+		array_ptr->assign( num_residues, 0.0 );
+	}
+	is_donor_flags.assign   ( num_residues, false );
+	is_acceptor_flags.assign( num_residues, false );
+
+	const auto set_coord = [] (coord_array &prm_x, coord_array &prm_y, coord_array &prm_z, const size_t &prm_index, const coord &prm_coord) {
+		prm_x[ prm_index ] = prm_coord.get_x();
+		prm_y[ prm_index ] = prm_coord.get_y();
+		prm_z[ prm_index ] = prm_coord.get_z();
+	};
+
+	for (size_t residue_ctr = 0; residue_ctr < num_residues; ++residue_ctr) {
+		const pdb_residue &the_residue = prm_pdb.get_residue_of_index__backbone_unchecked( residue_ctr );
+		if ( ! the_residue.has_carbon_alpha() ) {
+			continue;
+		}
+		set_coord( ca_x, ca_y, ca_z, residue_ctr, get_carbon_alpha_coord( the_residue ) );
+
+		if ( the_residue.has_carbon() && the_residue.has_oxygen() ) {
+			is_acceptor_flags[ residue_ctr ] = true;
+			set_coord( c_x, c_y, c_z, residue_ctr, get_carbon_coord( the_residue ) );
+			set_coord( o_x, o_y, o_z, residue_ctr, get_oxygen_coord( the_residue ) );
+		}
+
+		const bool is_proline = (
+			is_proper_amino_acid( the_residue.get_amino_acid() )
+			&&
+			the_residue.get_amino_acid() == amino_acid{ 'P' }
+		);
+		if ( ! the_residue.has_nitrogen() || is_proline ) {
+			continue;
+		}
+		const auto prev_index = index_of_preceding_residue_in_same_chain( prm_pdb, residue_ctr );
+		if ( prev_index ) {
+			const pdb_residue &prev_residue = prm_pdb.get_residue_of_index__backbone_unchecked( *prev_index );
+			if ( ! prev_residue.has_carbon() || ! prev_residue.has_oxygen() ) {
+				continue;
+			}
+		}
+		is_donor_flags[ residue_ctr ] = true;
+
+		const coord &nitrogen_coord = get_nitrogen_coord( the_residue );
+		set_coord( n_x, n_y, n_z, residue_ctr, nitrogen_coord );
+		if ( prev_index ) {
+			const pdb_residue &prev_residue = prm_pdb.get_residue_of_index__backbone_unchecked( *prev_index );
+			const coord        prev_c_to_o  = get_oxygen_coord( prev_residue ) - get_carbon_coord( prev_residue );
+			set_coord( h_x, h_y, h_z, residue_ctr, nitrogen_coord - ( prev_c_to_o / length( prev_c_to_o ) ) );
+		}
+		else {
+			set_coord( h_x, h_y, h_z, residue_ctr, nitrogen_coord );
+		}
+	}
+}
+
+/// \brief Get the number of residues
+size_t dssp_hbond_backbone_arrays::size() const {
+	return ca_x.size();
+}
+
+/// \brief Whether the residue of the specified index can act as the NH donor in an hbond
+bool dssp_hbond_backbone_arrays::is_donor(const size_t &prm_index ///< The index of the residue to query
+                                          ) const {
+	return is_donor_flags[ prm_index ];
+}
+
+/// \brief Whether the residue of the specified index can act as the CO acceptor in an hbond
+bool dssp_hbond_backbone_arrays::is_acceptor(const size_t &prm_index ///< The index of the residue to query
+                                             ) const {
+	return is_acceptor_flags[ prm_index ];
+}
+
+/// \brief Whether DSSP might assign a valid hbond energy from the NH of the first specified residue
+///        to the CO of the second
+///
+/// This matches dssp_hbond_calc::has_hbond_energy_asymm()
+bool dssp_hbond_backbone_arrays::has_hbond_energy(const size_t &prm_donor,   ///< The index of the NH donor residue
+                                                  const size_t &prm_acceptor ///< The index of the CO acceptor residue
+                                                  ) const {
+	constexpr double MIN_NO_HBOND_CA_DIST = 9.0;
+
+	if ( ! ( prm_donor < prm_acceptor || prm_donor > prm_acceptor + 1 ) ) {
+		return false;
+	}
+	if ( ! is_donor_flags[ prm_donor ] || ! is_acceptor_flags[ prm_acceptor ] ) {
+		return false;
+	}
+	const double diff_x = ca_x[ prm_acceptor ] - ca_x[ prm_donor ];
+	const double diff_y = ca_y[ prm_acceptor ] - ca_y[ prm_donor ];
+	const double diff_z = ca_z[ prm_acceptor ] - ca_z[ prm_donor ];
+	return sqrt( diff_x * diff_x + diff_y * diff_y + diff_z * diff_z ) < MIN_NO_HBOND_CA_DIST;
+}
+
+/// \brief Calculate the DSSP hbond energies from the NH of the specified donor residue
+///        to the CO of each of the specified acceptor residues
+///
+/// \pre has_hbond_energy() is true for the donor and each of the acceptors
+///
+/// The acceptors are processed in blocks of BLOCK_SIZE: each block's C and O coordinates are gathered into
+/// contiguous buffers so the loop that calculates the four distances (and their square roots) for each
+/// acceptor is free of indirection and branches and can be vectorised.
+void dssp_hbond_backbone_arrays::get_hbond_energies(const size_t                &prm_donor,     ///< The index of the NH donor residue
+                                                    const size_vec              &prm_acceptors, ///< The indices of the CO acceptor residues
+                                                    vector<hbond_energy_t>      &prm_energies   ///< The vector to be populated with the energy for each acceptor
+                                                    ) const {
+	const size_t num_acceptors = prm_acceptors.size();
+	prm_energies.resize( num_acceptors );
+
+	const double the_n_x = n_x[ prm_donor ];
+	const double the_n_y = n_y[ prm_donor ];
+	const double the_n_z = n_z[ prm_donor ];
+	const double the_h_x = h_x[ prm_donor ];
+	const double the_h_y = h_y[ prm_donor ];
+	const double the_h_z = h_z[ prm_donor ];
+
+	alignas( 64 ) array<double, BLOCK_SIZE> blk_c_x{}, blk_c_y{}, blk_c_z{}, blk_o_x{}, blk_o_y{}, blk_o_z{};
+	alignas( 64 ) array<double, BLOCK_SIZE> dists_no{}, dists_hc{}, dists_ho{}, dists_nc{};
+
+	for (size_t block_begin = 0; block_begin < num_acceptors; block_begin += BLOCK_SIZE) {
+		const size_t block_size = min( BLOCK_SIZE, num_acceptors - block_begin );
+
+		for (size_t blk_ctr = 0; blk_ctr < block_size; ++blk_ctr) {
+			const size_t &acceptor = prm_acceptors[ block_begin + blk_ctr ];
+			blk_c_x[ blk_ctr ] = c_x[ acceptor ];
+			blk_c_y[ blk_ctr ] = c_y[ acceptor ];
+			blk_c_z[ blk_ctr ] = c_z[ acceptor ];
+			blk_o_x[ blk_ctr ] = o_x[ acceptor ];
+			blk_o_y[ blk_ctr ] = o_y[ acceptor ];
+			blk_o_z[ blk_ctr ] = o_z[ acceptor ];
+		}
+
+		// These replicate the operations of distance_between_points() exactly so the energies are identical
+		// (the loop covers the whole block, even if it's only partly filled, so that it has a fixed trip count)
+		for (size_t blk_ctr = 0; blk_ctr < BLOCK_SIZE; ++blk_ctr) {
+			const double no_x = blk_o_x[ blk_ctr ] - the_n_x, no_y = blk_o_y[ blk_ctr ] - the_n_y, no_z = blk_o_z[ blk_ctr ] - the_n_z;
+			const double hc_x = blk_c_x[ blk_ctr ] - the_h_x, hc_y = blk_c_y[ blk_ctr ] - the_h_y, hc_z = blk_c_z[ blk_ctr ] - the_h_z;
+			const double ho_x = blk_o_x[ blk_ctr ] - the_h_x, ho_y = blk_o_y[ blk_ctr ] - the_h_y, ho_z = blk_o_z[ blk_ctr ] - the_h_z;
+			const double nc_x = blk_c_x[ blk_ctr ] - the_n_x, nc_y = blk_c_y[ blk_ctr ] - the_n_y, nc_z = blk_c_z[ blk_ctr ] - the_n_z;
+			dists_no[ blk_ctr ] = sqrt( no_x * no_x + no_y * no_y + no_z * no_z );
+			dists_hc[ blk_ctr ] = sqrt( hc_x * hc_x + hc_y * hc_y + hc_z * hc_z );
+			dists_ho[ blk_ctr ] = sqrt( ho_x * ho_x + ho_y * ho_y + ho_z * ho_z );
+			dists_nc[ blk_ctr ] = sqrt( nc_x * nc_x + nc_y * nc_y + nc_z * nc_z );
+		}
+
+		for (size_t blk_ctr = 0; blk_ctr < block_size; ++blk_ctr) {
+			prm_energies[ block_begin + blk_ctr ] = dssp_hbond_calc::get_hbond_energy_of_distances(
+				dists_no[ blk_ctr ],
+				dists_hc[ blk_ctr ],
+				dists_ho[ blk_ctr ],
+				dists_nc[ blk_ctr ]
+			);
+		}
+	}
+}
@@ -0,0 +1,96 @@
+/// \file
+/// \brief The dssp_hbond_backbone_arrays class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_SEC_STRUC_CALC_DSSP_DSSP_HBOND_BACKBONE_ARRAYS_HPP
+#define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_SEC_STRUC_CALC_DSSP_DSSP_HBOND_BACKBONE_ARRAYS_HPP
+
+#include <boost/align/aligned_allocator.hpp>
+
+#include "common/type_aliases.hpp"
+#include "structure/sec_struc_calc/dssp/dssp_hbond_calc.hpp"
+
+#include <vector>
+
+namespace cath { namespace file { class pdb; } }
+
+namespace cath {
+	namespace sec {
+
+		/// \brief Store the backbone coordinates of a PDB's residues in aligned structure-of-arrays form
+		///        for fast evaluation of DSSP hbond energies between many pairs of residues
+		///
+		/// Each residue's N, pseudo-H, C, O and CA coordinates are extracted once on construction
+		/// (rather than being looked up through the pdb_residue for each candidate pair) along
+		/// with whether the residue can act as an NH donor and/or as a CO acceptor.
+		///
+		/// The energies are calculated by get_hbond_energies() in blocks of candidate acceptors:
+		/// each block's coordinates are gathered into contiguous buffers and then a branch-free loop
+		/// (that the compiler can vectorise) calculates the block's energies. The results are
+		/// identical to those of dssp_hbond_calc::get_hbond_energy_asymm().
+		class dssp_hbond_backbone_arrays final {
+		public:
+			/// \brief The type of array used to store each of the coordinate dimensions
+			using coord_array = std::vector<double, boost::alignment::aligned_allocator<double, 64>>;
+
+			/// \brief The number of acceptors that get_hbond_energies() processes in each block
+			static constexpr size_t BLOCK_SIZE = 16;
+
+		private:
+			/// \brief The x, y and z coordinates of the residues' nitrogen atoms
+			coord_array n_x, n_y, n_z;
+
+			/// \brief The x, y and z coordinates of the residues' pseudo-hydrogen atoms (see dssp_hbond_calc::get_hbond_energy())
+			coord_array h_x, h_y, h_z;
+
+			/// \brief The x, y and z coordinates of the residues' carbon atoms
+			coord_array c_x, c_y, c_z;
+
+			/// \brief The x, y and z coordinates of the residues' oxygen atoms
+			coord_array o_x, o_y, o_z;
+
+			/// \brief The x, y and z coordinates of the residues' carbon alpha atoms
+			coord_array ca_x, ca_y, ca_z;
+
+			/// \brief Whether each residue can act as the NH donor in an hbond
+			bool_deq is_donor_flags;
+
+			/// \brief Whether each residue can act as the CO acceptor in an hbond
+			bool_deq is_acceptor_flags;
+
+		public:
+			explicit dssp_hbond_backbone_arrays(const file::pdb &);
+
+			size_t size() const;
+
+			bool is_donor(const size_t &) const;
+			bool is_acceptor(const size_t &) const;
+
+			bool has_hbond_energy(const size_t &,
+			                      const size_t &) const;
+
+			void get_hbond_energies(const size_t &,
+			                        const size_vec &,
+			                        std::vector<hbond_energy_t> &) const;
+		};
+
+	} // namespace sec
+} // namespace cath
+
+#endif
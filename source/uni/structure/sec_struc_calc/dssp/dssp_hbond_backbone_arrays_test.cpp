@@ -0,0 +1,106 @@
+/// \file
+/// \brief The dssp_hbond_backbone_arrays test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "dssp_hbond_backbone_arrays.hpp"
+
+#include "common/size_t_literal.hpp"
+#include "file/pdb/pdb.hpp"
+#include "structure/sec_struc_calc/dssp/bifur_hbond_list.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <sstream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::file;
+using namespace cath::sec;
+
+using std::ostringstream;
+using std::vector;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The dssp_hbond_backbone_arrays_test_suite_fixture to assist in testing dssp_hbond_backbone_arrays
+		struct dssp_hbond_backbone_arrays_test_suite_fixture : protected global_test_constants {
+		protected:
+			~dssp_hbond_backbone_arrays_test_suite_fixture() noexcept = default;
+
+			/// \brief The backbone-complete subset of the example PDB
+			const pdb backbone_pdb = backbone_complete_subset_of_pdb(
+				read_pdb_file( EXAMPLE_A_PDB_FILENAME() ),
+				boost::none,
+				dssp_skip_res_skipping::SKIP
+			).first;
+		};
+
+	}  // namespace test
+}  // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(dssp_hbond_backbone_arrays_test_suite, cath::test::dssp_hbond_backbone_arrays_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(has_hbond_energy_matches_dssp_hbond_calc) {
+	const dssp_hbond_backbone_arrays backbone_arrays{ backbone_pdb };
+	BOOST_REQUIRE_EQUAL( backbone_arrays.size(), backbone_pdb.get_num_residues() );
+
+	size_t num_mismatches = 0;
+	for (size_t donor_ctr = 0; donor_ctr < backbone_arrays.size(); ++donor_ctr) {
+		for (size_t acceptor_ctr = 0; acceptor_ctr < backbone_arrays.size(); ++acceptor_ctr) {
+			if ( backbone_arrays.has_hbond_energy( donor_ctr, acceptor_ctr ) != dssp_hbond_calc::has_hbond_energy_asymm( backbone_pdb, donor_ctr, acceptor_ctr ) ) {
+				++num_mismatches;
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL( num_mismatches, 0_z );
+}
+
+BOOST_AUTO_TEST_CASE(hbond_energies_match_dssp_hbond_calc_exactly) {
+	const dssp_hbond_backbone_arrays backbone_arrays{ backbone_pdb };
+
+	size_t num_checked = 0;
+	for (size_t donor_ctr = 0; donor_ctr < backbone_arrays.size(); ++donor_ctr) {
+		size_vec acceptors;
+		for (size_t acceptor_ctr = 0; acceptor_ctr < backbone_arrays.size(); ++acceptor_ctr) {
+			if ( backbone_arrays.has_hbond_energy( donor_ctr, acceptor_ctr ) ) {
+				acceptors.push_back( acceptor_ctr );
+			}
+		}
+		vector<hbond_energy_t> energies;
+		backbone_arrays.get_hbond_energies( donor_ctr, acceptors, energies );
+		BOOST_REQUIRE_EQUAL( energies.size(), acceptors.size() );
+		for (size_t acceptor_ctr = 0; acceptor_ctr < acceptors.size(); ++acceptor_ctr) {
+			BOOST_CHECK_EQUAL( energies[ acceptor_ctr ], dssp_hbond_calc::get_hbond_energy_asymm( backbone_pdb, donor_ctr, acceptors[ acceptor_ctr ] ) );
+			++num_checked;
+		}
+	}
+	BOOST_CHECK_GT( num_checked, dssp_hbond_backbone_arrays::BLOCK_SIZE );
+}
+
+BOOST_AUTO_TEST_CASE(bifur_hbonds_do_not_depend_on_the_number_of_threads) {
+	ostringstream single_threaded_ss;
+	ostringstream multi_threaded_ss;
+	single_threaded_ss << dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( backbone_pdb, 1 );
+	multi_threaded_ss  << dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( backbone_pdb, 3 );
+	BOOST_CHECK_EQUAL( multi_threaded_ss.str(), single_threaded_ss.str() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
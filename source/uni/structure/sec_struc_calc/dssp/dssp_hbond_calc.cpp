@@ -25,27 +25,42 @@
 #include "file/pdb/pdb_atom.hpp"
 #include "scan/spatial_index/spatial_index.hpp"
 #include "structure/sec_struc_calc/dssp/bifur_hbond_list.hpp"
+#include "structure/sec_struc_calc/dssp/dssp_hbond_backbone_arrays.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <vector>
 
 using namespace cath::common;
 using namespace cath::file;
 using namespace cath::scan;
 using namespace cath::sec;
 
+using std::deque;
+using std::future;
+using std::min;
+using std::vector;
+
+constexpr size_t dssp_hbond_calc::RESIDUES_PER_TASK;
+
 /// \brief Calculate the bifur_hbond_list list of (possibly bifurcating) hbonds between
 ///        the residues in the specified PDB
 ///
 /// This calls backbone_complete_subset_of_pdb() on the PDB. If the results are being generated
 /// in a context where that is required for other tasks, it's better to call backbone_complete_subset_of_pdb()
 /// outside and then use calc_bifur_hbonds_of_backbone_complete_pdb() instead.
-bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_pdb__recalc_backbone_residues(const pdb             &prm_pdb,            ///< The PDB to query
-                                                                                     const ostream_ref_opt &prm_ostream_ref_opt ///< An optional reference to an ostream to which any logging should be sent
+bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_pdb__recalc_backbone_residues(const pdb             &prm_pdb,             ///< The PDB to query
+                                                                                     const ostream_ref_opt &prm_ostream_ref_opt, ///< An optional reference to an ostream to which any logging should be sent
+                                                                                     const size_t          &prm_num_threads      ///< The maximum number of threads with which to calculate the hbond energies
                                                                                      ) {
 	return calc_bifur_hbonds_of_backbone_complete_pdb(
 		backbone_complete_subset_of_pdb(
 			prm_pdb,
 			prm_ostream_ref_opt,
 			dssp_skip_res_skipping::SKIP
-		).first
+		).first,
+		prm_num_threads
 	);
 }
 
@@ -56,7 +71,15 @@ bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_pdb__recalc_backbone_resi
 ///
 /// For simplicity, calc_bifur_hbonds_of_pdb__recalc_backbone_residues() can be used
 /// with a non backbone-complete PDB
-bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb(const pdb &prm_pdb ///< The PDB to query
+///
+/// This finds candidate pairs of residues with the spatial-index lattice, extracts the backbone
+/// coordinates once into a dssp_hbond_backbone_arrays and calculates the energies for each donor
+/// residue's candidate acceptors in blocks. If there are multiple threads, the donor residues are
+/// processed in tasks of up to RESIDUES_PER_TASK residues, with up to prm_num_threads tasks in flight
+/// at once. The hbonds are always added to the results in the same order, so the results don't
+/// depend on the number of threads.
+bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb(const pdb    &prm_pdb,        ///< The PDB to query
+                                                                             const size_t &prm_num_threads ///< The maximum number of threads with which to calculate the hbond energies
                                                                              ) {
 	// Note that this is set a little bit higher because sometimes float rounding
 	// errors take the answer over the cutoff. This can be fixed using doubles
@@ -70,29 +93,67 @@ bifur_hbond_list dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb(con
 
 	bifur_hbond_list results{ num_pdb_residues };
 
-	if ( num_pdb_residues > 0 ) {
-		const auto lattice = make_sparse_lattice( prm_pdb, CELL_SIZE, MAX_DIST );
+	if ( num_pdb_residues == 0 ) {
+		return results;
+	}
 
-		scan_sparse_lattice(
-			lattice,
-			prm_pdb,
-			CELL_SIZE,
-			MAX_DIST,
-			[&] (const simple_locn_index &x, const simple_locn_index &y) {
-				if ( x.index != y.index ) {
-					if ( dssp_hbond_calc::has_hbond_energy_asymm( prm_pdb, x.index, y.index ) ) {
-						const auto energy = dssp_hbond_calc::get_hbond_energy_asymm( prm_pdb, x.index, y.index );
-						if ( energy < 0.0 ) {
-							results.update_with_nh_idx_co_idx_energy(
-								x.index,
-								y.index,
-								energy
-							);
-						}
-					}
-				}
+	const dssp_hbond_backbone_arrays backbone_arrays{ prm_pdb };
+
+	// Gather each donor's candidate acceptors, in the order that the lattice scan finds them
+	size_vec_vec candidate_acceptors( num_pdb_residues );
+	scan_sparse_lattice(
+		make_sparse_lattice( prm_pdb, CELL_SIZE, MAX_DIST ),
+		prm_pdb,
+		CELL_SIZE,
+		MAX_DIST,
+		[&] (const simple_locn_index &x, const simple_locn_index &y) {
+			if ( x.index != y.index && backbone_arrays.has_hbond_energy( x.index, y.index ) ) {
+				candidate_acceptors[ x.index ].push_back( y.index );
+			}
+		}
+	);
+
+	vector<vector<hbond_energy_t>> energies( num_pdb_residues );
+	const auto calc_energies = [&] (const size_t &prm_begin, const size_t &prm_end) {
+		for (size_t donor_ctr = prm_begin; donor_ctr < prm_end; ++donor_ctr) {
+			backbone_arrays.get_hbond_energies( donor_ctr, candidate_acceptors[ donor_ctr ], energies[ donor_ctr ] );
+		}
+	};
+
+	if ( prm_num_threads <= 1 ) {
+		calc_energies( 0, num_pdb_residues );
+	}
+	else {
+		deque<future<void>> task_futures;
+		for (size_t begin = 0; begin < num_pdb_residues; begin += RESIDUES_PER_TASK) {
+			if ( task_futures.size() >= prm_num_threads ) {
+				task_futures.front().get();
+				task_futures.pop_front();
+			}
+			const size_t end = min( num_pdb_residues, begin + RESIDUES_PER_TASK );
+			task_futures.push_back( std::async(
+				std::launch::async,
+				[&, begin, end] { calc_energies( begin, end ); }
+			) );
+		}
+		while ( ! task_futures.empty() ) {
+			task_futures.front().get();
+			task_futures.pop_front();
+		}
+	}
+
+	for (size_t donor_ctr = 0; donor_ctr < num_pdb_residues; ++donor_ctr) {
+		const size_vec               &acceptors        = candidate_acceptors[ donor_ctr ];
+		const vector<hbond_energy_t> &donor_energies   = energies           [ donor_ctr ];
+		for (size_t acceptor_ctr = 0; acceptor_ctr < acceptors.size(); ++acceptor_ctr) {
+			if ( donor_energies[ acceptor_ctr ] < 0.0 ) {
+				results.update_with_nh_idx_co_idx_energy(
+					debug_numeric_cast<hbond_partner_t>( donor_ctr                 ),
+					debug_numeric_cast<hbond_partner_t>( acceptors[ acceptor_ctr ] ),
+					donor_energies[ acceptor_ctr ]
+				);
 			}
-		);
+		}
 	}
 
 	return results;
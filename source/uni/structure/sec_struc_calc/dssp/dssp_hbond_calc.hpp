@@ -61,6 +61,11 @@ namespace cath {
 			dssp_hbond_calc() = delete;
 			~dssp_hbond_calc() = delete;
 
+			static hbond_energy_t get_hbond_energy_of_distances(const double &,
+			                                                    const double &,
+			                                                    const double &,
+			                                                    const double &);
+
 			static hbond_energy_t get_hbond_energy(const geom::coord &,
 			                                       const geom::coord &,
 			                                       const geom::coord &,
@@ -83,40 +88,42 @@ namespace cath {
 			                                   const size_t &);
 
 			static bifur_hbond_list calc_bifur_hbonds_of_pdb__recalc_backbone_residues(const file::pdb &,
-			                                                                           const ostream_ref_opt & = boost::none);
+			                                                                           const ostream_ref_opt & = boost::none,
+			                                                                           const size_t & = 1);
+
+			static bifur_hbond_list calc_bifur_hbonds_of_backbone_complete_pdb(const file::pdb &,
+			                                                                   const size_t & = 1);
 
-			static bifur_hbond_list calc_bifur_hbonds_of_backbone_complete_pdb(const file::pdb &);
+			/// \brief The number of donor residues per task when calculating hbonds with multiple threads
+			static constexpr size_t RESIDUES_PER_TASK = 64;
 		};
 
-		/// \brief Calculate the DSSP hbond energy between the specified N & H coords of one
-		///        residue and the C & O coords of another
-		inline hbond_energy_t dssp_hbond_calc::get_hbond_energy(const geom::coord &prm_n, ///< The N coord of one residue
-		                                                        const geom::coord &prm_h, ///< The H coord of one residue
-		                                                        const geom::coord &prm_c, ///< The C coord of another residue
-		                                                        const geom::coord &prm_o  ///< The O coord of another residue
-		                                                        ) {
+		/// \brief Calculate the DSSP hbond energy from the specified distances between the N & H atoms
+		///        of one residue and the C & O atoms of another
+		///
+		/// This is kept free of any lookups so that it can be inlined into loops over arrays of distances
+		inline hbond_energy_t dssp_hbond_calc::get_hbond_energy_of_distances(const double &prm_dist_no, ///< The distance between the N and the O
+		                                                                     const double &prm_dist_hc, ///< The distance between the H and the C
+		                                                                     const double &prm_dist_ho, ///< The distance between the H and the O
+		                                                                     const double &prm_dist_nc  ///< The distance between the N and the C
+		                                                                     ) {
 			constexpr double         MIN_DISTANCE      = 0.5;
 			constexpr double         ENERGY_MULTIPLIER = 0.42 * 0.2 * 332;
 			constexpr hbond_energy_t MIN_ENERGY        = static_cast<hbond_energy_t>(   -9.9 );
 			constexpr hbond_energy_t MAX_ENERGY        = static_cast<hbond_energy_t>(    0.0 );
 			constexpr hbond_energy_t ROUNDING_FACTOR   = static_cast<hbond_energy_t>( 1000.0 );
 
-			const double dist_no = distance_between_points( prm_n, prm_o );
-			const double dist_hc = distance_between_points( prm_h, prm_c );
-			const double dist_ho = distance_between_points( prm_h, prm_o );
-			const double dist_nc = distance_between_points( prm_n, prm_c );
-
-			if ( dist_ho < MIN_DISTANCE || dist_hc < MIN_DISTANCE || dist_nc < MIN_DISTANCE || dist_no < MIN_DISTANCE ) {
+			if ( prm_dist_ho < MIN_DISTANCE || prm_dist_hc < MIN_DISTANCE || prm_dist_nc < MIN_DISTANCE || prm_dist_no < MIN_DISTANCE ) {
 				return MIN_ENERGY;
 			}
 
 			return std::round(
 				ROUNDING_FACTOR * boost::algorithm::clamp(
 					ENERGY_MULTIPLIER * (
-						  ( 1.0 / dist_no )
-						+ ( 1.0 / dist_hc )
-						- ( 1.0 / dist_ho )
-						- ( 1.0 / dist_nc )
+						  ( 1.0 / prm_dist_no )
+						+ ( 1.0 / prm_dist_hc )
+						- ( 1.0 / prm_dist_ho )
+						- ( 1.0 / prm_dist_nc )
 					),
 					MIN_ENERGY,
 					MAX_ENERGY
@@ -124,6 +131,21 @@ namespace cath {
 			) / ROUNDING_FACTOR;
 		}
 
+		/// \brief Calculate the DSSP hbond energy between the specified N & H coords of one
+		///        residue and the C & O coords of another
+		inline hbond_energy_t dssp_hbond_calc::get_hbond_energy(const geom::coord &prm_n, ///< The N coord of one residue
+		                                                        const geom::coord &prm_h, ///< The H coord of one residue
+		                                                        const geom::coord &prm_c, ///< The C coord of another residue
+		                                                        const geom::coord &prm_o  ///< The O coord of another residue
+		                                                        ) {
+			return get_hbond_energy_of_distances(
+				distance_between_points( prm_n, prm_o ),
+				distance_between_points( prm_h, prm_c ),
+				distance_between_points( prm_h, prm_o ),
+				distance_between_points( prm_n, prm_c )
+			);
+		}
+
 		/// \brief Calculate the DSSP hbond energy between the specified two residues (with supporting info
 		///        from the residue that precedes the first one)
 		inline hbond_energy_t dssp_hbond_calc::get_hbond_energy(const boost::optional<file::pdb_residue> &prm_residue_i_prev, ///< The residue that precedes the first residue
@@ -796,8 +796,9 @@ sec_struc_type_vec cath::sec::calc_sec_strucs(const bifur_hbond_list &prm_bifur_
 /// \brief Calculate the sec_struc_type values for the specified pdb
 ///
 /// \relates pdb
-sec_struc_type_vec cath::sec::calc_sec_strucs_of_pdb__recalc_backbone_residues(const pdb             &prm_pdb,   ///< The pdb to query
-                                                                               const ostream_ref_opt &prm_stderr ///< An optional reference to an ostream to which any logging should be performed
+sec_struc_type_vec cath::sec::calc_sec_strucs_of_pdb__recalc_backbone_residues(const pdb             &prm_pdb,        ///< The pdb to query
+                                                                               const ostream_ref_opt &prm_stderr,     ///< An optional reference to an ostream to which any logging should be performed
+                                                                               const size_t          &prm_num_threads ///< The maximum number of threads with which to calculate the hbonds
                                                                                ) {
 	const auto backbone_pdb = backbone_complete_subset_of_pdb(
 		prm_pdb,
@@ -805,7 +806,7 @@ sec_struc_type_vec cath::sec::calc_sec_strucs_of_pdb__recalc_backbone_residues(c
 		dssp_skip_res_skipping::SKIP
 	).first;
 	return calc_sec_strucs(
-		dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( backbone_pdb ),
+		dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( backbone_pdb, prm_num_threads ),
 		indices_of_residues_following_chain_breaks( backbone_pdb )
 	);
 }
@@ -813,10 +814,11 @@ sec_struc_type_vec cath::sec::calc_sec_strucs_of_pdb__recalc_backbone_residues(c
 /// \brief Calculate the sec_struc_type values for the specified pdb
 ///
 /// \relates pdb
-sec_struc_type_vec cath::sec::calc_sec_strucs_of_backbone_complete_pdb(const pdb &prm_pdb ///< The pdb to query
+sec_struc_type_vec cath::sec::calc_sec_strucs_of_backbone_complete_pdb(const pdb    &prm_pdb,        ///< The pdb to query
+                                                                       const size_t &prm_num_threads ///< The maximum number of threads with which to calculate the hbonds
                                                                        ) {
 	return calc_sec_strucs(
-		dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( prm_pdb ),
+		dssp_hbond_calc::calc_bifur_hbonds_of_backbone_complete_pdb( prm_pdb, prm_num_threads ),
 		indices_of_residues_following_chain_breaks( prm_pdb )
 	);
 }
@@ -243,9 +243,11 @@ namespace cath {
 		                                   const size_vec &);
 
 		sec_struc_type_vec calc_sec_strucs_of_pdb__recalc_backbone_residues(const file::pdb &,
-		                                                                    const ostream_ref_opt & = boost::none);
+		                                                                    const ostream_ref_opt & = boost::none,
+		                                                                    const size_t & = 1);
 
-		sec_struc_type_vec calc_sec_strucs_of_backbone_complete_pdb(const file::pdb &);
+		sec_struc_type_vec calc_sec_strucs_of_backbone_complete_pdb(const file::pdb &,
+		                                                            const size_t & = 1);
 
 		sec_struc_type_vec get_sec_strucs(const protein &);
 
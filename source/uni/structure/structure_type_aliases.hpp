@@ -192,6 +192,9 @@ namespace cath {
 	/// \brief TODOCUMENT
 	using protein_vec                     = std::vector<protein>;
 
+	/// \brief Type alias for a vector of references to const proteins
+	using protein_cref_vec                = ref_vec<const protein>;
+
 	/// \brief TODOCUMENT
 	using sec_struc_planar_angles_vec     = std::vector<sec_struc_planar_angles>;
 
@@ -82,14 +82,14 @@ namespace cath {
 				template <typename CELLS, typename ACTN>
 				void perform_action_on_matches(const view_cache_index_entry &,
 				                               const CELLS &,
-				                               const detail::vcie_match_criteria &,
+				                               const vcie_match_criteria &,
 				                               ACTN &) const;
 
 				template <typename CELLS, typename ACTN>
 				inline void perform_action_on_all_match_at_nodes(const CELLS &,
 				                                                 const view_cache_index_dim_dirn &,
 				                                                 const CELLS &,
-				                                                 const detail::vcie_match_criteria &,
+				                                                 const vcie_match_criteria &,
 				                                                 ACTN &) const;
 			};
 
@@ -154,7 +154,7 @@ namespace cath {
 			template <typename CELLS, typename ACTN>
 			inline void view_cache_index_dim_dirn::perform_action_on_matches(const view_cache_index_entry      &prm_entry,    ///< TODOCUMENT
 			                                                                 const CELLS                       &prm_cells,    ///< TODOCUMENT
-			                                                                 const detail::vcie_match_criteria &prm_criteria, ///< TODOCUMENT
+			                                                                 const vcie_match_criteria         &prm_criteria, ///< TODOCUMENT
 			                                                                 ACTN                              &prm_action    ///< TODOCUMENT
 			                                                                 ) const {
 				const bool increases = get_increases( prm_entry );
@@ -170,7 +170,7 @@ namespace cath {
 			inline void view_cache_index_dim_dirn::perform_action_on_all_match_at_nodes(const CELLS                       &prm_query_cells, ///< TODOCUMENT
 			                                                                            const view_cache_index_dim_dirn   &prm_query_dim,   ///< TODOCUMENT
 			                                                                            const CELLS                       &prm_match_cells, ///< TODOCUMENT
-			                                                                            const detail::vcie_match_criteria &prm_criteria,    ///< TODOCUMENT
+			                                                                            const vcie_match_criteria         &prm_criteria,    ///< TODOCUMENT
 			                                                                            ACTN                              &prm_action       ///< TODOCUMENT
 			                                                                            ) const {
 				if ( ! prm_query_cells.empty() && ! prm_match_cells.empty() ) {
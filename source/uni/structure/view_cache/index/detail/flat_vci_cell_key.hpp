@@ -0,0 +1,134 @@
+/// \file
+/// \brief The flat_vci_cell_key header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_DETAIL_FLAT_VCI_CELL_KEY_HPP
+#define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_DETAIL_FLAT_VCI_CELL_KEY_HPP
+
+#include <cstdint>
+
+namespace cath {
+	namespace index {
+		namespace detail {
+
+			/// \brief The type of the key used to identify a cell in a flat_view_cache_index
+			///
+			/// The bits are laid out (from most significant to least significant) as:
+			///  * 1  bit  : the direction (whether the to_index is greater than the from_index)
+			///  * 15 bits : the from-phi cell
+			///  * 48 bits : the Morton interleave of the (biased) x, y and z cells
+			///
+			/// so sorting by key groups entries by direction, then by from-phi cell and then
+			/// in Z-order through the view space, which keeps spatially close cells close in memory.
+			using flat_vci_cell_key = std::uint64_t;
+
+			/// \brief The number of bits used for each of the x, y and z cells in a flat_vci_cell_key
+			constexpr unsigned int FLAT_VCI_XYZ_CELL_BITS = 16;
+
+			/// \brief The number of bits used for the from-phi cell in a flat_vci_cell_key
+			constexpr unsigned int FLAT_VCI_PHI_CELL_BITS = 15;
+
+			/// \brief The bias added to the (possibly negative) x, y and z cells to make them unsigned
+			constexpr int FLAT_VCI_XYZ_CELL_BIAS = ( 1 << ( FLAT_VCI_XYZ_CELL_BITS - 1 ) );
+
+			/// \brief The minimum x, y or z cell that can be represented in a flat_vci_cell_key
+			constexpr int FLAT_VCI_MIN_XYZ_CELL  = -FLAT_VCI_XYZ_CELL_BIAS;
+
+			/// \brief The maximum x, y or z cell that can be represented in a flat_vci_cell_key
+			constexpr int FLAT_VCI_MAX_XYZ_CELL  =  FLAT_VCI_XYZ_CELL_BIAS - 1;
+
+			/// \brief The maximum from-phi cell that can be represented in a flat_vci_cell_key
+			constexpr int FLAT_VCI_MAX_PHI_CELL  = ( 1 << FLAT_VCI_PHI_CELL_BITS ) - 1;
+
+			/// \brief Spread the lowest 16 bits of the specified value so that there are two zero bits between each
+			inline constexpr std::uint64_t morton_spread_by_2(std::uint64_t prm_value ///< The value to spread
+			                                                  ) {
+				prm_value &= 0x000000000000FFFFu;
+				prm_value = ( prm_value | ( prm_value << 32 ) ) & 0x001F00000000FFFFu;
+				prm_value = ( prm_value | ( prm_value << 16 ) ) & 0x001F0000FF0000FFu;
+				prm_value = ( prm_value | ( prm_value <<  8 ) ) & 0x100F00F00F00F00Fu;
+				prm_value = ( prm_value | ( prm_value <<  4 ) ) & 0x10C30C30C30C30C3u;
+				prm_value = ( prm_value | ( prm_value <<  2 ) ) & 0x1249249249249249u;
+				return prm_value;
+			}
+
+			/// \brief Compact every third bit of the specified value into the lowest 16 bits (the inverse of morton_spread_by_2())
+			inline constexpr std::uint64_t morton_compact_by_2(std::uint64_t prm_value ///< The value to compact
+			                                                   ) {
+				prm_value &= 0x1249249249249249u;
+				prm_value = ( prm_value ^ ( prm_value >>  2 ) ) & 0x10C30C30C30C30C3u;
+				prm_value = ( prm_value ^ ( prm_value >>  4 ) ) & 0x100F00F00F00F00Fu;
+				prm_value = ( prm_value ^ ( prm_value >>  8 ) ) & 0x001F0000FF0000FFu;
+				prm_value = ( prm_value ^ ( prm_value >> 16 ) ) & 0x001F00000000FFFFu;
+				prm_value = ( prm_value ^ ( prm_value >> 32 ) ) & 0x000000000000FFFFu;
+				return prm_value;
+			}
+
+			/// \brief Make the flat_vci_cell_key for the specified direction and cells
+			///
+			/// \pre The cells must be within the ranges that can be represented
+			///      (see FLAT_VCI_MIN_XYZ_CELL, FLAT_VCI_MAX_XYZ_CELL and FLAT_VCI_MAX_PHI_CELL)
+			inline constexpr flat_vci_cell_key make_flat_vci_cell_key(const bool &prm_increases, ///< Whether the to_index is greater than the from_index
+			                                                          const int  &prm_phi_cell,  ///< The from-phi cell
+			                                                          const int  &prm_x_cell,    ///< The x cell
+			                                                          const int  &prm_y_cell,    ///< The y cell
+			                                                          const int  &prm_z_cell     ///< The z cell
+			                                                          ) {
+				return ( ( prm_increases ? flat_vci_cell_key{ 1 } : flat_vci_cell_key{ 0 } ) << ( FLAT_VCI_PHI_CELL_BITS + 3 * FLAT_VCI_XYZ_CELL_BITS ) )
+					| ( static_cast<flat_vci_cell_key>( prm_phi_cell ) << ( 3 * FLAT_VCI_XYZ_CELL_BITS ) )
+					| ( morton_spread_by_2( static_cast<flat_vci_cell_key>( prm_x_cell + FLAT_VCI_XYZ_CELL_BIAS ) ) << 2 )
+					| ( morton_spread_by_2( static_cast<flat_vci_cell_key>( prm_y_cell + FLAT_VCI_XYZ_CELL_BIAS ) ) << 1 )
+					| ( morton_spread_by_2( static_cast<flat_vci_cell_key>( prm_z_cell + FLAT_VCI_XYZ_CELL_BIAS ) )      );
+			}
+
+			/// \brief Get the direction from the specified flat_vci_cell_key
+			inline constexpr bool increases_of_flat_vci_cell_key(const flat_vci_cell_key &prm_key ///< The key to query
+			                                                     ) {
+				return ( ( prm_key >> ( FLAT_VCI_PHI_CELL_BITS + 3 * FLAT_VCI_XYZ_CELL_BITS ) ) != 0 );
+			}
+
+			/// \brief Get the from-phi cell from the specified flat_vci_cell_key
+			inline constexpr int phi_cell_of_flat_vci_cell_key(const flat_vci_cell_key &prm_key ///< The key to query
+			                                                   ) {
+				return static_cast<int>( ( prm_key >> ( 3 * FLAT_VCI_XYZ_CELL_BITS ) ) & static_cast<flat_vci_cell_key>( FLAT_VCI_MAX_PHI_CELL ) );
+			}
+
+			/// \brief Get the x cell from the specified flat_vci_cell_key
+			inline constexpr int x_cell_of_flat_vci_cell_key(const flat_vci_cell_key &prm_key ///< The key to query
+			                                                 ) {
+				return static_cast<int>( morton_compact_by_2( prm_key >> 2 ) ) - FLAT_VCI_XYZ_CELL_BIAS;
+			}
+
+			/// \brief Get the y cell from the specified flat_vci_cell_key
+			inline constexpr int y_cell_of_flat_vci_cell_key(const flat_vci_cell_key &prm_key ///< The key to query
+			                                                 ) {
+				return static_cast<int>( morton_compact_by_2( prm_key >> 1 ) ) - FLAT_VCI_XYZ_CELL_BIAS;
+			}
+
+			/// \brief Get the z cell from the specified flat_vci_cell_key
+			inline constexpr int z_cell_of_flat_vci_cell_key(const flat_vci_cell_key &prm_key ///< The key to query
+			                                                 ) {
+				return static_cast<int>( morton_compact_by_2( prm_key      ) ) - FLAT_VCI_XYZ_CELL_BIAS;
+			}
+
+		} // namespace detail
+	} // namespace index
+} // namespace cath
+
+#endif
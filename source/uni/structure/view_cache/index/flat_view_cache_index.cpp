@@ -0,0 +1,173 @@
+/// \file
+/// \brief The flat_view_cache_index class definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "flat_view_cache_index.hpp"
+
+#include <boost/range/algorithm/stable_sort.hpp>
+#include <boost/range/algorithm_ext/iota.hpp>
+
+#include "common/exception/out_of_range_exception.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::index;
+using namespace cath::index::detail;
+using namespace std;
+
+using cath::index::detail::detail::vci_linear_dim_spec_view_from_phi;
+using cath::index::detail::detail::vci_linear_dim_spec_view_x;
+using cath::index::detail::detail::vci_linear_dim_spec_view_y;
+using cath::index::detail::detail::vci_linear_dim_spec_view_z;
+
+/// \brief Get the key of the cell in which the specified entry falls
+///
+/// \throws out_of_range_exception if the entry's cells can't be represented in a flat_vci_cell_key
+flat_vci_cell_key flat_view_cache_index::key_of_entry(const view_cache_index_entry &prm_entry ///< The entry to be indexed
+                                                      ) const {
+	const auto cell_of = [&] (const auto &prm_spec, const auto &prm_cell_width) {
+		return cath::index::detail::detail::detail::cell_index_of_value_in_current(
+			prm_cell_width,
+			0,
+			std::decay_t<decltype( prm_spec )>().get_index_value( prm_entry )
+		);
+	};
+	const int phi_cell = cell_of( vci_linear_dim_spec_view_from_phi(), phi_cell_width );
+	const int x_cell   = cell_of( vci_linear_dim_spec_view_x(),        xyz_cell_width );
+	const int y_cell   = cell_of( vci_linear_dim_spec_view_y(),        xyz_cell_width );
+	const int z_cell   = cell_of( vci_linear_dim_spec_view_z(),        xyz_cell_width );
+
+	if ( phi_cell < 0 || phi_cell > FLAT_VCI_MAX_PHI_CELL ) {
+		BOOST_THROW_EXCEPTION(out_of_range_exception("Unable to index a view_cache_index_entry whose from-phi cell is out of range for a flat_view_cache_index"));
+	}
+	for (const int &xyz_cell : { x_cell, y_cell, z_cell } ) {
+		if ( xyz_cell < FLAT_VCI_MIN_XYZ_CELL || xyz_cell > FLAT_VCI_MAX_XYZ_CELL ) {
+			BOOST_THROW_EXCEPTION(out_of_range_exception("Unable to index a view_cache_index_entry whose view cell is out of range for a flat_view_cache_index"));
+		}
+	}
+
+	return make_flat_vci_cell_key(
+		( prm_entry.get_to_index() > prm_entry.get_from_index() ),
+		phi_cell,
+		x_cell,
+		y_cell,
+		z_cell
+	);
+}
+
+/// \brief Check that the specified flat_view_cache_index was built with the same cell widths as this one
+///
+/// \throws invalid_argument_exception if not
+void flat_view_cache_index::check_compatible(const flat_view_cache_index &prm_other ///< The other flat_view_cache_index
+                                             ) const {
+	if ( xyz_cell_width != prm_other.xyz_cell_width || phi_cell_width != prm_other.phi_cell_width ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot compare flat_view_cache_index objects that were built with different cell widths"));
+	}
+}
+
+/// \brief Ctor from the cell widths and the entries to index
+flat_view_cache_index::flat_view_cache_index(const view_base_type       &prm_xyz_cell_width, ///< The width of the cells in the x, y and z dimensions
+                                             const angle_type           &prm_phi_cell_width, ///< The width of the cells in the from-phi dimension
+                                             view_cache_index_entry_vec  prm_entries         ///< The entries to index
+                                             ) : xyz_cell_width( prm_xyz_cell_width ),
+                                                 phi_cell_width( prm_phi_cell_width ) {
+	vci_linear_dim_spec_view_x       ().check_cell_width( xyz_cell_width );
+	vci_linear_dim_spec_view_from_phi().check_cell_width( phi_cell_width );
+
+	const size_t num_entries = prm_entries.size();
+
+	// Calculate the key for each entry and then sort the entries' indices by key
+	flat_vci_cell_key_vec keys;
+	keys.reserve( num_entries );
+	for (const view_cache_index_entry &entry : prm_entries) {
+		keys.push_back( key_of_entry( entry ) );
+	}
+	size_vec order( num_entries );
+	boost::iota( order, 0_z );
+	boost::range::stable_sort(
+		order,
+		[&] (const size_t &x, const size_t &y) { return keys[ x ] < keys[ y ]; }
+	);
+
+	// Move the entries into place and record the start of each cell
+	entries.reserve( num_entries );
+	for (const size_t &entry_index : order) {
+		const flat_vci_cell_key &key = keys[ entry_index ];
+		if ( cell_keys.empty() || cell_keys.back() != key ) {
+			cell_keys.push_back( key );
+			cell_offsets.push_back( entries.size() );
+
+			const int phi_cell = phi_cell_of_flat_vci_cell_key( key );
+			const int x_cell   = x_cell_of_flat_vci_cell_key  ( key );
+			const int y_cell   = y_cell_of_flat_vci_cell_key  ( key );
+			const int z_cell   = z_cell_of_flat_vci_cell_key  ( key );
+			const bool is_first = ( cell_keys.size() == 1 );
+			min_phi_cell = is_first ? phi_cell : min( min_phi_cell, phi_cell );
+			max_phi_cell = is_first ? phi_cell : max( max_phi_cell, phi_cell );
+			min_x_cell   = is_first ? x_cell   : min( min_x_cell,   x_cell   );
+			max_x_cell   = is_first ? x_cell   : max( max_x_cell,   x_cell   );
+			min_y_cell   = is_first ? y_cell   : min( min_y_cell,   y_cell   );
+			max_y_cell   = is_first ? y_cell   : max( max_y_cell,   y_cell   );
+			min_z_cell   = is_first ? z_cell   : min( min_z_cell,   z_cell   );
+			max_z_cell   = is_first ? z_cell   : max( max_z_cell,   z_cell   );
+		}
+		entries.push_back( std::move( prm_entries[ entry_index ] ) );
+	}
+	cell_offsets.push_back( entries.size() );
+}
+
+/// \brief Get the number of entries in the index
+size_t flat_view_cache_index::get_num_entries() const {
+	return entries.size();
+}
+
+/// \brief Get the number of occupied cells in the index
+size_t flat_view_cache_index::get_num_cells() const {
+	return cell_keys.size();
+}
+
+/// \brief Build a flat_view_cache_index of the from/to residue pairs in the specified protein that meet the specified criteria
+///
+/// This indexes the same entries as build_view_cache_index()
+///
+/// \relates flat_view_cache_index
+flat_view_cache_index cath::index::build_flat_view_cache_index(const double              &prm_xyz_cell_width,       ///< The width of the cells in the x, y and z dimensions
+                                                               const angle_type          &prm_phi_angle_cell_width, ///< The width of the cells in the from-phi dimension
+                                                               const protein             &prm_protein,              ///< The protein whose from/to residue pairs should be indexed
+                                                               const vcie_match_criteria &prm_criteria              ///< The criteria that entries must meet to be indexed
+                                                               ) {
+	const size_t num_residues = prm_protein.get_length();
+	view_cache_index_entry_vec the_entries;
+	for (const size_t &from_ctr : indices( num_residues ) ) {
+		for (const size_t &to_ctr : indices( num_residues ) ) {
+			const view_cache_index_entry the_entry = make_view_cache_index_entry( prm_protein, from_ctr, to_ctr );
+			if ( prm_criteria( the_entry ) ) {
+				the_entries.push_back( the_entry );
+			}
+		}
+	}
+	return {
+		debug_numeric_cast<view_base_type>( prm_xyz_cell_width ),
+		prm_phi_angle_cell_width,
+		std::move( the_entries )
+	};
+}
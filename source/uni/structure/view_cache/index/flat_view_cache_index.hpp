@@ -0,0 +1,385 @@
+/// \file
+/// \brief The flat_view_cache_index class header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_FLAT_VIEW_CACHE_INDEX_HPP
+#define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_FLAT_VIEW_CACHE_INDEX_HPP
+
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/cpp14/cbegin_cend.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/size_t_literal.hpp"
+#include "common/type_aliases.hpp"
+#include "structure/view_cache/index/detail/dims/view_cache_index_dim_linear_from_phi.hpp"
+#include "structure/view_cache/index/detail/dims/view_cache_index_dim_linear_x.hpp"
+#include "structure/view_cache/index/detail/dims/view_cache_index_dim_linear_y.hpp"
+#include "structure/view_cache/index/detail/dims/view_cache_index_dim_linear_z.hpp"
+#include "structure/view_cache/index/detail/flat_vci_cell_key.hpp"
+#include "structure/view_cache/index/detail/vcie_match_criteria.hpp"
+#include "structure/view_cache/index/view_cache_index_entry.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cath { class protein; }
+
+using namespace cath::common::literals;
+
+namespace cath {
+	namespace index {
+		namespace detail {
+
+			/// \brief A half-open range of cells [ first, second ) in one dimension of a flat_view_cache_index
+			using flat_vci_cell_range      = std::pair<int, int>;
+
+			/// \brief A pair of flat_vci_cell_range values, used to represent searches that wrap around (in angle dimensions)
+			///
+			/// The second range is empty unless the search wraps
+			using flat_vci_cell_range_pair = std::pair<flat_vci_cell_range, flat_vci_cell_range>;
+
+			/// \brief Type alias for a vector of flat_vci_cell_key values
+			using flat_vci_cell_key_vec    = std::vector<flat_vci_cell_key>;
+
+			/// \brief Get the cells that might hold values in the range [ begin, end ] in the dimension specified by the spec T
+			///
+			/// This mirrors view_cache_index_dim_linear<T>::search_cell_ranges() but works in absolute cell numbers,
+			/// which are then limited to the specified occupied range, [ min_cell, max_cell ]
+			template <typename T>
+			flat_vci_cell_range_pair flat_vci_search_cell_ranges(const typename T::value_type &prm_cell_width, ///< The width of the cells in this dimension
+			                                                     const typename T::value_type &prm_begin,      ///< The start of the range of values to search for
+			                                                     const typename T::value_type &prm_end,        ///< The end of the range of values to search for
+			                                                     const int                    &prm_min_cell,   ///< The minimum occupied cell
+			                                                     const int                    &prm_max_cell    ///< The maximum occupied cell
+			                                                     ) {
+				const auto prepped    = T().prepare_search_begin_and_end( prm_begin, prm_end );
+				const int  begin_cell = detail::detail::cell_index_of_value_in_current( prm_cell_width, 0, prepped.first                   );
+				const int  end_cell   = detail::detail::cell_index_of_value_in_current( prm_cell_width, 0, prepped.second + prm_cell_width );
+				const auto limit      = [&] (const int &x, const int &y) {
+					return flat_vci_cell_range{ std::max( x, prm_min_cell ), std::min( y, prm_max_cell + 1 ) };
+				};
+				return ( prepped.first < prepped.second )
+					? flat_vci_cell_range_pair{ limit( begin_cell, end_cell ), flat_vci_cell_range{ 0, 0 }   }
+					: flat_vci_cell_range_pair{ limit( begin_cell, INT_MAX  ), limit( INT_MIN, end_cell )    };
+			}
+
+			/// \brief Get the value at the start of the specified (absolute) cell in a dimension with the specified cell width
+			template <typename T>
+			T flat_vci_min_value_in_cell(const T   &prm_cell_width, ///< The width of the cells
+			                             const int &prm_cell        ///< The cell of interest
+			                             ) {
+				return detail::detail::min_value_in_cell_of_index_in_current( prm_cell_width, prm_cell, 0_z );
+			}
+
+		} // namespace detail
+
+		/// \brief A flat alternative to view_cache_index that stores all of the entries in one contiguous
+		///        array, sorted by a key for the cell in which they fall
+		///
+		/// This indexes on the same dimensions as detail::standard_vci_nested_layers
+		/// (direction, from-phi, x, y and z) and uses the same cells and the same search windows so
+		/// that its queries perform the action on exactly the same pairs of entries. The difference
+		/// is that, rather than building a tree of vectors of (mostly sparse) cells, it sorts
+		/// the entries by a flat_vci_cell_key (in which the x, y and z cells are Morton-interleaved)
+		/// and then finds neighbouring cells by binary searches in the sorted, unique keys.
+		///
+		/// The index is immutable once constructed.
+		class flat_view_cache_index final {
+		private:
+			/// \brief The width of the cells in the x, y and z dimensions
+			detail::view_base_type     xyz_cell_width;
+
+			/// \brief The width of the cells in the from-phi dimension
+			detail::angle_type         phi_cell_width;
+
+			/// \brief The sorted, unique keys of the occupied cells
+			detail::flat_vci_cell_key_vec cell_keys;
+
+			/// \brief The offsets into entries of the start of each occupied cell, with a final one-past-the-end offset
+			///
+			/// So the entries for cell_keys[ i ] are entries[ cell_offsets[ i ] ] to entries[ cell_offsets[ i + 1 ] - 1 ]
+			size_vec                   cell_offsets;
+
+			/// \brief The entries, sorted by cell key (and within each cell, in the order in which they were specified)
+			view_cache_index_entry_vec entries;
+
+			/// \brief The minimum occupied from-phi cell
+			int min_phi_cell = 0;
+
+			/// \brief The maximum occupied from-phi cell
+			int max_phi_cell = -1;
+
+			/// \brief The minimum occupied x cell
+			int min_x_cell   = 0;
+
+			/// \brief The maximum occupied x cell
+			int max_x_cell   = -1;
+
+			/// \brief The minimum occupied y cell
+			int min_y_cell   = 0;
+
+			/// \brief The maximum occupied y cell
+			int max_y_cell   = -1;
+
+			/// \brief The minimum occupied z cell
+			int min_z_cell   = 0;
+
+			/// \brief The maximum occupied z cell
+			int max_z_cell   = -1;
+
+			detail::flat_vci_cell_key key_of_entry(const view_cache_index_entry &) const;
+
+			size_size_pair find_cell(const detail::flat_vci_cell_key &,
+			                         const size_t &,
+			                         const size_t &) const;
+
+			template <typename FN>
+			void for_each_cell_in_ranges(const bool &,
+			                             const detail::flat_vci_cell_range_pair &,
+			                             const detail::flat_vci_cell_range &,
+			                             const detail::flat_vci_cell_range &,
+			                             const detail::flat_vci_cell_range &,
+			                             FN &&) const;
+
+			void check_compatible(const flat_view_cache_index &) const;
+
+		public:
+			flat_view_cache_index(const detail::view_base_type &,
+			                      const detail::angle_type &,
+			                      view_cache_index_entry_vec);
+
+			size_t get_num_entries() const;
+			size_t get_num_cells() const;
+
+			template <typename ACTN>
+			void perform_action_on_matches(const view_cache_index_entry &,
+			                               const detail::vcie_match_criteria &,
+			                               ACTN &) const;
+
+			template <typename ACTN>
+			void perform_action_on_all_match_at_leaves(const flat_view_cache_index &,
+			                                           const detail::vcie_match_criteria &,
+			                                           ACTN &) const;
+
+			template <typename ACTN>
+			void perform_action_on_all_match_at_nodes(const flat_view_cache_index &,
+			                                          const detail::vcie_match_criteria &,
+			                                          ACTN &) const;
+		};
+
+		/// \brief Get the index range of the entries in the cell with the specified key,
+		///        searching only within cell_keys[ prm_begin ] to cell_keys[ prm_end - 1 ]
+		///
+		/// \returns The begin and end offsets into entries, which are equal if the cell isn't occupied
+		inline size_size_pair flat_view_cache_index::find_cell(const detail::flat_vci_cell_key &prm_key,   ///< The key of the cell to find
+		                                                       const size_t                    &prm_begin, ///< The index of the first cell key to search
+		                                                       const size_t                    &prm_end    ///< The index of one-past the last cell key to search
+		                                                       ) const {
+			const auto begin_itr = std::next( common::cbegin( cell_keys ), static_cast<ptrdiff_t>( prm_begin ) );
+			const auto end_itr   = std::next( common::cbegin( cell_keys ), static_cast<ptrdiff_t>( prm_end   ) );
+			const auto find_itr  = std::lower_bound( begin_itr, end_itr, prm_key );
+			if ( find_itr == end_itr || *find_itr != prm_key ) {
+				return { 0_z, 0_z };
+			}
+			const auto cell_index = static_cast<size_t>( std::distance( common::cbegin( cell_keys ), find_itr ) );
+			return { cell_offsets[ cell_index ], cell_offsets[ cell_index + 1 ] };
+		}
+
+		/// \brief Call the specified function with the begin and end offsets into entries of each occupied cell
+		///        in the specified direction and ranges of cells
+		///
+		/// For each from-phi cell, this uses the keys of the two opposite corners of the x/y/z box to narrow
+		/// down the keys that need searching (which works because Morton keys increase with each of x, y and z)
+		template <typename FN>
+		void flat_view_cache_index::for_each_cell_in_ranges(const bool                             &prm_increases,  ///< The direction of the cells of interest
+		                                                    const detail::flat_vci_cell_range_pair &prm_phi_ranges, ///< The ranges of from-phi cells of interest
+		                                                    const detail::flat_vci_cell_range      &prm_x_range,    ///< The range of x cells of interest
+		                                                    const detail::flat_vci_cell_range      &prm_y_range,    ///< The range of y cells of interest
+		                                                    const detail::flat_vci_cell_range      &prm_z_range,    ///< The range of z cells of interest
+		                                                    FN                                    &&prm_fn          ///< The function to call with the begin and end offsets of each occupied cell
+		                                                    ) const {
+			if ( prm_x_range.first >= prm_x_range.second || prm_y_range.first >= prm_y_range.second || prm_z_range.first >= prm_z_range.second ) {
+				return;
+			}
+			for (const detail::flat_vci_cell_range &phi_range : { prm_phi_ranges.first, prm_phi_ranges.second } ) {
+				for (int phi_cell = phi_range.first; phi_cell < phi_range.second; ++phi_cell) {
+					const auto lower_key = detail::make_flat_vci_cell_key( prm_increases, phi_cell, prm_x_range.first,      prm_y_range.first,      prm_z_range.first      );
+					const auto upper_key = detail::make_flat_vci_cell_key( prm_increases, phi_cell, prm_x_range.second - 1, prm_y_range.second - 1, prm_z_range.second - 1 );
+					const auto begin_itr = std::lower_bound( common::cbegin( cell_keys ), common::cend( cell_keys ), lower_key );
+					const auto end_itr   = std::upper_bound( begin_itr,                   common::cend( cell_keys ), upper_key );
+					if ( begin_itr == end_itr ) {
+						continue;
+					}
+					const auto begin_index = static_cast<size_t>( std::distance( common::cbegin( cell_keys ), begin_itr ) );
+					const auto end_index   = static_cast<size_t>( std::distance( common::cbegin( cell_keys ), end_itr   ) );
+					for (int x_cell = prm_x_range.first; x_cell < prm_x_range.second; ++x_cell) {
+						for (int y_cell = prm_y_range.first; y_cell < prm_y_range.second; ++y_cell) {
+							for (int z_cell = prm_z_range.first; z_cell < prm_z_range.second; ++z_cell) {
+								const auto the_cell = find_cell(
+									detail::make_flat_vci_cell_key( prm_increases, phi_cell, x_cell, y_cell, z_cell ),
+									begin_index,
+									end_index
+								);
+								if ( the_cell.first != the_cell.second ) {
+									prm_fn( the_cell.first, the_cell.second );
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// \brief Perform the specified action on each entry in this index that matches the specified entry
+		///        under the specified criteria
+		///
+		/// As with view_cache_index, this searches in the entry's direction and then, unless the criteria
+		/// require matching directions, in the opposite direction.
+		template <typename ACTN>
+		void flat_view_cache_index::perform_action_on_matches(const view_cache_index_entry      &prm_entry,    ///< The entry for which matches should be found
+		                                                      const detail::vcie_match_criteria &prm_criteria, ///< The criteria for matching
+		                                                      ACTN                              &prm_action    ///< The action to perform on each matching pair
+		                                                      ) const {
+			using phi_spec = detail::detail::vci_linear_dim_spec_view_from_phi;
+			using x_spec   = detail::detail::vci_linear_dim_spec_view_x;
+			using y_spec   = detail::detail::vci_linear_dim_spec_view_y;
+			using z_spec   = detail::detail::vci_linear_dim_spec_view_z;
+
+			if ( entries.empty() ) {
+				return;
+			}
+
+			const auto phi_value  = phi_spec().get_index_value  ( prm_entry    );
+			const auto phi_radius = phi_spec().get_search_radius( prm_criteria );
+			const auto xyz_radius = x_spec  ().get_search_radius( prm_criteria );
+			const auto x_value    = x_spec  ().get_index_value  ( prm_entry    );
+			const auto y_value    = y_spec  ().get_index_value  ( prm_entry    );
+			const auto z_value    = z_spec  ().get_index_value  ( prm_entry    );
+
+			const auto phi_ranges = detail::flat_vci_search_cell_ranges<phi_spec>( phi_cell_width, phi_value - phi_radius, phi_value + phi_radius, min_phi_cell, max_phi_cell );
+			const auto x_range    = detail::flat_vci_search_cell_ranges<x_spec  >( xyz_cell_width, x_value   - xyz_radius, x_value   + xyz_radius, min_x_cell,   max_x_cell   ).first;
+			const auto y_range    = detail::flat_vci_search_cell_ranges<y_spec  >( xyz_cell_width, y_value   - xyz_radius, y_value   + xyz_radius, min_y_cell,   max_y_cell   ).first;
+			const auto z_range    = detail::flat_vci_search_cell_ranges<z_spec  >( xyz_cell_width, z_value   - xyz_radius, z_value   + xyz_radius, min_z_cell,   max_z_cell   ).first;
+
+			const auto action_on_cell = [&] (const size_t &prm_begin, const size_t &prm_end) {
+				for (size_t entry_ctr = prm_begin; entry_ctr < prm_end; ++entry_ctr) {
+					const view_cache_index_entry &entry = entries[ entry_ctr ];
+					if ( prm_criteria( prm_entry, entry ) ) {
+						prm_action( prm_entry, entry );
+					}
+				}
+			};
+
+			const bool increases = ( prm_entry.get_to_index() > prm_entry.get_from_index() );
+			for_each_cell_in_ranges( increases, phi_ranges, x_range, y_range, z_range, action_on_cell );
+			if ( ! prm_criteria.get_require_matching_directions() ) {
+				for_each_cell_in_ranges( ! increases, phi_ranges, x_range, y_range, z_range, action_on_cell );
+			}
+		}
+
+		/// \brief Perform the specified action on each pair of an entry in this index and a matching entry in the specified index
+		///
+		/// This searches for each entry in turn, like view_cache_index::perform_action_on_all_match_at_leaves()
+		template <typename ACTN>
+		void flat_view_cache_index::perform_action_on_all_match_at_leaves(const flat_view_cache_index       &prm_search_index, ///< The index in which to search for matches
+		                                                                  const detail::vcie_match_criteria &prm_criteria,     ///< The criteria for matching
+		                                                                  ACTN                              &prm_action        ///< The action to perform on each matching pair
+		                                                                  ) const {
+			for (const view_cache_index_entry &entry : entries) {
+				prm_search_index.perform_action_on_matches( entry, prm_criteria, prm_action );
+			}
+		}
+
+		/// \brief Perform the specified action on each pair of an entry in this index and a matching entry in the specified index
+		///
+		/// This searches cell-against-cell, like view_cache_index::perform_action_on_all_match_at_nodes(),
+		/// and so only considers pairs of entries with matching directions.
+		///
+		/// \pre The two indices must have been built with the same cell widths else an invalid_argument_exception is thrown
+		template <typename ACTN>
+		void flat_view_cache_index::perform_action_on_all_match_at_nodes(const flat_view_cache_index       &prm_match_index, ///< The index in which to search for matches
+		                                                                 const detail::vcie_match_criteria &prm_criteria,    ///< The criteria for matching
+		                                                                 ACTN                              &prm_action       ///< The action to perform on each matching pair
+		                                                                 ) const {
+			using phi_spec = detail::detail::vci_linear_dim_spec_view_from_phi;
+			using x_spec   = detail::detail::vci_linear_dim_spec_view_x;
+			using y_spec   = detail::detail::vci_linear_dim_spec_view_y;
+			using z_spec   = detail::detail::vci_linear_dim_spec_view_z;
+
+			check_compatible( prm_match_index );
+			if ( entries.empty() || prm_match_index.entries.empty() ) {
+				return;
+			}
+
+			const auto phi_radius = phi_spec().get_search_radius( prm_criteria );
+			const auto xyz_radius = x_spec  ().get_search_radius( prm_criteria );
+
+			const auto search_range = [&] (const auto &prm_spec, const auto &prm_cell_width, const int &prm_cell, const auto &prm_radius, const int &prm_min, const int &prm_max) {
+				using spec_type = std::decay_t<decltype( prm_spec )>;
+				return detail::flat_vci_search_cell_ranges<spec_type>(
+					prm_cell_width,
+					detail::flat_vci_min_value_in_cell( prm_cell_width, prm_cell     ) - prm_radius,
+					detail::flat_vci_min_value_in_cell( prm_cell_width, prm_cell + 1 ) + prm_radius,
+					prm_min,
+					prm_max
+				);
+			};
+
+			for (const size_t &query_cell_ctr : common::indices( cell_keys.size() ) ) {
+				const detail::flat_vci_cell_key &query_key = cell_keys[ query_cell_ctr ];
+				const size_t query_begin = cell_offsets[ query_cell_ctr     ];
+				const size_t query_end   = cell_offsets[ query_cell_ctr + 1 ];
+
+				const auto phi_ranges = search_range( phi_spec(), phi_cell_width, detail::phi_cell_of_flat_vci_cell_key( query_key ), phi_radius, prm_match_index.min_phi_cell, prm_match_index.max_phi_cell );
+				const auto x_range    = search_range( x_spec  (), xyz_cell_width, detail::x_cell_of_flat_vci_cell_key  ( query_key ), xyz_radius, prm_match_index.min_x_cell,   prm_match_index.max_x_cell   ).first;
+				const auto y_range    = search_range( y_spec  (), xyz_cell_width, detail::y_cell_of_flat_vci_cell_key  ( query_key ), xyz_radius, prm_match_index.min_y_cell,   prm_match_index.max_y_cell   ).first;
+				const auto z_range    = search_range( z_spec  (), xyz_cell_width, detail::z_cell_of_flat_vci_cell_key  ( query_key ), xyz_radius, prm_match_index.min_z_cell,   prm_match_index.max_z_cell   ).first;
+
+				prm_match_index.for_each_cell_in_ranges(
+					detail::increases_of_flat_vci_cell_key( query_key ),
+					phi_ranges,
+					x_range,
+					y_range,
+					z_range,
+					[&] (const size_t &prm_match_begin, const size_t &prm_match_end) {
+						for (size_t query_ctr = query_begin; query_ctr < query_end; ++query_ctr) {
+							const view_cache_index_entry &query_entry = entries[ query_ctr ];
+							for (size_t match_ctr = prm_match_begin; match_ctr < prm_match_end; ++match_ctr) {
+								const view_cache_index_entry &match_entry = prm_match_index.entries[ match_ctr ];
+								if ( prm_criteria( query_entry, match_entry ) ) {
+									prm_action( query_entry, match_entry );
+								}
+							}
+						}
+					}
+				);
+			}
+		}
+
+		flat_view_cache_index build_flat_view_cache_index(const double &,
+		                                                  const detail::angle_type &,
+		                                                  const protein &,
+		                                                  const detail::vcie_match_criteria &);
+
+	} // namespace index
+} // namespace cath
+
+#endif
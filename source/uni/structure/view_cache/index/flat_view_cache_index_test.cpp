@@ -0,0 +1,205 @@
+/// \file
+/// \brief The flat_view_cache_index test suite
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/range/algorithm/sort.hpp>
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/size_t_literal.hpp"
+#include "structure/geometry/angle.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/protein_source_file_set/protein_from_pdb.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "structure/view_cache/index/detail/flat_vci_cell_key.hpp"
+#include "structure/view_cache/index/detail/vcie_match_criteria.hpp"
+#include "structure/view_cache/index/flat_view_cache_index.hpp"
+#include "structure/view_cache/index/view_cache_index.hpp"
+#include "structure/view_cache/index/view_cache_index_benchmark.hpp"
+#include "test/global_test_constants.hpp"
+
+#include <tuple>
+#include <vector>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::geom;
+using namespace cath::index;
+using namespace cath::index::detail;
+using namespace std;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The flat_view_cache_index_test_suite_fixture to assist in testing flat_view_cache_index
+		struct flat_view_cache_index_test_suite_fixture : protected global_test_constants {
+		protected:
+			~flat_view_cache_index_test_suite_fixture() noexcept = default;
+
+			/// \brief Type alias for the from/to indices of a pair of matched entries
+			using idx_idx_idx_idx_tuple     = tuple<index_type, index_type, index_type, index_type>;
+
+			/// \brief Type alias for a vector of idx_idx_idx_idx_tuple
+			using idx_idx_idx_idx_tuple_vec = vector<idx_idx_idx_idx_tuple>;
+
+			/// \brief An action that records the from/to indices of each pair of entries it's shown
+			struct recording_action final {
+				/// \brief The from/to indices of each pair of entries seen so far
+				idx_idx_idx_idx_tuple_vec seen;
+
+				/// \brief Record the from/to indices of the specified pair of entries
+				void operator()(const view_cache_index_entry &prm_entry_a, ///< The first  entry
+				                const view_cache_index_entry &prm_entry_b  ///< The second entry
+				                ) {
+					seen.emplace_back(
+						prm_entry_a.get_from_index(),
+						prm_entry_a.get_to_index(),
+						prm_entry_b.get_from_index(),
+						prm_entry_b.get_to_index()
+					);
+				}
+
+				/// \brief Get the recorded from/to indices, sorted
+				idx_idx_idx_idx_tuple_vec sorted_seen() const {
+					idx_idx_idx_idx_tuple_vec result = seen;
+					boost::range::sort( result );
+					return result;
+				}
+			};
+
+			/// \brief The first domain to compare
+			const protein protein_a = read_protein_from_files( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), "1c0pA01" );
+
+			/// \brief The second domain to compare
+			const protein protein_b = read_protein_from_files( protein_from_pdb(), TEST_SOURCE_DATA_DIR(), "1hdoA00" );
+
+			/// \brief The criteria to use in the comparisons
+			const vcie_match_criteria criteria = make_default_vcie_match_criteria();
+
+			/// \brief The width of the cells in the x, y and z dimensions
+			const double xyz_cell_width = sqrt( 40.0 );
+
+			/// \brief The width of the cells in the from-phi dimension
+			const angle_type phi_cell_width = make_angle_from_degrees<angle_base_type>( 67.5 );
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(flat_view_cache_index_test_suite, cath::test::flat_view_cache_index_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(cell_key_round_trips) {
+	for (const bool &increases : { false, true } ) {
+		for (const int &phi_cell : { 0, 1, 5, FLAT_VCI_MAX_PHI_CELL } ) {
+			for (const int &xyz_cell : { FLAT_VCI_MIN_XYZ_CELL, -7, -1, 0, 1, 13, FLAT_VCI_MAX_XYZ_CELL } ) {
+				const auto key = make_flat_vci_cell_key( increases, phi_cell, xyz_cell, -xyz_cell / 2, xyz_cell / 3 );
+				BOOST_CHECK_EQUAL( increases_of_flat_vci_cell_key( key ), increases       );
+				BOOST_CHECK_EQUAL( phi_cell_of_flat_vci_cell_key ( key ), phi_cell        );
+				BOOST_CHECK_EQUAL( x_cell_of_flat_vci_cell_key   ( key ), xyz_cell        );
+				BOOST_CHECK_EQUAL( y_cell_of_flat_vci_cell_key   ( key ), -xyz_cell / 2   );
+				BOOST_CHECK_EQUAL( z_cell_of_flat_vci_cell_key   ( key ), xyz_cell / 3    );
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(cell_key_increases_with_each_of_x_y_and_z) {
+	const auto key = make_flat_vci_cell_key( true, 2, -1, 0, 3 );
+	BOOST_CHECK_LT( key, make_flat_vci_cell_key( true, 2,  0, 0, 3 ) );
+	BOOST_CHECK_LT( key, make_flat_vci_cell_key( true, 2, -1, 1, 3 ) );
+	BOOST_CHECK_LT( key, make_flat_vci_cell_key( true, 2, -1, 0, 4 ) );
+	BOOST_CHECK_LT( key, make_flat_vci_cell_key( true, 3, -9, 0, 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE(indexes_the_same_entries_as_view_cache_index) {
+	const flat_view_cache_index flat_index = build_flat_view_cache_index( xyz_cell_width, phi_cell_width, protein_a, criteria );
+	size_t num_entries = 0;
+	for (const size_t &from_ctr : indices( protein_a.get_length() ) ) {
+		for (const size_t &to_ctr : indices( protein_a.get_length() ) ) {
+			if ( criteria( make_view_cache_index_entry( protein_a, from_ctr, to_ctr ) ) ) {
+				++num_entries;
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL  ( flat_index.get_num_entries(), num_entries );
+	BOOST_CHECK_GT     ( flat_index.get_num_cells(),   0_z         );
+	BOOST_CHECK_LE     ( flat_index.get_num_cells(),   num_entries );
+}
+
+BOOST_AUTO_TEST_CASE(matches_at_nodes_are_identical_to_view_cache_index) {
+	const view_cache_index      scaffold_index_a = build_view_cache_index     ( xyz_cell_width, phi_cell_width, phi_cell_width, protein_a, criteria );
+	const view_cache_index      scaffold_index_b = build_view_cache_index     ( xyz_cell_width, phi_cell_width, phi_cell_width, protein_b, criteria );
+	const flat_view_cache_index flat_index_a     = build_flat_view_cache_index( xyz_cell_width, phi_cell_width,                 protein_a, criteria );
+	const flat_view_cache_index flat_index_b     = build_flat_view_cache_index( xyz_cell_width, phi_cell_width,                 protein_b, criteria );
+
+	recording_action scaffold_action;
+	recording_action flat_action;
+	scaffold_index_a.perform_action_on_all_match_at_nodes( scaffold_index_b, criteria, scaffold_action );
+	flat_index_a.perform_action_on_all_match_at_nodes    ( flat_index_b,     criteria, flat_action     );
+
+	BOOST_REQUIRE_GT( scaffold_action.seen.size(), 0_z );
+	const auto scaffold_seen = scaffold_action.sorted_seen();
+	const auto flat_seen     = flat_action.sorted_seen();
+	BOOST_CHECK( scaffold_seen == flat_seen );
+}
+
+BOOST_AUTO_TEST_CASE(matches_for_entries_are_identical_to_view_cache_index) {
+	const view_cache_index      scaffold_index = build_view_cache_index     ( xyz_cell_width, phi_cell_width, phi_cell_width, protein_b, criteria );
+	const flat_view_cache_index flat_index     = build_flat_view_cache_index( xyz_cell_width, phi_cell_width,                 protein_b, criteria );
+
+	recording_action scaffold_action;
+	recording_action flat_action;
+	for (const size_t &from_ctr : indices( protein_a.get_length() ) ) {
+		for (const size_t &to_ctr : indices( protein_a.get_length() ) ) {
+			const view_cache_index_entry the_entry = make_view_cache_index_entry( protein_a, from_ctr, to_ctr );
+			if ( criteria( the_entry ) ) {
+				scaffold_index.perform_action_on_matches( the_entry, criteria, scaffold_action );
+				flat_index.perform_action_on_matches    ( the_entry, criteria, flat_action     );
+			}
+		}
+	}
+
+	BOOST_REQUIRE_GT( scaffold_action.seen.size(), 0_z );
+	const auto scaffold_seen = scaffold_action.sorted_seen();
+	const auto flat_seen     = flat_action.sorted_seen();
+	BOOST_CHECK( scaffold_seen == flat_seen );
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_comparing_indices_with_different_cell_widths) {
+	const flat_view_cache_index flat_index_a = build_flat_view_cache_index( xyz_cell_width,       phi_cell_width, protein_a, criteria );
+	const flat_view_cache_index flat_index_b = build_flat_view_cache_index( xyz_cell_width * 2.0, phi_cell_width, protein_b, criteria );
+	recording_action the_action;
+	BOOST_CHECK_THROW( flat_index_a.perform_action_on_all_match_at_nodes( flat_index_b, criteria, the_action ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_finds_the_same_matches_with_both_indices) {
+	const auto result = benchmark_view_cache_indices( protein_a, protein_b, xyz_cell_width, phi_cell_width, criteria, 2 );
+	BOOST_TEST_MESSAGE( result );
+	BOOST_CHECK_GT   ( result.scaffold_num_matches, 0_z                             );
+	BOOST_CHECK_EQUAL( result.flat_num_matches,     result.scaffold_num_matches     );
+	BOOST_CHECK_CLOSE( result.flat_score,           result.scaffold_score,    1e-6 );
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_throws_on_zero_repeats) {
+	BOOST_CHECK_THROW( benchmark_view_cache_indices( protein_a, protein_b, xyz_cell_width, phi_cell_width, criteria, 0 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+/// \file
+/// \brief The view_cache_index_benchmark definitions
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "view_cache_index_benchmark.hpp"
+
+#include <boost/core/ignore_unused.hpp>
+
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/chrono/duration_to_seconds_string.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "structure/view_cache/index/detail/vcie_match_criteria.hpp"
+#include "structure/view_cache/index/flat_view_cache_index.hpp"
+#include "structure/view_cache/index/quad_find_action.hpp"
+#include "structure/view_cache/index/view_cache_index.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::index;
+using namespace cath::index::detail;
+using namespace std;
+
+using boost::ignore_unused;
+using std::chrono::high_resolution_clock;
+
+namespace cath {
+	namespace index {
+		namespace detail {
+
+			/// \brief Wrap a quad_find_action to also count the pairs of entries on which it's performed
+			class counting_quad_find_action final {
+			private:
+				/// \brief The quad_find_action to which each pair should be passed
+				quad_find_action the_action;
+
+				/// \brief The number of pairs of entries on which the action has been performed
+				size_t num_matches = 0;
+
+			public:
+				/// \brief Ctor from the two proteins being compared
+				counting_quad_find_action(const protein &prm_protein_a, ///< The first  protein being compared
+				                          const protein &prm_protein_b  ///< The second protein being compared
+				                          ) : the_action( prm_protein_a, prm_protein_b ) {
+				}
+
+				/// \brief Count the pair of entries and pass them to the quad_find_action
+				void operator()(const view_cache_index_entry &prm_entry_a, ///< The entry from the first  protein
+				                const view_cache_index_entry &prm_entry_b  ///< The entry from the second protein
+				                ) {
+					++num_matches;
+					the_action( prm_entry_a, prm_entry_b );
+				}
+
+				/// \brief Get the number of pairs of entries on which the action has been performed
+				const size_t & get_num_matches() const {
+					return num_matches;
+				}
+
+				/// \brief Get the total quad_find_action score
+				const double & get_total_score() const {
+					return the_action.get_total_score();
+				}
+			};
+
+		} // namespace detail
+	} // namespace index
+} // namespace cath
+
+/// \brief Time building and scanning a pair of proteins with view_cache_index and with flat_view_cache_index
+///
+/// Each repeat builds both indices for both proteins and then scans them against each other at nodes.
+/// The durations are the fastest over the repeats (to reduce the noise from other activity on the machine).
+///
+/// \relates view_cache_index_benchmark_result
+view_cache_index_benchmark_result cath::index::benchmark_view_cache_indices(const protein             &prm_protein_a,            ///< The first  protein to compare
+                                                                           const protein             &prm_protein_b,            ///< The second protein to compare
+                                                                           const double              &prm_xyz_cell_width,       ///< The width of the cells in the x, y and z dimensions
+                                                                           const angle_type          &prm_phi_angle_cell_width, ///< The width of the cells in the from-phi dimension
+                                                                           const vcie_match_criteria &prm_criteria,             ///< The criteria for matching
+                                                                           const size_t              &prm_num_repeats           ///< The number of times to repeat the benchmark
+                                                                           ) {
+	if ( prm_num_repeats == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot benchmark view_cache_index with zero repeats"));
+	}
+
+	view_cache_index_benchmark_result result{
+		hrc_duration::max(), hrc_duration::max(), 0, 0.0,
+		hrc_duration::max(), hrc_duration::max(), 0, 0.0
+	};
+
+	for (const size_t &repeat_ctr : indices( prm_num_repeats ) ) {
+		ignore_unused( repeat_ctr );
+
+		// Build and scan with the scaffold view_cache_index
+		const auto scaffold_build_start = high_resolution_clock::now();
+		const view_cache_index scaffold_index_a = build_view_cache_index( prm_xyz_cell_width, prm_phi_angle_cell_width, prm_phi_angle_cell_width, prm_protein_a, prm_criteria );
+		const view_cache_index scaffold_index_b = build_view_cache_index( prm_xyz_cell_width, prm_phi_angle_cell_width, prm_phi_angle_cell_width, prm_protein_b, prm_criteria );
+		const auto scaffold_scan_start  = high_resolution_clock::now();
+		counting_quad_find_action scaffold_action( prm_protein_a, prm_protein_b );
+		scaffold_index_a.perform_action_on_all_match_at_nodes( scaffold_index_b, prm_criteria, scaffold_action );
+		const auto scaffold_scan_stop   = high_resolution_clock::now();
+
+		// Build and scan with the flat_view_cache_index
+		const auto flat_build_start = high_resolution_clock::now();
+		const flat_view_cache_index flat_index_a = build_flat_view_cache_index( prm_xyz_cell_width, prm_phi_angle_cell_width, prm_protein_a, prm_criteria );
+		const flat_view_cache_index flat_index_b = build_flat_view_cache_index( prm_xyz_cell_width, prm_phi_angle_cell_width, prm_protein_b, prm_criteria );
+		const auto flat_scan_start  = high_resolution_clock::now();
+		counting_quad_find_action flat_action( prm_protein_a, prm_protein_b );
+		flat_index_a.perform_action_on_all_match_at_nodes( flat_index_b, prm_criteria, flat_action );
+		const auto flat_scan_stop   = high_resolution_clock::now();
+
+		result.scaffold_build_durn  = min( result.scaffold_build_durn, hrc_duration{ scaffold_scan_start - scaffold_build_start } );
+		result.scaffold_scan_durn   = min( result.scaffold_scan_durn,  hrc_duration{ scaffold_scan_stop  - scaffold_scan_start  } );
+		result.scaffold_num_matches = scaffold_action.get_num_matches();
+		result.scaffold_score       = scaffold_action.get_total_score();
+		result.flat_build_durn      = min( result.flat_build_durn,     hrc_duration{ flat_scan_start     - flat_build_start     } );
+		result.flat_scan_durn       = min( result.flat_scan_durn,      hrc_duration{ flat_scan_stop      - flat_scan_start      } );
+		result.flat_num_matches     = flat_action.get_num_matches();
+		result.flat_score           = flat_action.get_total_score();
+	}
+	return result;
+}
+
+/// \brief Insert a description of the specified view_cache_index_benchmark_result into the specified ostream
+///
+/// \relates view_cache_index_benchmark_result
+ostream & cath::index::operator<<(ostream                                 &prm_os,    ///< The ostream into which the description should be inserted
+                                  const view_cache_index_benchmark_result &prm_result ///< The view_cache_index_benchmark_result to describe
+                                  ) {
+	prm_os << "view_cache_index_benchmark_result[scaffold: build "
+	       << durn_to_seconds_string( prm_result.scaffold_build_durn )
+	       << ", scan "
+	       << durn_to_seconds_string( prm_result.scaffold_scan_durn  )
+	       << ", "
+	       << prm_result.scaffold_num_matches
+	       << " matches, score "
+	       << prm_result.scaffold_score
+	       << "; flat: build "
+	       << durn_to_seconds_string( prm_result.flat_build_durn     )
+	       << ", scan "
+	       << durn_to_seconds_string( prm_result.flat_scan_durn      )
+	       << ", "
+	       << prm_result.flat_num_matches
+	       << " matches, score "
+	       << prm_result.flat_score
+	       << "]";
+	return prm_os;
+}
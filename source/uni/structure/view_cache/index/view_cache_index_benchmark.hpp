@@ -0,0 +1,78 @@
+/// \file
+/// \brief The view_cache_index_benchmark header
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_VIEW_CACHE_INDEX_BENCHMARK_HPP
+#define _CATH_TOOLS_SOURCE_UNI_STRUCTURE_VIEW_CACHE_INDEX_VIEW_CACHE_INDEX_BENCHMARK_HPP
+
+#include "common/chrono/chrono_type_aliases.hpp"
+#include "structure/view_cache/index/detail/view_cache_index_type_aliases.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace cath { class protein; }
+namespace cath { namespace index { namespace detail { class vcie_match_criteria; } } }
+
+namespace cath {
+	namespace index {
+
+		/// \brief The timings and results of scanning a pair of proteins with view_cache_index and with flat_view_cache_index
+		///
+		/// The durations are the fastest over the repeats
+		struct view_cache_index_benchmark_result final {
+			/// \brief The time taken to build both view_cache_index objects
+			hrc_duration scaffold_build_durn;
+
+			/// \brief The time taken to scan the view_cache_index objects against each other (at nodes)
+			hrc_duration scaffold_scan_durn;
+
+			/// \brief The number of matching pairs of entries found by the view_cache_index scan
+			size_t       scaffold_num_matches;
+
+			/// \brief The total quad_find_action score from the view_cache_index scan
+			double       scaffold_score;
+
+			/// \brief The time taken to build both flat_view_cache_index objects
+			hrc_duration flat_build_durn;
+
+			/// \brief The time taken to scan the flat_view_cache_index objects against each other (at nodes)
+			hrc_duration flat_scan_durn;
+
+			/// \brief The number of matching pairs of entries found by the flat_view_cache_index scan
+			size_t       flat_num_matches;
+
+			/// \brief The total quad_find_action score from the flat_view_cache_index scan
+			double       flat_score;
+		};
+
+		view_cache_index_benchmark_result benchmark_view_cache_indices(const protein &,
+		                                                               const protein &,
+		                                                               const double &,
+		                                                               const detail::angle_type &,
+		                                                               const detail::vcie_match_criteria &,
+		                                                               const size_t & = 1);
+
+		std::ostream & operator<<(std::ostream &,
+		                          const view_cache_index_benchmark_result &);
+
+	} // namespace index
+} // namespace cath
+
+#endif
@@ -20,42 +20,81 @@
 
 #include "view_cache.hpp"
 
-
 #include "common/boost_addenda/range/indices.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
 #include "ssap/context_res.hpp"
 #include "ssap/ssap.hpp"
 #include "structure/protein/protein.hpp"
 
+#include <algorithm>
+#include <future>
+
 using namespace cath::common;
 using namespace cath::geom;
 using namespace cath::index;
 
+using std::async;
+using std::future;
+using std::launch;
+using std::min;
+using std::vector;
 
 /// \brief Private static method that implements the process of building the views from proteins
-coord_vec_vec view_cache::build_views(const protein &prm_protein ///< The protein which the view_cache should be built to represent
-                                      ) {
+///
+/// The rows (from-residues) are shared out in contiguous blocks between up to prm_num_threads threads,
+/// each of which writes only to its own part of the pre-sized array.
+coord_vec view_cache::build_views(const protein &prm_protein,    ///< The protein which the view_cache should be built to represent
+                                  const size_t  &prm_num_threads ///< The maximum number of threads to use to build the views
+                                  ) {
+	if ( prm_num_threads == 0 ) {
+		BOOST_THROW_EXCEPTION(invalid_argument_exception("Cannot build a view_cache with zero threads"));
+	}
+
 	// Grab the number of residues and prepare the views accordingly
 	const size_t num_residues = prm_protein.get_length();
-	coord_vec_vec new_views( num_residues );
-	for (coord_vec &view_of : new_views) {
-		view_of.reserve( num_residues );
-	}
+	coord_vec new_views( num_residues * num_residues, coord::ORIGIN_COORD );
 
-	// Loop over the all from-versus-to residue pairs and add the resulting views
-	for (const size_t &from_res_ctr : indices( num_residues ) ) {
-		for (const size_t &to_res_ctr : indices( num_residues ) ) {
-			coord_vec &view_of_from = new_views[ from_res_ctr ];
-			view_of_from.push_back( view_vector_of_residue_pair(
-				prm_protein.get_residue_ref_of_index( from_res_ctr ),
-				prm_protein.get_residue_ref_of_index( to_res_ctr   )
-			) );
+	// Prepare a function to calculate the views from the specified range of from-residues
+	const auto build_rows_fn = [&] (const size_t &prm_begin_row, const size_t &prm_end_row) {
+		for (size_t from_res_ctr = prm_begin_row; from_res_ctr < prm_end_row; ++from_res_ctr) {
+			const residue &from_residue = prm_protein.get_residue_ref_of_index( from_res_ctr );
+			const size_t   row_offset   = from_res_ctr * num_residues;
+			for (const size_t &to_res_ctr : indices( num_residues ) ) {
+				new_views[ row_offset + to_res_ctr ] = view_vector_of_residue_pair(
+					from_residue,
+					prm_protein.get_residue_ref_of_index( to_res_ctr )
+				);
+			}
 		}
+	};
+
+	// Do the work on this thread if there's only one thread or one row
+	const size_t num_blocks = min( prm_num_threads, num_residues );
+	if ( num_blocks <= 1 ) {
+		build_rows_fn( 0, num_residues );
+		return new_views;
+	}
+
+	// Otherwise, share the rows out between the threads and wait for them to finish
+	vector<future<void>> block_futures;
+	block_futures.reserve( num_blocks );
+	for (const size_t &block_ctr : indices( num_blocks ) ) {
+		block_futures.push_back( async(
+			launch::async,
+			build_rows_fn,
+			( block_ctr         * num_residues ) / num_blocks,
+			( ( block_ctr + 1 ) * num_residues ) / num_blocks
+		) );
+	}
+	for (future<void> &block_future : block_futures) {
+		block_future.get();
 	}
 	return new_views;
 }
 
 /// \brief Ctor for view_cache from a protein that the view_cache should represent
-view_cache::view_cache(const protein &prm_protein ///< The protein which the view_cache should be built to represent
-                       ) : views( build_views( prm_protein ) ) {
+view_cache::view_cache(const protein &prm_protein,    ///< The protein which the view_cache should be built to represent
+                       const size_t  &prm_num_threads ///< The maximum number of threads to use to build the views
+                       ) : num_residues { prm_protein.get_length()                     },
+                           views        { build_views( prm_protein, prm_num_threads ) } {
 }
-
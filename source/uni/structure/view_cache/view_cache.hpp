@@ -31,25 +31,41 @@ namespace cath {
 
 		/// \brief Cache of views (ie vectors implemented as coords) between pairs of residues in a particular list
 		///        (most likely a protein)
+		///
+		/// The views are stored in a single contiguous, row-major array (indexed by from-residue then to-residue)
+		/// rather than a vector of vectors, so that a view lookup is one multiply-add and the views from a given
+		/// residue are adjacent in memory. Once built, a view_cache is read-only and so can be shared between threads.
 		class view_cache final {
 		private:
-			/// \brief The views - coords indexed by the from-residue and then by the to-residue
-			geom::coord_vec_vec views;
+			/// \brief The number of residues (so the views array is num_residues x num_residues)
+			size_t num_residues;
 
-			static geom::coord_vec_vec build_views(const protein &);
+			/// \brief The views - coords indexed by ( from-residue * num_residues + to-residue )
+			geom::coord_vec views;
+
+			static geom::coord_vec build_views(const protein &,
+			                                   const size_t &);
 
 		public:
-			explicit view_cache(const protein &);
-			
+			explicit view_cache(const protein &,
+			                    const size_t & = 1);
+
+			size_t get_num_residues() const;
+
 			const geom::coord & get_view(const size_t &,
 			                             const size_t &) const;
 		};
 
+		/// \brief Getter for the number of residues (so the views array is num_residues x num_residues)
+		inline size_t view_cache::get_num_residues() const {
+			return num_residues;
+		}
+
 		/// \brief Getter for the view from residue with the specified from-index to the residue with the specified to-index
 		inline const geom::coord & view_cache::get_view(const size_t &prm_from_index, ///< The index of the from-residue of the view to be retrieved
 		                                                const size_t &prm_to_index    ///< The index of the to-residue   of the view to be retrieved
 		                                                ) const {
-			return views[ prm_from_index ][ prm_to_index   ];
+			return views[ prm_from_index * num_residues + prm_to_index ];
 		}
 
 	} // namespace index
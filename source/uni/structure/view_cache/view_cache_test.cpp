@@ -0,0 +1,101 @@
+/// \file
+/// \brief The view_cache test suite
+
+
+/// \copyright
+/// CATH Tools - Protein structure comparison tools such as SSAP and SNAP
+/// Copyright (C) 2011, Orengo Group, University College London
+///
+/// This program is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "common/boost_addenda/range/indices.hpp"
+#include "common/exception/invalid_argument_exception.hpp"
+#include "common/size_t_literal.hpp"
+#include "structure/entry_querier/residue_querier.hpp"
+#include "structure/protein/protein.hpp"
+#include "structure/protein/protein_source_file_set/protein_from_pdb.hpp"
+#include "structure/protein/sec_struc.hpp"
+#include "structure/protein/sec_struc_planar_angles.hpp"
+#include "structure/view_cache/view_cache.hpp"
+#include "test/global_test_constants.hpp"
+
+using namespace cath;
+using namespace cath::common;
+using namespace cath::index;
+
+namespace cath {
+	namespace test {
+
+		/// \brief The view_cache_test_suite_fixture to assist in testing view_cache
+		struct view_cache_test_suite_fixture : protected global_test_constants {
+		protected:
+			~view_cache_test_suite_fixture() noexcept = default;
+
+			/// \brief An example protein
+			const protein protein_a = read_protein_from_files( protein_from_pdb(), TEST_SOURCE_DATA_DIR() / "aligned_pair_score", "1c55A" );
+
+			/// \brief Another example protein
+			const protein protein_b = read_protein_from_files( protein_from_pdb(), TEST_SOURCE_DATA_DIR() / "aligned_pair_score", "1c56A" );
+		};
+
+	} // namespace test
+} // namespace cath
+
+BOOST_FIXTURE_TEST_SUITE(view_cache_test_suite, cath::test::view_cache_test_suite_fixture)
+
+BOOST_AUTO_TEST_CASE(views_match_directly_calculated_views_for_any_num_threads) {
+	for (const size_t &num_threads : { 1_z, 3_z } ) {
+		const view_cache the_view_cache{ protein_a, num_threads };
+		BOOST_REQUIRE_EQUAL( the_view_cache.get_num_residues(), protein_a.get_length() );
+
+		size_t num_mismatches = 0;
+		for (const size_t &from_index : indices( protein_a.get_length() ) ) {
+			for (const size_t &to_index : indices( protein_a.get_length() ) ) {
+				if ( ! ( the_view_cache.get_view( from_index, to_index ) == view_vector( protein_a, from_index, to_index ) ) ) {
+					++num_mismatches;
+				}
+			}
+		}
+		BOOST_CHECK_EQUAL( num_mismatches, 0_z );
+	}
+}
+
+BOOST_AUTO_TEST_CASE(throws_on_zero_threads) {
+	BOOST_CHECK_THROW( view_cache( protein_a, 0 ), invalid_argument_exception );
+}
+
+BOOST_AUTO_TEST_CASE(residue_querier_scores_are_unchanged_by_view_caches) {
+	const view_cache      view_cache_a{ protein_a };
+	const view_cache      view_cache_b{ protein_b };
+	const residue_querier plain_querier{};
+	const residue_querier caching_querier{ protein_a, view_cache_a, protein_b, view_cache_b };
+
+	size_t num_mismatches = 0;
+	for (const size_t &a_from : indices( protein_a.get_length() ) ) {
+		for (const size_t &b_from : { 0_z, protein_b.get_length() / 2, protein_b.get_length() - 1 } ) {
+			for (const size_t &a_to : indices( protein_a.get_length() ) ) {
+				const size_t b_to = a_to % protein_b.get_length();
+				if ( plain_querier.distance_score__offset_1  ( protein_a, protein_b, a_from + 1, b_from + 1, a_to + 1, b_to + 1 )
+				     != caching_querier.distance_score__offset_1( protein_a, protein_b, a_from + 1, b_from + 1, a_to + 1, b_to + 1 ) ) {
+					++num_mismatches;
+				}
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL( num_mismatches, 0_z );
+}
+
+BOOST_AUTO_TEST_SUITE_END()